@@ -44,6 +44,68 @@ def fnv1a(data):
         hash_ = ((hash_ ^ c) * 16777619) & 0xffffffff
     return hash_
 
+def keyword_hash(data, seed):
+    """FNV-1a hash with `seed` mixed into the offset basis; must be identical
+    to keyword_hash() in 'src/lib/datadict.cc'."""
+    hash_ = 2166136261 ^ seed
+    for c in bytearray(data):
+        hash_ = ((hash_ ^ c) * 16777619) & 0xffffffff
+    return hash_
+
+def build_keyword_hash(keywords):
+    """Build a minimal perfect hash for `keywords` by hash and displace.
+
+    Returns (displacement, slots). A keyword `k` is placed at
+      slots[-d - 1] if d < 0, or
+      slots[keyword_hash(k, d) % n] otherwise,
+    where d = displacement[keyword_hash(k, 0) % n] and n = len(keywords).
+    """
+    n = len(keywords)
+    buckets = [[] for _ in range(n)]
+    for k in keywords:
+        buckets[keyword_hash(k, 0) % n].append(k)
+
+    displacement = [0] * n
+    slots = [None] * n
+
+    # place larger buckets first, while most of slots are free.
+    order = sorted(range(n), key=lambda b: len(buckets[b]), reverse=True)
+    pos = 0
+    while pos < n and len(buckets[order[pos]]) > 1:
+        b = order[pos]
+        d = 1
+        while True:
+            placed = [keyword_hash(k, d) % n for k in buckets[b]]
+            if (len(set(placed)) == len(placed) and
+                    all(slots[i] is None for i in placed)):
+                break
+            d += 1
+        for k, i in zip(buckets[b], placed):
+            slots[i] = k
+        displacement[b] = d
+        pos += 1
+
+    # buckets with single keyword take a free slot directly.
+    free = [i for i in range(n) if slots[i] is None]
+    for b in order[pos:]:
+        if not buckets[b]:
+            continue
+        i = free.pop()
+        slots[i] = buckets[b][0]
+        displacement[b] = -i - 1
+
+    return displacement, slots
+
+def tag_xx_mask(tag_s):
+    """'(60xx,3000)' -> (mask, value); a tag matches if tag & mask == value.
+    Repeating groups such as 60xx are even groups; odd groups are private."""
+    digits = tag_s[1:5] + tag_s[6:10]
+    mask = int(''.join('0' if c == 'x' else 'f' for c in digits), 16)
+    if 'x' in tag_s[1:5]:
+        mask |= 0x10000
+    value = int(digits.replace('x', '0'), 16)
+    return mask, value
+
 def uid2val(uid):
     """uid -> val"""
     val = list(map(int, uid.split('.')[-2:]))
@@ -139,7 +201,7 @@ def build_uid_registry(soup):
     print('write to', UIDCONST2_FILENAME)
     fout3.close()
 
-def build_elements_registry(soup):
+def build_elements_registry(soup, source):
     """Process tables 6-1, 7-1, 8-1"""
 
     datadict = []
@@ -173,6 +235,12 @@ def build_elements_registry(soup):
 
     print('MERGE TABLE 1 DONE', file=sys.stderr)
 
+    write_elements_registry(datadict, source)
+
+def write_elements_registry(datadict, source):
+    """Write tables for rows [tag, name, keyword, vr, vm, retired] of elements
+    sorted by tag; `source` names where the rows came from."""
+
     fout3 = open(DICOMDICT_INC_FILENAME, 'w')
 
     # Data dictionary with key 'Tag'
@@ -181,6 +249,7 @@ def build_elements_registry(soup):
     lines_with_x = []
     tags = []
     keywords = []
+    keyword_to_idx = {}
 
     min_kw = 10000
     max_kw = 0
@@ -202,12 +271,11 @@ def build_elements_registry(soup):
         tags.append(line)
 
         if keyword:
-            line = '/* %-62s */ %d' % (keyword, idx)
-            keywords.append(line)
+            keyword_to_idx[keyword] = idx
 
         if 'x' in row[0]:
-            line = ' /* %s */ %d' % (tag_s, idx)
-            lines_with_x.append(line)
+            mask, value = tag_xx_mask(tag_s)
+            lines_with_x.append((mask, value, tag_s, idx))
 
         if keyword:
             if len(keyword) > max_kw:
@@ -217,17 +285,33 @@ def build_elements_registry(soup):
 
     print('MERGE TABLE 2 DONE', file=sys.stderr)
 
-    lines_with_x.sort()
-    keywords.sort()
+    # tags with 'x' are looked up by (tag & mask); a mask with less 'x'
+    # comes first so that more specific entry wins.
+    masks = sorted(set(m for m, v, t, i in lines_with_x),
+                   key=lambda m: (-bin(m).count('1'), m))
+    lines_with_x.sort(key=lambda r: (masks.index(r[0]), r[1]))
+    masks = [' 0x%08x, %3d' % (m, [r[0] for r in lines_with_x].index(m))
+             for m in masks]
+    lines_with_x = [' /* %s */ 0x%08x, 0x%08x, %4d' % (t, m, v, i)
+                    for m, v, t, i in lines_with_x]
+
+    displacement, slots = build_keyword_hash(
+        [k.encode('ascii') for k in keyword_to_idx])
+    keywords = ['/* %-62s */ %d' % (k.decode(), keyword_to_idx[k.decode()])
+                for k in slots]
+    displacement = ',\n'.join(
+        ' ' + ', '.join('%5d' % d for d in displacement[i:i+12])
+        for i in range(0, len(displacement), 12))
 
     print('C++ TABLE READY', file=sys.stderr)
 
-    print('''/* This data dictionary is generated from 'part06.html' by 'codegen_builddict.py' at %s.
+    print('''/* This data dictionary is generated from %s by 'codegen_builddict.py' at %s.
  * 'part06.xml' is available at 'http://dicom.nema.org/medical/dicom/current/source/docbook/part06/part06.xml'.
  */
 
 const char* DATADICTIONARY_VERSION = "%s";
 const int SIZE_ELEMENT_REGISTRY = %d;
+const int SIZE_TAGS_XX_MASK = %d;
 const int SIZE_INDEX_TAGS_WITH_XX = %d;
 const int SIZE_INDEX_KEYWORD = %d;
 
@@ -239,10 +323,24 @@ static const tag_t tags_registry[] = {
 %s
 };
 
-static const int tags_xx_index[] = {
+// distinct masks of tags with 'x', e.g. 0xff00ffff for (60xx,3000), and
+// the first row in tags_xx_index[] with the mask.
+static const tag_t tags_xx_mask[] = {
+%s
+};
+
+// (mask, tag & mask, index to element_registry) sorted by mask, as in
+// tags_xx_mask[], and then by value.
+static const tag_t tags_xx_index[] = {
+%s
+};
+
+// minimal perfect hash of keywords; see keyword_hash() in 'datadict.cc'.
+static const int keyword_hash_displacement[] = {
 %s
 };
 
+// index to element_registry for each slot of the keyword hash.
 static const int keyword_index[] = {
 %s
 };
@@ -251,14 +349,18 @@ static const int keyword_index[] = {
             shortest keyword = %d bytes. */
 
     ''' % (
+        source,
         datetime.datetime.now().strftime("%I:%M%p on %B %d, %Y"),
         DATADICTIONARY_VERSION,
         len(lines),
+        len(masks),
         len(lines_with_x),
         len(keywords),
         ',\n'.join(lines),
         ',\n'.join(tags),
+        ',\n'.join(masks),
         ',\n'.join(lines_with_x),
+        displacement,
         ',\n'.join(keywords),
         min_kw, max_kw), file=fout3)
 
@@ -307,7 +409,7 @@ def do_parse(part6filename):
     print('PARSE %s DONE'%part6filename, file=sys.stderr)
 
     # bulid_tables
-    build_elements_registry(soup)
+    build_elements_registry(soup, "'%s'" % os.path.basename(part6filename))
     build_uid_registry(soup)
     
     # place generated tsuid_t constants into dicom.h and dicomsdl.i.in
@@ -30,8 +30,10 @@ DICOMSDL_CODEC_RESULT charls_decoder(const char *tsuid, char *data,
     return DICOMSDL_CODEC_ERROR;
   }
 
-  if (ic->datasize < ic->rowstep * ic->rows
-      || ic->rowstep < ic->cols * (ic->prec > 8 ? 2 : 1) * ic->ncomps) {
+  // rowstep < 0 stores rows bottom-up; only its magnitude bounds the buffer.
+  int absrowstep = (ic->rowstep > 0 ? ic->rowstep : -ic->rowstep);
+  if (ic->datasize < absrowstep * ic->rows
+      || absrowstep < ic->cols * (ic->prec > 8 ? 2 : 1) * ic->ncomps) {
     snprintf(ic->info, ARGBUF_SIZE, "charls_decoder(...): "
              "pixelbuf for decoded image is too small; "
              "buflen %d < rowstep %d * rows %d or "
@@ -50,10 +52,40 @@ DICOMSDL_CODEC_RESULT charls_decoder(const char *tsuid, char *data,
     return DICOMSDL_CODEC_ERROR;
   }
 
-  std::vector<BYTE> dataUnc;
-  dataUnc.resize(info.bytesperline * info.height);
+  if (ic->rows != info.height || ic->cols != info.width
+      || ic->ncomps != info.components
+      || (ic->prec > 8) != (info.bitspersample > 8)) {
+    snprintf(ic->info, ARGBUF_SIZE, "error: info mismatch "
+             "DICOM info (%d x %d x %d, %d bits) != "
+             "JPEGLS info (%d x %d x %d, %d bits)",
+             ic->cols, ic->rows, ic->ncomps, ic->prec,
+             info.width, info.height, info.components, info.bitspersample);
+    return DICOMSDL_CODEC_ERROR;
+  }
+
+  // components of ILV_NONE are decoded plane by plane.
+  bool planar = (info.components > 1 && info.ilv == ILV_NONE);
+
+  if (ic->rowstep > 0 && !planar) {
+    // decode straight into the caller's buffer; rows are bytesperline apart.
+    info.bytesperline = ic->rowstep;
+    error = JpegLsDecode(ic->data, ic->datasize, data, datasize, &info);
+    if (error != OK) {
+      snprintf(ic->info, ARGBUF_SIZE, "charls_decoder(...): "
+               "error in JpegLsDecode");
+      return DICOMSDL_CODEC_ERROR;
+    }
+    return DICOMSDL_CODEC_OK;
+  }
 
-  error = JpegLsDecode(&dataUnc[0], dataUnc.size(), data, datasize, NULL);
+  // otherwise decode into scratch memory, kept per thread, and copy rows.
+  static thread_local std::vector<BYTE> dataUnc;
+  size_t planesize = size_t(info.bytesperline) * info.height;
+  size_t size = planesize * (planar ? info.components : 1);
+  if (dataUnc.size() < size)
+    dataUnc.resize(size);
+
+  error = JpegLsDecode(&dataUnc[0], size, data, datasize, NULL);
 
   if (error != OK) {
     snprintf(ic->info, ARGBUF_SIZE, "charls_decoder(...): "
@@ -61,24 +93,35 @@ DICOMSDL_CODEC_RESULT charls_decoder(const char *tsuid, char *data,
     return DICOMSDL_CODEC_ERROR;
   }
 
-  if (ic->rows != info.height || ic->cols != info.width) {
-    snprintf(ic->info, ARGBUF_SIZE, "error: info mismatch "
-             "DICOM info (%d x %d) != JPEGLS info (%d x %d)",
-             ic->cols, ic->rows, info.width, info.height);
-    return DICOMSDL_CODEC_ERROR;
-  }
-
-  int rowstep = (ic->rowstep > 0 ? ic->rowstep : -ic->rowstep);
-  int bytesperline = (rowstep > info.bytesperline ? info.bytesperline : rowstep);
+  int bytesperline = (absrowstep > info.bytesperline ? info.bytesperline : absrowstep);
 
   uint8_t *q;
   if (ic->rowstep > 0)
     q = (uint8_t *) (ic->data);
   else
-    q = (uint8_t*) (ic->data + (ic->rows - 1) * (-ic->rowstep));
-  for (int j = 0; j < ic->rows; j++) {
-    memcpy(q, &dataUnc[info.bytesperline * j], bytesperline);
-    q += ic->rowstep;
+    q = (uint8_t*) (ic->data + (ic->rows - 1) * absrowstep);
+
+  if (!planar) {
+    for (int j = 0; j < ic->rows; j++) {
+      memcpy(q, &dataUnc[info.bytesperline * j], bytesperline);
+      q += ic->rowstep;
+    }
+  } else {
+    // interleave planes into rows of pixels
+    int nbytes = (info.bitspersample > 8 ? 2 : 1);
+    int ncomps = info.components;
+    for (int j = 0; j < ic->rows; j++) {
+      for (int c = 0; c < ncomps; c++) {
+        const BYTE *p = &dataUnc[planesize * c + info.bytesperline * j];
+        uint8_t *r = q + c * nbytes;
+        for (int i = 0; i < info.width; i++) {
+          memcpy(r, p, nbytes);
+          p += nbytes;
+          r += ncomps * nbytes;
+        }
+      }
+      q += ic->rowstep;
+    }
   }
 
   return DICOMSDL_CODEC_OK;
@@ -94,28 +137,126 @@ DICOMSDL_CODEC_RESULT charls_encoder(const char *tsuid, imagecontainer *ic,
           )
     return DICOMSDL_CODEC_NOTSUPPORTED;
 
-  if (data == NULL|| datasize == 0|| free_memory_fn == NULL) {
-    snprintf(ic->info, ARGBUF_SIZE, "charls_decoder(...): "
+  if (data == NULL|| datasize == NULL|| free_memory_fn == NULL) {
+    snprintf(ic->info, ARGBUF_SIZE, "charls_encoder(...): "
              "data or datasize or free_memory_fn is NULL.");
     return DICOMSDL_CODEC_ERROR;
   }
 
   *free_memory_fn = charls_codec_free_memory;
-
-  /*
-   * { do encode pixel data }
-   * *datasize = { encoded data size }
-   * *data = (char *)malloc(*datasize);
-   * { store encoded data to *data }
-   * free_memory_fn = dummy_codec_free_memory;
-   * return
-   */
-
   *data = NULL;
   *datasize = 0;
 
-  snprintf(ic->info, ARGBUF_SIZE, "DUMMY ENCODER");
-  return DICOMSDL_CODEC_ERROR;
+  if (ic->ncomps != 1 && ic->ncomps != 3) {
+    snprintf(ic->info, ARGBUF_SIZE, "charls_encoder(...): "
+             "cannot encode image with %d components", ic->ncomps);
+    return DICOMSDL_CODEC_ERROR;
+  }
+  if (ic->prec < 2 || ic->prec > 16) {
+    snprintf(ic->info, ARGBUF_SIZE, "charls_encoder(...): "
+             "cannot encode image with %d bits allocated", ic->prec);
+    return DICOMSDL_CODEC_ERROR;
+  }
+
+  // parse argument
+  int near = 0;
+  int bits = ic->prec;
+
+  argparser p(ic);  // argument is set in ic->args
+  int key = 0;
+  while ((key = p.get_next_argkey()) > 0) {
+    switch (key) {
+      case ARGKEY_NEAR:
+        near = p.value_as_int();
+        if (near < 0)
+          near = 0;
+        break;
+      case ARGKEY_BITS:
+        bits = p.value_as_int();
+        break;
+      default:
+        break;
+    }
+  }
+  if (key != 0) {
+    // argument key error, error message in ic->info
+    return DICOMSDL_CODEC_ERROR;
+  }
+
+  // JPEG-LS Lossless Image Compression
+  if (strcmp("1.2.840.10008.1.2.4.80", tsuid) == 0)
+    near = 0;
+
+  JlsParameters params;
+  memset(&params, 0, sizeof(params));
+  params.width = ic->cols;
+  params.height = ic->rows;
+  // code only the stored bits when samples keep their width in memory;
+  // sign-extended samples don't fit in fewer bits than allocated.
+  if (bits < 2 || bits > ic->prec || (bits > 8) != (ic->prec > 8))
+    bits = ic->prec;
+  params.bitspersample = (ic->sgnd ? (ic->prec > 8 ? 16 : 8) : bits);
+  params.components = ic->ncomps;
+  params.ilv = (ic->ncomps == 3 ? ILV_SAMPLE : ILV_NONE);
+  params.allowedlossyerror = near;
+
+  int nbytes = (ic->prec > 8 ? 2 : 1);
+  int linesize = ic->cols * ic->ncomps * nbytes;
+  if (ic->rowstep < linesize && -ic->rowstep < linesize) {
+    snprintf(ic->info, ARGBUF_SIZE, "charls_encoder(...): "
+             "rowstep %d < cols %d * ncomps %d * %d bytes",
+             ic->rowstep, ic->cols, ic->ncomps, nbytes);
+    return DICOMSDL_CODEC_ERROR;
+  }
+
+  // the encoder reads rows bytesperline apart; bottom-up rows are copied
+  // into top-down order first.
+  std::vector<BYTE> rows;
+  const BYTE *src = (const BYTE *) ic->data;
+  if (ic->rowstep > 0) {
+    params.bytesperline = ic->rowstep;
+  } else {
+    rows.resize(size_t(linesize) * ic->rows);
+    const BYTE *q = src + size_t(ic->rows - 1) * (-ic->rowstep);
+    for (int j = 0; j < ic->rows; j++) {
+      memcpy(&rows[size_t(linesize) * j], q, linesize);
+      q += ic->rowstep;
+    }
+    src = &rows[0];
+    params.bytesperline = linesize;
+  }
+
+  // the bundled CharLS doesn't check the end of the output buffer; reserve
+  // enough for the worst case, LIMIT (4x) bits per sample plus bit stuffing.
+  size_t rawsize = size_t(linesize) * ic->rows;
+  size_t bufsize = rawsize * 5 + 1024;
+  BYTE *buf = (BYTE *) malloc(bufsize);
+  if (!buf) {
+    snprintf(ic->info, ARGBUF_SIZE, "charls_encoder(...): "
+             "cannot allocate %d bytes", int(bufsize));
+    return DICOMSDL_CODEC_ERROR;
+  }
+
+  size_t written = 0;
+  JLS_ERROR error;
+  try {
+    error = JpegLsEncode(buf, bufsize, &written, src,
+                         size_t(params.bytesperline) * ic->rows, &params);
+  } catch (JlsException &e) {
+    error = e._error;
+  }
+  if (error != OK) {
+    free(buf);
+    snprintf(ic->info, ARGBUF_SIZE, "charls_encoder(...): "
+             "error %d in JpegLsEncode", int(error));
+    return DICOMSDL_CODEC_ERROR;
+  }
+
+  BYTE *shrunk = (BYTE *) realloc(buf, written);
+  *data = (char *) (shrunk ? shrunk : buf);
+  *datasize = long(written);
+  ic->lossy = (near > 0 ? 1 : 0);
+  return DICOMSDL_CODEC_OK;
 }
 
 extern "C" void charls_codec_free_memory(char *data) {
@@ -123,4 +264,12 @@ extern "C" void charls_codec_free_memory(char *data) {
     free(data);
 }
 
+extern "C" const char *const *charls_transfer_syntaxes() {
+  static const char *const tsuids[] = {
+      "1.2.840.10008.1.2.4.80",  // JPEG-LS Lossless Image Compression
+      "1.2.840.10008.1.2.4.81",  // JPEG-LS Lossy (Near-Lossless) Image Compression
+      NULL};
+  return tsuids;
+}
+
 }  // namespace dicom -----------------------------------------------------
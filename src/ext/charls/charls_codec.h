@@ -24,6 +24,8 @@ extern "C" DICOMSDL_CODEC_RESULT charls_encoder(
 
 extern "C" void charls_codec_free_memory(char *data);
 
+extern "C" const char *const *charls_transfer_syntaxes();
+
 }  // namespace dicom ----------------------------------------------------------
 
 #endif // DICOMSDL_CHARLS_CODEC_H__
@@ -28,6 +28,10 @@ typedef struct {
 	int len;
 	unsigned char *buf;
 	unsigned char *ptr;
+	/* more buffers read after buf, e.g. fragments of a frame */
+	int nfrags;
+	char **frags;
+	long *fraglens;
 } MEMFILE;
 
 LOCAL(size_t) _JFREAD(FILE* in, unsigned char *destbuf, int destbufsiz)
@@ -35,9 +39,17 @@ LOCAL(size_t) _JFREAD(FILE* in, unsigned char *destbuf, int destbufsiz)
 	size_t nread = 0;
 	MEMFILE *mem = (MEMFILE*) in;
 
-	if (mem->buf+mem->len <= mem->ptr)
-		return 0; // cannot read more
-	else if (mem->len -  (mem->ptr - mem->buf) < destbufsiz) {
+	while (mem->buf+mem->len <= mem->ptr) {
+		if (mem->nfrags <= 0)
+			return 0; // cannot read more
+		mem->len = (int) mem->fraglens[0];
+		mem->buf = mem->ptr = (unsigned char *) mem->frags[0];
+		mem->frags++;
+		mem->fraglens++;
+		mem->nfrags--;
+	}
+
+	if (mem->len -  (mem->ptr - mem->buf) < destbufsiz) {
 		nread = mem->len -  (mem->ptr - mem->buf);
 		memcpy(destbuf, mem->ptr, nread);
 		mem->ptr += nread;
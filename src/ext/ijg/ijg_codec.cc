@@ -65,23 +65,10 @@ DICOMSDL_CODEC_RESULT ijg_encoder(const char *tsuid, imagecontainer *ic,
   }
   *free_memory_fn = ijg_codec_free_memory;
 
-  // check if jpeg encoder support image's precision.
-  if (jmode == JPEG_BASELINE && ic->prec > 8) {
-    sprintf(ic->info,
-      "JPEG BASE PROCESS 1 encoding "
-      "doesn't allow %d bits precision", ic->prec);
-    return DICOMSDL_CODEC_ERROR;
-  }
-  if (jmode == JPEG_EXTENDED && ic->prec > 12) {
-    sprintf(ic->info,
-      "JPEG EXTENDED PROCESS 2 & 4 encoding "
-      "doesn't allow %d bits precision", ic->prec);
-    return DICOMSDL_CODEC_ERROR;
-  }
-
   // parse argument
 
 	int quality = 100;
+	int bits = ic->prec;
 
 	argparser p(ic); // argument is set in ic->args
 	int key = 0;
@@ -94,6 +81,9 @@ DICOMSDL_CODEC_RESULT ijg_encoder(const char *tsuid, imagecontainer *ic,
 						quality = 100;
 				}
 				break;
+			case ARGKEY_BITS:
+				bits = p.value_as_int();
+				break;
 			default:
 				break;
         }
@@ -103,14 +93,33 @@ DICOMSDL_CODEC_RESULT ijg_encoder(const char *tsuid, imagecontainer *ic,
 		return DICOMSDL_CODEC_ERROR;
 	}
 
+  // code only the stored bits when samples keep their width in memory.
+  int precision = ic->prec;
+  if (bits > 0 && bits < ic->prec && (bits > 8) == (ic->prec > 8))
+    precision = bits;
+
+  // check if jpeg encoder support image's precision.
+  if (jmode == JPEG_BASELINE && precision > 8) {
+    sprintf(ic->info,
+      "JPEG BASE PROCESS 1 encoding "
+      "doesn't allow %d bits precision", precision);
+    return DICOMSDL_CODEC_ERROR;
+  }
+  if (jmode == JPEG_EXTENDED && precision > 12) {
+    sprintf(ic->info,
+      "JPEG EXTENDED PROCESS 2 & 4 encoding "
+      "doesn't allow %d bits precision", precision);
+    return DICOMSDL_CODEC_ERROR;
+  }
+
 	// encode according to image's precision
 	DICOMSDL_CODEC_RESULT ret;
 	*data = (char *)malloc(ic->rows * ic->rowstep * 2);  // reserve just a large buffer
 	*datasize = ic->rows * ic->rowstep * 2;
 
-	if (ic->prec > 12)
+	if (precision > 12)
 		ret = encode_ijg_jpeg16(ic, data, datasize, jmode, quality);
-	else if (ic->prec > 8)
+	else if (precision > 8)
 		ret = encode_ijg_jpeg12(ic, data, datasize, jmode, quality);
 	else
 		ret = encode_ijg_jpeg8(ic, data, datasize, jmode, quality);
@@ -188,55 +197,53 @@ JPEG_MODE scan_jpeg_header(char *src, int srclen, imagecontainer *ic)
 
 
 DICOMSDL_CODEC_RESULT decode_ijg_jpeg8
-	(char *src, int srclen, imagecontainer *ic);
+	(const fragmentlist *frags, imagecontainer *ic);
 DICOMSDL_CODEC_RESULT decode_ijg_jpeg12
-	(char *src, int srclen, imagecontainer *ic);
+	(const fragmentlist *frags, imagecontainer *ic);
 DICOMSDL_CODEC_RESULT decode_ijg_jpeg16
-	(char *src, int srclen, imagecontainer *ic);
-
+	(const fragmentlist *frags, imagecontainer *ic);
 
-DICOMSDL_CODEC_RESULT ijg_decoder(const char *tsuid, char *data, long datasize,
-                                             imagecontainer *ic)
- {
-  if (
+static bool is_ijg_tsuid(const char *tsuid)
+{
+  return (
       // PS3.5 A.4.1 JPEG Image Compression
-      strcmp("1.2.840.10008.1.2.4.50", tsuid) != 0 &&  // JPEG Baseline (Process 1): Default Transfer Syntax for Lossy JPEG 8 Bit Image Compression
-      strcmp("1.2.840.10008.1.2.4.51", tsuid) != 0 &&  // JPEG Extended (Process 2 & 4): Default Transfer Syntax for Lossy JPEG 12 Bit Image Compression (Process 4 only)
-      strcmp("1.2.840.10008.1.2.4.57", tsuid) != 0 &&  // JPEG Lossless, Non-Hierarchical (Process 14)
-      strcmp("1.2.840.10008.1.2.4.70", tsuid) != 0  // "JPEG Lossless, Non-Hierarchical, First-Order Prediction (Process 14 [Selection Value 1]): Default Transfer Syntax for Lossless JPEG Image Compression
-  )
-    return DICOMSDL_CODEC_NOTSUPPORTED;
-
-  if (!data) {
-    snprintf(ic->info, ARGBUF_SIZE, "ijg_decoder(...): data == NULL");
-    return DICOMSDL_CODEC_ERROR;
-  }
+      strcmp("1.2.840.10008.1.2.4.50", tsuid) == 0 ||  // JPEG Baseline (Process 1): Default Transfer Syntax for Lossy JPEG 8 Bit Image Compression
+      strcmp("1.2.840.10008.1.2.4.51", tsuid) == 0 ||  // JPEG Extended (Process 2 & 4): Default Transfer Syntax for Lossy JPEG 12 Bit Image Compression (Process 4 only)
+      strcmp("1.2.840.10008.1.2.4.57", tsuid) == 0 ||  // JPEG Lossless, Non-Hierarchical (Process 14)
+      strcmp("1.2.840.10008.1.2.4.70", tsuid) == 0  // "JPEG Lossless, Non-Hierarchical, First-Order Prediction (Process 14 [Selection Value 1]): Default Transfer Syntax for Lossless JPEG Image Compression
+  );
+}
 
+static bool check_pixelbuf(const char *funcname, imagecontainer *ic)
+{
   if (ic->datasize < ic->rowstep * ic->rows
       ||  ic->rowstep < ic->cols * (ic->prec > 8 ? 2 : 1) * ic->ncomps) {
-    snprintf(ic->info, ARGBUF_SIZE, "ijg_decoder(...): "
+    snprintf(ic->info, ARGBUF_SIZE, "%s(...): "
              "pixelbuf for decoded image is too small; "
              "buflen %d < rowstep %d * rows %d or "
              "rowstep < cols %d * (prec %d > 8 ? 2 : 1) * ncomps %d",
-             int(ic->datasize), ic->rowstep, ic->rows,
+             funcname, int(ic->datasize), ic->rowstep, ic->rows,
              ic->cols, ic->prec, ic->ncomps
     );
-    return DICOMSDL_CODEC_ERROR;
+    return false;
   }
+  return true;
+}
 
+// jmode and ic->prec are from scan_jpeg_header(...)
+static DICOMSDL_CODEC_RESULT decode_ijg(JPEG_MODE jmode,
+                                        const fragmentlist *frags,
+                                        imagecontainer *ic)
+{
   DICOMSDL_CODEC_RESULT ret;
-	JPEG_MODE jmode;
-
-	// scan jpeg header
-	jmode = scan_jpeg_header(data, datasize, ic);
 
 	if (jmode != JPEG_UNKNOWN) {
 		if (ic->prec > 12)
-			ret = decode_ijg_jpeg16(data, datasize, ic);
+			ret = decode_ijg_jpeg16(frags, ic);
 		else if (ic->prec > 8)
-			ret = decode_ijg_jpeg12(data, datasize, ic);
+			ret = decode_ijg_jpeg12(frags, ic);
 		else
-			ret = decode_ijg_jpeg8(data, datasize, ic);
+			ret = decode_ijg_jpeg8(frags, ic);
 	} else {
 	  // error message is in ic->info
 		strcpy(ic->info, "cannot read jpeg header.");
@@ -245,9 +252,69 @@ DICOMSDL_CODEC_RESULT ijg_decoder(const char *tsuid, char *data, long datasize,
 	return ret;
 }
 
+
+DICOMSDL_CODEC_RESULT ijg_decoder(const char *tsuid, char *data, long datasize,
+                                             imagecontainer *ic)
+ {
+  if (!is_ijg_tsuid(tsuid))
+    return DICOMSDL_CODEC_NOTSUPPORTED;
+
+  if (!data) {
+    snprintf(ic->info, ARGBUF_SIZE, "ijg_decoder(...): data == NULL");
+    return DICOMSDL_CODEC_ERROR;
+  }
+
+  if (!check_pixelbuf("ijg_decoder", ic))
+    return DICOMSDL_CODEC_ERROR;
+
+	// scan jpeg header
+	JPEG_MODE jmode = scan_jpeg_header(data, datasize, ic);
+
+	fragmentlist frags;
+	frags.nfragments = 1;
+	frags.data = &data;
+	frags.datasize = &datasize;
+	return decode_ijg(jmode, &frags, ic);
+}
+
+DICOMSDL_CODEC_RESULT ijg_fragments_decoder(const char *tsuid,
+                                            const fragmentlist *frags,
+                                            imagecontainer *ic)
+{
+  if (!is_ijg_tsuid(tsuid))
+    return DICOMSDL_CODEC_NOTSUPPORTED;
+
+  if (!frags || frags->nfragments < 1 || !frags->data[0]) {
+    snprintf(ic->info, ARGBUF_SIZE, "ijg_fragments_decoder(...): "
+             "no fragment to decode");
+    return DICOMSDL_CODEC_ERROR;
+  }
+
+  if (!check_pixelbuf("ijg_fragments_decoder", ic))
+    return DICOMSDL_CODEC_ERROR;
+
+	// frame header is looked up in the first fragment only;
+	// let the caller join fragments if it is not there.
+	JPEG_MODE jmode = scan_jpeg_header(frags->data[0], frags->datasize[0], ic);
+	if (jmode == JPEG_UNKNOWN)
+		return DICOMSDL_CODEC_NOTSUPPORTED;
+
+	return decode_ijg(jmode, frags, ic);
+}
+
 extern "C" void ijg_codec_free_memory(char *data) {
   if (data)
     free(data);
 }
 
+extern "C" const char *const *ijg_transfer_syntaxes() {
+  static const char *const tsuids[] = {
+      "1.2.840.10008.1.2.4.50",  // JPEG Baseline (Process 1)
+      "1.2.840.10008.1.2.4.51",  // JPEG Extended (Process 2 & 4)
+      "1.2.840.10008.1.2.4.57",  // JPEG Lossless, Non-Hierarchical (Process 14)
+      "1.2.840.10008.1.2.4.70",  // JPEG Lossless, Non-Hierarchical, First-Order Prediction
+      NULL};
+  return tsuids;
+}
+
 } // namespace dicom ------------------------------------------------------
@@ -17,6 +17,13 @@ namespace dicom {  //------------------------------------------------------
 extern "C" DICOMSDL_CODEC_RESULT ijg_decoder(const char *tsuid, char *data,
                                              long datasize,
                              imagecontainer *ic);
+
+/*
+ * same as ijg_decoder(), for a frame split into fragments;
+ * fragments are read in place by the data source manager.
+ */
+extern "C" DICOMSDL_CODEC_RESULT ijg_fragments_decoder(
+    const char *tsuid, const fragmentlist *frags, imagecontainer *ic);
 /*
  * jpeg encoder using ijg library
  *
@@ -32,6 +39,8 @@ extern "C" DICOMSDL_CODEC_RESULT ijg_encoder(const char *tsuid,
 
 extern "C" void ijg_codec_free_memory(char *data);
 
+extern "C" const char *const *ijg_transfer_syntaxes();
+
 }  // namespace dicom ------------------------------------------------------
 
 #endif // DICOMSDL_IJG_CODEC_H__
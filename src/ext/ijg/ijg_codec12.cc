@@ -29,6 +29,10 @@ typedef struct {
   int len;
   unsigned char *buf;
   unsigned char *ptr;
+  // fragments read after buf; see jdatasrc.c.patch
+  int nfrags;
+  char **frags;
+  long *fraglens;
 } MEMFILE;
 
 // -----------------------------------------------------------------------
@@ -75,6 +79,7 @@ DICOMSDL_CODEC_RESULT encode_ijg_jpeg12(imagecontainer *ic, char **data,
   mem.buf = (unsigned char *)*data;  // memory has beed allocated by ijg_codec.cc
   mem.ptr = mem.buf;
   mem.len = *datasize;
+  mem.nfrags = 0;
   jpeg_stdio_dest(&cinfo, (FILE *) &mem);
 
   // Step 3: set parameters for compression
@@ -136,7 +141,7 @@ DICOMSDL_CODEC_RESULT encode_ijg_jpeg12(imagecontainer *ic, char **data,
 // -----------------------------------------------------------------------
 // decoder
 
-DICOMSDL_CODEC_RESULT decode_ijg_jpeg12(char *src, int srclen,
+DICOMSDL_CODEC_RESULT decode_ijg_jpeg12(const fragmentlist *frags,
                                         imagecontainer *ic) {
   struct jpeg_decompress_struct cinfo;
 
@@ -157,11 +162,14 @@ DICOMSDL_CODEC_RESULT decode_ijg_jpeg12(char *src, int srclen,
 
   // Step 2: specify data source
 
-  // init source stream
+  // init source stream; fragments are read in place one after another
   MEMFILE mem;
-  mem.len = srclen;
-  mem.buf = (unsigned char*) src;
+  mem.len = int(frags->datasize[0]);
+  mem.buf = (unsigned char*) frags->data[0];
   mem.ptr = mem.buf;
+  mem.nfrags = frags->nfragments - 1;
+  mem.frags = frags->data + 1;
+  mem.fraglens = frags->datasize + 1;
   jpeg_stdio_src(&cinfo, (FILE *) &mem);
 
   // Step 3: read file parameters with jpeg_read_header()
@@ -17,8 +17,8 @@
 
 namespace dicom {  //-------------------------------------------------------
 
-DICOMSDL_CODEC_RESULT __decode_opj_jpeg2k(char *src, int srclen,
-                                          imagecontainer *ic);
+struct bytestream;
+DICOMSDL_CODEC_RESULT __decode_opj_jpeg2k(bytestream *bs, imagecontainer *ic);
 DICOMSDL_CODEC_RESULT opj_image_to_image(opj_image_t *image,
                                          imagecontainer *ic);
 
@@ -44,10 +44,25 @@ static void info_callback(const char *msg, void *client_data) {
 
 // ----------------------------------------------------------------------------
 
+// A stream over one buffer, or over a fragment list read in place.
+// With frags, datasize is the sum of all fragments and offset runs over them.
 struct bytestream {
   char *data;
   size_t datasize;
   size_t offset;
+  const fragmentlist *frags;
+  int frag;  // fragment holding offset
+  size_t frag_start;  // offset of the first byte in frags->data[frag]
+
+  bytestream(char *_data, size_t _datasize)
+      : data(_data), datasize(_datasize), offset(0), frags(NULL), frag(0),
+        frag_start(0) {}
+  explicit bytestream(const fragmentlist *_frags)
+      : data(_frags->data[0]), datasize(0), offset(0), frags(_frags), frag(0),
+        frag_start(0) {
+    for (int i = 0; i < frags->nfragments; i++)
+      datasize += size_t(frags->datasize[i]);
+  }
 };
 
 static OPJ_SIZE_T __bs_read(void * p_buffer, OPJ_SIZE_T p_nb_bytes,
@@ -56,8 +71,33 @@ static OPJ_SIZE_T __bs_read(void * p_buffer, OPJ_SIZE_T p_nb_bytes,
   size_t nb_read = (remaining > p_nb_bytes ? p_nb_bytes : remaining);
   if (nb_read == 0)
     return (OPJ_SIZE_T) -1;
-  memcpy(p_buffer, bs->data + bs->offset, nb_read);
-  bs->offset += nb_read;
+  if (!bs->frags) {
+    memcpy(p_buffer, bs->data + bs->offset, nb_read);
+    bs->offset += nb_read;
+    return nb_read;
+  }
+
+  // skip and seek only move offset; find its fragment here.
+  if (bs->offset < bs->frag_start) {
+    bs->frag = 0;
+    bs->frag_start = 0;
+  }
+  char *dst = (char *) p_buffer;
+  size_t left = nb_read;
+  while (left) {
+    size_t fragsize = size_t(bs->frags->datasize[bs->frag]);
+    size_t pos = bs->offset - bs->frag_start;
+    if (pos >= fragsize) {
+      bs->frag_start += fragsize;
+      bs->frag++;
+      continue;
+    }
+    size_t n = (fragsize - pos < left ? fragsize - pos : left);
+    memcpy(dst, bs->frags->data[bs->frag] + pos, n);
+    dst += n;
+    left -= n;
+    bs->offset += n;
+  }
   return nb_read;
 }
 
@@ -90,14 +130,22 @@ opj_stream_t* dicomsdl_create_memory_stream(bytestream *bs,
                                             OPJ_BOOL p_is_read_stream) {
   opj_stream_t* l_stream = 00;
 
-  if (bs->data == NULL || bs->datasize == 0)
+  if (bs->data == NULL || bs->datasize == 0
+      || (bs->frags != NULL && !p_is_read_stream))
     return NULL;
 
-  l_stream = opj_stream_create(OPJ_J2K_STREAM_CHUNK_SIZE, p_is_read_stream);
+  // a read stream needs no buffer larger than the codestream itself.
+  size_t chunk_size = OPJ_J2K_STREAM_CHUNK_SIZE;
+  if (p_is_read_stream && bs->datasize < chunk_size)
+    chunk_size = bs->datasize;
+
+  l_stream = opj_stream_create(chunk_size, p_is_read_stream);
   if (!l_stream)
     return NULL;
 
   bs->offset = 0;
+  bs->frag = 0;
+  bs->frag_start = 0;
 
   opj_stream_set_user_data(l_stream, bs, NULL);
   opj_stream_set_user_data_length(l_stream, bs->datasize);
@@ -115,9 +163,18 @@ extern "C" void opj_codec_free_memory(char *data)
     free(data);
 }
 
+extern "C" const char *const *opj_transfer_syntaxes()
+{
+  static const char *const tsuids[] = {
+      "1.2.840.10008.1.2.4.90",  // JPEG 2000 Image Compression (Lossless Only)
+      "1.2.840.10008.1.2.4.91",  // JPEG 2000 Image Compression
+      NULL};
+  return tsuids;
+}
+
 // Encoder ---------------------------------------------------------------------
 
-opj_image_t* image_to_opj_image(imagecontainer *ic);
+opj_image_t* image_to_opj_image(imagecontainer *ic, int bits);
 
 extern "C" DICOMSDL_CODEC_RESULT opj_encoder(
     const char *tsuid, imagecontainer *ic, char **data, long *datasize,
@@ -144,7 +201,7 @@ extern "C" DICOMSDL_CODEC_RESULT opj_encoder(
   opj_codec_t* l_codec = NULL;
   opj_image_t *image = NULL;
   char *encoded_pixel = NULL;
-  bytestream bs;
+  bytestream bs(NULL, 0);
 
   opj_set_default_encoder_parameters(&parameters);
   parameters.cp_comment = (char *) "openjp2/dicomsdl";
@@ -155,6 +212,7 @@ extern "C" DICOMSDL_CODEC_RESULT opj_encoder(
   int layers = 0;
   int level = 5;
   bool reversible = true;
+  int bits = ic->prec;
 
   argparser p(ic);  // argument is set in ic->args
   int key = 0;
@@ -187,6 +245,9 @@ extern "C" DICOMSDL_CODEC_RESULT opj_encoder(
           reversible = false;
       }
         break;
+      case ARGKEY_BITS:
+        bits = p.value_as_int();
+        break;
       default:
         break;
     }
@@ -223,7 +284,7 @@ extern "C" DICOMSDL_CODEC_RESULT opj_encoder(
 
   // prepare opj image -------------------------------------------------
 
-  image = image_to_opj_image(ic);
+  image = image_to_opj_image(ic, bits);
   if (image) {
     // PS3.5-2009, A.4.4 JPEG 2000 image compression
     // The optional JP2 file format header shall NOT be included.
@@ -322,13 +383,17 @@ template<class T> void __copyto(T *src, int srcstep, int *dst, int w, int h) {
   }
 }
 
-opj_image_t* image_to_opj_image(imagecontainer *ic) {
+opj_image_t* image_to_opj_image(imagecontainer *ic, int bits) {
 
   int i, numcomps, w, h, precision, signedness;
   numcomps = ic->ncomps;
   w = ic->cols;
   h = ic->rows;
+  // code only the stored bits when the decoder gives back samples of the
+  // same width as ic->prec.
   precision = ic->prec;
+  if (bits > 0 && bits < ic->prec && (bits > 8) == (ic->prec > 8))
+    precision = bits;
   signedness = ic->sgnd;
   OPJ_COLOR_SPACE color_space = (
       numcomps == 1 ? OPJ_CLRSPC_GRAY : OPJ_CLRSPC_SRGB);
@@ -420,7 +485,40 @@ extern "C" DICOMSDL_CODEC_RESULT opj_decoder(const char *tsuid, char *data, long
     return DICOMSDL_CODEC_ERROR;
   }
 
-  return __decode_opj_jpeg2k(data, datasize, ic);
+  bytestream bs(data, size_t(datasize));
+  return __decode_opj_jpeg2k(&bs, ic);
+}
+
+extern "C" DICOMSDL_CODEC_RESULT opj_fragments_decoder(
+    const char *tsuid, const fragmentlist *frags, imagecontainer *ic)
+{
+  if (
+      // PS3.5 A.4.4 JPEG 2000 Image Compression
+      strcmp("1.2.840.10008.1.2.4.90", tsuid) != 0 &&  // JPEG 2000 Image Compression (Lossless Only)
+      strcmp("1.2.840.10008.1.2.4.91", tsuid) != 0  // JPEG 2000 Image Compression
+  )
+    return DICOMSDL_CODEC_NOTSUPPORTED;
+
+  if (!frags || frags->nfragments < 1 || !frags->data[0]) {
+    snprintf(ic->info, ARGBUF_SIZE, "opj_fragments_decoder(...): "
+             "no fragment to decode");
+    return DICOMSDL_CODEC_ERROR;
+  }
+
+  if (ic->datasize < ic->rowstep * ic->rows
+      ||  ic->rowstep < ic->cols * (ic->prec > 8 ? 2 : 1) * ic->ncomps) {
+    snprintf(ic->info, ARGBUF_SIZE, "opj_fragments_decoder(...): "
+             "pixelbuf for decoded image is too small; "
+             "buflen %d < rowstep %d * rows %d or "
+             "rowstep < cols %d * (prec %d > 8 ? 2 : 1) * ncomps %d",
+             int(ic->datasize), ic->rowstep, ic->rows,
+             ic->cols, ic->prec, ic->ncomps
+    );
+    return DICOMSDL_CODEC_ERROR;
+  }
+
+  bytestream bs(frags);
+  return __decode_opj_jpeg2k(&bs, ic);
 }
 
 // Decoder : subroutines -------------------------------------------------
@@ -442,7 +540,7 @@ extern "C" DICOMSDL_CODEC_RESULT opj_decoder(const char *tsuid, char *data, long
 //}
 
 bool is_supported_gray_format(opj_image_t *image) {
-  return (image->numcomps == 1 && image->comps[0].factor == 0);
+  return (image->numcomps == 1);
 }
 
 bool is_supported_rgb_format(opj_image_t *image) {
@@ -457,8 +555,8 @@ bool is_supported_rgb_format(opj_image_t *image) {
       && image->comps[0].dy == image->comps[1].dy
       && image->comps[1].dy == image->comps[2].dy && image->comps[0].prec == 8
       && image->comps[1].prec == 8 && image->comps[2].prec == 8
-      && image->comps[0].factor == 0 && image->comps[1].factor == 0
-      && image->comps[2].factor == 0);
+      && image->comps[0].factor == image->comps[1].factor
+      && image->comps[1].factor == image->comps[2].factor);
 }
 
 template<class T> void __copyfrom(T *dst, int dststep, int *src, int w, int h) {
@@ -474,17 +572,84 @@ template<class T> void __copyfrom(T *dst, int dststep, int *src, int w, int h) {
   }
 }
 
-int is_jp2(char *src, int srclen) {
-  if (srclen < 8)
+int is_jp2(bytestream *bs) {
+  char sig[8];
+  // the signature box may straddle fragments; read the bytes out.
+  if (bs->datasize < 8 || __bs_read(sig, 8, bs) != 8)
     return -1;
-  if (!memcmp(src + 4, "jP  ", 4))
+  bs->offset = 0;
+  if (!memcmp(sig + 4, "jP  ", 4))
     return 1;  // jp2
   return 0;  // try codestream
 }
 
-DICOMSDL_CODEC_RESULT __decode_opj_jpeg2k(char *src, int srclen,
-                                          imagecontainer *ic) {
+// Decoder setup, kept per thread. An opj_codec_t decodes one codestream only,
+// so repeated frames reuse the parsed arguments and decoding parameters.
+struct opj_decoder_setup {
+  char args[ARGBUF_SIZE];  // ic->args this setup was built from
   opj_dparameters_t parameters;
+  int threads;  // -1 if not given in args
+  int area[4];  // x0, y0, x1, y1 on the full resolution grid; 0 for border
+  bool ready;
+
+  opj_decoder_setup() : threads(-1), ready(false) { args[0] = '\0'; }
+};
+
+static opj_decoder_setup *get_decoder_setup(imagecontainer *ic) {
+  static thread_local opj_decoder_setup setup;
+
+  if (setup.ready && strncmp(setup.args, ic->args, ARGBUF_SIZE) == 0)
+    return &setup;
+
+  setup.ready = false;
+  setup.threads = -1;
+  memset(setup.area, 0, sizeof(setup.area));
+  opj_set_default_decoder_parameters(&setup.parameters);
+
+  argparser p(ic);  // argument is set in ic->args
+  int key = 0;
+  while ((key = p.get_next_argkey()) > 0) {
+    switch (key) {
+      case ARGKEY_THREADS:
+        setup.threads = p.value_as_int();
+        if (setup.threads < 0)
+          setup.threads = 0;
+        break;
+      case ARGKEY_LAYER: {
+        int layers = p.value_as_int();
+        setup.parameters.cp_layer = OPJ_UINT32(layers > 0 ? layers : 0);
+      }
+        break;
+      case ARGKEY_REDUCE: {
+        int reduce = p.value_as_int();
+        setup.parameters.cp_reduce = OPJ_UINT32(reduce > 0 ? reduce : 0);
+      }
+        break;
+      case ARGKEY_AREA: {
+        int *a = setup.area;
+        if (sscanf(p.value_as_string(), "%d,%d,%d,%d", a, a + 1, a + 2, a + 3)
+                != 4 || a[0] < 0 || a[1] < 0 || a[2] < 0 || a[3] < 0) {
+          snprintf(ic->info, ARGBUF_SIZE,
+                   "area '%s' should be 'x0,y0,x1,y1'", p.value_as_string());
+          return NULL;
+        }
+      }
+        break;
+      default:
+        break;
+    }
+  }
+  if (key != 0)
+    return NULL;  // argument key error, error message in ic->info
+
+  memcpy(setup.args, ic->args, ARGBUF_SIZE);
+  setup.ready = true;
+  return &setup;
+}
+
+DICOMSDL_CODEC_RESULT __decode_opj_jpeg2k(bytestream *bs, imagecontainer *ic) {
+  opj_decoder_setup *setup;
+  int threads;
   opj_image_t* image = NULL;
   opj_codec_t* l_codec = NULL;
   opj_stream_t *l_stream = NULL; /* Stream */
@@ -492,14 +657,20 @@ DICOMSDL_CODEC_RESULT __decode_opj_jpeg2k(char *src, int srclen,
 
   DICOMSDL_CODEC_RESULT result = DICOMSDL_CODEC_OK;
 
-  opj_set_default_decoder_parameters(&parameters);
+  setup = get_decoder_setup(ic);
+  if (!setup) {
+    result = DICOMSDL_CODEC_ERROR;
+    goto fin;
+  }
 
-  bytestream bs;
-  bs.data = src;
-  bs.datasize = srclen;
-  bs.offset = 0;
+  // threads=n in ic->args, 1 if not given; 0 for all cpus.
+  threads = setup->threads;
+  if (threads < 0)
+    threads = 1;
+  if (threads <= 0)
+    threads = opj_get_num_cpus();
 
-  l_stream = dicomsdl_create_memory_stream(&bs, 1);
+  l_stream = dicomsdl_create_memory_stream(bs, 1);
   if (!l_stream) {
     snprintf(ic->info, ARGBUF_SIZE, "__decode_opj_jpeg2k(...): "
              "ERROR -> failed to create the stream");
@@ -507,7 +678,7 @@ DICOMSDL_CODEC_RESULT __decode_opj_jpeg2k(char *src, int srclen,
     goto fin;
   }
 
-  if (is_jp2(src, srclen) > 0) {  // -- JP2
+  if (is_jp2(bs) > 0) {  // -- JP2
     l_codec = opj_create_decompress(OPJ_CODEC_JP2);
   } else {  // try codestream
     l_codec = opj_create_decompress(OPJ_CODEC_J2K);
@@ -519,13 +690,22 @@ DICOMSDL_CODEC_RESULT __decode_opj_jpeg2k(char *src, int srclen,
   opj_set_error_handler(l_codec, error_callback, ic);
 
   // Setup the decoder decoding parameters using user parameters
-  if (!opj_setup_decoder(l_codec, &parameters)) {
+  if (!opj_setup_decoder(l_codec, &setup->parameters)) {
     snprintf(ic->info, ARGBUF_SIZE, "__decode_opj_jpeg2k(...): "
              "ERROR -> opj_decompress: failed to setup the decoder");
     result = DICOMSDL_CODEC_ERROR;
     goto fin;
   }
 
+  // code-blocks of the frame are decoded by openjpeg's own thread pool.
+  if (threads > 1 && opj_has_thread_support() &&
+      !opj_codec_set_threads(l_codec, threads)) {
+    snprintf(ic->info, ARGBUF_SIZE, "__decode_opj_jpeg2k(...): "
+             "ERROR -> opj_decompress: failed to set %d threads", threads);
+    result = DICOMSDL_CODEC_ERROR;
+    goto fin;
+  }
+
   // Read the main header of the codestream and if necessary the JP2 boxes
   if (!opj_read_header(l_stream, l_codec, &image)) {
     snprintf(ic->info, ARGBUF_SIZE, "__decode_opj_jpeg2k(...): "
@@ -534,8 +714,9 @@ DICOMSDL_CODEC_RESULT __decode_opj_jpeg2k(char *src, int srclen,
     goto fin;
   }
 
-  // Optional if you want decode the entire image
-  if (!opj_set_decode_area(l_codec, image, 0, 0, 0, 0)){
+  // area 0,0,0,0 decodes the entire image
+  if (!opj_set_decode_area(l_codec, image, setup->area[0], setup->area[1],
+                           setup->area[2], setup->area[3])){
     snprintf(ic->info, ARGBUF_SIZE, "__decode_opj_jpeg2k(...): "
              "ERROR -> opj_decompress: failed to set the decoded area");
     result = DICOMSDL_CODEC_ERROR;
@@ -576,6 +757,15 @@ DICOMSDL_CODEC_RESULT opj_image_to_image(opj_image_t *image,
   int signedness = 0;
   unsigned char *dst = (unsigned char *) (ic->data);
 
+  // decoded image should fit in the caller's buffer of ic->rows x ic->cols.
+  if (int(image->comps[0].w) > ic->cols || int(image->comps[0].h) > ic->rows) {
+    snprintf(ic->info, ARGBUF_SIZE, "opj_image_to_image(...): "
+             "decoded image %dx%d is larger than %dx%d",
+             int(image->comps[0].w), int(image->comps[0].h),
+             ic->cols, ic->rows);
+    return DICOMSDL_CODEC_ERROR;
+  }
+
   // Gray scale image
   if (is_supported_gray_format(image)) {
     width = image->comps[0].w;
@@ -14,9 +14,30 @@
 
 namespace dicom {  // ----------------------------------------------------------
 
+/*
+ * jpeg2k decoder using openjpeg library
+ *
+ * acceptable arguments in ic->args are ...
+ * 	threads=[ int value >= 0; 0 for number of cpus ]
+ * 	reduce=[ int value >= 0; decode at 1/2^reduce of full resolution ]
+ * 	area=[ x0,y0,x1,y1 in full resolution; 0 for image border ]
+ * 	layer=[ int value >= 0; decode up to this quality layer; 0 for all ]
+ *
+ *	threads defaults to 1; PixelSequence passes Config "OPJ_DECODE_THREADS".
+ *	with reduce or area, ic->rows and ic->cols are set to the decoded size.
+ *
+ *	example) reduce=3;area=0,0,1024,1024
+ */
 extern "C" DICOMSDL_CODEC_RESULT opj_decoder(const char *tsuid, char *data,
                                              long datasize, imagecontainer *ic);
 
+/*
+ * same as opj_decoder(), for a frame split into fragments;
+ * fragments are read in place by the stream callbacks.
+ */
+extern "C" DICOMSDL_CODEC_RESULT opj_fragments_decoder(
+    const char *tsuid, const fragmentlist *frags, imagecontainer *ic);
+
 /*
  * jpeg2k encoder using openjpeg library
  *
@@ -37,6 +58,8 @@ extern "C" DICOMSDL_CODEC_RESULT opj_encoder(const char *tsuid,
 
 extern "C" void opj_codec_free_memory(char *data);
 
+extern "C" const char *const *opj_transfer_syntaxes();
+
 }  // namespace dicom ----------------------------------------------------------
 
 #endif
@@ -84,6 +84,27 @@ typedef struct {
 typedef DICOMSDL_CODEC_RESULT (*decoder_fnptr)(const char *, char *, long,
                                                imagecontainer *);
 
+/* encoded pixel data split into fragments
+ *
+ * fragments are read in order as one contiguous stream of encoded data;
+ * data[i] points to datasize[i] bytes of i-th fragment.
+ */
+typedef struct {
+  int nfragments;
+  char **data;
+  long *datasize;
+} fragmentlist;
+
+/* decode pixel data given in fragments, without joining them
+ *
+ * same as decoder_fnptr except the encoded data.
+ * return DICOMSDL_CODEC_NOTSUPPORTED to have the fragments joined and
+ * decoded by decoder_fnptr of the same codec.
+ */
+typedef DICOMSDL_CODEC_RESULT (*fragments_decoder_fnptr)(const char *,
+                                                         const fragmentlist *,
+                                                         imagecontainer *);
+
 /* free memory allocated by encoder
  */
 typedef void (*free_memory_fnptr)(char *);
@@ -101,6 +122,8 @@ typedef void (*free_memory_fnptr)(char *);
  *  ic->data, ic->datasize, ic->rowstep, ic->rows, ic->cols,
  *  ic->prec, ic->sgnd, ic->ncomps,
  *  ic->args[256];
+ *  ic->prec gives the layout of samples in ic->data; "bits=n" in ic->args
+ *  gives the number of bits actually stored in a sample (BitsStored).
  *  char**, long* = data and its size of encoded pixel data
  *       data is allocated by encoder
  *
@@ -117,6 +140,16 @@ typedef DICOMSDL_CODEC_RESULT (*encoder_fnptr)(const char *, imagecontainer *,
                                                char **, long *,
                                                free_memory_fnptr *);
 
+/* transfer syntaxes handled by encoder and decoder
+ *
+ * return NULL terminated array of transfer syntax UID values such as
+ *  { "1.2.840.10008.1.2.4.80", "1.2.840.10008.1.2.4.81", NULL }
+ *
+ * codec is called only for these transfer syntaxes; codec without this
+ * function is tried for all transfer syntaxes.
+ */
+typedef const char *const *(*transfer_syntaxes_fnptr)();
+
 #ifdef _MSC_VER
 	#ifndef snprintf
 		#define snprintf _snprintf
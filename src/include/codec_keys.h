@@ -16,6 +16,11 @@
 #define ARGKEY_REVERSIBLE 6 /* reversible */
 #define ARGKEY_MODE 7 /* mode */
 #define ARGKEY_QUALITY 8 /* quality */
+#define ARGKEY_THREADS 9 /* threads */
+#define ARGKEY_REDUCE 10 /* reduce */
+#define ARGKEY_AREA 11 /* area */
+#define ARGKEY_NEAR 12 /* near */
+#define ARGKEY_BITS 13 /* bits */
 
 static int __stricmp(const char *a, const char *b)
 {
@@ -26,7 +31,10 @@ static int get_argkey(char *arg) {
 	char *c = arg;
 	int key=0;
 	switch (*c++) {
+		case 'a': case 'A': key=ARGKEY_AREA; goto L_EXIT; break;
+		case 'b': case 'B': key=ARGKEY_BITS; goto L_EXIT; break;
 		case 'm': case 'M': key=ARGKEY_MODE; goto L_EXIT; break;
+		case 'n': case 'N': key=ARGKEY_NEAR; goto L_EXIT; break;
 		case 'l': case 'L': {
 			switch (*c++) {
 				case 'a': case 'A': key=ARGKEY_LAYER; goto L_EXIT; break;
@@ -37,10 +45,17 @@ static int get_argkey(char *arg) {
 		case 'q': case 'Q': key=ARGKEY_QUALITY; goto L_EXIT; break;
 		case 'p': case 'P': key=ARGKEY_PRECISE; goto L_EXIT; break;
 		case 's': case 'S': key=ARGKEY_STEP; goto L_EXIT; break;
+		case 't': case 'T': key=ARGKEY_THREADS; goto L_EXIT; break;
 		case 'r': case 'R': {
 			switch (*c++) {
 				case 'a': case 'A': key=ARGKEY_RATE; goto L_EXIT; break;
-				case 'e': case 'E': key=ARGKEY_REVERSIBLE; goto L_EXIT; break;
+				case 'e': case 'E': {
+					switch (*c++) {
+						case 'v': case 'V': key=ARGKEY_REVERSIBLE; goto L_EXIT; break;
+						case 'd': case 'D': key=ARGKEY_REDUCE; goto L_EXIT; break;
+						default: goto L_EXIT; break;
+					};
+				}; break;
 				default: goto L_EXIT; break;
 			};
 		}; break;
@@ -56,6 +71,11 @@ L_EXIT:
 		case ARGKEY_REVERSIBLE: if (__stricmp(arg, "reversible")) return 0; break;
 		case ARGKEY_MODE: if (__stricmp(arg, "mode")) return 0; break;
 		case ARGKEY_QUALITY: if (__stricmp(arg, "quality")) return 0; break;
+		case ARGKEY_THREADS: if (__stricmp(arg, "threads")) return 0; break;
+		case ARGKEY_REDUCE: if (__stricmp(arg, "reduce")) return 0; break;
+		case ARGKEY_AREA: if (__stricmp(arg, "area")) return 0; break;
+		case ARGKEY_NEAR: if (__stricmp(arg, "near")) return 0; break;
+		case ARGKEY_BITS: if (__stricmp(arg, "bits")) return 0; break;
 		default: break;
 	}
 	return key;
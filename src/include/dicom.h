@@ -9,12 +9,19 @@
 #ifndef DICOMSDL_DICOM_H_
 #define DICOMSDL_DICOM_H_
 
+#include <stdint.h>
 #include <string.h>
 
+#include <atomic>
 #include <functional>
+#include <iterator>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "dicomcfg.h"
@@ -27,6 +34,7 @@ class InStream;
 class Sequence;
 class PixelSequence;
 class DicomException;
+struct TagFilter;
 
 // Types -======================================================================
 
@@ -84,6 +92,11 @@ struct TAG {
   inline static uint16_t group(tag_t tag) { return (uint16_t)(tag >> 16); }
   inline static uint16_t element(tag_t tag) { return (uint16_t)(tag & 0xffff); }
 
+  /// True for a Private Creator Data Element (gggg,0010-00ff), gggg odd.
+  inline static bool is_private_creator(tag_t tag) {
+    return (tag & 0x10000) && (tag & 0xff00) == 0 && (tag & 0xff) >= 0x10;
+  }
+
   /// Tag -> std::string "(gggg,eeee)""
   static std::string repr(tag_t tag);
 
@@ -91,6 +104,7 @@ struct TAG {
   static const char* keyword(tag_t tag); // Tag::keyword(tag)
   static const char* name(tag_t tag); // Tag::name(tag)
   static tag_t from_keyword(const char* keyword); // Tag::from_keyword(string)
+  static tag_t from_keyword(const char* keyword, size_t size);
 };
 
 // UID -----------------------------------------------------------------------
@@ -372,9 +386,28 @@ class DataElement {
   }
 
   /// Return memory pointer where DataElement's raw value is stored. It can be
-  /// on the mmap'ed disk or allocated memory.
+  /// on the mmap'ed disk or allocated memory. Returns nullptr if the stream
+  /// doesn't keep its bytes (WINDOWED); use pinValue() or readValue() there.
   void* value_ptr();
 
+  /// Return memory pointer to `size` bytes at `offset` within the value. Only
+  /// that part has to be loaded from the stream. Returns nullptr if the
+  /// stream doesn't keep its bytes (WINDOWED); use readValue() there.
+  void* value_ptr(size_t offset, size_t size);
+
+  /// Same as value_ptr(offset, size), but works for every stream; the bytes
+  /// stay valid until unpinValue() is called with the returned pointer.
+  void* pinValue(size_t offset, size_t size);
+  void unpinValue(const void* ptr);
+
+  /// Copy `size` bytes at `offset` within the value into `ptr`. Returns
+  /// number of bytes copied.
+  size_t readValue(size_t offset, void* ptr, size_t size);
+
+  /// Copy the value from the stream into memory owned by this DataElement,
+  /// so it outlives the stream's bytes (e.g. on forward-only streams).
+  void retainValue();
+
   /// Return Buffer<T> which contains DataElement's value. Byte order swapping
   /// is done according to the machines endianess, transfer syntax, and VR.
   template <typename T>
@@ -446,12 +479,76 @@ class DataElement {
   void _fromNumberVectorToString(const std::vector<AVT>& value);
 };
 
+// LoadOption ------------------------------------------------------------------
+
+// Options for open_file() and DataSet::attachToFile(); may be or'ed together.
+struct LoadOption {
+  typedef enum {
+    DEFAULT = 0,
+    // map the file read-only into memory instead of copying it to the heap.
+    MMAP = 0x01,
+    // read the file in page-aligned windows with positioned reads and keep a
+    // bounded number of them in memory (see InWindowedFileStream).
+    // DataElement::value_ptr() returns nullptr, and pinning values in more
+    // than Config INSTREAM_WINDOW_COUNT windows at once fails.
+    WINDOWED = 0x02,
+    // parse data elements but leave pixel data on disk; only the position
+    // and length of (7FE0,0010) are recorded, and frames of a pixel sequence
+    // are located on first access. implies WINDOWED unless MMAP is given.
+    // the end of an encapsulated pixel data is found by skipping item headers.
+    HEADER_ONLY = 0x04,
+    // allow many threads to read the DataSet at once. lazy loading of the
+    // DataSet, its sequences and pixel sequences is serialized by a mutex of
+    // the root DataSet; until the whole DataSet is parsed, getDataElement()
+    // on the root DataSet takes the mutex, and it is lock-free after that.
+    // the file is read into memory at once unless MMAP is given; WINDOWED
+    // and HEADER_ONLY use MMAP instead of windows. adding, removing or
+    // changing DataElements is not thread-safe.
+    CONCURRENT = 0x08,
+  } type;
+};
+typedef LoadOption::type loadopt_t;
+
+// Reads up to `size` bytes into `buf` and returns number of bytes read;
+// returns 0 at the end of stream. Used for forward-only streams (pipe, socket,
+// tar member, ...).
+typedef std::function<size_t(uint8_t* buf, size_t size)> ReaderFunctionType;
+
+// TagPath ---------------------------------------------------------------------
+
+// A tag string parsed once and evaluated against any DataSet, e.g.
+// "00100010", "(0010,0010)", "PatientName", "0009,{CREATOR}10" or
+// "52009229.0.00289145.0.00281053" (tag '.' item number '.' tag ...).
+class TagPath {
+ public:
+  struct Node {
+    tag_t tag;            // (gggg,00ee) for a tag with private creator.
+    std::string creator;  // private creator between '{' and '}'.
+    int seqidx;           // item number after the tag; -1 for the last tag.
+  };
+
+  explicit TagPath(const char* tagstr);
+  explicit TagPath(const std::string& tagstr) : TagPath(tagstr.c_str()) {}
+
+  // Returns TagPath for `tagstr` from a per-thread cache of recently used
+  // strings; the reference is valid until next from_string() in the thread.
+  static const TagPath& from_string(const char* tagstr);
+
+  inline const std::vector<Node>& nodes() const { return nodes_; }
+  inline const std::string& str() const { return tagstr_; }
+
+ private:
+  std::string tagstr_;
+  std::vector<Node> nodes_;
+};
+
 // DataSet =====================================================================
 
 class DataSet {
   DataSet *root_dataset_;
 
-  std::map<tag_t, std::unique_ptr<DataElement>> edict_;
+  // (tag, DataElement) records sorted by tag.
+  std::vector<std::pair<tag_t, DataElement*>> edict_;
   std::unique_ptr<InStream> is_;
 
   tag_t last_tag_loaded_;
@@ -466,6 +563,44 @@ class DataSet {
 
   size_t offset_in_stream_;  // location in the file (for DICOMDIR)
 
+  // DataElements of a root DataSet and its items are constructed in blocks
+  // owned by the root DataSet, which are freed at once by close() or
+  // ~DataSet(). Memory of a removed or replaced DataElement is kept in a free
+  // list and reused by the next new DataElement.
+  typedef std::aligned_storage<sizeof(DataElement),
+                               alignof(DataElement)>::type ElementStorage;
+  std::vector<std::unique_ptr<ElementStorage[]>> arena_;
+  size_t arena_used_;      // number of DataElements used in arena_.back()
+  size_t arena_capacity_;  // number of DataElements in arena_.back()
+  void* free_elements_;    // first free slot; each holds pointer to the next.
+
+  int load_option_;  // LoadOption given to attachToFile()
+
+  std::unique_ptr<TagFilter> load_tags_;  // built by setLoadTags()
+  // elements not in tag_filter_ are skipped by load(); nullptr loads all.
+  // points into root_dataset_->load_tags_.
+  const TagFilter* tag_filter_;
+
+  // creator -> (group, block) of the private blocks reserved in this
+  // DataSet, built on demand by findPrivateBlock().
+  std::unordered_map<std::string, std::vector<std::pair<uint16_t, uint8_t>>>
+      private_blocks_;
+  std::atomic<bool> private_blocks_valid_;
+
+  // serializes lazy loading in LoadOption::CONCURRENT mode; see lockLoading().
+  std::recursive_mutex load_mutex_;
+  // true if getDataElement() of the root DataSet will not load() any more.
+  std::atomic<bool> load_complete_;
+
+  DataElement* newDataElement(tag_t tag, vr_t vr, size_t length,
+                              size_t offset);
+  void deleteDataElement(DataElement* de);
+  void destroyDataElements();
+
+  // element loop of load() for each transfer syntax family.
+  template <bool is_explicit_vr, bool is_little_endian>
+  void _load(tag_t load_until, InStream *instream);
+
  public:
   DataSet();
   DataSet(DataSet* parent);
@@ -476,8 +611,10 @@ class DataSet {
   DataElement* addDataElement(tag_t tag, vr_t vr = VR::NONE,
                               uint32_t length = 0, size_t offset = 0);
   DataElement* addDataElement(const char *tagstr, vr_t vr = VR::NONE);
+  DataElement* addDataElement(const TagPath& tagpath, vr_t vr = VR::NONE);
   DataElement* getDataElement(tag_t tag);
   DataElement* getDataElement(const char *tagstr);
+  DataElement* getDataElement(const TagPath& tagpath);
   inline DataElement& operator[](tag_t tag) { return *getDataElement(tag); }
   inline DataElement& operator[](const char* tagstr) {
     return *getDataElement(tagstr);
@@ -487,15 +624,40 @@ class DataSet {
 
   void removeDataElement(tag_t tag);  /// Remove a data element.
   void removeDataElement(const char *tagstr);
+  void removeDataElement(const TagPath& tagpath);
+
+  // Block number (0x10-0xff) reserved by private creator `creator` in group
+  // `gggg`; returns 0 if no such block.
+  tag_t findPrivateBlock(uint16_t gggg, const std::string& creator);
+  // Called when a Private Creator Data Element is added, removed or changed.
+  inline void invalidatePrivateBlocks() { private_blocks_valid_ = false; }
+
+  // Returns a lock on the mutex of the root DataSet that serializes lazy
+  // loading if the root DataSet is loaded with LoadOption::CONCURRENT;
+  // otherwise returns an empty lock.
+  std::unique_lock<std::recursive_mutex> lockLoading();
 
   void attachToMemory(const uint8_t* data, size_t datasize, bool copy_data);
-  void attachToFile(const char* filename);
-  void attachToInstream(InStream *basestream, size_t size);
+  void attachToFile(const char* filename,
+                    int load_option = LoadOption::DEFAULT);
+  void attachToInstream(InStream *basestream, size_t size,
+                        const TagFilter* tag_filter = nullptr);
+  void attachToReader(ReaderFunctionType reader);
   void detach();  /// delete InFileStream or InMemoryStream object
 
   void load(tag_t load_until, InStream *instream);
   void loadDicomFile(tag_t load_until);
 
+  // Create DataElements only for the given tags while loading; the other
+  // elements are skipped by their length. Each entry is a tag or a tag path
+  // in the form of getDataElement(), e.g. "00280010", "(0028,0010)", "Rows"
+  // or "PerFrameFunctionalGroupsSequence.FrameContentSequence.StackID".
+  // Item numbers in a path may be omitted and are not used; a path selects
+  // the element in every item. A sequence given by itself is loaded as a
+  // whole. File meta information and SpecificCharacterSet are always loaded.
+  // An empty `tagpaths` loads all elements. Call before loadDicomFile().
+  void setLoadTags(const std::vector<std::string>& tagpaths);
+
   // Config::set("SAVE_SQ_EXPLICIT_LENGTH", "TRUE")
   // Config::set("SAVE_SQ_EXPLICIT_LENGTH", "FALSE")
   // - Write explicit length of Sequence and its DataSet items if "TRUE".
@@ -532,13 +694,42 @@ class DataSet {
   inline size_t getOffset() { return offset_in_stream_; }
   inline void setOffset(size_t offset) { offset_in_stream_ = offset; }
 
-  inline decltype(edict_)::iterator begin() {
-    return edict_.begin();
-  }
-  inline decltype(edict_)::iterator end() {
-    return edict_.end();
-  }
-  
+  // Iterates (tag, DataElement*) records in tag order. Like an iterator of
+  // std::map, it stays valid while DataElements are added or removed (e.g. by
+  // lazy loading in getDataElement()); if its own DataElement is removed, it
+  // moves on to the next tag.
+  class iterator {
+    DataSet* ds_;
+    mutable size_t index_;  // position in ds_->edict_; SIZE_MAX at end.
+    tag_t tag_;
+
+    void sync() const;  // find tag_ again if edict_ was changed.
+
+   public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef std::pair<tag_t, DataElement*> value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef value_type* pointer;
+    typedef value_type& reference;
+
+    iterator() : ds_(nullptr), index_(SIZE_MAX), tag_(0) {}
+    iterator(DataSet* ds, size_t index);
+
+    reference operator*() const;
+    pointer operator->() const { return &**this; }
+    iterator& operator++();
+    iterator operator++(int) {
+      iterator it = *this;
+      ++*this;
+      return it;
+    }
+    bool operator==(const iterator& other) const;
+    bool operator!=(const iterator& other) const { return !(*this == other); }
+  };
+
+  inline iterator begin() { return iterator(this, 0); }
+  inline iterator end() { return iterator(this, SIZE_MAX); }
+
   std::wstring dump(size_t max_length=120);
 
   void copyFrameData(size_t index, uint8_t *data, int datasize, int rowstep);
@@ -546,13 +737,30 @@ class DataSet {
 
 // if keep_on_error is true, ignore exception and return partially decoded
 // DataSet.
-std::unique_ptr<DataSet> open_file(const char* filename,
-                                   tag_t load_until = 0xffffffff,
-                                   bool keep_on_error = false);
-std::unique_ptr<DataSet> open_memory(const uint8_t* data, size_t datasize,
-                                     bool copy_data = true,
-                                     tag_t load_until = 0xffffffff,
-                                     bool keep_on_error = false);
+// if load_tags is not empty, only those elements are loaded; see
+// DataSet::setLoadTags().
+std::unique_ptr<DataSet> open_file(
+    const char* filename, tag_t load_until = 0xffffffff,
+    bool keep_on_error = false, int load_option = LoadOption::DEFAULT,
+    const std::vector<std::string>& load_tags = {});
+std::unique_ptr<DataSet> open_memory(
+    const uint8_t* data, size_t datasize, bool copy_data = true,
+    tag_t load_until = 0xffffffff, bool keep_on_error = false,
+    const std::vector<std::string>& load_tags = {});
+
+// Parse a DICOM file in a single pass from a forward-only stream.
+// Values are copied into the DataSet as they are parsed and the stream keeps
+// only the bytes of the current data element. Data elements longer than
+// Config::getInteger("STREAM_RETAIN_LENGTH", 65536) bytes (e.g. pixel data)
+// are dropped; raise it to retain them.
+std::unique_ptr<DataSet> open_stream(
+    ReaderFunctionType reader, tag_t load_until = 0xffffffff,
+    bool keep_on_error = false,
+    const std::vector<std::string>& load_tags = {});
+// same as open_stream(), reads from a file descriptor (e.g. pipe or socket).
+std::unique_ptr<DataSet> open_fd(
+    int fd, tag_t load_until = 0xffffffff, bool keep_on_error = false,
+    const std::vector<std::string>& load_tags = {});
 
 
 // Sequence ====================================================================
@@ -564,6 +772,12 @@ class Sequence {
 
   std::vector<std::unique_ptr<DataSet>> seq_;
 
+  std::unique_ptr<InStream> is_;  // InSubStream
+  // attached, but loadItems() is not finished yet.
+  std::atomic<bool> items_pending_;
+  bool items_loading_;  // loadItems() is running.
+  const TagFilter* tag_filter_;  // passed to items; see DataSet::setLoadTags
+
  public:
   Sequence(DataSet* root_dataset);
   ~Sequence();
@@ -572,16 +786,27 @@ class Sequence {
 
   void load(InStream* instream);
 
-  inline int size() { return (int)seq_.size(); }
+  // attached sequence is parsed by loadItems(), which is called on first
+  // access to its items.
+  void attachToInstream(InStream* basestream, size_t size,
+                        const TagFilter* tag_filter = nullptr);
+  void loadItems();
+
+  inline int size() {
+    if (items_pending_) loadItems();
+    return (int)seq_.size();
+  }
 
   DataSet* addDataSet();              // wrapper
   DataSet* getDataSet(size_t index);  // wrapper
   DataSet* operator[](size_t index);
 
   inline decltype(seq_)::iterator begin() {
+    if (items_pending_) loadItems();
     return seq_.begin();
   }
   inline decltype(seq_)::iterator end() {
+    if (items_pending_) loadItems();
     return seq_.end();
   }
 
@@ -589,44 +814,38 @@ class Sequence {
   // void removeAll(bool delete_dataset = true);  // wrapper
 };
 
-// PixelSequence ===============================================================
-
-struct PixelFrame {
-  // `frag_offsets_`, `startoffset_`, `endoffset_` are set only when
-  // `PixelFrame` is loaded from `InStream`. Encoded pixel data are on the
-  // `InStream`.
-
-  // start and endoffset pair of pixel fragments [start] [end] [start] [end] ...
-  std::vector<size_t> frag_offsets_;
-  // start offset in `InStream`.
-  size_t startoffset_;
-  // end offset == `startoffset_` of next frame.
-  size_t endoffset_;
-
-  // `encoded_data_`, `encoded_data_size_` are used only when `PixelFrame` is
-  // created by user. Encoded pixel data are on the `encoded_data_`.
-
-  uint8_t* encoded_data_;     // encoded pixel data.
-  size_t encoded_data_size_;  // length of encoded pixel data.
-
-  PixelFrame();
-  ~PixelFrame();
-
-  // load a frame from instream; should be called from
-  // PixelSequence::loadFrames().
-  // buf should be uint8_t[8];
-  void load(InStream* instream, size_t frame_length, uint8_t* buf);
-
-  // setEncodedData() should be called from PixelSequence::setEncodedFrameData()
-  void setEncodedData(uint8_t* data, size_t size);
+// CodecLock ===================================================================
 
+// held by the caller of decodeFrames(), copyDecodedFrameRegion() or
+// encodeFrames(), which unlock() it only while codecs run and lock() it again
+// before touching the DataSet or its stream; e.g. the Python binding passes
+// one that releases the GIL.
+class CodecLock {
  public:
-  size_t encodedDataSize() { return encoded_data_size_; };
+  virtual ~CodecLock() {}
+  virtual void lock() = 0;
+  virtual void unlock() = 0;
 };
 
+// PixelSequence ===============================================================
+
 class PixelSequence {
-  std::vector<std::unique_ptr<PixelFrame>> frames_;
+  // frame table; frame i has [start] [end] offsets in `is_` at
+  // frame_offsets_[i * 2], and its fragments are frag_offsets_[k * 2] and
+  // frag_offsets_[k * 2 + 1] (start and end offsets) for k in
+  // [frame_frags_[i * 2], frame_frags_[i * 2 + 1]). offsets are 0 and the
+  // range is empty for frames added by user.
+  std::vector<size_t> frame_offsets_;
+  std::vector<size_t> frame_frags_;
+  std::vector<size_t> frag_offsets_;  // shared by all frames
+  // encoded data of frames added or set by user, indexed by frame; empty, or
+  // shorter than the frame table, for frames on the `InStream`.
+  std::vector<Buffer<uint8_t>> encoded_frames_;
+
   std::unique_ptr<InStream> is_;  // InSubStream
+  // attached, but loadFrames() is not finished yet.
+  std::atomic<bool> frames_pending_;
+  bool frames_loading_;  // loadFrames() is running.
 
   DataSet *root_dataset_;
   tsuid_t transfer_syntax_;
@@ -634,23 +853,38 @@ class PixelSequence {
 
   size_t base_offset_;  // base offset to calculate actual offset from offset_table
 
+  void _loadFrames();
+  // append a frame taking over `data` allocated with malloc(); it is released
+  // with ::free(), also when this throws.
+  void adoptEncodedFrameData(uint8_t* data, size_t datasize);
+  void appendEncodedFrame(Buffer<uint8_t>&& buf);
+
  public:
   PixelSequence(DataSet *root_dataset, tsuid_t tsuid);
   ~PixelSequence();
   PixelSequence(const PixelSequence&) = delete;
   PixelSequence(const PixelSequence&&) = delete;
 
-  PixelFrame* addPixelFrame();
+  // append a frame with a copy of `data`, padded to even length.
+  void addEncodedFrameData(const uint8_t* data, size_t datasize);
 
+  // attached pixel sequence is parsed by loadFrames(), which is called on
+  // first access to the frames if nobody calls it before.
+  // without a usable basic offset table, a JPEG, JPEG-LS or JPEG 2000 frame
+  // begins at each fragment that starts with SOI (FFD8) or SOC and SIZ
+  // (FF4F FF51), if the first fragment does and there are NumberOfFrames of
+  // them; otherwise, and for other transfer syntaxes, all fragments make one
+  // frame.
   void attachToInstream(InStream* basestream, size_t size);
 
   void loadFrames();
 
-  inline decltype(frames_)::iterator begin() { return frames_.begin(); }
-  inline decltype(frames_)::iterator end() { return frames_.end(); }
   inline InStream* instream() { return is_.get(); }
 
-  inline size_t numberOfFrames() const { return frames_.size(); }
+  inline size_t numberOfFrames() {
+    if (frames_pending_) loadFrames();
+    return frame_offsets_.size() / 2;
+  }
 
   // return start and end offset of `frame` with `index`
   size_t frameOffset(size_t index, size_t& end_offset);
@@ -659,11 +893,42 @@ class PixelSequence {
   // [start] [end] [start] [end] ...
   // returned vector size is 2 * number of fragments.
   std::vector<size_t> frameFragmentOffsets(size_t index);
+  // max_layers > 0 decodes only the first max_layers quality layers of a
+  // JPEG 2000 frame, e.g. for a fast first paint; ignored by other codecs.
+  // rowstep < 0 stores rows bottom-up (RLE and JPEG-LS); `data` is the start
+  // of the buffer either way.
   void copyDecodedFrameData(size_t index, uint8_t* data, int datasize,
-                            int rowstep);
+                            int rowstep, int max_layers = 0);
+
+  // decode `count` frames from `first` into `data`; frame i is written at
+  // data + (i - first) * framestep. frames are decoded in parallel with
+  // Config::getInteger("DECODE_THREADS", 0) threads (0: number of cores).
+  void decodeFrames(size_t first, size_t count, uint8_t* data, int rowstep,
+                    size_t framestep, CodecLock* codec_lock = nullptr);
+
+  // decode frame `index` at 1/2^reduce of full resolution, only the area
+  // [x0, x1) x [y0, y1) of the full resolution image (x1 or y1 of 0 means the
+  // image border). only for JPEG 2000; a smaller decode costs less.
+  void copyDecodedFrameRegion(size_t index, uint8_t* data, int datasize,
+                              int rowstep, int reduce, int x0 = 0, int y0 = 0,
+                              int x1 = 0, int y1 = 0, int max_layers = 0,
+                              CodecLock* codec_lock = nullptr);
+  // rows and columns of the image from copyDecodedFrameRegion().
+  void decodedRegionSize(int reduce, int x0, int y0, int x1, int y1,
+                         int& rows, int& cols);
 
   void setEncodedFrameData(size_t index, uint8_t* data, size_t datasize);
 
+  // encode `count` frames, frame i at data + i * framestep, in the transfer
+  // syntax of this sequence and append them. frames are encoded in parallel
+  // with Config::getInteger("ENCODE_THREADS", 0) threads (0: number of
+  // cores). `codec_args` is passed to the encoder, e.g. "near=2" for JPEG-LS.
+  // if the encoder was lossy, LossyImageCompression (0028,2110), its ratio
+  // and method are set in the root DataSet.
+  void encodeFrames(const uint8_t* data, size_t count, int rowstep,
+                    size_t framestep, const char* codec_args = "",
+                    CodecLock* codec_lock = nullptr);
+
   Buffer<uint8_t> encodedFrameData(size_t index);
   size_t encodedFrameDataSize(size_t index);
 };
@@ -674,7 +939,8 @@ struct PixelSequenceItem {
   size_t offset;
 };
 
-// load/unload codec for encoding/decoding pixels
+// load/unload codec for encoding/decoding pixels; safe to call while other
+// threads decode or encode, which keep using the codecs they started with.
 void load_codec(char *codec_filename);
 void unload_codec(char *codec_filename);
 
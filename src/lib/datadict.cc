@@ -24,12 +24,15 @@ typedef struct _element_registry_struct_ {
 /*
  const char* DATADICTIONARY_VERSION = "DICOM PS3.6 2020c";
  const int SIZE_ELEMENT_REGISTRY = 4206;
+ const int SIZE_TAGS_XX_MASK = 5;
  const int SIZE_INDEX_TAGS_WITH_XX = 88;
  const int SIZE_INDEX_KEYWORD = 4202;
 
  static const ElementRegistry element_registry[] = {}
  static const tag_t tags_registry[] = {}
- static const int tags_xx_index[] = {}
+ static const tag_t tags_xx_mask[] = {}
+ static const tag_t tags_xx_index[] = {}
+ static const int keyword_hash_displacement[] = {}
  static const int keyword_index[] = {}
  */
 
@@ -140,19 +143,6 @@ const char *UID::uidvalue_to_uidname(const char *uidvalue) {
 
 // -----------------------------------------------------------------------------
 
-static int _compare_tag_xx(const char *a, char *b) {
-  while (*a) {
-    if (*a == 'x' || *a == *b) {
-      a++;
-      b++;
-    } else {
-      if (*a > *b) return 1;
-      if (*a < *b) return -1;
-    }
-  }
-  return 0;
-}
-
 // Search a Tag from Element Registry
 static ElementRegistry *_find_tag(tag_t key) {
   int imin, imax;
@@ -173,27 +163,27 @@ static ElementRegistry *_find_tag(tag_t key) {
   if ((imax == imin) && (tags_registry[imin] == key))
     return (ElementRegistry *)element_registry + imin;
 
-  // Try find key from 'int tags_xx_index[]'
+  // Try find (key & mask) from 'tag_t tags_xx_index[]' for each mask
 
-  imin = 0;
-  imax = SIZE_INDEX_TAGS_WITH_XX - 1;
-  char key_str[16];
-  sprintf(key_str, "(%04x,%04x)", TAG::group(key), TAG::element(key));
+  for (int i = 0; i < SIZE_TAGS_XX_MASK; i++) {
+    tag_t mask = tags_xx_mask[i * 2];
+    tag_t value = key & mask;
 
-  while (imin < imax) {
-    int imid = (imin + imax) / 2;
+    imin = int(tags_xx_mask[i * 2 + 1]);
+    imax = (i + 1 < SIZE_TAGS_XX_MASK ? int(tags_xx_mask[i * 2 + 3])
+                                      : SIZE_INDEX_TAGS_WITH_XX) - 1;
+    while (imin < imax) {
+      int imid = (imin + imax) / 2;
 
-    if (_compare_tag_xx(element_registry[tags_xx_index[imid]].tag_str,
-                        key_str) < 0)
-      imin = imid + 1;
-    else
-      imax = imid;
-  }
+      if (tags_xx_index[imid * 3 + 1] < value)
+        imin = imid + 1;
+      else
+        imax = imid;
+    }
 
-  if ((_compare_tag_xx(element_registry[tags_xx_index[imin]].tag_str,
-                       key_str) == 0) &&
-      (imax == imin))
-    return (ElementRegistry *)element_registry + tags_xx_index[imin];
+    if (tags_xx_index[imin * 3 + 1] == value)
+      return (ElementRegistry *)element_registry + tags_xx_index[imin * 3 + 2];
+  }
 
   // can't find tag from registry
 
@@ -240,21 +230,35 @@ const char *TAG::keyword(tag_t tag) {
   return "(Unknown Data Elements)";
 }
 
+// FNV-1a with `seed` mixed into the offset basis;
+// should be same with keyword_hash() in 'misc/codegen_builddict.py'.
+static inline uint32_t keyword_hash(const char *ptr, size_t size,
+                                    uint32_t seed) {
+  uint32_t hash = 0x811c9dc5 ^ seed;
+  while (size--) {
+    hash ^= uint32_t(uint8_t(*ptr++));
+    hash *= 0x1000193;
+  }
+  return hash;
+}
+
 // Element's Keyword -> Tag
 tag_t TAG::from_keyword(const char *keyword) {
-  int imin = 0, imax = SIZE_INDEX_KEYWORD - 1;
-  while (imin < imax) {
-    int imid = (imin + imax) / 2;
-    if (strcmp(element_registry[keyword_index[imid]].keyword, keyword) < 0)
-      imin = imid + 1;
-    else
-      imax = imid;
-  }
+  return from_keyword(keyword, strlen(keyword));
+}
 
-  if ((strcmp(element_registry[keyword_index[imin]].keyword, keyword) == 0) &&
-      (imax == imin)) {
-    return tags_registry[keyword_index[imin]];
-  } else
+tag_t TAG::from_keyword(const char *keyword, size_t size) {
+  // keyword_index[] is a minimal perfect hash table
+  int d = keyword_hash_displacement[keyword_hash(keyword, size, 0) %
+                                    SIZE_INDEX_KEYWORD];
+  int slot = (d < 0 ? -d - 1
+                    : int(keyword_hash(keyword, size, uint32_t(d)) %
+                          SIZE_INDEX_KEYWORD));
+
+  const char *found = element_registry[keyword_index[slot]].keyword;
+  if (strncmp(found, keyword, size) == 0 && found[size] == '\0')
+    return tags_registry[keyword_index[slot]];
+  else
     return 0xFFFFFFFF;
 }
 
@@ -367,7 +371,7 @@ vr_t VR::from_uint16le(uint16_t u)
 }
 
 std::string TAG::repr(tag_t tag) {
-  static char buf[16];
+  char buf[16];
   sprintf(buf, "(%04X,%04X)", TAG::group(tag), TAG::element(tag));
   return std::string(buf);
 }
@@ -1,9 +1,11 @@
-/* This data dictionary is generated from 'part06.html' by 'codegenerator_builddictionary.py' at 12:05AM on August 11, 2020.
+/* This data dictionary is generated from the rows of the previous 'datadict.inc.cxx' by 'codegen_builddict.py' at 03:16AM on October 17, 2026.
+ * The previous file was generated from 'part06.html' at 12:05AM on August 11, 2020.
  * 'part06.xml' is available at 'http://dicom.nema.org/medical/dicom/current/source/docbook/part06/part06.xml'.
  */
 
 const char* DATADICTIONARY_VERSION = "DICOM PS3.6 2020c";
 const int SIZE_ELEMENT_REGISTRY = 4844;
+const int SIZE_TAGS_XX_MASK = 5;
 const int SIZE_INDEX_TAGS_WITH_XX = 88;
 const int SIZE_INDEX_KEYWORD = 4838;
 
@@ -9701,4936 +9703,5357 @@ static const tag_t tags_registry[] = {
  /* 4843 */ 0xfffee0dd
 };
 
-static const int tags_xx_index[] = {
- /* (0020,31xx) */ 1558,
- /* (0028,04x0) */ 1974,
- /* (0028,04x1) */ 1975,
- /* (0028,04x2) */ 1976,
- /* (0028,04x3) */ 1977,
- /* (0028,08x0) */ 1987,
- /* (0028,08x2) */ 1988,
- /* (0028,08x3) */ 1989,
- /* (0028,08x4) */ 1990,
- /* (0028,08x8) */ 1991,
- /* (1000,xxx0) */ 3542,
- /* (1000,xxx1) */ 3543,
- /* (1000,xxx2) */ 3544,
- /* (1000,xxx3) */ 3545,
- /* (1000,xxx4) */ 3546,
- /* (1000,xxx5) */ 3547,
- /* (1010,xxxx) */ 3548,
- /* (50xx,0005) */ 4749,
- /* (50xx,0010) */ 4750,
- /* (50xx,0020) */ 4751,
- /* (50xx,0022) */ 4752,
- /* (50xx,0030) */ 4753,
- /* (50xx,0040) */ 4754,
- /* (50xx,0103) */ 4755,
- /* (50xx,0104) */ 4756,
- /* (50xx,0105) */ 4757,
- /* (50xx,0106) */ 4758,
- /* (50xx,0110) */ 4759,
- /* (50xx,0112) */ 4760,
- /* (50xx,0114) */ 4761,
- /* (50xx,1001) */ 4762,
- /* (50xx,2000) */ 4763,
- /* (50xx,2002) */ 4764,
- /* (50xx,2004) */ 4765,
- /* (50xx,2006) */ 4766,
- /* (50xx,2008) */ 4767,
- /* (50xx,200A) */ 4768,
- /* (50xx,200C) */ 4769,
- /* (50xx,200E) */ 4770,
- /* (50xx,2500) */ 4771,
- /* (50xx,2600) */ 4772,
- /* (50xx,2610) */ 4773,
- /* (50xx,3000) */ 4774,
- /* (60xx,0010) */ 4786,
- /* (60xx,0011) */ 4787,
- /* (60xx,0012) */ 4788,
- /* (60xx,0015) */ 4789,
- /* (60xx,0022) */ 4790,
- /* (60xx,0040) */ 4791,
- /* (60xx,0045) */ 4792,
- /* (60xx,0050) */ 4793,
- /* (60xx,0051) */ 4794,
- /* (60xx,0052) */ 4795,
- /* (60xx,0060) */ 4796,
- /* (60xx,0061) */ 4797,
- /* (60xx,0062) */ 4798,
- /* (60xx,0063) */ 4799,
- /* (60xx,0066) */ 4800,
- /* (60xx,0068) */ 4801,
- /* (60xx,0069) */ 4802,
- /* (60xx,0100) */ 4803,
- /* (60xx,0102) */ 4804,
- /* (60xx,0110) */ 4805,
- /* (60xx,0200) */ 4806,
- /* (60xx,0800) */ 4807,
- /* (60xx,0802) */ 4808,
- /* (60xx,0803) */ 4809,
- /* (60xx,0804) */ 4810,
- /* (60xx,1001) */ 4811,
- /* (60xx,1100) */ 4812,
- /* (60xx,1101) */ 4813,
- /* (60xx,1102) */ 4814,
- /* (60xx,1103) */ 4815,
- /* (60xx,1200) */ 4816,
- /* (60xx,1201) */ 4817,
- /* (60xx,1202) */ 4818,
- /* (60xx,1203) */ 4819,
- /* (60xx,1301) */ 4820,
- /* (60xx,1302) */ 4821,
- /* (60xx,1303) */ 4822,
- /* (60xx,1500) */ 4823,
- /* (60xx,3000) */ 4824,
- /* (60xx,4000) */ 4825,
- /* (7Fxx,0010) */ 4834,
- /* (7Fxx,0011) */ 4835,
- /* (7Fxx,0020) */ 4836,
- /* (7Fxx,0030) */ 4837,
- /* (7Fxx,0040) */ 4838
+// distinct masks of tags with 'x', e.g. 0xff00ffff for (60xx,3000), and
+// the first row in tags_xx_index[] with the mask.
+static const tag_t tags_xx_mask[] = {
+ 0xffffff0f,   0,
+ 0xff01ffff,   9,
+ 0xffffff00,  80,
+ 0xffff000f,  81,
+ 0xffff0000,  87
 };
 
+// (mask, tag & mask, index to element_registry) sorted by mask, as in
+// tags_xx_mask[], and then by value.
+static const tag_t tags_xx_index[] = {
+ /* (0028,04x0) */ 0xffffff0f, 0x00280400, 1974,
+ /* (0028,04x1) */ 0xffffff0f, 0x00280401, 1975,
+ /* (0028,04x2) */ 0xffffff0f, 0x00280402, 1976,
+ /* (0028,04x3) */ 0xffffff0f, 0x00280403, 1977,
+ /* (0028,08x0) */ 0xffffff0f, 0x00280800, 1987,
+ /* (0028,08x2) */ 0xffffff0f, 0x00280802, 1988,
+ /* (0028,08x3) */ 0xffffff0f, 0x00280803, 1989,
+ /* (0028,08x4) */ 0xffffff0f, 0x00280804, 1990,
+ /* (0028,08x8) */ 0xffffff0f, 0x00280808, 1991,
+ /* (50xx,0005) */ 0xff01ffff, 0x50000005, 4749,
+ /* (50xx,0010) */ 0xff01ffff, 0x50000010, 4750,
+ /* (50xx,0020) */ 0xff01ffff, 0x50000020, 4751,
+ /* (50xx,0022) */ 0xff01ffff, 0x50000022, 4752,
+ /* (50xx,0030) */ 0xff01ffff, 0x50000030, 4753,
+ /* (50xx,0040) */ 0xff01ffff, 0x50000040, 4754,
+ /* (50xx,0103) */ 0xff01ffff, 0x50000103, 4755,
+ /* (50xx,0104) */ 0xff01ffff, 0x50000104, 4756,
+ /* (50xx,0105) */ 0xff01ffff, 0x50000105, 4757,
+ /* (50xx,0106) */ 0xff01ffff, 0x50000106, 4758,
+ /* (50xx,0110) */ 0xff01ffff, 0x50000110, 4759,
+ /* (50xx,0112) */ 0xff01ffff, 0x50000112, 4760,
+ /* (50xx,0114) */ 0xff01ffff, 0x50000114, 4761,
+ /* (50xx,1001) */ 0xff01ffff, 0x50001001, 4762,
+ /* (50xx,2000) */ 0xff01ffff, 0x50002000, 4763,
+ /* (50xx,2002) */ 0xff01ffff, 0x50002002, 4764,
+ /* (50xx,2004) */ 0xff01ffff, 0x50002004, 4765,
+ /* (50xx,2006) */ 0xff01ffff, 0x50002006, 4766,
+ /* (50xx,2008) */ 0xff01ffff, 0x50002008, 4767,
+ /* (50xx,200A) */ 0xff01ffff, 0x5000200a, 4768,
+ /* (50xx,200C) */ 0xff01ffff, 0x5000200c, 4769,
+ /* (50xx,200E) */ 0xff01ffff, 0x5000200e, 4770,
+ /* (50xx,2500) */ 0xff01ffff, 0x50002500, 4771,
+ /* (50xx,2600) */ 0xff01ffff, 0x50002600, 4772,
+ /* (50xx,2610) */ 0xff01ffff, 0x50002610, 4773,
+ /* (50xx,3000) */ 0xff01ffff, 0x50003000, 4774,
+ /* (60xx,0010) */ 0xff01ffff, 0x60000010, 4786,
+ /* (60xx,0011) */ 0xff01ffff, 0x60000011, 4787,
+ /* (60xx,0012) */ 0xff01ffff, 0x60000012, 4788,
+ /* (60xx,0015) */ 0xff01ffff, 0x60000015, 4789,
+ /* (60xx,0022) */ 0xff01ffff, 0x60000022, 4790,
+ /* (60xx,0040) */ 0xff01ffff, 0x60000040, 4791,
+ /* (60xx,0045) */ 0xff01ffff, 0x60000045, 4792,
+ /* (60xx,0050) */ 0xff01ffff, 0x60000050, 4793,
+ /* (60xx,0051) */ 0xff01ffff, 0x60000051, 4794,
+ /* (60xx,0052) */ 0xff01ffff, 0x60000052, 4795,
+ /* (60xx,0060) */ 0xff01ffff, 0x60000060, 4796,
+ /* (60xx,0061) */ 0xff01ffff, 0x60000061, 4797,
+ /* (60xx,0062) */ 0xff01ffff, 0x60000062, 4798,
+ /* (60xx,0063) */ 0xff01ffff, 0x60000063, 4799,
+ /* (60xx,0066) */ 0xff01ffff, 0x60000066, 4800,
+ /* (60xx,0068) */ 0xff01ffff, 0x60000068, 4801,
+ /* (60xx,0069) */ 0xff01ffff, 0x60000069, 4802,
+ /* (60xx,0100) */ 0xff01ffff, 0x60000100, 4803,
+ /* (60xx,0102) */ 0xff01ffff, 0x60000102, 4804,
+ /* (60xx,0110) */ 0xff01ffff, 0x60000110, 4805,
+ /* (60xx,0200) */ 0xff01ffff, 0x60000200, 4806,
+ /* (60xx,0800) */ 0xff01ffff, 0x60000800, 4807,
+ /* (60xx,0802) */ 0xff01ffff, 0x60000802, 4808,
+ /* (60xx,0803) */ 0xff01ffff, 0x60000803, 4809,
+ /* (60xx,0804) */ 0xff01ffff, 0x60000804, 4810,
+ /* (60xx,1001) */ 0xff01ffff, 0x60001001, 4811,
+ /* (60xx,1100) */ 0xff01ffff, 0x60001100, 4812,
+ /* (60xx,1101) */ 0xff01ffff, 0x60001101, 4813,
+ /* (60xx,1102) */ 0xff01ffff, 0x60001102, 4814,
+ /* (60xx,1103) */ 0xff01ffff, 0x60001103, 4815,
+ /* (60xx,1200) */ 0xff01ffff, 0x60001200, 4816,
+ /* (60xx,1201) */ 0xff01ffff, 0x60001201, 4817,
+ /* (60xx,1202) */ 0xff01ffff, 0x60001202, 4818,
+ /* (60xx,1203) */ 0xff01ffff, 0x60001203, 4819,
+ /* (60xx,1301) */ 0xff01ffff, 0x60001301, 4820,
+ /* (60xx,1302) */ 0xff01ffff, 0x60001302, 4821,
+ /* (60xx,1303) */ 0xff01ffff, 0x60001303, 4822,
+ /* (60xx,1500) */ 0xff01ffff, 0x60001500, 4823,
+ /* (60xx,3000) */ 0xff01ffff, 0x60003000, 4824,
+ /* (60xx,4000) */ 0xff01ffff, 0x60004000, 4825,
+ /* (7Fxx,0010) */ 0xff01ffff, 0x7f000010, 4834,
+ /* (7Fxx,0011) */ 0xff01ffff, 0x7f000011, 4835,
+ /* (7Fxx,0020) */ 0xff01ffff, 0x7f000020, 4836,
+ /* (7Fxx,0030) */ 0xff01ffff, 0x7f000030, 4837,
+ /* (7Fxx,0040) */ 0xff01ffff, 0x7f000040, 4838,
+ /* (0020,31xx) */ 0xffffff00, 0x00203100, 1558,
+ /* (1000,xxx0) */ 0xffff000f, 0x10000000, 3542,
+ /* (1000,xxx1) */ 0xffff000f, 0x10000001, 3543,
+ /* (1000,xxx2) */ 0xffff000f, 0x10000002, 3544,
+ /* (1000,xxx3) */ 0xffff000f, 0x10000003, 3545,
+ /* (1000,xxx4) */ 0xffff000f, 0x10000004, 3546,
+ /* (1000,xxx5) */ 0xffff000f, 0x10000005, 3547,
+ /* (1010,xxxx) */ 0xffff0000, 0x10100000, 3548
+};
+
+// minimal perfect hash of keywords; see keyword_hash() in 'datadict.cc'.
+static const int keyword_hash_displacement[] = {
+     0,     0,     2,     1, -4838,     0,     0,     3, -4835, -4831,     1,     0,
+ -4828, -4826,     0,     0, -4825,     1, -4824,     0,     0,     0,     0,     0,
+     0,     0, -4823,     0, -4819, -4816,     0,     1, -4811,     0,     0, -4808,
+ -4806,     1,     3,     1, -4805,     1, -4802,     1,     0, -4801,     1,     1,
+ -4795,     1,     1,     1,     1,     0, -4793,     0,     0,     1, -4790,     0,
+     1,     1,     0,     0, -4786,     0,     0,     1, -4785,     1, -4784, -4782,
+     0, -4780,     1, -4779, -4777, -4776,     1,     1,     6,     2, -4774,     2,
+     0,     0,     1, -4772, -4771, -4769,     0, -4768, -4765, -4764, -4762,     0,
+     0, -4761, -4759, -4758,     0, -4757,     0, -4752,     2,     0,     0,     0,
+     2,     3,     0,     0,     1,     0, -4751,     0,     1,     0, -4750, -4748,
+ -4747,     2, -4745,     1,     0,     2,     0, -4740, -4737, -4736,     0,     2,
+     0,     1,     0,     2,     0,     0,     1,     3,     0,     0,     0,     1,
+     0,     0, -4735, -4733, -4730, -4724,     2, -4722,     0,     1, -4718, -4713,
+ -4711, -4706,     0,     1,     1,     0, -4704,     2, -4700, -4699,     0, -4697,
+     1,     0, -4695,     0, -4694,     0,     0,     0,     1, -4693, -4687, -4686,
+ -4681,     0,     1, -4680,     0, -4679,     0,     0, -4678,     1, -4677,     3,
+     0,     0,     0,     0, -4676,     0,     0, -4673,     1,     1,     0, -4671,
+     0, -4670,     0, -4669,     0,     2,     0, -4668,     0, -4666,     0,     0,
+     0,     1,     0,     0,     0, -4665, -4660,     0, -4655,     0,     2,     2,
+     0,     0,     2,     1,     0, -4652,     0, -4649, -4648,     1, -4638,     0,
+ -4637, -4635, -4634, -4632,     0, -4630,     0,     0,     1,     0, -4622, -4620,
+     0,     1, -4617,     1,     0,     0, -4614,     0,     0,     1, -4605,     2,
+     0,     0,     0,     0,     0,     1,     1, -4604,     0, -4602,     6, -4599,
+ -4598, -4597, -4596,     0, -4592,     0,     0,     0,     0,     0, -4591,     2,
+     0,     2, -4588, -4587,     0, -4585,     0,     0,     2, -4583, -4581, -4580,
+     0,     0, -4572,     0, -4569,     0,     1,     1,     1, -4564,     1,     0,
+     1,     0, -4563,     1,     0,     1,     1, -4562,     0, -4560,     2,     6,
+ -4559,     0, -4554,     4, -4550, -4546, -4545, -4544,     0,     4,     2, -4543,
+     0, -4542,     1,     1,     2, -4541, -4540, -4539,     0, -4538,     0, -4536,
+     1,     0,     0, -4534, -4532, -4530,     0, -4528,     2,     0,     3,     5,
+     0,     0,     3, -4525, -4523,     2,     0,     0, -4522,     0,     1,     2,
+ -4517, -4515,     0, -4511, -4508,     2, -4507,     0, -4506,     1,     4, -4505,
+ -4498,     0,     2, -4497, -4496, -4491,     0, -4485, -4484,     0,     3, -4483,
+     0, -4481,     0, -4477,     1,     0,     4,     0,     0,     0,     2, -4475,
+ -4474, -4473, -4471,     2, -4469,     1,     0, -4462,     0,     1,     0,     0,
+     0,     0,     1,     2,     3, -4458, -4453, -4451,     0, -4445,     2, -4439,
+     4,     1,     1, -4435, -4432, -4429,     0, -4428, -4427,     2, -4423,     3,
+ -4421,     1, -4420,     7, -4413, -4410, -4409,     0,     0,     1,     0,     0,
+     0,     0, -4407,     0, -4404, -4402, -4400,     0, -4393, -4392, -4387,     0,
+     2, -4385, -4382, -4380, -4379,     0, -4377, -4373,     0, -4369,     1,     0,
+ -4365,     0,     2, -4364, -4362,     1, -4360,     0, -4358,     1,     1,     0,
+     0,     1,     0,     2,     0,     0,     0, -4356,     0, -4355,     2,     1,
+     1,     0,     0,     0,     0, -4354,     0, -4353,     0, -4351, -4350,     0,
+ -4349,     0, -4345,     0, -4344,     0,     2,     0,     2, -4340,     2,     0,
+     0, -4339,     1,     0, -4335,     1, -4334, -4333,     0,     0,     0,     0,
+ -4330,     0, -4325,     0,     4, -4318, -4317, -4313,     0,     1, -4311,     0,
+ -4309, -4307,     1, -4306, -4302,     1,     0,     1,     0,     0, -4301, -4300,
+     1,     1, -4296, -4295,     1,     1, -4294,     0, -4293,     7,     1,     0,
+     0,     0, -4292, -4290,     1,     0, -4289,     0,     0,     3,     0,     0,
+ -4287, -4286, -4282, -4279, -4278, -4276,     1, -4272, -4270,     0,     0,     0,
+     0,     0, -4265,     1, -4263,     0,     2, -4261, -4244,     2, -4238,     0,
+ -4236,     3, -4235, -4233, -4228,     0,     0, -4227,     2,     0, -4226,     0,
+     0,     0, -4223, -4220,     0,     1, -4219,     0,     0, -4218,     1,     2,
+     0,     1,     0, -4209,     0, -4207,     0,     0, -4205,     3,     2, -4198,
+     0, -4197, -4195,     1, -4191, -4188,     0,     1, -4184,     0,     0, -4183,
+     0,     2,     1,     0,     1,     0, -4182, -4177, -4176,     0,     0, -4173,
+     3,     0, -4170,     0, -4167, -4165, -4162, -4152, -4148, -4145, -4144, -4141,
+ -4133, -4132,     0,     0, -4131, -4128, -4123, -4120,     0,     2,     0,     1,
+     2, -4119, -4118,     6, -4116,     1, -4112,     0,     0,     0,     3,     0,
+     0, -4111, -4107, -4105, -4104,     0,     0,     0, -4103,     0,     2,     0,
+     0,     2,     0,     0,     2,     0,     0,     1,     0,     0,     0,     7,
+     1,     0,     0,     0,     0, -4101,     0, -4100,     1,     0,     0, -4098,
+     1, -4094,     1,     0, -4092,     0,     0,     2, -4090,     0,     0, -4089,
+     0,     0, -4088,     0, -4087,     0,     0,     1,     0, -4071,     0, -4069,
+     0,     0,     0,     1, -4068,     0,     0,     0, -4061,     0, -4060,     0,
+     0, -4058,     0,     3,     0,     2,     0, -4057,     0, -4054,     2, -4049,
+ -4047, -4040,     0, -4039,     1,     1,     2,     3,     1,     0, -4032,     1,
+ -4030,     0, -4029,     0, -4027,     1, -4020, -4019,     0,     3, -4018, -4012,
+     3, -4010,     1, -4007,     0, -4003,     1,     3,     0,     0,     0,     3,
+     8,     0, -4002,     0,     1, -3996,     2,     2, -3993,     2, -3991,     0,
+ -3989,     0,     1, -3985,     0,     3, -3981,     0, -3978, -3977, -3973, -3971,
+     0,     0,     0,     2, -3970,     0, -3969,     0, -3967, -3962,     0,     1,
+     0,     1, -3961,     1,     0,     0, -3959,     2,     1,     0, -3957,     1,
+     2, -3956,     0,     0, -3955,     4,     0, -3954,     1,     2, -3953,     0,
+     1,     1, -3951,     2,     0, -3949,     0,     0, -3947,     2,     0,     0,
+ -3946, -3943, -3937,     0,     0,     1, -3934, -3931,     0,     1,     0, -3930,
+     0,     0, -3924,     0,     1,     5,     0,     0,     5,     0,     0,     1,
+     0, -3923,     0,     0,     0, -3921,     2,     0,     0, -3920,     0, -3915,
+     0,     1,     5,     1, -3908, -3906,     0,     1,     0, -3904,     1,     0,
+ -3895,     0, -3894,     0,     7,     2,     0,     0, -3891,     0,     2, -3887,
+ -3886, -3884,     0, -3882, -3880,     0, -3879,     2,     0,     4,     5,     0,
+ -3874,     1, -3871, -3868, -3866,     0,     1, -3856,     2,     0,     0,     0,
+     1,     0,     2, -3855,     0,     1,     1, -3848, -3847, -3844,     0,     0,
+     0, -3841,     1,     1,     0,     4, -3836, -3832,     1,     0,     4, -3831,
+     0,     1, -3828,     0, -3827, -3826,     0, -3824, -3822,     6, -3819,     0,
+     1,     0, -3814,     1, -3812, -3810, -3806,     0,     1,     0,     2,     0,
+ -3805, -3804, -3803,     0,     0, -3802,     2, -3799, -3797,     1,     0, -3796,
+ -3795,     0,     0, -3790, -3786,     0,     4,     1, -3785, -3783,     0,     2,
+     0, -3782, -3780,     2, -3777,     0,     2,     0,     0,     1,     1,     4,
+     0, -3775,     6,     0,     0, -3774, -3770,     2, -3768,     2, -3767,     4,
+     1,     0,     1, -3766,     0, -3764, -3760,     3,     3, -3759,     2, -3757,
+ -3755,     1, -3754,     0,     1,     0,     0,     0, -3741,     3,     1, -3739,
+ -3738,     0,     0,     7, -3737,     0,     0,     0, -3736,     0, -3735, -3731,
+     1, -3729,     1,     2,     3,     1,     0, -3727,     2,     3,     3, -3724,
+     2,     0, -3722,     1, -3718, -3717, -3715, -3710, -3703,     2, -3702, -3700,
+     3,     1, -3695,     2, -3688, -3684,     0,     0,     0,     2, -3682,     0,
+     0, -3681,     1,     3, -3679,     1, -3677,     0,     1, -3670, -3669,     1,
+ -3667,     0, -3666,     2,     0,     5,     0, -3665, -3663, -3661,     0, -3660,
+ -3654, -3652,     0, -3651, -3649, -3648,     1, -3647,     0, -3646,     0,     0,
+     1,     2,     1, -3645,     0,     0,     0, -3642,     2,     0, -3640,     0,
+     2,     0,     0,     1,     0,     0,     3,     0,     1,     0,     0,     0,
+ -3632,     1,     0, -3629,     2,     1,     0,     1,     2, -3626, -3625,     0,
+     1, -3624, -3621,     0,     0,     0,     2,     1,     2,     0, -3614,     1,
+ -3613,     1,     1, -3612, -3611,     0,     1,     1, -3608, -3606, -3604, -3603,
+ -3599, -3598,     2, -3595, -3594, -3592, -3591,     0, -3590,     2, -3589, -3584,
+ -3583, -3581,     1, -3580, -3578,     4, -3577,     1,     0,     0, -3573,     0,
+ -3572,     1,     1, -3571,     2,     0,     2, -3566, -3565,     4,     0, -3562,
+ -3555,     0, -3548,     0,     0,     1,     2, -3542,     2, -3540, -3539,     0,
+     0,     0, -3538,     0,     1, -3534,     0, -3531,     0,     0,     0, -3530,
+     0,     0, -3529,     0, -3527, -3526,     1,     0,     0,     0, -3525,     2,
+ -3521,     3,     0,     0, -3517, -3516,     2,     0,     0, -3508,     1,     0,
+     0,     0,     0,     0, -3506, -3504,     0,     0,     2, -3497,     2, -3496,
+     0, -3495, -3494,     3,     0, -3493,     1,     0,     3, -3492, -3490, -3484,
+     3,     1,     0, -3482, -3480,     0,     0,     0, -3478,     0, -3474,     0,
+     0, -3472,     1,     0, -3471, -3465,     1, -3461, -3459, -3458, -3455,     0,
+     0,     2,     2,     3,     0,     0, -3454, -3450,     1, -3443,     0,     0,
+     0,     2,     0,     2,     0,     0,     2, -3440, -3435, -3430,     1,     0,
+     0,     0,     1, -3429, -3428, -3422,     1,     4,     1, -3420, -3419,     0,
+ -3416,     1,     0,     0, -3415, -3412,     1,     2,     0,     0, -3410, -3409,
+     1, -3407,     0, -3405,     0,     0, -3404,     0,     2,     0,     1,     0,
+     0, -3403, -3400,     2,     4,     1,     0, -3399,     3,     2, -3398,     2,
+     1,     0,     0, -3395,     0,     0,     0,     0,     0, -3394,     2, -3391,
+     3,     2, -3378, -3372,     0,     0,     0,     0,     0,     5, -3364, -3359,
+     0,     0, -3357,     4, -3356,     0,     0,     0, -3352,     1, -3345, -3343,
+ -3332, -3329,     1,     0,     0, -3328,     1, -3326,     0, -3325,     0,     0,
+     0,     0,     0,     0, -3324,     0,     0,     2,     0,     3,     1, -3318,
+     3,     0,     0,     0,     1,     0,     3,     2,     1,     2, -3315, -3313,
+     3,     1, -3306, -3302,     0,     0,     0,     0, -3299, -3295, -3293,     9,
+     1, -3292,     0,     0,     0,     0,     0,     5, -3290,     6, -3287,     0,
+ -3284, -3283,     0,     1,     0,     1, -3281,     1,     0, -3279,     1,     3,
+     0,     0,     0,     0, -3276, -3268,     0,     5,     0, -3262, -3261,     1,
+     6,     1,     2,     0,     0, -3260,     0,     0,     0, -3256,     7,     1,
+ -3255,     2,     0,     0,     0,     0,     0,     3,     1, -3254,     0,     0,
+ -3252, -3248,     0,     0, -3246,     1,     1, -3245,     2,     0,     0,     0,
+     0,     5,     2,     0, -3238,     5, -3227,     2,     0, -3224,     1, -3220,
+     5, -3218,     0,     2, -3217,     1,     0,     1,     3,     0,     0,     0,
+     0, -3215,     1, -3214,     4,     1, -3213, -3211, -3209,     0, -3205,     0,
+     3,     0, -3204,     0, -3203, -3200, -3199, -3193,     0,     1,     0,     5,
+     0,     0,     3,     1, -3191, -3189,     0, -3187,     0,     0,     0,     0,
+     2, -3185, -3182,     1,     0,     0,     1,     0, -3180, -3177,     2, -3175,
+ -3172,     0, -3167,     0,     1,     2,     0,     0,     4,     0,     0,     0,
+     0,     1,     0,     0,     1,     0, -3163,     2, -3157, -3155,     1, -3154,
+     0,     1,     1, -3153,     4, -3146,     0, -3141, -3136, -3133,     1,     2,
+     0,     0,     0, -3131,     3,     0,     0,     1, -3130, -3125, -3123,     0,
+     1, -3122, -3121, -3120,     4,     0, -3114, -3110, -3108,     0,     1,     1,
+     0, -3099,     0,     0, -3097,     3,     1,     2, -3095,     0,     0, -3094,
+     0,     1,     0, -3091, -3090,     0, -3084, -3081, -3080,     0, -3078,     0,
+     0,     0,     0,     0, -3070,     4,     7,     1,     0,     0,     5,     2,
+ -3067, -3066, -3063,     0,     1,     0, -3061, -3060, -3059,     1, -3057,     0,
+     0,     1, -3054,     0,     1, -3053,     1,     1, -3050,     0,     0,     0,
+ -3045, -3042,     0,     0,     1,     1,     0,     7,     0,     1,     0, -3036,
+    12, -3034, -3033,     1,     0,     1,     0, -3032,     4,     1, -3029,     5,
+ -3028,     0, -3026,     1, -3023,     0,     0, -3022, -3021,     2,     0, -3018,
+ -3017, -3014,     0,     1,     2,     2,     1,     0, -3012,     0, -3009, -3006,
+     2,     0, -3005, -3004, -3003,     0,     0, -3002,     2,     0, -2999,     0,
+     0, -2996,     3, -2990,     0,     0,     0,     1,     1,     0, -2985,     0,
+ -2983,     0,     4, -2980,     0, -2978, -2977,     3, -2975, -2973,     2,     1,
+     0,     0, -2967,     0,     3,     0,     2,     0,     1, -2965, -2963,     0,
+ -2959,     0,     0,     0,     0, -2952,     0,     1,     0,     0,     6,     0,
+     4,     3, -2947,     0,     0, -2946,     1,     0, -2943, -2940,     0,     0,
+ -2939,     0, -2933,     1, -2926,     1,     0,     0, -2925,     1,     2, -2923,
+     0,     0,     0,     3,     0,     1,     0,     0, -2919, -2915,     1, -2914,
+     1,     0,     1,     3,     0,     6,     3,     0, -2910, -2909,     0,     0,
+ -2908,     1,     0,     3, -2906,     2,     0,     0, -2904,    12,     1,     5,
+ -2900,     0, -2898,     5,     0,     2,     0, -2896,     2, -2893,     0,     4,
+     6, -2890,     0, -2889, -2885, -2882,     1,     0,     3, -2878,     2,     0,
+     3, -2877, -2876,     0,     0,     0,     0,     1, -2875,     0, -2873,     1,
+     6, -2872,     0,     0,     2, -2870, -2869, -2868,     3,     3,     3,     0,
+ -2867,     0, -2864,     0,     2,     0,     0,     0,     5, -2861,     0,     1,
+ -2859,     0,     2, -2857,     4, -2850, -2844,     3, -2841,     0,     1,     0,
+ -2833,     0,     1,     0,     0,     0,     2,     0, -2830,     0,     0,     0,
+     3,     0, -2828,     0,     0, -2827,     0,     4,     3, -2825,     1,     0,
+     0,     0, -2824,     0,     1,     0, -2820,     4,     0,     1, -2819, -2818,
+     0,     3, -2817,     1,     0, -2815,     1, -2814,     0, -2812,     0,     1,
+     1,     0,     8, -2808,     0,     2,     1,     4, -2801,     2, -2796, -2792,
+     1, -2789,     0,     3,     0,     1,     1, -2788,    12,     2, -2785, -2784,
+     0, -2783,     0,     0, -2781,     0, -2780, -2777, -2774,     0,     0, -2772,
+     0, -2768,     1,     1,     0,     0,     2,     0, -2767,     0, -2766,     2,
+ -2765,     0,     0,     0, -2764,     0,     0, -2763, -2761, -2756,     1, -2748,
+     0, -2742,     1,     2,     1,     0, -2741,     6, -2734,     0,     1,     0,
+ -2732, -2731,     7,     0,     0,     3,     0, -2727,     0, -2723, -2717, -2711,
+     0, -2710, -2703,     0,     0,     0, -2702,     0,     0,     0,     0, -2701,
+     5,     0,     0, -2699,     0,     0, -2698, -2696, -2694, -2692,     0, -2691,
+ -2690,     1, -2685, -2684,     1,     0, -2683, -2682,     0,     8,     0,     3,
+ -2681,     2, -2680,     0,     3,     3, -2678, -2676,     0,     1, -2674,     0,
+     0, -2673, -2672,     0,     3, -2668, -2665,     1,     3, -2663, -2656,     0,
+     5,     2,     0,     0, -2655,     1,     1,     0, -2654,     2,     0, -2653,
+     0, -2651,     3,     1, -2644,     1, -2643,     2,     4,     0, -2642, -2639,
+ -2637,     1, -2634,     1, -2633,     2,     0,     1,     1,     0,     0,     1,
+ -2630, -2625, -2624, -2622,     0,     1, -2621, -2617,     0,     0,     0,     0,
+     2,     1,     3, -2614,     2,     1,     0, -2613,     3, -2600, -2599,     0,
+     0,     0, -2598, -2597,     0,     0,     0,     1, -2595,     0,     2, -2594,
+ -2586,     0,     0,     0, -2585,     0,     6, -2583,     0, -2582, -2579, -2578,
+     9, -2574,     0,     1,     1,     0, -2571, -2570, -2569, -2566,     2,     1,
+     0,     0, -2565,     1,     0, -2559, -2558,     0, -2555,     0,     0,     6,
+ -2551,     1,     0,     0, -2550, -2548,     0, -2547,     0,     0, -2546, -2544,
+     0,     0, -2543,     0, -2542, -2541, -2539, -2536,     2, -2534, -2532,     4,
+     1,     0, -2531,     0, -2530, -2528,     0,     0, -2527, -2526,     3, -2525,
+ -2523,     0,     2, -2514,     0, -2512, -2511,     1,     0, -2508,     0,     0,
+ -2507, -2506, -2499,     0,     0,     3,     4,     0, -2497,     0, -2495,     0,
+     0, -2494,     0,     2, -2493,     4,     0, -2489,     0,     1,     1, -2488,
+ -2487,     0, -2484,     0,     3,     1,     0,     0, -2480,     0, -2479,     0,
+     0,     3,     0,     0,     0,     0,     2,     1,     0,     0,     1, -2474,
+ -2470,     0,     0, -2466,     0,     0, -2465,     0,     3, -2461,     1,     0,
+ -2460,     5, -2459,     8, -2458, -2455, -2449,     0,     0,     0,     0,     9,
+ -2448,     0, -2447, -2446, -2440,     2,     0, -2436,     4, -2434,     1,     0,
+ -2433,     0,     3,     0,     0, -2432, -2430, -2425, -2423, -2422,     9,     0,
+     3, -2419, -2415,     0,     3,    13, -2413,     0, -2412, -2406, -2405, -2400,
+     0,     0, -2399,     0, -2397,     0,     1,     0, -2395,     2, -2394,     1,
+     1,     0, -2392,     0,     0,     2, -2382,     0, -2379, -2377,     1, -2376,
+     1,     2,     1,     2, -2374,     0,     0,     0, -2373,     5,     5,     0,
+     0,     0, -2371,     2,     7,     0, -2370,     0, -2368,     0, -2360,     0,
+ -2358,     0,     4,     0,     1, -2356,     0,     0,     4,     1,     0,     1,
+ -2355, -2351, -2349, -2348, -2347, -2346,     0,     0,     0, -2345, -2342,     0,
+ -2330,     2, -2329,     1,     0, -2324,     0,     1, -2323, -2320,     0, -2319,
+ -2318, -2313,     0, -2310,     0, -2309,     0, -2304, -2303, -2299,     5,     2,
+ -2296,     0,     2, -2295,     0, -2291,     0,     0, -2282,     7,     0,     0,
+     1,     5, -2277, -2276, -2275,     0,     1,     1,     0, -2272,     0,     2,
+ -2271,     0, -2270,     0,     0,     6, -2269,     2,     2,     6,     0,     3,
+ -2260, -2259,     2,     1, -2258,     2,     0, -2257, -2256, -2255,     4,     0,
+ -2252, -2248,     9,     3,     0,     0,     1,     0, -2244,     2,     5,     0,
+     0, -2241,     0, -2240,     0,     4,     3,     0,     0,     0,     0,     0,
+ -2238, -2237,     0,     0, -2236, -2233,     1, -2232, -2229, -2227, -2225,     0,
+ -2223, -2213,     0, -2210,     1, -2209,     0,     0,     3,     4, -2204,     0,
+     7,     0, -2203,     4,     0, -2199, -2198, -2192,     0, -2187, -2183, -2181,
+     0,     0, -2180,     1,     0,     1,     0,     0,     0, -2178, -2172, -2171,
+     0,     1, -2167,     6, -2164,     1,     0,     0, -2158,     3, -2155, -2151,
+     3,     0,     3, -2149,     4,    10,     1, -2146,     0,     1, -2144,     0,
+     0,     0, -2142,     0,     0,     2,     1,     0,     0,     3, -2137,     0,
+     1,     1, -2136,     0, -2135,     0, -2131,     0,     1,     0,     9,     0,
+     1, -2123,     0,     6,     0,     4, -2121,     0,     6,     0,     1,     3,
+     1,     0,     1,     0,     0,     0, -2119,     0,     7,     2,     0,     0,
+     1, -2118, -2116,     0,     0,     4,     2,     0,     0,     0, -2111,     0,
+     0, -2110, -2108, -2106, -2102, -2101,     0, -2094,     0,    14, -2092, -2086,
+     0,     1,     4, -2082, -2081,     0,     0, -2080, -2077,     1,     0,     1,
+     0,     0,     0,     0,     0,     2,     0,     0,     0, -2075,     3, -2074,
+     0,     0, -2068, -2065,     1,     0,     0,     2, -2061,     1, -2058,     0,
+     0,     0,     0, -2057,     2,     1,     5,     0,     1,     0,     4,     1,
+ -2055,     1,     4,     0,     0,     0,     0,     1, -2053,     0, -2051, -2048,
+     0,     9,     0,     1,     0,     2,     0,     0, -2047,     0,     0,     0,
+     0, -2046, -2045,     8, -2043, -2040, -2033, -2032,     0,     0,     1, -2031,
+ -2030,     0,     2,     4, -2027, -2024,     0, -2023, -2022,     0, -2021,     0,
+    14,     0,     1,     0, -2020, -2018,     0, -2009,     0, -2006,     2,     2,
+ -2005,     0, -2000,     0, -1997,     2, -1996,     0, -1994,     0,     0,     0,
+ -1993,     0, -1992, -1990, -1988,     0,     0,     0,     0,     0, -1987,     0,
+     0,     0, -1986,     0,     0,     0,     0, -1984,     3,     0,     8,     0,
+     4,     0,     0, -1974,     0,     0,     0,     0,     0,     1,     0,     1,
+     1,     5,     0, -1973,     1,     0,     6, -1968,     0, -1966,     0, -1965,
+ -1964,     1, -1963,     1,     0,     0,     0, -1954,     0, -1952, -1950, -1940,
+ -1939,    11, -1937, -1934,     1, -1929,     3,     2, -1926,     5,     8,     6,
+     0, -1920, -1914, -1913,     0,     0,     2, -1908,     0,     1, -1906, -1896,
+ -1895,     1, -1890, -1887,     5, -1886,     0, -1885,     3,     1, -1884,     0,
+     4,     0, -1883,     4, -1881,     0,     1,     0,     0,     1,     3,     1,
+ -1880, -1879, -1878,     2,     0,     1,     0,     0,     1,     0, -1875,     0,
+     1, -1872,     2, -1871,     2, -1861,     1,     0,     0,     0,     2, -1859,
+ -1856,     0,     5, -1849, -1847,     0, -1845,     0, -1843,     0, -1841, -1838,
+ -1837,     0, -1827, -1823, -1819,     0,     4,     1, -1816,     7, -1813,     0,
+     0,     5,     1,     6, -1812,     1,     0,     1,     0,     4,     2,     0,
+ -1811,     2,     0,     0, -1810, -1803,     0,     0, -1802,     0,     4, -1799,
+     1,     0, -1796, -1794,     0,     0,     4,     0, -1793,     0,    11, -1790,
+ -1784,     1, -1782,     0, -1780,     0, -1779, -1774, -1773,     0, -1771,     6,
+     0,     0,     0,     0, -1770,    12,     1,     3,     2, -1769,     0,     5,
+     1,     1, -1758, -1756,     0,     0,     0,     0,     1,     0, -1755, -1753,
+     0,     0,     0,     0, -1749,     0,     0,     0,     0,     2,     0,     1,
+ -1747, -1745,     1,     1, -1744,     0,     2,     0,    13,     0, -1739,     0,
+ -1738,     1,     1,     2,     0, -1737,     0, -1735,     1,     0, -1731,     2,
+     0,     0, -1730,     0,     0, -1728,     0, -1727, -1722, -1719,     0, -1714,
+ -1713,     3,     4,     2,     4, -1703, -1702, -1701,     7, -1699, -1695,     4,
+ -1692,     2,     0, -1684,     0,     0, -1683,     0, -1682, -1679,     0,     0,
+ -1678,     1, -1675,     0,     2,     0,     3,     0,     6, -1674,    11,     0,
+     0,     5,     0,     1,     0, -1671, -1669,     0, -1666, -1665, -1663, -1657,
+     4,     0,     0,     2,     7,     1,     0, -1655,     0, -1653,     1,     0,
+     0,     3,     3,     1,    11, -1651, -1650,     8,     0,     0, -1649, -1646,
+ -1644, -1638,     0,     1,     2,     0,     0, -1637, -1636,     0,     0,     0,
+     0,     1,     1,     0,     0,     0,     0, -1633,     3, -1632,     0,     0,
+     0,     0, -1630,     7,     0,     2,     0,     0, -1629,     0,     0,     6,
+ -1627, -1626,     0,     1, -1625,     1, -1621,     0, -1619, -1614,     0,     0,
+     8,     0,     6,     0,     0,     2,     0,     0, -1611,     0,     2,     0,
+ -1610,     0, -1606, -1604,     0, -1603,     0,     2,     7,     0,     3,     3,
+     0, -1600, -1593,     0, -1592, -1591,     3,     0,     0,     0, -1587,     0,
+     0,    13, -1586,     0,     3,     0,     4, -1584, -1582, -1580,     8, -1579,
+ -1576, -1573, -1563,     2,     1,     1,     0,     3,     0,     0,     0,     1,
+     0,     4,     0, -1560, -1555,     0,     0,     1,     1, -1553,     3, -1552,
+     0, -1550,     0, -1548,     0,     4,     6,     4,     0, -1544,     0,     1,
+ -1541, -1540,     0,     1,     4, -1536,     8,     0, -1534,     0,     0,     3,
+ -1530,     2,     8,     1,     0,     0, -1525, -1523,     0,     0, -1522, -1521,
+     1,     0,     0,     2,     0,     0,     0, -1520, -1519,     3,     4,     0,
+ -1514,     8, -1511, -1507, -1505,     4,     6, -1504,     0, -1503, -1500, -1497,
+     0,     0, -1496,     0, -1495, -1494, -1492, -1483,     9,     3,     0,    15,
+     0, -1482,     0,     0,     0,     0, -1472, -1471,     1,     1,     0, -1470,
+     0, -1461, -1460, -1454,     1,     0,     0, -1453,     0, -1448,     0,     0,
+     0,     0, -1447, -1440,     0,     1,     1,     0,     0, -1439,     5,     0,
+     0, -1438,     0,     0, -1436, -1435,     3,     0,     0, -1433, -1430, -1425,
+ -1421,     0,     1,     0,    16,     3,     2, -1419,     0, -1417, -1413,     0,
+ -1411,     0, -1410, -1407, -1402,     4,     2,     0,     0, -1401,     0,     0,
+     0,     0, -1398,     0,     0,     6, -1397, -1394,     3,     2,     0,     0,
+ -1388,     0,     0,     2,     0,     0, -1383, -1382, -1381, -1371, -1370, -1368,
+ -1367,     8,     0,     0, -1366,     0, -1364,     0, -1363, -1362,     0, -1361,
+     1,     0, -1356,     0,     0,     2,     1,     0,     3,     1,     9, -1349,
+     0,     1, -1344,     1,     3, -1343, -1342, -1341,     0,     6,     0,     8,
+     0,     0,     0, -1340,     0,     0,    25,     0,     6, -1338,     3,     0,
+ -1337,     6, -1335, -1334, -1331,     0, -1329, -1323, -1322,     0, -1318, -1317,
+ -1316,     3,     0,     0,     1, -1314,     2, -1308, -1305,     0, -1304,     1,
+     0,     3, -1303,     0, -1298,     4,     0,     1,     4,     0,     0,     0,
+     0,     1,     0, -1292, -1291,     0,     2, -1290, -1287, -1283,     0, -1281,
+     0, -1277,     0, -1276,     0, -1275,     0,     0,     4,     0,     4, -1270,
+ -1259, -1258,     5,     0,     1, -1255,     0, -1251, -1249, -1244, -1242,    17,
+     0, -1241,     0, -1240,     0,     0,     0,     1, -1230,     4,     0,     2,
+     0,     1,     1,     0,     1, -1229,     3,     3,     3,     0,     2,     0,
+     0,     3,     0,     3,     1,     0,     0,     5,     8,     1, -1222, -1220,
+ -1217,     0,     5, -1216, -1212,     1,     0,     0, -1210,     0,     0,     5,
+ -1205, -1202, -1201,     0, -1198, -1197, -1196,     0, -1188,     1,     0,     3,
+     0, -1181,     0,     0, -1176,     0,     0,     1,    12,     0, -1173,     0,
+     0,     0,     0,     4, -1163, -1160, -1152,     2,     0,     1,     0,     5,
+     1,     0, -1150,     1, -1147,     0, -1146, -1144,     0,     2,     5,     0,
+     0,     0,     0,     4, -1139,     4,     0,     0, -1137,     0, -1133, -1129,
+     0,     0, -1127,     0, -1126,     0,     4,     7,     5, -1125,     1,     0,
+     0, -1123,    13,     0,     0, -1119,     0, -1118,     0, -1115, -1113,     0,
+     0, -1111, -1107,     1, -1105,     1,     0,     0, -1098,     0,     1,     0,
+ -1097, -1096, -1095, -1092, -1088, -1084, -1082,     6, -1075,     0,     0,     6,
+ -1070,     0,     0,     0, -1065,     0,     0,     0, -1056,     0,     0, -1051,
+     0,     2,     0,     0,     0,     0, -1049,     1,     0, -1048,     5,     3,
+ -1045,    28,     0, -1042,     2,     0,     0,     5,     2,     0, -1039,    10,
+     1,     0,     0,     0, -1038,     0, -1036,     0,     1, -1034, -1033,     0,
+     0,     0,     9,    13,     6,    15, -1032,     0, -1028,    20,     0, -1026,
+     0, -1025,     1,     0,     0, -1022,     1,     3,     1,     5, -1020,     0,
+     0, -1019,     0, -1017,     0,     2,     0,     0,     8, -1016, -1014, -1012,
+     0,     0, -1002,     0, -1001,     9,     0,     0,     0, -1000,     0,     1,
+     1,  -994,     0,     0,     0,  -991,  -982,     3,  -979,  -976,     0,  -975,
+  -974,     0,  -973,     0,  -970,  -967,  -958,     0,     0,     0,     0,  -952,
+     2,  -950,     0,     7,    17,  -947,  -945,     0,  -944,     0,     0,  -941,
+  -939,     1,  -938,     0,     0,  -937,     0,  -932,  -930,     0,  -929,     0,
+     0,     0,  -928,  -925,  -922,  -919,  -918,     6,    14,  -917,     0,     1,
+     0,     0,  -913,  -912,  -911,  -910,  -908,     0,     0,     0,  -905,  -903,
+  -902,  -900,     0,     5,     0,  -899,     0,     0,     0,  -896,  -895,  -894,
+     2,  -893,  -892,     0,     0,  -891,  -889,  -887,     0,  -885,  -883,  -881,
+  -880,     0,     0,     0,     2,     0,  -879,     0,     0,     9,    13,  -876,
+     0,    10,  -875,  -873,  -870,     0,     1,  -868,     0,     0,     0,     0,
+  -866,  -861,     1,  -860,  -859,     0,  -857,     1,     8,     0,  -856,  -854,
+  -853,  -852,  -851,     0,  -849,  -848,  -847,     0,  -846,  -841,  -837,     0,
+  -834,  -832,     2,  -831,    17,     0,     0,     1,     5,  -828,     0,     2,
+     0,     0,    14,     0,  -827,     0,  -826,  -825,     0,     3,     0,     2,
+     1,     0,     0,     0,  -823,  -815,  -814,    12,     0,     0,     0,     0,
+     1,  -813,     0,     8,     0,     0,     0,  -810,     2,     0,     2,     0,
+     0,  -808,     0,     0,  -806,     0,     0,     0,  -805,     0,     5,     0,
+     0,     2,  -804,  -802,     0,  -800,  -796,  -793,     0,     0,  -792,  -791,
+     3,     7,  -790,  -788,  -784,     0,     0,     0,     1,  -780,  -776,  -769,
+     1,     0,     0,     0,     1,     0,     0,     0,  -765,     0,     0,     4,
+  -764,     6,  -763,  -754,  -751,     0,  -750,  -745,     0,  -740,     6,     0,
+  -730,     0,  -728,  -724,     2,  -718,  -716,     0,     0,  -713,     0,  -710,
+     0,     0,     2,     5,     5,     0,     0,  -705,     5,     0,  -702,     0,
+     0,     0,  -701,  -700,  -697,     0,  -695,     7,     0,  -693,  -690,     0,
+     0,     0,  -689,  -688,  -687,     7,     1,  -683,     8,  -680,  -679,     0,
+     0,     0,     1,     0,     5,  -664,     3,  -662,  -658,     3,  -657,     0,
+     0,  -656,     0,     0,  -655,     0,     0,     2,     1,     0,  -653,  -651,
+     1,    11,  -649,    16,     0,     0,  -646,     1,     1,  -645,     1,  -643,
+     0,  -642,  -638,     0,     0,  -636,     0,     6,     0,  -634,     5,     5,
+  -631,  -626,    12,     1,  -625,     0,     1,     0,     4,     0,     1,     0,
+  -614,     1,  -613,     0,  -612,     0,  -605,  -602,     1,  -601,     0,     4,
+  -599,     3,  -597,  -596,     3,     3,  -592,     0,     0,     0,  -590,     3,
+  -588,     0,     0,     0,  -583,     1,     0,     4,  -578,     0,     1,  -577,
+     0,    28,  -576,     2,     0,  -573,  -572,     2,  -570,     0,     1,     1,
+  -567,     0,     3,  -561,  -558,  -556,     0,  -553,  -552,     0,    12,  -551,
+     1,     3,    13,    16,  -549,  -546,  -544,     0,  -542,  -540,     0,     9,
+     2,  -539,     0,     4,  -538,     4,    10,  -537,     7,  -535,     5,     0,
+     0,  -534,     0,     0,     3,  -532,     0,  -531,     0,     1,     2,  -528,
+  -524,  -522,     4,     1,  -520,     2,     0,  -519,     0,  -509,     0,     0,
+     0,  -506,  -500,    14,  -499,     0,     3,     0,  -496,     4,  -495,  -494,
+  -489,  -487,  -481,  -479,    11,  -478,  -467,     1,     0,     0,     0,     2,
+    30,    17,  -464,  -463,     0,  -462,  -459,     0,     2,  -456,     0,  -455,
+     0,  -454,  -451,     0,     4,  -450,  -447,     0,     0,     0,     0,    15,
+  -446,     0,  -443,     7,     0,     0,     0,     5,  -440,  -439,  -437,     4,
+     0,     0,  -436,     0,  -431,     3,     0,  -428,     5,     0,  -426,  -424,
+  -422,  -419,     0,  -417,     0,    34,     8,     9,  -412,     0,  -410,     1,
+     4,     0,    22,  -408,     0,    11,  -405,  -403,  -399,  -397,     3,     0,
+     5,  -396,     0,     0,     1,  -394,  -390,  -386,     0,     1,  -384,     0,
+  -376,     0,     2,  -375,     0,     0,  -371,     0,     5,     0,     1,  -359,
+  -355,     1,  -353,    13,     2,  -348,     1,     0,     2,    11,     0,     7,
+  -344,  -342,  -336,  -326,     4,     0,  -322,  -320,     1,  -319,  -317,     0,
+     2,     3,  -313,  -309,  -307,  -306,  -305,  -303,     0,     2,     2,     0,
+  -301,  -300,     0,  -298,  -297,  -293,     1,     0,     5,  -290,     1,     9,
+     0,  -289,     0,     0,     0,  -287,     0,     3,     0,  -283,  -279,  -278,
+  -274,     0,  -273,     5,     0,  -271,     0,  -270,     0,    10,     0,  -268,
+  -267,     4,     3,     6,  -266,     4,  -265,  -261,     0,  -259,  -257,     0,
+     1,     0,     1,     0,     0,  -256,  -254,  -246,    23,     0,  -245,  -244,
+  -242,  -240,     1,     4,     0,     0,  -239,    10,     1,  -236,     9,     0,
+     2,     1,    10,     0,     9,     0,     0,     0,     1,  -233,  -232,     0,
+     0,  -229,     3,  -228,     1,     0,     0,     0,     0,     3,  -226,  -225,
+  -223,  -222,  -221,     0,     0,     0,  -215,  -212,     0,     0,     0,     0,
+  -205,     0,     2,     1,  -204,     2,  -202,     1,  -198,     0,  -196,    15,
+     1,     0,     0,  -192,     0,     1,     0,     0,     0,  -188,     0,     0,
+  -180,  -179,     0,     0,     4,     1,  -177,     0,  -176,     9,     0,     0,
+  -167,  -165,  -157,  -152,  -150,     0,     0,  -147,     0,    10,     0,     0,
+     0,  -137,     6,     7,  -131,     5,     0,     0,     0,  -129,     0,  -124,
+     1,     9,     4,  -120,     0,    17,  -116,  -111,  -107,     0,   -99,     0,
+     0,   -97,     2,   -90,     1,     8,     0,     0,   -89,     0,   -88,     3,
+   -85,     0,     0,    13,     4,    10,   -80,     0,     0,     4,   -79,   -74,
+   -73,     2,   -69,     0,     4,   -68,     1,     5,     0,     2,     9,     0,
+     0,     0,     3,    26,     0,     0,   -64,     0,     7,    14,     6,     8,
+   -57,     4,     0,   -55,   -54,   -53,     0,     0,    20,   -44,     0,    17,
+     1,   -43,   -40,   -38,     0,     0,   -36,     0,     0,     3,   -34,   -31,
+     0,     5,     1,     0,   -29,     0,     1,     0,   -26,     0,     2,   -25,
+   -23,   -18,     0,     1,   -13,   -12,     0,     0,   -11,     0,    -6,    -3,
+    20,     0
+};
+
+// index to element_registry for each slot of the keyword hash.
 static const int keyword_index[] = {
-/* AITDeviceType                                                  */ 4734,
+/* AnatomicStructureSpaceOrRegionModifierCodeSequenceTrial        */ 234,
+/* SCPStatus                                                      */ 3405,
+/* VertexPointIndexList                                           */ 2929,
+/* ReferencedFrameNumber                                          */ 182,
+/* OverrideDateTime                                               */ 4438,
+/* InstanceCreationTime                                           */ 48,
+/* PartialDataDisplayHandling                                     */ 3301,
+/* SegmentDescription                                             */ 2877,
+/* NumberOfPatientSupportDevices                                  */ 4401,
+/* ToleranceTableLabel                                            */ 3897,
+/* CoefficientsSDHN                                               */ 4832,
+/* LensThickness                                                  */ 1729,
+/* LensConstantSequence                                           */ 1712,
+/* AdditionalDrugSequence                                         */ 671,
+/* ShortTermFluctuationCalculated                                 */ 1853,
+/* OphthalmicAxialLength                                          */ 1686,
+/* RTPlanName                                                     */ 3866,
+/* TemporalPositionSequence                                       */ 1621,
+/* BlockNumber                                                    */ 4002,
+/* XRaySourceIndex                                                */ 1254,
 /* ALinePixelSpacing                                              */ 2769,
-/* ALineRate                                                      */ 2766,
-/* ALinesPerFrame                                                 */ 2767,
-/* ASLBolusCutoffDelayTime                                        */ 1196,
-/* ASLBolusCutoffFlag                                             */ 1193,
-/* ASLBolusCutoffTechnique                                        */ 1195,
-/* ASLBolusCutoffTimingSequence                                   */ 1194,
-/* ASLContext                                                     */ 1188,
-/* ASLCrusherDescription                                          */ 1192,
-/* ASLCrusherFlag                                                 */ 1190,
-/* ASLCrusherFlowLimit                                            */ 1191,
-/* ASLMidSlabPosition                                             */ 1187,
-/* ASLPulseTrainDuration                                          */ 1189,
-/* ASLSlabNumber                                                  */ 1184,
+/* PertinentSOPClassesInSeries                                    */ 4567,
+/* OECFColumnNames                                                */ 558,
+/* TransportClassification                                        */ 4727,
+/* CornealSizeSequence                                            */ 2634,
+/* StartingMetersetValueKnownFlag                                 */ 4419,
+/* SpecificAbsorptionRateSequence                                 */ 1178,
+/* RepositoryUniqueID                                             */ 2586,
+/* ContentCreatorIdentificationCodeSequence                       */ 3079,
+/* MultienergyCTXRayDetectorSequence                              */ 1263,
 /* ASLSlabOrientation                                             */ 1186,
-/* ASLSlabSequence                                                */ 1197,
-/* ASLSlabThickness                                               */ 1185,
-/* ASLTechniqueDescription                                        */ 1183,
-/* ATDAbilityAssessment                                           */ 4677,
-/* ATDAssessmentFlag                                              */ 4678,
-/* ATDAssessmentProbability                                       */ 4679,
-/* ATDAssessmentSequence                                          */ 4704,
-/* AbortFlag                                                      */ 4692,
-/* AbortReason                                                    */ 4690,
-/* AbsoluteChannelDisplayScale                                    */ 2258,
-/* AbsoluteDosimetricObjectiveFlag                                */ 4598,
-/* AbstractPriorCodeSequence                                      */ 3251,
-/* AbstractPriorValue                                             */ 3250,
-/* Acceleration                                                   */ 598,
-/* AccessionNumber                                                */ 71,
-/* AccessoryCode                                                  */ 3999,
-/* AcquiredImageAreaDoseProduct                                   */ 1335,
-/* AcquiredSoundpathLength                                        */ 462,
-/* AcquisitionComments                                            */ 929,
-/* AcquisitionCompressionType                                     */ 463,
-/* AcquisitionContextDescription                                  */ 2350,
-/* AcquisitionContextSequence                                     */ 2349,
-/* AcquisitionContrast                                            */ 252,
-/* AcquisitionDate                                                */ 57,
-/* AcquisitionDateTime                                            */ 61,
-/* AcquisitionDeviceProcessingCode                                */ 853,
-/* AcquisitionDeviceProcessingDescription                         */ 852,
-/* AcquisitionDeviceTypeCodeSequence                              */ 1650,
-/* AcquisitionDuration                                            */ 1097,
-/* AcquisitionEndLocationSequence                                 */ 1486,
-/* AcquisitionIndex                                               */ 1628,
-/* AcquisitionMatrix                                              */ 845,
-/* AcquisitionMethodAlgorithmSequence                             */ 1758,
-/* AcquisitionMethodCodeSequence                                  */ 1757,
-/* AcquisitionMotion                                              */ 1484,
-/* AcquisitionNumber                                              */ 1513,
-/* AcquisitionProtocolDescription                                 */ 1297,
-/* AcquisitionProtocolElementSequence                             */ 1479,
-/* AcquisitionProtocolElementSpecificationSequence                */ 1478,
-/* AcquisitionProtocolName                                        */ 1296,
-/* AcquisitionSampleSize                                          */ 464,
-/* AcquisitionStartCondition                                      */ 691,
-/* AcquisitionStartConditionData                                  */ 692,
-/* AcquisitionStartLocationSequence                               */ 1485,
-/* AcquisitionStatus                                              */ 4710,
-/* AcquisitionTerminationCondition                                */ 689,
-/* AcquisitionTerminationConditionData                            */ 693,
-/* AcquisitionTime                                                */ 64,
-/* AcquisitionTimeSynchronized                                    */ 904,
-/* AcquisitionType                                                */ 1203,
-/* AcquisitionsInSeries                                           */ 1542,
-/* AcquisitionsInStudy                                            */ 1545,
-/* AcrossScanSpatialResolution                                    */ 1674,
-/* ActiveAperture                                                 */ 519,
-/* ActiveSourceDiameter                                           */ 4090,
-/* ActiveSourceLength                                             */ 4091,
-/* ActualCardiacTriggerDelayTime                                  */ 1604,
-/* ActualCardiacTriggerTimePriorToRPeak                           */ 1578,
-/* ActualEnvironmentalConditions                                  */ 383,
-/* ActualFrameDuration                                            */ 833,
-/* ActualHumanPerformersSequence                                  */ 2430,
-/* ActualRespiratoryTriggerDelayTime                              */ 1609,
-/* AdaptiveMapFormat                                              */ 1985,
-/* AddIntermediateSequence                                        */ 2654,
-/* AddNearSequence                                                */ 2653,
-/* AddOtherSequence                                               */ 2655,
-/* AddPower                                                       */ 2656,
-/* AdditionalDrugSequence                                         */ 671,
-/* AdditionalInspectionMethodSequence                             */ 4733,
-/* AdditionalInspectionSelectionCriteria                          */ 4732,
-/* AdditionalParameterRecordingInstanceSequence                   */ 4444,
-/* AdditionalPatientHistory                                       */ 317,
-/* AdditionalRTROIIdentificationCodeSequence                      */ 3761,
-/* AdditionalScreeningPerformed                                   */ 4731,
-/* AddressTrial                                                   */ 2538,
+/* StrainSourceRegistryCodeSequence                               */ 281,
+/* RTPhysicianIntentPredecessorSequence                           */ 4569,
+/* ReconstructionProtocolElementSequence                          */ 1488,
+/* ReferencedDigitalSignatureSequence                             */ 3527,
+/* TomotherapeuticControlPointSequence                            */ 4629,
+/* PrintManagementCapabilitiesSequence                            */ 3641,
+/* ImageBoxContentSequence                                        */ 3644,
+/* StereoRotation                                                 */ 1649,
+/* ReferencedSurfaceNumber                                        */ 2936,
+/* DisplaySubsystemSequence                                       */ 2112,
+/* DeformableRegistrationGridSequence                             */ 2895,
+/* FovealPointNormativeDataFlag                                   */ 1889,
+/* ConceptualVolumeConstituentIndex                               */ 4497,
+/* ScreeningTestModeCodeSequence                                  */ 1808,
+/* OrganExposed                                                   */ 2327,
+/* OphthalmicAnatomicReferencePointXCoordinate                    */ 1792,
+/* ScreenMinimumColorBitDepth                                     */ 3294,
+/* MRAcquisitionPhaseEncodingStepsOutOfPlane                      */ 1175,
+/* EnhancedPaletteColorLookupTableSequence                        */ 2043,
+/* CoordinateSystemNumberOfAxes                                   */ 399,
+/* FunctionalMRSequence                                           */ 1386,
+/* PositiveCatchTrialsQuantity                                    */ 1835,
+/* SurfaceScanAcquisitionTypeCodeSequence                         */ 3466,
+/* FloatingPointValues                                            */ 2962,
+/* SelectorDSValue                                                */ 3277,
+/* VerticesOfTheRegion                                            */ 2147,
+/* TerminationRelativeDensityThreshold                            */ 1397,
 /* AdministrationRouteCodeSequence                                */ 2827,
-/* AdmissionID                                                    */ 2196,
-/* AdmittingDate                                                  */ 2205,
-/* AdmittingDiagnosesCodeSequence                                 */ 163,
-/* AdmittingDiagnosesDescription                                  */ 162,
-/* AdmittingTime                                                  */ 2206,
-/* AdvancedBlendingSequence                                       */ 3219,
-/* AfterloaderChannelID                                           */ 4121,
-/* AgeCorrectedSensitivityDeviationAlgorithmSequence              */ 1844,
-/* AgeCorrectedSensitivityDeviationProbabilityValue               */ 1876,
-/* AgeCorrectedSensitivityDeviationValue                          */ 1869,
-/* AirCounts                                                      */ 424,
-/* AlarmDecision                                                  */ 4700,
+/* AssigningAgencyOrDepartmentCodeSequence                        */ 2292,
+/* IntravascularOCTFrameContentSequence                           */ 2775,
+/* ReferencedGeneralPurposeScheduledProcedureStepTransactionUID   */ 2419,
+/* SourceOfLensThicknessDataCodeSequence                          */ 1731,
+/* NominalBeamEnergyUnit                                          */ 3879,
+/* ReferencedImplantTemplateGroupMemberID                         */ 3464,
+/* FindingsGroupUIDTrial                                          */ 2461,
+/* ReferenceDosePointCoordinates                                  */ 4297,
+/* SkipBeats                                                      */ 774,
+/* DeadTimeCorrectionFlag                                         */ 2864,
+/* ReceiveCoilName                                                */ 836,
+/* StrainStockSequence                                            */ 282,
+/* AttenuationCorrectionSource                                    */ 1411,
+/* BlockOrientation                                               */ 4374,
+/* RealWorldValueMappingSequence                                  */ 2447,
+/* TypeOfOpticalCorrection                                        */ 1699,
+/* CompressionContactArea                                         */ 827,
+/* NominalScannedPixelSpacing                                     */ 914,
 /* AlarmDecisionTime                                              */ 4699,
-/* AlgorithmCodeSequenceTrial                                     */ 2527,
-/* AlgorithmDescription                                           */ 1356,
-/* AlgorithmDescriptionTrial                                      */ 2528,
-/* AlgorithmFamilyCodeSequence                                    */ 2939,
-/* AlgorithmName                                                  */ 2945,
-/* AlgorithmNameCodeSequence                                      */ 2940,
-/* AlgorithmParameters                                            */ 2942,
-/* AlgorithmRoutingCodeSequence                                   */ 4726,
-/* AlgorithmSource                                                */ 1895,
-/* AlgorithmType                                                  */ 1355,
-/* AlgorithmVersion                                               */ 2941,
-/* AliasedDataType                                                */ 1441,
-/* Allergies                                                      */ 309,
-/* AllowLossyCompression                                          */ 3664,
-/* AllowMediaSplitting                                            */ 3656,
-/* AlongScanSpatialResolution                                     */ 1669,
-/* AlphaLUTTransferFunction                                       */ 2048,
-/* AlphaPaletteColorLookupTableData                               */ 2018,
-/* AlphaPaletteColorLookupTableDescriptor                         */ 2009,
-/* AlternateBeamDose                                              */ 3932,
-/* AlternateBeamDoseType                                          */ 3933,
-/* AlternateContainerIdentifierSequence                           */ 2340,
-/* AlternateContentDescriptionSequence                            */ 3080,
-/* AlternateRepresentationSequence                                */ 236,
-/* AlternateValueSequence                                         */ 4429,
-/* AmbientLightValueSource                                        */ 2114,
-/* AmbientReflectionIntensity                                     */ 3193,
-/* AmplifierType                                                  */ 438,
-/* AnalyzedArea                                                   */ 2693,
-/* AnatomicApproachDirectionCodeSequenceTrial                     */ 229,
-/* AnatomicLocationOfExaminingInstrumentCodeSequenceTrial         */ 233,
-/* AnatomicLocationOfExaminingInstrumentDescriptionTrial          */ 232,
-/* AnatomicPerspectiveCodeSequenceTrial                           */ 231,
-/* AnatomicPerspectiveDescriptionTrial                            */ 230,
-/* AnatomicPortalOfEntranceCodeSequenceTrial                      */ 228,
-/* AnatomicRegionModifierSequence                                 */ 219,
-/* AnatomicRegionSequence                                         */ 218,
-/* AnatomicRegionsInStudyCodeSequence                             */ 82,
-/* AnatomicStructure                                              */ 217,
-/* AnatomicStructureReferencePoint                                */ 1767,
-/* AnatomicStructureSpaceOrRegionCodeSequenceTrial                */ 227,
-/* AnatomicStructureSpaceOrRegionModifierCodeSequenceTrial        */ 234,
-/* AnatomicStructureSpaceOrRegionSequence                         */ 221,
-/* AnatomicalOrientationType                                      */ 324,
-/* AnchorPoint                                                    */ 3054,
-/* AnchorPointAnnotationUnits                                     */ 3046,
-/* AnchorPointVisibility                                          */ 3055,
-/* AngioFlag                                                      */ 666,
-/* AngleNumber                                                    */ 1519,
-/* AngularPosition                                                */ 793,
-/* AngularStep                                                    */ 796,
-/* AngularViewVector                                              */ 2817,
-/* AnimationCurveSequence                                         */ 3213,
-/* AnimationStepSize                                              */ 3214,
-/* AnnotationClipping                                             */ 3210,
-/* AnnotationContentSequence                                      */ 3645,
-/* AnnotationDisplayFormatID                                      */ 3571,
-/* AnnotationFlag                                                 */ 3559,
-/* AnnotationGroupNumber                                          */ 2520,
-/* AnnotationPosition                                             */ 3607,
-/* AnodeTargetMaterial                                            */ 822,
-/* AnomalyLocatorIndicator                                        */ 4743,
-/* AnomalyLocatorIndicatorSequence                                */ 4742,
-/* AnteriorChamberDepth                                           */ 1730,
-/* AnteriorChamberDepthDefinitionCodeSequence                     */ 1723,
-/* AnteriorChamberDepthSequence                                   */ 1725,
-/* ApertureElevation                                              */ 521,
-/* ApertureValue                                                  */ 584,
-/* ApexPosition                                                   */ 1613,
-/* ApplicableFrameRange                                           */ 2071,
-/* ApplicableSafetyStandardAgency                                 */ 1148,
-/* ApplicableSafetyStandardDescription                            */ 1149,
-/* ApplicationManufacturer                                        */ 1354,
-/* ApplicationMaximumRepaintTime                                  */ 3295,
-/* ApplicationName                                                */ 1352,
-/* ApplicationSetupCheck                                          */ 3834,
-/* ApplicationSetupManufacturer                                   */ 4107,
-/* ApplicationSetupName                                           */ 4106,
-/* ApplicationSetupNumber                                         */ 4105,
-/* ApplicationSetupSequence                                       */ 4103,
-/* ApplicationSetupType                                           */ 4104,
-/* ApplicationVersion                                             */ 1353,
-/* ApplicatorApertureShape                                        */ 4242,
-/* ApplicatorDescription                                          */ 4011,
-/* ApplicatorGeometrySequence                                     */ 4241,
-/* ApplicatorID                                                   */ 4009,
-/* ApplicatorOpening                                              */ 4243,
-/* ApplicatorOpeningX                                             */ 4244,
-/* ApplicatorOpeningY                                             */ 4245,
-/* ApplicatorSequence                                             */ 4008,
-/* ApplicatorType                                                 */ 4010,
-/* ApprovalSequence                                               */ 2608,
-/* ApprovalStatus                                                 */ 4481,
-/* ApprovalStatusDateTime                                         */ 2597,
-/* ApprovalStatusFurtherDescription                               */ 2596,
-/* ApprovalSubjectSequence                                        */ 2617,
-/* Arbitrary                                                      */ 4632,
-/* ArchiveRequested                                               */ 2554,
-/* ArterialSpinLabelingContrast                                   */ 1181,
-/* AscanRate                                                      */ 1802,
-/* AsserterIdentificationSequence                                 */ 2611,
-/* AssertionCodeSequence                                          */ 2609,
-/* AssertionComments                                              */ 2614,
-/* AssertionDateTime                                              */ 2612,
-/* AssertionExpirationDateTime                                    */ 2613,
-/* AssertionUID                                                   */ 2610,
-/* AssessedAttributeValueSequence                                 */ 3488,
-/* AssessedSOPInstanceSequence                                    */ 3481,
-/* AssessmentLabel                                                */ 3495,
-/* AssessmentObservationsSequence                                 */ 3484,
-/* AssessmentRequesterSequence                                    */ 3490,
-/* AssessmentSetID                                                */ 3489,
-/* AssessmentSummary                                              */ 3479,
-/* AssessmentSummaryDescription                                   */ 3480,
-/* AssessmentTypeCodeSequence                                     */ 3493,
-/* AssignedLocation                                               */ 4698,
-/* AssigningAgencyOrDepartmentCodeSequence                        */ 2292,
-/* AssigningFacilitySequence                                      */ 2290,
-/* AssigningJurisdictionCodeSequence                              */ 2291,
-/* AttachedContours                                               */ 3744,
-/* AttenuationCorrected                                           */ 1419,
-/* AttenuationCorrectionMethod                                    */ 2843,
-/* AttenuationCorrectionSource                                    */ 1411,
-/* AttenuationCorrectionTemporalRelationship                      */ 1430,
-/* AttributeItemSelector                                          */ 3389,
-/* AttributeModificationDateTime                                  */ 3537,
-/* AttributeOccurrencePointer                                     */ 3388,
-/* AttributeOccurrencePrivateCreator                              */ 3390,
-/* AttributeOccurrenceSequence                                    */ 3387,
-/* AttributeToleranceValuesSequence                               */ 4310,
-/* AudioComments                                                  */ 4770,
-/* AudioSampleData                                                */ 4769,
-/* AudioSampleFormat                                              */ 4764,
-/* AudioType                                                      */ 4763,
-/* AuthorIdentificationSequence                                   */ 4509,
-/* AuthorObserverSequence                                         */ 2484,
-/* AuthorizationEquipmentCertificationNumber                      */ 3513,
-/* AutoKVPLowerBound                                              */ 1504,
-/* AutoKVPSelectionType                                           */ 1502,
-/* AutoKVPUpperBound                                              */ 1503,
-/* AutorefractionLeftEyeSequence                                  */ 2636,
-/* AutorefractionRightEyeSequence                                 */ 2635,
-/* AutosequenceFlag                                               */ 3365,
-/* AvailableTransferSyntaxUID                                     */ 237,
-/* AverageBeamDosePointDepth                                      */ 3928,
-/* AverageBeamDosePointEquivalentDepth                            */ 3929,
-/* AverageBeamDosePointSSD                                        */ 3930,
-/* AverageBeamDosePointSourceToExternalContourDistance            */ 4038,
-/* AverageCornealPower                                            */ 2691,
-/* AveragePulseWidth                                              */ 805,
-/* AxialAcceptance                                                */ 2848,
-/* AxialDetectorDimension                                         */ 1403,
-/* AxialLengthOfTheEye                                            */ 1664,
-/* AxialMash                                                      */ 2849,
-/* AxialPower                                                     */ 2703,
-/* AxialResolution                                                */ 2764,
-/* AxisLabels                                                     */ 4754,
-/* AxisOfRotation                                                 */ 2921,
-/* AxisUnits                                                      */ 4753,
-/* B1rms                                                          */ 851,
-/* BackgroundColor                                                */ 2648,
+/* ReferencedImageSequence                                        */ 174,
+/* VisualFieldShape                                               */ 1807,
+/* ASLContext                                                     */ 1188,
+/* InterpretationText                                             */ 4645,
+/* ResultsID                                                      */ 4634,
+/* SurfaceMeshZPixelOffset                                        */ 1804,
+/* RangeModulatorNumber                                           */ 4187,
+/* DepthOfScanField                                               */ 943,
+/* CertificateOfSigner                                            */ 3521,
+/* ColumnOverlap                                                  */ 1944,
+/* SourceOrientation                                              */ 4723,
+/* OverlayPlaneOrigin                                             */ 4795,
+/* EffectiveDoseCalculationMethodCodeSequence                     */ 4488,
+/* PrintingBitDepth                                               */ 3564,
+/* SelectorFDValue                                                */ 3279,
+/* ATDAssessmentProbability                                       */ 4679,
+/* StrainAdditionalInformation                                    */ 284,
+/* RowsForNthOrderCoefficients                                    */ 1974,
 /* BackgroundIlluminationColorCodeSequence                        */ 1812,
-/* BackgroundLuminance                                            */ 1810,
-/* BadPixelImage                                                  */ 432,
-/* BarcodeSymbology                                               */ 3655,
-/* BarcodeValue                                                   */ 3654,
-/* BaselineCorrection                                             */ 1094,
-/* BasicColorImageSequence                                        */ 3604,
-/* BasicGrayscaleImageSequence                                    */ 3603,
-/* BasisMaterialsCodeSequence                                     */ 4711,
-/* BasisRTTreatmentPhaseIndex                                     */ 4546,
-/* BatteryLevel                                                   */ 553,
-/* BeamAngle                                                      */ 1317,
-/* BeamAreaLimitSequence                                          */ 4403,
-/* BeamCurrentModulationID                                        */ 4191,
-/* BeamDeliveryDurationLimit                                      */ 3953,
-/* BeamDescription                                                */ 3951,
-/* BeamDose                                                       */ 3921,
-/* BeamDoseMeaning                                                */ 3926,
-/* BeamDosePointDepth                                             */ 3923,
-/* BeamDosePointEquivalentDepth                                   */ 3924,
-/* BeamDosePointSSD                                               */ 3925,
-/* BeamDosePointSourceToExternalContourDistance                   */ 3935,
-/* BeamDoseSpecificationPoint                                     */ 3919,
-/* BeamDoseType                                                   */ 3931,
-/* BeamDoseVerificationControlPointSequence                       */ 3927,
-/* BeamLimitingDeviceAngle                                        */ 4025,
-/* BeamLimitingDeviceAngleTolerance                               */ 3899,
-/* BeamLimitingDeviceLeafPairsSequence                            */ 3822,
-/* BeamLimitingDevicePositionSequence                             */ 4021,
-/* BeamLimitingDevicePositionTolerance                            */ 3901,
-/* BeamLimitingDeviceRotationDirection                            */ 4026,
-/* BeamLimitingDeviceSequence                                     */ 3943,
-/* BeamLimitingDeviceToleranceSequence                            */ 3900,
-/* BeamMeterset                                                   */ 3922,
-/* BeamModifierOrientationAngle                                   */ 4335,
-/* BeamName                                                       */ 3950,
-/* BeamNumber                                                     */ 3949,
-/* BeamOrderIndex                                                 */ 3408,
-/* BeamOrderIndexTrial                                            */ 3364,
-/* BeamSequence                                                   */ 3939,
-/* BeamSpotSize                                                   */ 2760,
-/* BeamStopperPosition                                            */ 3861,
-/* BeamTaskSequence                                               */ 3362,
-/* BeamTaskType                                                   */ 3363,
-/* BeamType                                                       */ 3952,
-/* BeatRejectionFlag                                              */ 768,
-/* BeltHeight                                                     */ 4725,
-/* BiPlaneAcquisitionSequence                                     */ 2062,
-/* BibliographicCitationTrial                                     */ 2514,
-/* BillingItemSequence                                            */ 2315,
-/* BillingProcedureStepSequence                                   */ 2328,
-/* BillingSuppliesAndDevicesSequence                              */ 2330,
-/* BiopsyTargetSequence                                           */ 917,
-/* BitsAllocated                                                  */ 1945,
-/* BitsForCodeWord                                                */ 1990,
-/* BitsGrouped                                                    */ 1934,
-/* BitsMappedToColorLookupTable                                   */ 2037,
-/* BitsStored                                                     */ 1946,
-/* BlendingDisplayInputSequence                                   */ 3221,
-/* BlendingDisplaySequence                                        */ 3222,
-/* BlendingInputNumber                                            */ 3220,
-/* BlendingLUT1Sequence                                           */ 2038,
-/* BlendingLUT1TransferFunction                                   */ 2039,
-/* BlendingLUT2Sequence                                           */ 2044,
-/* BlendingLUT2TransferFunction                                   */ 2045,
+/* KVP                                                            */ 686,
+/* ContainerComponentMaterial                                     */ 2751,
+/* MeasurementValuesSequence                                      */ 2965,
+/* PerformedProcedureStepStartDateTime                            */ 2435,
+/* DigitalSignatureDateTime                                       */ 3519,
+/* PresentationInputType                                          */ 3157,
+/* T2Preparation                                                  */ 1056,
+/* OriginalImageIdentification                                    */ 1566,
+/* NumberOfGeneralAccessories                                     */ 4380,
+/* WedgeTotalHeight                                               */ 543,
+/* DataSetDescription                                             */ 1899,
+/* ImageLocation                                                  */ 1963,
+/* TableTopVerticalAdjustedPosition                               */ 3366,
+/* ReferencedPathIndex                                            */ 1272,
+/* AlarmDecision                                                  */ 4700,
+/* HistogramNumberOfBins                                          */ 2866,
+/* PatientMotherBirthName                                         */ 303,
+/* ReportDetailSequenceTrial                                      */ 2545,
+/* Quantity                                                       */ 2313,
+/* FalsePositivesQuantity                                         */ 1839,
+/* ContextGroupIdentificationSequence                             */ 122,
+/* AnimationCurveSequence                                         */ 3213,
+/* DetectorManufacturerName                                       */ 1016,
+/* ParallelReductionFactorInPlane                                 */ 1095,
+/* ReferencedSourceNumber                                         */ 4455,
+/* IVUSGatedRate                                                  */ 925,
+/* SecondaryCountsAccumulated                                     */ 2856,
+/* SynchronizationTrigger                                         */ 755,
+/* ReferencedCurveSequence                                        */ 175,
+/* HPGLPenNumber                                                  */ 2991,
+/* EndAcquisitionDateTime                                         */ 1349,
+/* MydriaticAgentConcentrationUnitsSequence                       */ 1673,
+/* LateralSpreadingDeviceID                                       */ 4181,
+/* NumberOfContourPoints                                          */ 3742,
 /* BlendingLookupTableData                                        */ 2042,
-/* BlendingLookupTableDescriptor                                  */ 2041,
-/* BlendingMode                                                   */ 3223,
+/* StructuredDisplayTextBoxSequence                               */ 3326,
+/* PostprocessingFunction                                         */ 934,
+/* PatientEquipmentRelationshipCodeSequence                       */ 4532,
+/* AnatomicRegionsInStudyCodeSequence                             */ 82,
+/* DeliveryTimeStructureCodeSequence                              */ 4619,
+/* ReferencedImageNavigationSequence                              */ 2731,
+/* CTAcquisitionTypeSequence                                      */ 1202,
+/* ReferencedSurfaceMeshIdentificationSequence                    */ 1790,
+/* NominalScreenDefinitionSequence                                */ 3289,
+/* EncapsulatedDocument                                           */ 2589,
+/* StrainStockNumber                                              */ 280,
+/* TableTopLongitudinalAdjustedPosition                           */ 3367,
+/* ContrastBolusAgentDetected                                     */ 1241,
+/* SignalToNoiseRatio                                             */ 1738,
+/* EnergyWindowRangeSequence                                      */ 2787,
+/* NumberOfCopies                                                 */ 3549,
+/* BscanSlabThickness                                             */ 1798,
+/* SwitchingPhaseNominalDuration                                  */ 1260,
+/* NumberOfAssessmentObservations                                 */ 3483,
+/* GraphicLayerRecommendedDisplayGrayscaleValue                   */ 3071,
+/* TargetUID                                                      */ 918,
+/* ImageBoxScrollDirection                                        */ 3312,
+/* ImageBoxLayoutType                                             */ 3309,
+/* ThresholdValueSequence                                         */ 3227,
+/* TotalTime                                                      */ 4768,
+/* WedgeChamferHeight                                             */ 548,
+/* ImplantTemplateGroupVersion                                    */ 3451,
+/* OverlayBackgroundDensity                                       */ 3617,
+/* TargetMaximumDose                                              */ 3889,
+/* ImagePlanePixelSpacing                                         */ 3674,
+/* SubstanceAdministrationNotes                                   */ 2604,
+/* GridAspectRatio                                                */ 1027,
+/* BeamTaskType                                                   */ 3363,
+/* ScanPatternTypeCodeSequence                                    */ 1789,
+/* BrachyControlPointSequence                                     */ 4148,
+/* StructuredConstraintObservationSequence                        */ 3487,
+/* VisualFieldGlobalResultsIndexSequence                          */ 1901,
+/* LargeGreenPaletteColorLookupTableData                          */ 2020,
+/* TomoType                                                       */ 865,
+/* DigitalImageFormatAcquired                                     */ 732,
+/* MultiplexedAudioChannelsDescriptionCodeSequence                */ 2259,
+/* RTBeamModifierDefinitionDistance                               */ 4402,
+/* PixelCoordinatesSetTrial                                       */ 2529,
+/* ProcedureContextSequenceTrial                                  */ 2536,
+/* MaximumAlongScanDistortion                                     */ 1670,
+/* PresentationLUTShape                                           */ 3622,
 /* BlendingOperationType                                          */ 3331,
-/* BlendingPosition                                               */ 3151,
-/* BlendingSequence                                               */ 3148,
-/* BlendingWeightConstant                                         */ 2040,
-/* BlindSpotLocalized                                             */ 1881,
-/* BlindSpotXCoordinate                                           */ 1882,
-/* BlindSpotYCoordinate                                           */ 1883,
-/* BlockColumns                                                   */ 1942,
-/* BlockData                                                      */ 4007,
-/* BlockDefinitionSequence                                        */ 4372,
-/* BlockDivergence                                                */ 4000,
-/* BlockEdgeData                                                  */ 4373,
-/* BlockEdgeDataSequence                                          */ 4377,
-/* BlockIdentifyingInformationStatus                              */ 132,
-/* BlockMountingPosition                                          */ 4001,
-/* BlockName                                                      */ 4003,
-/* BlockNumber                                                    */ 4002,
-/* BlockNumberOfPoints                                            */ 4006,
-/* BlockOrientation                                               */ 4374,
-/* BlockRows                                                      */ 1941,
-/* BlockSequence                                                  */ 3994,
-/* BlockSlabNumber                                                */ 4250,
-/* BlockSlabSequence                                              */ 4248,
-/* BlockSlabThickness                                             */ 4249,
-/* BlockThickness                                                 */ 4004,
-/* BlockTransmission                                              */ 4005,
-/* BlockTrayID                                                    */ 3995,
-/* BlockType                                                      */ 3998,
-/* BlockedPixels                                                  */ 1940,
-/* BloodSignalNulling                                             */ 1057,
-/* BluePaletteColorLookupTableData                                */ 2017,
-/* BluePaletteColorLookupTableDescriptor                          */ 2008,
-/* BoardingPassID                                                 */ 4683,
-/* BodyPartExamined                                               */ 660,
-/* BodyPartThickness                                              */ 823,
-/* Bold                                                           */ 3105,
-/* BolusDefinitionSequence                                        */ 4381,
-/* BolusDescription                                               */ 3973,
-/* BolusID                                                        */ 3972,
-/* BoneThermalIndex                                               */ 936,
-/* BorderDensity                                                  */ 3582,
-/* BottomRightHandCornerOfLocalizerArea                           */ 2733,
-/* BoundingBoxAnnotationUnits                                     */ 3045,
-/* BoundingBoxBottomRightHandCorner                               */ 3052,
-/* BoundingBoxCrop                                                */ 3171,
-/* BoundingBoxTextHorizontalJustification                         */ 3053,
+/* TextStyleSequence                                              */ 3093,
+/* XRayImageReceptorTranslation                                   */ 3671,
+/* PresentationSizeMode                                           */ 3081,
+/* ScheduledWorkitemCodeSequence                                  */ 2414,
+/* NumberOfFramesInOverlay                                        */ 4789,
+/* MatingFeatureSetLabel                                          */ 3006,
+/* ROIPhysicalPropertyValue                                       */ 3757,
+/* EncryptedContent                                               */ 3532,
+/* ProcedureExpirationDate                                        */ 489,
+/* MaximumDepthDistortion                                         */ 1668,
+/* EntityLabel                                                    */ 4537,
+/* AverageCornealPower                                            */ 2691,
+/* RecordedBrachyAccessoryDeviceSequence                          */ 3835,
+/* TableCradleTiltAngle                                           */ 1333,
+/* TableLongitudinalIncrement                                     */ 789,
+/* ROIVolume                                                      */ 3731,
+/* TemplateExtensionFlag                                          */ 2570,
 /* BoundingBoxTopLeftHandCorner                                   */ 3051,
-/* BoundingPolygon                                                */ 4686,
-/* BoundingRectangle                                              */ 2995,
-/* BrachyAccessoryDeviceID                                        */ 4114,
-/* BrachyAccessoryDeviceName                                      */ 4116,
-/* BrachyAccessoryDeviceNominalThickness                          */ 4117,
-/* BrachyAccessoryDeviceNominalTransmission                       */ 4118,
-/* BrachyAccessoryDeviceNumber                                    */ 4113,
+/* ConventionalMachineVerificationSequence                        */ 3381,
+/* LINACOutput                                                    */ 518,
+/* MaterialPipeDiameter                                           */ 364,
+/* StorageMediaFileSetID                                          */ 3503,
+/* PertinentOtherEvidenceSequence                                 */ 2546,
+/* SegmentationAlgorithmIdentificationSequence                    */ 2878,
+/* ColorFilterArrayPatternRows                                    */ 564,
+/* ShadowStyle                                                    */ 3100,
+/* ParticipationType                                              */ 2487,
+/* PETTableDynamicsSequence                                       */ 1407,
+/* IrradiationEventIdentificationSequence                         */ 1338,
+/* VectorAccuracy                                                 */ 2925,
+/* SOPInstanceUIDOfConcatenationSource                            */ 1540,
+/* AnomalyLocatorIndicator                                        */ 4743,
+/* OverlayCompressionStepPointers                                 */ 4800,
+/* AgeCorrectedSensitivityDeviationProbabilityValue               */ 1876,
+/* ReferencedDoseReferenceNumber                                  */ 4461,
+/* ExposureControlSensingRegionLeftVerticalEdge                   */ 1308,
+/* Rows                                                           */ 1914,
+/* PresentationStateCompositorComponentSequence                   */ 3202,
+/* RelationshipType                                               */ 2459,
+/* TableVerticalIncrement                                         */ 787,
+/* CompensatorColumnOffset                                        */ 4157,
+/* ObjectiveLensNumericalAperture                                 */ 2729,
+/* ReferencedRangeModulatorNumber                                 */ 4477,
+/* TableFrameOfReferenceUID                                       */ 1624,
+/* ModelSpecificationSequence                                     */ 1465,
+/* OverlayCompressionDescription                                  */ 4799,
+/* BeamStopperPosition                                            */ 3861,
+/* PredecessorDocumentsSequence                                   */ 2541,
+/* ImageBoxLargeScrollType                                        */ 3315,
+/* FocalLengthIn35mmFilm                                          */ 610,
+/* NumberOfKSpaceTrajectories                                     */ 1115,
+/* ExposureInuAs                                                  */ 804,
+/* RawDataHandling                                                */ 2433,
+/* DisplayShadingFlag                                             */ 2256,
+/* DecompositionMethod                                            */ 1278,
+/* HangingProtocolLevel                                           */ 3232,
+/* FilterThicknessMaximum                                         */ 1032,
+/* PredictorConstants                                             */ 1939,
+/* ResponsibleOrganization                                        */ 332,
+/* Time                                                           */ 2499,
+/* NumberOfReferences                                             */ 40,
+/* TemporalPositionIndex                                          */ 1575,
+/* ReferencedCompensatorNumber                                    */ 4469,
+/* DateTimeOfLastCalibration                                      */ 830,
+/* EquivalentCodeSequence                                         */ 120,
+/* StageNumber                                                    */ 201,
+/* PhysicalUnitsYDirection                                        */ 961,
+/* PulseNumber                                                    */ 3854,
+/* ExpiryDate                                                     */ 384,
+/* ReferencedRadiationDoseIdentificationIndex                     */ 4279,
+/* DeviceSequence                                                 */ 2742,
+/* IsotopeNumber                                                  */ 1515,
+/* SpecimenDetailedDescription                                    */ 2355,
+/* ImagesInAcquisition                                            */ 1543,
+/* ModifiedImageTime                                              */ 1563,
+/* CoordinateSystemAxesSequence                                   */ 400,
+/* ReportingPriority                                              */ 2377,
+/* VectorGridData                                                 */ 2898,
+/* MinDensity                                                     */ 3584,
+/* PixelDataAreaRotationAngleRelativeToFOV                        */ 1022,
+/* ImagePathFilterPassBand                                        */ 1634,
+/* ReferencedRTPhysicianIntentSequence                            */ 4325,
+/* DataFrameAssignmentSequence                                    */ 2035,
+/* TableOfXBreakPoints                                            */ 990,
+/* KeratometryRightEyeSequence                                    */ 2641,
+/* ReferencedDeviceIndex                                          */ 4274,
+/* ImageSetLabel                                                  */ 3252,
+/* PersonTelephoneNumbers                                         */ 2385,
+/* ShadowOffsetY                                                  */ 3102,
+/* SourceType                                                     */ 4088,
+/* LineStyleSequence                                              */ 3094,
+/* AlgorithmName                                                  */ 2945,
+/* RTImageLabel                                                   */ 3666,
+/* ReferencedSOPClassUID                                          */ 178,
+/* EchoPeakPosition                                               */ 1201,
+/* SpecimenPreparationStepContentItemSequence                     */ 2357,
+/* SourceToCompensatorTrayDistance                                */ 3981,
+/* TerminationDensityThreshold                                    */ 1396,
+/* IlluminationWaveLength                                         */ 1677,
+/* LUTData                                                        */ 2058,
+/* PhysiciansReadingStudyIdentificationSequence                   */ 159,
+/* PreferredPlaybackSequencing                                    */ 835,
+/* OpticalPathIdentificationSequence                              */ 2734,
+/* LargeBluePaletteColorLookupTableDescriptor                     */ 2012,
+/* RTAccessoryHolderSlotExistenceFlag                             */ 4282,
+/* ScanVelocity                                                   */ 842,
+/* SurfaceScanModeCodeSequence                                    */ 3467,
+/* MostRecentTreatmentDate                                        */ 3800,
+/* TagAngleSecondAxis                                             */ 1170,
+/* TransferTubeNumber                                             */ 4139,
+/* DiffusionModelCodeSequence                                     */ 2967,
+/* StudyTime                                                      */ 62,
+/* RadiotherapyTreatmentType                                      */ 4554,
+/* ROIStandardDeviation                                           */ 4822,
+/* RadiationAtomicNumber                                          */ 4164,
+/* AlgorithmDescription                                           */ 1356,
 /* BrachyAccessoryDeviceSequence                                  */ 4112,
-/* BrachyAccessoryDeviceType                                      */ 4115,
-/* BrachyApplicationSetupDose                                     */ 3938,
-/* BrachyApplicationSetupDoseSpecificationPoint                   */ 3937,
-/* BrachyControlPointDeliveredSequence                            */ 3848,
-/* BrachyControlPointSequence                                     */ 4148,
-/* BrachyPulseControlPointDeliveredSequence                       */ 3855,
-/* BrachyReferencedDoseReferenceSequence                          */ 4462,
+/* TopicSubject                                                   */ 3507,
+/* AssessmentLabel                                                */ 3495,
+/* ContainerComponentDiameter                                     */ 2754,
+/* ColumnAngulation                                               */ 861,
+/* PatientFrameOfReferenceSource                                  */ 1617,
+/* DeliveredTreatmentTime                                         */ 3788,
+/* ReferencedContentItemIdentifier                                */ 2573,
+/* FieldOfViewShape                                               */ 799,
+/* PixelBandwidth                                                 */ 708,
+/* ImageBoxSmallScrollType                                        */ 3313,
+/* ConceptualVolumeSegmentationDefinedFlag                        */ 4500,
+/* NumberOfLeafJawPairs                                           */ 3947,
+/* ClinicalTrialSponsorName                                       */ 335,
+/* DecayCorrected                                                 */ 1418,
+/* ExcitationFrequency                                            */ 458,
+/* LUTExplanation                                                 */ 2056,
+/* AxialDetectorDimension                                         */ 1403,
+/* MultienergyCTProcessingSequence                                */ 1251,
+/* KVUsedInGainCalibration                                        */ 425,
+/* UniformResourceLocatorTrial                                    */ 2565,
+/* EchoNumbers                                                    */ 700,
+/* VisualAcuityLeftEyeSequence                                    */ 2669,
+/* IssuerOfServiceEpisodeIDSequence                               */ 2215,
+/* ZeroVelocityPixelValue                                         */ 1446,
+/* PerformedProcedureStepDiscontinuationReasonCodeSequence        */ 2311,
+/* StructureSetDate                                               */ 3718,
+/* RTDoseROISequence                                              */ 3700,
+/* ContactDisplayName                                             */ 3360,
+/* ReceiverEquipmentSequence                                      */ 437,
+/* AxialPower                                                     */ 2703,
+/* VolumeLocalizationTechnique                                    */ 1084,
+/* ContainerTypeCodeSequence                                      */ 2341,
+/* ReportedValuesOrigin                                           */ 3669,
+/* ContrastFlowRate                                               */ 740,
+/* ReferencePixelY0                                               */ 959,
+/* MaximumPointDistance                                           */ 2919,
+/* AlgorithmVersion                                               */ 2941,
+/* SourceToPatientSurfaceDistance                                 */ 4318,
+/* RouteID                                                        */ 4718,
+/* FNumber                                                        */ 555,
+/* CompensatorNumber                                              */ 3979,
+/* PulserNotes                                                    */ 436,
+/* FrameOfReferenceTransformationType                             */ 3764,
+/* DeviceMotionParameterCodeSequence                              */ 4254,
+/* GeneralAccessoryType                                           */ 4237,
+/* ReferencedDefinedDeviceIndex                                   */ 4269,
+/* WaveformDisplayBackgroundCIELabValue                           */ 2250,
+/* AcquisitionComments                                            */ 929,
+/* ReferencedFractionGroupSequence                                */ 4456,
+/* RequestedContrastAgent                                         */ 2180,
+/* ScanSpotSizesDelivered                                         */ 4221,
+/* FileSetDescriptorFileID                                        */ 23,
+/* TablePosition                                                  */ 1228,
 /* BrachyTaskSequence                                             */ 3411,
-/* BrachyTreatmentTechnique                                       */ 4083,
-/* BrachyTreatmentType                                            */ 4084,
-/* BrachytherapySourceType                                        */ 4556,
-/* BranchOfService                                                */ 305,
-/* BreastImplantPresent                                           */ 2030,
-/* BreastSupportIsocenterPrimaryAngle                             */ 1364,
-/* BreastSupportIsocenterSecondaryAngle                           */ 1365,
-/* BreastSupportXPositionToIsocenter                              */ 1366,
-/* BreastSupportYPositionToIsocenter                              */ 1367,
-/* BreastSupportZPositionToIsocenter                              */ 1368,
-/* BreedRegistrationNumber                                        */ 328,
-/* BreedRegistrationSequence                                      */ 327,
-/* BreedRegistryCodeSequence                                      */ 329,
-/* BridgeResistors                                                */ 501,
-/* BrightnessValue                                                */ 585,
-/* BscanCycleTime                                                 */ 1800,
-/* BscanCycleTimeVector                                           */ 1801,
-/* BscanRate                                                      */ 1803,
-/* BscanSlabThickness                                             */ 1798,
-/* BulkMotionCompensationTechnique                                */ 1146,
-/* BulkMotionSignalSource                                         */ 1147,
-/* BulkMotionStatus                                               */ 1141,
-/* BurnedInAnnotation                                             */ 1965,
-/* CADFileFormat                                                  */ 359,
-/* CArmPhotonElectronControlPointSequence                         */ 4314,
-/* CArmPositionerTabletopRelationship                             */ 1336,
-/* CIExyWhitePoint                                                */ 2101,
-/* CSSFontName                                                    */ 3091,
-/* CTAcquisitionDetailsSequence                                   */ 1205,
-/* CTAcquisitionTypeSequence                                      */ 1202,
-/* CTAdditionalXRaySourceSequence                                 */ 1248,
-/* CTDIPhantomTypeCodeSequence                                    */ 1244,
-/* CTDIvol                                                        */ 1243,
-/* CTDIvolNotificationTrigger                                     */ 1500,
-/* CTExposureSequence                                             */ 1222,
-/* CTGeometrySequence                                             */ 1213,
-/* CTImageFrameTypeSequence                                       */ 1230,
-/* CTPositionSequence                                             */ 1227,
-/* CTReconstructionSequence                                       */ 1215,
-/* CTTableDynamicsSequence                                        */ 1209,
-/* CTXRayDetailsSequence                                          */ 1226,
-/* CalciumScoringMassFactorDevice                                 */ 1246,
-/* CalciumScoringMassFactorPatient                                */ 1245,
-/* CalculatedAnatomyThickness                                     */ 1319,
-/* CalculatedDoseReferenceDescription                             */ 3814,
-/* CalculatedDoseReferenceDoseValue                               */ 3815,
-/* CalculatedDoseReferenceNumber                                  */ 3813,
-/* CalculatedDoseReferenceSequence                                */ 3812,
-/* CalculatedFrameList                                            */ 184,
-/* CalculatedTargetPosition                                       */ 920,
-/* CalculationComment                                             */ 1728,
-/* CalculationCommentSequence                                     */ 1726,
-/* CalculationCommentType                                         */ 1727,
-/* CalibrationDataSequence                                        */ 2829,
-/* CalibrationDate                                                */ 492,
-/* CalibrationImage                                               */ 2741,
-/* CalibrationNotes                                               */ 433,
-/* CalibrationProcedure                                           */ 486,
-/* CalibrationSequence                                            */ 1320,
-/* CalibrationSettingsSequence                                    */ 485,
-/* CalibrationTime                                                */ 491,
-/* CameraAngleOfView                                              */ 1659,
-/* CameraElevationAngle                                           */ 599,
-/* CameraOwnerName                                                */ 618,
-/* CameraPositionGroupSequence                                    */ 2191,
-/* CardiacBeatRejectionTechnique                                  */ 1143,
+/* BatteryLevel                                                   */ 553,
+/* SendingApplicationEntityTitle                                  */ 8,
+/* BlockSlabThickness                                             */ 4249,
+/* ASLBolusCutoffTimingSequence                                   */ 1194,
+/* CurveDate                                                      */ 60,
+/* ReferencedSpatialRegistrationSequence                          */ 3150,
+/* BlockData                                                      */ 4007,
+/* PixelValueMappingCodeSequence                                  */ 2448,
+/* LargestImagePixelValue                                         */ 1952,
+/* ProcedureStepProgressDescription                               */ 3356,
+/* ComplexImageComponent                                          */ 251,
+/* RegistrationSequence                                           */ 3130,
+/* NumberOfMapPoints                                              */ 1784,
+/* PresentationAnimationStyle                                     */ 3211,
+/* DiffuseReflectionIntensity                                     */ 3195,
+/* AnodeTargetMaterial                                            */ 822,
+/* MetersetToDoseMappingSequence                                  */ 4299,
+/* TerminationCountsThreshold                                     */ 1395,
+/* ContainerComponentThickness                                    */ 2744,
+/* DataInformationSequence                                        */ 2810,
+/* GeneralizedDefectSensitivityDeviationAlgorithmSequence         */ 1846,
+/* ScreeningBaselineType                                          */ 1893,
+/* AcquisitionNumber                                              */ 1513,
+/* SubstanceAdministrationApproval                                */ 2595,
+/* InterpretationRecordedDate                                     */ 4638,
+/* RelativeOpacity                                                */ 3149,
+/* RadiationGenerationModeIndex                                   */ 4268,
+/* NormalizationFactorFormat                                      */ 1981,
+/* RadiopharmaceuticalStartTime                                   */ 760,
+/* RequestedProcedureDescriptionTrial                             */ 2382,
+/* CoordinateStartValue                                           */ 4760,
+/* ScanSpotTuneID                                                 */ 4213,
+/* HangingProtocolDefinitionSequence                              */ 3235,
+/* OverlayActivationLayer                                         */ 4811,
+/* PixelShiftFrameRange                                           */ 2149,
+/* ReferencedImageRealWorldValueMappingSequence                   */ 2446,
+/* SubjectDistanceRange                                           */ 617,
+/* StackID                                                        */ 1568,
+/* TimeOfSecondaryCapture                                         */ 723,
+/* SteepCornealAxisSequence                                       */ 2660,
+/* OrderCallbackTelecomInformation                                */ 2396,
+/* DeviceLabel                                                    */ 4529,
+/* MRDRDirectoryRecordOffset                                      */ 35,
+/* FirstALineLocation                                             */ 2779,
+/* ATDAssessmentFlag                                              */ 4678,
+/* GridSpacingMaterial                                            */ 1024,
+/* PixelComponentRangeStop                                        */ 986,
+/* ReferencedTreatmentRecordSequence                              */ 3782,
+/* GeneralPurposePerformedProcedureStepStatus                     */ 2402,
+/* BlockDivergence                                                */ 4000,
+/* DisplaySubsystemName                                           */ 2081,
+/* PrinterCharacteristicsSequence                                 */ 3642,
+/* PixelOriginInterpretation                                      */ 2738,
+/* BoundingBoxTextHorizontalJustification                         */ 3053,
+/* ExposuresOnPlate                                               */ 856,
+/* DisplayFunctionType                                            */ 2102,
+/* ReferencedRTInstanceSequence                                   */ 4316,
+/* SUVType                                                        */ 2841,
+/* ImageTranslationVector                                         */ 948,
+/* PriorTreatmentDoseDescription                                  */ 4581,
+/* RadiationDoseMeasurementPointCoordinates                       */ 4306,
+/* GPSImgDirectionRef                                             */ 641,
+/* ScreeningBaselineMeasuredSequence                              */ 1892,
+/* StructureSetDescription                                        */ 3717,
+/* BridgeResistors                                                */ 501,
+/* BasisRTTreatmentPhaseIndex                                     */ 4546,
+/* EmptyImageBoxCIELabValue                                       */ 3324,
+/* NumberOfPoints                                                 */ 4750,
+/* AxialMash                                                      */ 2849,
+/* ElementShape                                                   */ 445,
+/* StudyIDIssuer                                                  */ 2155,
+/* ScheduledAdmissionTime                                         */ 2201,
+/* EquivalentPupilRadius                                          */ 2682,
+/* PatientState                                                   */ 2221,
+/* WedgeType                                                      */ 3963,
+/* DeviationIndex                                                 */ 860,
+/* ReferencedRefractiveMeasurementsSequence                       */ 2675,
+/* InterventionDrugStartTime                                      */ 677,
+/* DigitalZoomRatio                                               */ 609,
+/* RTRadiationSetUsage                                            */ 4412,
+/* ChemicalShiftMinimumIntegrationLimitInppm                      */ 1198,
+/* DocumentingOrganizationIdentifierCodeSequenceTrial             */ 2467,
+/* ReferencedControlPointIndex                                    */ 4471,
+/* SoftwareVersions                                               */ 730,
 /* CardiacCyclePosition                                           */ 1177,
-/* CardiacFramingType                                             */ 749,
-/* CardiacNumberOfImages                                          */ 776,
-/* CardiacRRIntervalSpecified                                     */ 1096,
-/* CardiacSignalSource                                            */ 1109,
-/* CardiacSynchronizationSequence                                 */ 1131,
-/* CardiacSynchronizationTechnique                                */ 1070,
-/* CarrierID                                                      */ 4721,
-/* CarrierIDAssigningAuthority                                    */ 4722,
-/* CassetteID                                                     */ 715,
-/* CassetteOrientation                                            */ 854,
-/* CassetteSize                                                   */ 855,
-/* CatchTrialsDataFlag                                            */ 1834,
-/* CatheterDirectionOfRotation                                    */ 2777,
-/* CatheterRotationalRate                                         */ 2768,
-/* CenterOfCircularCollimator                                     */ 901,
-/* CenterOfCircularExposureControlSensingRegion                   */ 1312,
-/* CenterOfCircularOutline                                        */ 892,
-/* CenterOfCircularShutter                                        */ 881,
-/* CenterOfMass                                                   */ 4684,
-/* CenterOfPTO                                                    */ 4685,
-/* CenterOfRotation                                               */ 2922,
-/* CenterOfRotationOffset                                         */ 797,
-/* CertificateOfSigner                                            */ 3521,
+/* XRay3DAcquisitionSequence                                      */ 1341,
 /* CertificateType                                                */ 3520,
-/* CertifiedTimestamp                                             */ 3524,
-/* CertifiedTimestampType                                         */ 3523,
-/* ChairHeadFramePosition                                         */ 4051,
-/* ChairHeadFramePositionTolerance                                */ 4053,
-/* ChannelBaseline                                                */ 2240,
-/* ChannelDefinitionSequence                                      */ 2229,
-/* ChannelDeliveryContinuationSequence                            */ 3423,
-/* ChannelDeliveryOrderIndex                                      */ 3422,
-/* ChannelDeliveryOrderSequence                                   */ 3415,
-/* ChannelDerivationDescription                                   */ 2236,
+/* RelativeURIReferenceWithinEncapsulatedDocument                 */ 3042,
+/* DACType                                                        */ 467,
+/* TherapyType                                                    */ 679,
+/* DigitalSignaturesSequence                                      */ 4839,
+/* SourceEncapsulationNominalThickness                            */ 4094,
+/* RelatedRTROIObservationsSequence                               */ 3752,
+/* DataPointRows                                                  */ 2125,
+/* SurfacePointsNormalsSequence                                   */ 2913,
+/* Pressure                                                       */ 596,
+/* LabelStyleSelection                                            */ 3652,
+/* SeamLineIndex                                                  */ 2780,
+/* CenterOfPTO                                                    */ 4685,
+/* AngioFlag                                                      */ 666,
+/* MultipleSpinEcho                                               */ 1047,
+/* MatrixRegistrationSequence                                     */ 3131,
+/* NavigationIndicatorSequence                                    */ 3304,
+/* PaletteColorLookupTableUID                                     */ 2013,
+/* VariableFlipAngleFlag                                          */ 848,
+/* ASLCrusherDescription                                          */ 1192,
+/* ColorImagePrintingFlag                                         */ 3557,
+/* DetectorSecondaryAngle                                         */ 875,
+/* VerbalSourceTrial                                              */ 2537,
+/* ModulatedScanModeType                                          */ 4167,
+/* TransmitCoilName                                               */ 837,
+/* RTRadiationPhysicalAndGeometricContentDetailFlag               */ 4322,
+/* IdentifyingComments                                            */ 241,
+/* DoseMeasurementDeviceCodeSequence                              */ 4443,
+/* InputSequencePositionIndex                                     */ 3158,
+/* FrameReferenceTime                                             */ 2854,
+/* TMLinePositionY1Retired                                        */ 981,
 /* ChannelDescriptionCodeSequence                                 */ 1655,
-/* ChannelDisplaySequence                                         */ 2253,
-/* ChannelEffectiveLength                                         */ 4119,
-/* ChannelIdentificationCode                                      */ 2260,
-/* ChannelImpedanceSequence                                       */ 2264,
-/* ChannelInnerLength                                             */ 4120,
-/* ChannelLabel                                                   */ 2231,
-/* ChannelLength                                                  */ 4125,
-/* ChannelMaximumValue                                            */ 4779,
-/* ChannelMinimumValue                                            */ 4778,
-/* ChannelMode                                                    */ 2261,
-/* ChannelNumber                                                  */ 4124,
-/* ChannelOffset                                                  */ 2243,
-/* ChannelOverlap                                                 */ 513,
-/* ChannelPosition                                                */ 2255,
-/* ChannelRecommendedDisplayCIELabValue                           */ 2254,
-/* ChannelSampleSkew                                              */ 2242,
-/* ChannelSensitivity                                             */ 2237,
-/* ChannelSensitivityCorrectionFactor                             */ 2239,
-/* ChannelSensitivityUnitsSequence                                */ 2238,
-/* ChannelSequence                                                */ 4123,
-/* ChannelSettingsSequence                                        */ 507,
-/* ChannelShieldID                                                */ 4143,
-/* ChannelShieldName                                              */ 4144,
-/* ChannelShieldNominalThickness                                  */ 4145,
-/* ChannelShieldNominalTransmission                               */ 4146,
+/* EntityDescription                                              */ 4539,
+/* Grid                                                           */ 814,
+/* BreedRegistrationSequence                                      */ 327,
+/* DeviceAlternateIdentifierType                                  */ 4512,
+/* MultiplexGroupUID                                              */ 2262,
 /* ChannelShieldNumber                                            */ 4142,
-/* ChannelShieldSequence                                          */ 4141,
-/* ChannelSourceModifiersSequence                                 */ 2234,
-/* ChannelSourceSequence                                          */ 2233,
-/* ChannelStatus                                                  */ 2232,
-/* ChannelThreshold                                               */ 508,
-/* ChannelTimeSkew                                                */ 2241,
-/* ChannelTotalTime                                               */ 4126,
-/* ChannelWidth                                                   */ 2631,
-/* ChemicalShiftMaximumIntegrationLimitInHz                       */ 1162,
-/* ChemicalShiftMaximumIntegrationLimitInppm                      */ 1199,
-/* ChemicalShiftMinimumIntegrationLimitInHz                       */ 1161,
-/* ChemicalShiftMinimumIntegrationLimitInppm                      */ 1198,
-/* ChemicalShiftReference                                         */ 1083,
-/* ChemicalShiftSequence                                          */ 1108,
-/* CineRate                                                       */ 683,
-/* CineRelativeToRealTime                                         */ 3318,
-/* ClinicalFractionNumber                                         */ 4410,
-/* ClinicalTrialCoordinatingCenterName                            */ 346,
-/* ClinicalTrialProtocolEthicsCommitteeApprovalNumber             */ 353,
-/* ClinicalTrialProtocolEthicsCommitteeName                       */ 352,
-/* ClinicalTrialProtocolID                                        */ 336,
-/* ClinicalTrialProtocolName                                      */ 337,
-/* ClinicalTrialSeriesDescription                                 */ 351,
-/* ClinicalTrialSeriesID                                          */ 350,
-/* ClinicalTrialSiteID                                            */ 338,
-/* ClinicalTrialSiteName                                          */ 339,
-/* ClinicalTrialSponsorName                                       */ 335,
-/* ClinicalTrialSubjectID                                         */ 340,
-/* ClinicalTrialSubjectReadingID                                  */ 341,
-/* ClinicalTrialTimePointDescription                              */ 343,
-/* ClinicalTrialTimePointID                                       */ 342,
-/* CoatingMaterialsCodeSequence                                   */ 3001,
-/* CodeLabel                                                      */ 1987,
-/* CodeMeaning                                                    */ 99,
-/* CodeNumberFormat                                               */ 1986,
-/* CodeTableLocation                                              */ 1989,
-/* CodeValue                                                      */ 95,
-/* CodingSchemeDesignator                                         */ 97,
-/* CodingSchemeExternalID                                         */ 113,
-/* CodingSchemeIdentificationSequence                             */ 111,
-/* CodingSchemeName                                               */ 114,
-/* CodingSchemeRegistry                                           */ 112,
-/* CodingSchemeResourcesSequence                                  */ 104,
-/* CodingSchemeResponsibleOrganization                            */ 115,
-/* CodingSchemeUID                                                */ 107,
-/* CodingSchemeURL                                                */ 109,
-/* CodingSchemeURLType                                            */ 105,
-/* CodingSchemeVersion                                            */ 98,
-/* CoefficientCoding                                              */ 1976,
-/* CoefficientCodingPointers                                      */ 1977,
-/* CoefficientsSDDN                                               */ 4833,
-/* CoefficientsSDHN                                               */ 4832,
-/* CoefficientsSDVN                                               */ 4831,
-/* CoincidenceWindowWidth                                         */ 2852,
-/* CollationFlag                                                  */ 3558,
-/* CollimatorGridName                                             */ 816,
-/* CollimatorLeftVerticalEdge                                     */ 897,
-/* CollimatorLowerHorizontalEdge                                  */ 900,
-/* CollimatorRightVerticalEdge                                    */ 898,
-/* CollimatorShape                                                */ 896,
-/* CollimatorShapeSequence                                        */ 1291,
-/* CollimatorType                                                 */ 817,
-/* CollimatorUpperHorizontalEdge                                  */ 899,
-/* ColorFilterArrayPatternColumns                                 */ 565,
-/* ColorFilterArrayPatternRows                                    */ 564,
-/* ColorFilterArrayPatternValues                                  */ 566,
-/* ColorImagePrintingFlag                                         */ 3557,
-/* ColorSpace                                                     */ 2050,
-/* ColumnAngulation                                               */ 861,
-/* ColumnAngulationPatient                                        */ 1316,
-/* ColumnOverlap                                                  */ 1944,
-/* ColumnPositionInTotalImagePixelMatrix                          */ 2736,
-/* Columns                                                        */ 1915,
-/* ColumnsForNthOrderCoefficients                                 */ 1975,
-/* CombinationSegmentReferenceSequence                            */ 4520,
-/* CommentsOnPatientPerformanceOfVisualField                      */ 1825,
-/* CommentsOnRadiationDose                                        */ 2323,
-/* CommentsOnThePerformedProcedureStep                            */ 2310,
-/* CommentsOnTheScheduledProcedureStep                            */ 2333,
-/* CompensatorBasePlaneOffset                                     */ 4368,
-/* CompensatorColumnOffset                                        */ 4157,
-/* CompensatorColumns                                             */ 3983,
-/* CompensatorDefinitionSequence                                  */ 4364,
-/* CompensatorDescription                                         */ 4162,
-/* CompensatorDistalThicknessMap                                  */ 4367,
-/* CompensatorDivergence                                          */ 4152,
-/* CompensatorID                                                  */ 3980,
-/* CompensatorMapOrientation                                      */ 4365,
-/* CompensatorMillingToolDiameter                                 */ 4160,
-/* CompensatorMountingPosition                                    */ 4153,
-/* CompensatorNumber                                              */ 3979,
-/* CompensatorPixelSpacing                                        */ 3984,
-/* CompensatorPosition                                            */ 3985,
-/* CompensatorProximalThicknessMap                                */ 4366,
-/* CompensatorRelativeStoppingPowerRatio                          */ 4159,
-/* CompensatorRows                                                */ 3982,
-/* CompensatorSequence                                            */ 3978,
-/* CompensatorShapeFabricationCodeSequence                        */ 4369,
-/* CompensatorShapeSequence                                       */ 4370,
-/* CompensatorThicknessData                                       */ 3987,
-/* CompensatorTransmissionData                                    */ 3986,
-/* CompensatorTrayID                                              */ 3990,
-/* CompensatorType                                                */ 3989,
-/* CompletionFlag                                                 */ 2551,
-/* CompletionFlagDescription                                      */ 2552,
-/* ComplexImageComponent                                          */ 251,
-/* Component1ReferencedID                                         */ 3442,
-/* Component1ReferencedMatingFeatureID                            */ 3444,
-/* Component1ReferencedMatingFeatureSetID                         */ 3443,
-/* Component2ReferencedID                                         */ 3445,
-/* Component2ReferencedMatingFeatureID                            */ 3447,
-/* Component2ReferencedMatingFeatureSetID                         */ 3446,
-/* ComponentAssemblySequence                                      */ 3441,
-/* ComponentID                                                    */ 3440,
-/* ComponentInputSequence                                         */ 3200,
-/* ComponentManufacturer                                          */ 362,
-/* ComponentManufacturingProcedure                                */ 361,
-/* ComponentReferenceSystem                                       */ 360,
-/* ComponentSequence                                              */ 3439,
-/* ComponentShape                                                 */ 370,
-/* ComponentType                                                  */ 3199,
-/* ComponentTypeCodeSequence                                      */ 3436,
-/* ComponentTypesSequence                                         */ 3435,
-/* ComponentWelderIDs                                             */ 374,
-/* CompositingMethod                                              */ 3161,
-/* CompoundGraphicInstanceID                                      */ 3088,
-/* CompoundGraphicSequence                                        */ 3087,
-/* CompoundGraphicType                                            */ 3127,
-/* CompoundGraphicUnits                                           */ 3121,
-/* CompressionCode                                                */ 1927,
-/* CompressionContactArea                                         */ 827,
-/* CompressionDescription                                         */ 1930,
-/* CompressionForce                                               */ 824,
-/* CompressionLabel                                               */ 1929,
-/* CompressionOriginator                                          */ 1928,
-/* CompressionPressure                                            */ 825,
-/* CompressionRecognitionCode                                     */ 1926,
-/* CompressionSequence                                            */ 1931,
-/* CompressionStepPointers                                        */ 1932,
-/* ConcatenationFrameOffsetNumber                                 */ 1594,
-/* ConcatenationUID                                               */ 1582,
-/* ConceptCodeSequence                                            */ 2513,
-/* ConceptNameCodeSequence                                        */ 2471,
-/* ConceptualVolumeBlockingConstraint                             */ 4588,
-/* ConceptualVolumeCategoryCodeSequence                           */ 4587,
-/* ConceptualVolumeCombinationDescription                         */ 4499,
-/* ConceptualVolumeCombinationExpression                          */ 4496,
-/* ConceptualVolumeCombinationFlag                                */ 4498,
-/* ConceptualVolumeConstituentIndex                               */ 4497,
-/* ConceptualVolumeConstituentSegmentationReferenceSequence       */ 4502,
-/* ConceptualVolumeConstituentSequence                            */ 4492,
-/* ConceptualVolumeDerivationAlgorithmSequence                    */ 4506,
-/* ConceptualVolumeDescription                                    */ 4507,
-/* ConceptualVolumeOptimizationPrecedence                         */ 4586,
-/* ConceptualVolumeSegmentationDefinedFlag                        */ 4500,
-/* ConceptualVolumeSegmentationReferenceSequence                  */ 4501,
-/* ConceptualVolumeSequence                                       */ 4521,
-/* ConceptualVolumeTypeCodeSequence                               */ 4589,
-/* ConceptualVolumeTypeModifierCodeSequence                       */ 4590,
-/* ConceptualVolumeUID                                            */ 4490,
-/* CondenserLensPower                                             */ 2727,
-/* ConfidentialityCode                                            */ 2376,
-/* ConfidentialityConstraintOnPatientDataDescription              */ 2400,
-/* ConfigurationDescription                                       */ 2090,
-/* ConfigurationID                                                */ 2088,
-/* ConfigurationInformation                                       */ 3587,
-/* ConfigurationInformationDescription                            */ 3588,
-/* ConfigurationName                                              */ 2089,
-/* ConfigurationQAResultsSequence                                 */ 2094,
-/* ConfirmationSequence                                           */ 4430,
-/* ConnectorType                                                  */ 524,
-/* ConsentForClinicalTrialUseSequence                             */ 354,
-/* ConsentForDistributionFlag                                     */ 356,
-/* ConstantVolumeFlag                                             */ 1233,
-/* ConstituentConceptualVolumeUID                                 */ 4503,
-/* ConstraintType                                                 */ 3496,
-/* ConstraintValueSequence                                        */ 3498,
-/* ConstraintViolationCondition                                   */ 3501,
-/* ConstraintViolationSignificance                                */ 3500,
-/* ConstraintWeight                                               */ 3884,
-/* ConsultingPhysicianIdentificationSequence                      */ 94,
-/* ConsultingPhysicianName                                        */ 93,
-/* ContactDisplayName                                             */ 3360,
-/* ContactURI                                                     */ 3359,
-/* ContainerComponentDescription                                  */ 2755,
-/* ContainerComponentDiameter                                     */ 2754,
-/* ContainerComponentID                                           */ 2752,
-/* ContainerComponentLength                                       */ 2753,
-/* ContainerComponentMaterial                                     */ 2751,
-/* ContainerComponentSequence                                     */ 2343,
-/* ContainerComponentThickness                                    */ 2744,
-/* ContainerComponentTypeCodeSequence                             */ 2743,
-/* ContainerComponentWidth                                        */ 2746,
-/* ContainerDescription                                           */ 2342,
-/* ContainerIdentifier                                            */ 2338,
-/* ContainerTypeCodeSequence                                      */ 2341,
-/* ContentCreatorIdentificationCodeSequence                       */ 3079,
-/* ContentCreatorName                                             */ 3078,
-/* ContentDate                                                    */ 58,
-/* ContentDescription                                             */ 3075,
-/* ContentItemModifierSequence                                    */ 2335,
-/* ContentLabel                                                   */ 3074,
-/* ContentQualification                                           */ 1041,
-/* ContentSequence                                                */ 2561,
-/* ContentTemplateSequence                                        */ 2556,
-/* ContentTime                                                    */ 65,
-/* ContextGroupExtensionCreatorUID                                */ 108,
-/* ContextGroupExtensionFlag                                      */ 106,
-/* ContextGroupIdentificationSequence                             */ 122,
-/* ContextGroupLocalVersion                                       */ 102,
-/* ContextGroupVersion                                            */ 101,
-/* ContextIdentifier                                              */ 110,
-/* ContextUID                                                     */ 116,
-/* ContinuationEndMeterset                                        */ 3352,
+/* ScheduledStudyLocation                                         */ 2164,
+/* OrderFillerIdentifierSequence                                  */ 2285,
+/* OphthalmicAxialLengthQualityMetricTypeDescription              */ 1752,
+/* UserSelectedGainY                                              */ 503,
+/* RefractiveIndexApplied                                         */ 2783,
+/* BeamDoseType                                                   */ 3931,
+/* MatingFeatureSequence                                          */ 3007,
 /* ContinuationEndTotalReferenceAirKerma                          */ 3413,
-/* ContinuationPulseNumber                                        */ 3414,
-/* ContinuationStartMeterset                                      */ 3351,
-/* ContinuationStartTotalReferenceAirKerma                        */ 3412,
-/* ContinuityOfContent                                            */ 2473,
-/* ContourData                                                    */ 3745,
-/* ContourGeometricType                                           */ 3739,
-/* ContourImageSequence                                           */ 3723,
-/* ContourNumber                                                  */ 3743,
-/* ContourOffsetVector                                            */ 3741,
-/* ContourSequence                                                */ 3738,
-/* ContourSlabThickness                                           */ 3740,
-/* ContourUncertaintyRadius                                       */ 3139,
-/* ContraindicationsCodeSequence                                  */ 1458,
-/* Contrast                                                       */ 613,
-/* ContrastAdministrationProfileSequence                          */ 1238,
-/* ContrastBolusAdministrationRouteSequence                       */ 659,
-/* ContrastBolusAgent                                             */ 656,
-/* ContrastBolusAgentAdministered                                 */ 1240,
-/* ContrastBolusAgentDetected                                     */ 1241,
-/* ContrastBolusAgentNumber                                       */ 1236,
-/* ContrastBolusAgentPhase                                        */ 1242,
-/* ContrastBolusAgentSequence                                     */ 657,
-/* ContrastBolusIngredient                                        */ 742,
-/* ContrastBolusIngredientCodeSequence                            */ 1237,
+/* GPSDestBearing                                                 */ 649,
+/* FrameAcquisitionSequence                                       */ 1294,
+/* SlabThickness                                                  */ 1123,
+/* Units                                                          */ 2838,
+/* TreatmentTerminationStatus                                     */ 3779,
+/* IntensifierActiveDimensions                                    */ 1301,
+/* InstructionText                                                */ 1469,
+/* CurveActivationLayer                                           */ 4762,
+/* DoubleFloatRealWorldValueLastValueMapped                       */ 2452,
+/* DegreeOfFreedomType                                            */ 3011,
+/* PresentedVisualStimuliDataFlag                                 */ 1820,
+/* RangeOfFreedom                                                 */ 3018,
+/* ContributingSourcesSequence                                    */ 1340,
+/* ReferencedToleranceTableNumber                                 */ 4466,
+/* NotchFilterBandwidth                                           */ 2248,
+/* MagnetizationTransfer                                          */ 1055,
+/* StudiesContainingOtherReferencedInstancesSequence              */ 195,
+/* ExposureIndex                                                  */ 858,
+/* ReferringPhysicianAddress                                      */ 90,
+/* BreedRegistryCodeSequence                                      */ 329,
+/* RegionDataType                                                 */ 952,
+/* ObservationDateTime                                            */ 2469,
+/* OphthalmicAxialLengthMeasurementsType                          */ 1684,
+/* RadiationMachineSAD                                            */ 3677,
+/* TreatmentRecordContentOrigin                                   */ 4414,
+/* PixelPaddingValue                                              */ 1957,
+/* MultienergyAcquisitionDescription                              */ 1275,
+/* ManufacturerRelatedModelGroup                                  */ 128,
+/* DiaphragmPosition                                              */ 3684,
 /* ContrastBolusIngredientConcentration                           */ 743,
-/* ContrastBolusIngredientOpaque                                  */ 1298,
-/* ContrastBolusIngredientPercentByVolume                         */ 2758,
-/* ContrastBolusRoute                                             */ 734,
+/* ContextUID                                                     */ 116,
+/* BrachyReferencedDoseReferenceSequence                          */ 4462,
+/* ASLBolusCutoffFlag                                             */ 1193,
+/* DisplaySetsSequence                                            */ 3296,
+/* AudioSampleFormat                                              */ 4764,
+/* LinePattern                                                    */ 3111,
+/* ConceptualVolumeCategoryCodeSequence                           */ 4587,
+/* DistanceSourceToIsocenter                                      */ 1286,
+/* ImagedNucleus                                                  */ 699,
 /* ContrastBolusStartTime                                         */ 736,
-/* ContrastBolusStopTime                                          */ 737,
-/* ContrastBolusT1Relaxivity                                      */ 658,
-/* ContrastBolusTotalDose                                         */ 738,
-/* ContrastBolusUsageSequence                                     */ 1239,
-/* ContrastBolusVolume                                            */ 735,
-/* ContrastFlowDuration                                           */ 741,
-/* ContrastFlowRate                                               */ 740,
-/* ContrastFrameAveraging                                         */ 2073,
-/* ContributingEquipmentSequence                                  */ 1506,
-/* ContributingSOPInstancesReferenceSequence                      */ 1629,
-/* ContributingSourcesSequence                                    */ 1340,
-/* ContributionDateTime                                           */ 1507,
-/* ContributionDescription                                        */ 1508,
-/* ControlPoint3DPosition                                         */ 4150,
-/* ControlPointDeliverySequence                                   */ 3789,
-/* ControlPointIndex                                              */ 4016,
-/* ControlPointOrientation                                        */ 4233,
-/* ControlPointRelativePosition                                   */ 4149,
-/* ControlPointSequence                                           */ 4015,
-/* ConventionalControlPointVerificationSequence                   */ 3385,
-/* ConventionalMachineVerificationSequence                        */ 3381,
-/* ConversionSourceAttributesSequence                             */ 1590,
-/* ConversionType                                                 */ 83,
-/* ConvolutionKernel                                              */ 831,
-/* ConvolutionKernelGroup                                         */ 1217,
-/* CoordinateStartValue                                           */ 4760,
-/* CoordinateStepValue                                            */ 4761,
-/* CoordinateSystemAxesSequence                                   */ 400,
-/* CoordinateSystemAxisCodeSequence                               */ 2366,
-/* CoordinateSystemAxisDescription                                */ 401,
-/* CoordinateSystemAxisNumber                                     */ 403,
-/* CoordinateSystemAxisType                                       */ 404,
-/* CoordinateSystemAxisUnits                                      */ 405,
-/* CoordinateSystemAxisValues                                     */ 406,
-/* CoordinateSystemDataSetMapping                                 */ 402,
-/* CoordinateSystemNumberOfAxes                                   */ 399,
-/* CoordinateSystemTransformRotationAndScaleMatrix                */ 412,
-/* CoordinateSystemTransformSequence                              */ 407,
-/* CoordinateSystemTransformTranslationMatrix                     */ 413,
-/* CoordinatesSetGeometricTypeTrial                               */ 2526,
-/* CorneaMeasurementMethodCodeSequence                            */ 2664,
-/* CorneaMeasurementsSequence                                     */ 2658,
-/* CornealAxis                                                    */ 2663,
-/* CornealEccentricityIndex                                       */ 2696,
-/* CornealISValue                                                 */ 2692,
-/* CornealPointEstimated                                          */ 2702,
-/* CornealPointLocation                                           */ 2701,
-/* CornealPower                                                   */ 2662,
-/* CornealSize                                                    */ 2633,
-/* CornealSizeSequence                                            */ 2634,
-/* CornealTopographyMapQualityEvaluation                          */ 2699,
-/* CornealTopographyMapTypeCodeSequence                           */ 2683,
-/* CornealTopographyMappingNormalsSequence                        */ 2685,
-/* CornealTopographySurface                                       */ 2678,
-/* CornealVertexLocation                                          */ 2679,
+/* CineRate                                                       */ 683,
+/* MaterialCodeSequence                                           */ 1277,
+/* GridPitch                                                      */ 1026,
+/* LensDescription                                                */ 2619,
+/* FirstOrderPhaseCorrectionAngle                                 */ 4784,
+/* MainRoofAngle                                                  */ 523,
+/* DeliveredNominalRangeModulationFractions                       */ 4263,
+/* MRAcquisitionType                                              */ 664,
+/* CalculatedDoseReferenceDoseValue                               */ 3815,
+/* TotalCompensatorTrayFactor                                     */ 3977,
+/* LongTrianglePointIndexList                                     */ 2949,
+/* EventCodeSequence                                              */ 211,
+/* OCTFocalDistance                                               */ 2759,
+/* TreatmentSummaryMeasuredDoseReferenceSequence                  */ 3826,
+/* ReferencedOverlayPlaneSequence                                 */ 3609,
+/* TreatmentTerminationCode                                       */ 3780,
+/* SoftTissueFocusThermalIndex                                    */ 939,
+/* PartialFourierDirection                                        */ 1069,
+/* ReferenceToRecordedSound                                       */ 4641,
+/* VisualFieldTestPointNormalsSequence                            */ 1874,
+/* AcquisitionSampleSize                                          */ 464,
+/* IVUSPullbackRate                                               */ 924,
+/* DeviceAlternateIdentifierFormat                                */ 4513,
+/* DeliveredNominalRangeModulatedRegionDepths                     */ 4264,
+/* NumberOfRotations                                              */ 2804,
+/* AnatomicStructure                                              */ 217,
+/* DetectorVector                                                 */ 2793,
+/* ReformattingThickness                                          */ 3333,
+/* MediaStorageSOPInstanceUID                                     */ 3,
+/* PatientPrimaryLanguageCodeSequence                             */ 274,
+/* SensingMethod                                                  */ 603,
+/* Reference                                                      */ 1547,
+/* ReferencedPrintJobSequence                                     */ 3640,
+/* OverlayLabel                                                   */ 4823,
+/* BibliographicCitationTrial                                     */ 2514,
+/* RotationInformationSequence                                    */ 2805,
+/* WedgeThinEdgePosition                                          */ 3971,
+/* RescaleIntercept                                               */ 1998,
+/* SafePositionExitDate                                           */ 3849,
+/* SegmentedGreenPaletteColorLookupTableData                      */ 2024,
+/* BulkMotionCompensationTechnique                                */ 1146,
+/* PropertyLabel                                                  */ 398,
+/* AssertionCodeSequence                                          */ 2609,
+/* ProcedureContextFlagTrial                                      */ 2560,
+/* ScatterFractionFactor                                          */ 2860,
+/* TotalAperture                                                  */ 520,
+/* SetupDeviceParameter                                           */ 4078,
+/* PowerlineFrequency                                             */ 2263,
+/* PotentialThreatObjectID                                        */ 4673,
+/* RecordedChannelShieldSequence                                  */ 3846,
 /* CornealWavefront                                               */ 2707,
-/* CorrectedImage                                                 */ 1925,
-/* CorrectedLocalizedDeviationFromNormal                          */ 1858,
-/* CorrectedLocalizedDeviationFromNormalCalculated                */ 1857,
-/* CorrectedLocalizedDeviationFromNormalProbability               */ 1860,
-/* CorrectedLocalizedDeviationFromNormalProbabilityCalculated     */ 1859,
-/* CorrectedParameterSequence                                     */ 3810,
+/* ImageTriggerDelay                                              */ 752,
+/* DetectorXPositionToIsocenter                                   */ 1371,
+/* AnchorPointAnnotationUnits                                     */ 3046,
+/* NumberOfPriorsReferenced                                       */ 3239,
+/* PhaseContrast                                                  */ 1049,
+/* SegmentSurfaceSourceInstanceSequence                           */ 2938,
+/* GeneticModificationsNomenclature                               */ 288,
+/* InterventionDrugInformationSequence                            */ 667,
+/* ReferencedDefinedProtocolSequence                              */ 1459,
+/* ObservationSignificance                                        */ 3485,
+/* PrinterStatus                                                  */ 3634,
+/* LargestValidPixelValue                                         */ 1950,
+/* TangentialPower                                                */ 2704,
+/* BasisMaterialsCodeSequence                                     */ 4711,
+/* EnergyWindowVector                                             */ 2784,
+/* ImageID                                                        */ 2831,
+/* HistogramBinWidth                                              */ 2869,
+/* MaterialPropertiesFileFormatRetired                            */ 368,
+/* ContrastBolusAgentSequence                                     */ 657,
+/* LensStatusDescription                                          */ 1709,
+/* PatternOffColorCIELabValue                                     */ 3108,
+/* ChannelLabel                                                   */ 2231,
+/* LongDeviceDescription                                          */ 2757,
+/* TemplateIdentifier                                             */ 2567,
+/* ProposedStudySequence                                          */ 3648,
+/* TomoClass                                                      */ 866,
+/* DecimateCropResult                                             */ 3602,
+/* PerformedStationClassCodeSequence                              */ 2424,
+/* MakerNote                                                      */ 593,
+/* DecayCorrectionDateTime                                        */ 1390,
+/* ReformattingOperationType                                      */ 3332,
+/* ExposuresOnDetectorSinceLastCalibration                        */ 1005,
+/* SegmentReferenceIndex                                          */ 4518,
+/* DetectorManufacturerModelName                                  */ 1017,
+/* RegistrationTypeCodeSequence                                   */ 3135,
+/* ImagesInStudy                                                  */ 1546,
+/* GridAbsorbingMaterial                                          */ 1023,
+/* BeamDosePointDepth                                             */ 3923,
 /* CorrectionValue                                                */ 3811,
-/* CountLossNormalizationCorrected                                */ 1424,
-/* CountRate                                                      */ 834,
-/* CountryOfResidence                                             */ 310,
-/* CountsAccumulated                                              */ 688,
-/* CountsIncluded                                                 */ 2863,
-/* CountsSource                                                   */ 2839,
-/* CouplingMedium                                                 */ 476,
-/* CouplingTechnique                                              */ 475,
-/* CouplingVelocity                                               */ 477,
-/* CoverageOfKSpace                                               */ 1116,
-/* CranialThermalIndex                                            */ 937,
-/* CreationDate                                                   */ 3627,
-/* CreationTime                                                   */ 3628,
-/* CreatorVersionUID                                              */ 245,
-/* Crop                                                           */ 3159,
-/* CroppingSpecificationIndex                                     */ 3160,
-/* CroppingSpecificationNumber                                    */ 3175,
-/* CumulativeDoseReferenceCoefficient                             */ 4012,
-/* CumulativeDoseToDoseReference                                  */ 3798,
-/* CumulativeMeterset                                             */ 4326,
-/* CumulativeMetersetWeight                                       */ 4041,
-/* CumulativeTimeWeight                                           */ 4151,
-/* CurrentConfigurationID                                         */ 2079,
-/* CurrentFractionNumber                                          */ 3776,
-/* CurrentFrameFunctionalGroupsSequence                           */ 41,
-/* CurrentObserverTrial                                           */ 2532,
-/* CurrentPatientLocation                                         */ 2219,
-/* CurrentRequestedProcedureEvidenceSequence                      */ 2544,
-/* CurrentTreatmentStatus                                         */ 3856,
+/* RecommendedViewingMode                                         */ 2004,
+/* FlowCompensationDirection                                      */ 1157,
+/* EnergyWindowNumber                                             */ 2830,
+/* WedgeInContactLength                                           */ 541,
+/* EnergyWindowTotalWidth                                         */ 675,
+/* ObservationSubjectContextFlagTrial                             */ 2558,
+/* InPlanePhaseEncodingDirection                                  */ 846,
 /* CurvatureType                                                  */ 371,
-/* CurveActivationLayer                                           */ 4762,
-/* CurveData                                                      */ 4774,
-/* CurveDataDescriptor                                            */ 4759,
-/* CurveDate                                                      */ 60,
-/* CurveDescription                                               */ 4752,
-/* CurveDimensions                                                */ 4749,
-/* CurveLabel                                                     */ 4771,
-/* CurveNumber                                                    */ 1523,
-/* CurveRange                                                     */ 4758,
-/* CurveReferencedOverlayGroup                                    */ 4773,
-/* CurveReferencedOverlaySequence                                 */ 4772,
-/* CurveTime                                                      */ 67,
-/* CustodialOrganizationSequence                                  */ 2486,
-/* CustomRendered                                                 */ 606,
-/* CylinderAxis                                                   */ 1639,
-/* CylinderLensPower                                              */ 1638,
-/* CylinderPower                                                  */ 2677,
-/* CylinderSequence                                               */ 2623,
-/* DACAmplitude                                                   */ 470,
-/* DACGainPoints                                                  */ 468,
-/* DACSequence                                                    */ 466,
-/* DACTimePoints                                                  */ 469,
-/* DACType                                                        */ 467,
-/* DCTLabel                                                       */ 1978,
-/* DDLValue                                                       */ 2100,
-/* DICOMMediaRetrievalSequence                                    */ 2582,
-/* DICOMRetrievalSequence                                         */ 2581,
-/* DICOMStorageSequence                                           */ 2439,
-/* DICOSVersion                                                   */ 4706,
-/* DLPNotificationTrigger                                         */ 1501,
-/* DVHData                                                        */ 3709,
-/* DVHDoseScaling                                                 */ 3706,
-/* DVHMaximumDose                                                 */ 3713,
-/* DVHMeanDose                                                    */ 3714,
-/* DVHMinimumDose                                                 */ 3712,
-/* DVHNormalizationDoseValue                                      */ 3704,
-/* DVHNormalizationPoint                                          */ 3703,
-/* DVHNumberOfBins                                                */ 3708,
-/* DVHROIContributionType                                         */ 3711,
-/* DVHReferencedROISequence                                       */ 3710,
-/* DVHSequence                                                    */ 3705,
-/* DVHType                                                        */ 3691,
-/* DVHVolumeUnits                                                 */ 3707,
-/* Damping                                                        */ 460,
-/* DarkCurrentCounts                                              */ 422,
-/* DarkCurrentSequence                                            */ 421,
-/* DataBlock                                                      */ 1980,
-/* DataBlockDescription                                           */ 1979,
-/* DataCollectionCenterPatient                                    */ 1214,
-/* DataCollectionDiameter                                         */ 704,
-/* DataElementsSigned                                             */ 3517,
-/* DataFrameAssignmentSequence                                    */ 2035,
-/* DataInformationSequence                                        */ 2810,
-/* DataObservationSequence                                        */ 1902,
-/* DataPathAssignment                                             */ 2036,
-/* DataPathID                                                     */ 2046,
-/* DataPointColumns                                               */ 2126,
-/* DataPointRows                                                  */ 2125,
-/* DataRepresentation                                             */ 2129,
-/* DataSetDescription                                             */ 1899,
-/* DataSetName                                                    */ 1896,
-/* DataSetSource                                                  */ 1898,
-/* DataSetSubtype                                                 */ 69,
-/* DataSetTrailingPadding                                         */ 4840,
-/* DataSetType                                                    */ 68,
-/* DataSetVersion                                                 */ 1897,
-/* DataType                                                       */ 1439,
-/* DataValueRepresentation                                        */ 4755,
-/* Date                                                           */ 2498,
-/* DateOfDocumentOrVerbalTransactionTrial                         */ 2495,
-/* DateOfGainCalibration                                          */ 430,
-/* DateOfLastCalibration                                          */ 828,
-/* DateOfLastDetectorCalibration                                  */ 1003,
-/* DateOfSecondaryCapture                                         */ 722,
-/* DateTime                                                       */ 2497,
-/* DateTimeOfLastCalibration                                      */ 830,
-/* DeadTimeCorrected                                              */ 1421,
-/* DeadTimeCorrectionFlag                                         */ 2864,
-/* DeadTimeFactor                                                 */ 2861,
-/* DecayCorrected                                                 */ 1418,
-/* DecayCorrection                                                */ 2844,
-/* DecayCorrectionDateTime                                        */ 1390,
-/* DecayFactor                                                    */ 2858,
-/* DecimalPotentialVisualAcuity                                   */ 2698,
-/* DecimalVisualAcuity                                            */ 2673,
-/* DecimateCropResult                                             */ 3602,
-/* DecompositionAlgorithmIdentificationSequence                   */ 1280,
-/* DecompositionDescription                                       */ 1279,
-/* DecompositionMaterialSequence                                  */ 1281,
-/* DecompositionMethod                                            */ 1278,
-/* DecoupledNucleus                                               */ 1087,
-/* Decoupling                                                     */ 1086,
-/* DecouplingChemicalShiftReference                               */ 1090,
-/* DecouplingFrequency                                            */ 1088,
-/* DecouplingMethod                                               */ 1089,
-/* DefaultMagnificationType                                       */ 3578,
-/* DefaultPrinterResolutionID                                     */ 3575,
-/* DefaultSmoothingType                                           */ 3580,
-/* DefinitionSourceSequence                                       */ 180,
-/* DeformableRegistrationGridSequence                             */ 2895,
-/* DeformableRegistrationSequence                                 */ 2893,
-/* DegreeOfDilation                                               */ 1644,
-/* DegreeOfFreedomID                                              */ 3010,
-/* DegreeOfFreedomType                                            */ 3011,
-/* DeidentificationAction                                         */ 136,
-/* DeidentificationActionSequence                                 */ 134,
-/* DeidentificationMethod                                         */ 348,
-/* DeidentificationMethodCodeSequence                             */ 349,
-/* DelayLawIdentifier                                             */ 481,
-/* DeletionLock                                                   */ 3401,
-/* DeliveredChannelTotalTime                                      */ 3839,
-/* DeliveredDepthDoseParametersSequence                           */ 4260,
-/* DeliveredDistalDepth                                           */ 4262,
-/* DeliveredDistalDepthFraction                                   */ 4261,
-/* DeliveredMeterset                                              */ 3792,
-/* DeliveredNominalRangeModulatedRegionDepths                     */ 4264,
-/* DeliveredNominalRangeModulationFractions                       */ 4263,
-/* DeliveredNumberOfPulses                                        */ 3841,
-/* DeliveredPrimaryMeterset                                       */ 3785,
-/* DeliveredPulseRepetitionInterval                               */ 3843,
-/* DeliveredReferenceDoseDefinition                               */ 4265,
-/* DeliveredSecondaryMeterset                                     */ 3786,
-/* DeliveredTreatmentTime                                         */ 3788,
-/* DeliveryMaximumDose                                            */ 3886,
-/* DeliveryRate                                                   */ 4327,
-/* DeliveryRateUnitSequence                                       */ 4328,
-/* DeliveryTimeStructureCodeSequence                              */ 4619,
-/* DeliveryVerificationImageSequence                              */ 3373,
-/* DeliveryWarningDose                                            */ 3885,
-/* Density                                                        */ 4681,
-/* DepthDoseParametersSequence                                    */ 4259,
-/* DepthOfScanField                                               */ 943,
-/* DepthOfTransverseImage                                         */ 1672,
-/* DepthSpatialResolution                                         */ 1667,
-/* DepthValueAveragingFlag                                        */ 3934,
-/* DepthsOfFocus                                                  */ 1433,
-/* DerivationAlgorithmSequence                                    */ 1786,
-/* DerivationCodeSequence                                         */ 253,
-/* DerivationConceptualVolumeSequence                             */ 4504,
-/* DerivationDescription                                          */ 198,
-/* DerivationImageSequence                                        */ 246,
-/* DerivationImplantAssemblyTemplateSequence                      */ 3431,
-/* DerivationImplantTemplateSequence                              */ 2972,
-/* DestinationAE                                                  */ 3630,
-/* DetailsOfCoefficients                                          */ 1973,
-/* DetectorActivationOffsetFromExposure                           */ 1009,
-/* DetectorActiveAreaOrientation                                  */ 1377,
-/* DetectorActiveAreaTLHCPosition                                 */ 1376,
-/* DetectorActiveDimensions                                       */ 1014,
-/* DetectorActiveOrigin                                           */ 1015,
-/* DetectorActiveShape                                            */ 1013,
-/* DetectorActiveTime                                             */ 1008,
-/* DetectorBinning                                                */ 1010,
-/* DetectorCalibrationData                                        */ 4730,
-/* DetectorConditionsNominalFlag                                  */ 996,
-/* DetectorConfiguration                                          */ 999,
-/* DetectorDescription                                            */ 1000,
-/* DetectorElementPhysicalSize                                    */ 1011,
-/* DetectorElementSize                                            */ 2851,
-/* DetectorElementSpacing                                         */ 1012,
-/* DetectorGeometry                                               */ 1401,
-/* DetectorGeometrySequence                                       */ 4664,
-/* DetectorID                                                     */ 1002,
-/* DetectorInformationSequence                                    */ 2795,
-/* DetectorIsocenterPrimaryAngle                                  */ 1369,
-/* DetectorIsocenterSecondaryAngle                                */ 1370,
-/* DetectorLinesOfResponseUsed                                    */ 2846,
-/* DetectorManufacturerModelName                                  */ 1017,
-/* DetectorManufacturerName                                       */ 1016,
-/* DetectorMode                                                   */ 1001,
-/* DetectorNormalizationCorrection                                */ 1428,
-/* DetectorPositionSequence                                       */ 1360,
-/* DetectorPrimaryAngle                                           */ 874,
-/* DetectorSecondaryAngle                                         */ 875,
-/* DetectorTemperature                                            */ 997,
-/* DetectorTemperatureSequence                                    */ 416,
-/* DetectorTimeSinceLastExposure                                  */ 1007,
-/* DetectorType                                                   */ 998,
-/* DetectorVector                                                 */ 2793,
-/* DetectorXPositionToIsocenter                                   */ 1371,
-/* DetectorYPositionToIsocenter                                   */ 1372,
-/* DetectorZPositionToIsocenter                                   */ 1373,
-/* DeviationIndex                                                 */ 860,
-/* DeviceAlternateIdentifier                                      */ 4511,
-/* DeviceAlternateIdentifierFormat                                */ 4513,
-/* DeviceAlternateIdentifierType                                  */ 4512,
-/* DeviceDescription                                              */ 2756,
-/* DeviceDiameter                                                 */ 2747,
-/* DeviceDiameterUnits                                            */ 2748,
-/* DeviceID                                                       */ 711,
-/* DeviceIndex                                                    */ 4541,
-/* DeviceLabel                                                    */ 4529,
-/* DeviceLength                                                   */ 2745,
-/* DeviceMotionControlSequence                                    */ 4251,
-/* DeviceMotionExecutionMode                                      */ 4252,
-/* DeviceMotionObservationMode                                    */ 4253,
-/* DeviceMotionParameterCodeSequence                              */ 4254,
-/* DeviceOrderIndex                                               */ 4360,
-/* DeviceSequence                                                 */ 2742,
-/* DeviceSerialNumber                                             */ 709,
-/* DeviceSettingDescription                                       */ 616,
-/* DeviceTypeCodeSequence                                         */ 4530,
-/* DeviceUID                                                      */ 710,
-/* DeviceVolume                                                   */ 2749,
-/* DiameterOfCircularOutline                                      */ 893,
-/* DiameterOfVisibility                                           */ 3116,
-/* DiaphragmPosition                                              */ 3684,
-/* DiffuseReflectionIntensity                                     */ 3195,
-/* DiffusionAcquisitionCodeSequence                               */ 2966,
-/* DiffusionAnisotropyType                                        */ 1136,
-/* DiffusionBMatrixSequence                                       */ 1379,
-/* DiffusionBValue                                                */ 1110,
-/* DiffusionBValueXX                                              */ 1380,
-/* DiffusionBValueXY                                              */ 1381,
-/* DiffusionBValueXZ                                              */ 1382,
-/* DiffusionBValueYY                                              */ 1383,
-/* DiffusionBValueYZ                                              */ 1384,
-/* DiffusionBValueZZ                                              */ 1385,
-/* DiffusionDirectionality                                        */ 1099,
-/* DiffusionGradientDirectionSequence                             */ 1100,
-/* DiffusionGradientOrientation                                   */ 1111,
-/* DiffusionModelCodeSequence                                     */ 2967,
-/* DigitalImageFormatAcquired                                     */ 732,
-/* DigitalSignatureDateTime                                       */ 3519,
-/* DigitalSignaturePurposeCodeSequence                            */ 3526,
-/* DigitalSignatureUID                                            */ 3518,
-/* DigitalSignaturesSequence                                      */ 4839,
-/* DigitalZoomRatio                                               */ 609,
-/* DigitizingDeviceTransportDirection                             */ 915,
-/* DimensionDescriptionLabel                                      */ 1625,
-/* DimensionIndexPointer                                          */ 1586,
-/* DimensionIndexPrivateCreator                                   */ 1591,
-/* DimensionIndexSequence                                         */ 1593,
-/* DimensionIndexValues                                           */ 1580,
-/* DimensionOrganizationSequence                                  */ 1592,
-/* DimensionOrganizationType                                      */ 1622,
-/* DimensionOrganizationUID                                       */ 1585,
-/* DirectSegmentReferenceSequence                                 */ 4519,
-/* DirectoryRecordSequence                                        */ 28,
-/* DirectoryRecordType                                            */ 32,
-/* DischargeDate                                                  */ 2207,
-/* DischargeDiagnosisCodeSequence                                 */ 2210,
-/* DischargeDiagnosisDescription                                  */ 2209,
-/* DischargeTime                                                  */ 2208,
-/* DisplayCalibrationResultSequence                               */ 2099,
+/* VolumeCroppingMethod                                           */ 3170,
+/* FontName                                                       */ 3089,
+/* PTORegionSequence                                              */ 4744,
+/* RadiationDoseCentralAxisDisplacement                           */ 4303,
+/* ModifiedImageID                                                */ 1560,
+/* TargetMinimumDose                                              */ 3887,
+/* ImageOrientationSlide                                          */ 2721,
+/* AxialLengthOfTheEye                                            */ 1664,
+/* CompoundGraphicSequence                                        */ 3087,
+/* RelevantInformationSequence                                    */ 2418,
+/* GeneralAccessorySequence                                       */ 4234,
+/* XRayMassAttenuationCoefficient                                 */ 1284,
+/* ProcedureStepProgress                                          */ 3355,
+/* LossyImageCompressionRetired                                   */ 197,
+/* RotationPoint                                                  */ 3117,
+/* PlanningInputInformationSequence                               */ 4601,
+/* CardiacSynchronizationTechnique                                */ 1070,
+/* PRCSToRCSOrientation                                           */ 4747,
+/* TableTopRollRotationDirection                                  */ 4045,
+/* AcquisitionsInSeries                                           */ 1542,
+/* StageCodeSequence                                              */ 2278,
+/* SourceNumber                                                   */ 4087,
+/* RangeShifterSettingsSequence                                   */ 4199,
+/* ScheduledStationClassCodeSequence                              */ 2421,
+/* IterativeReconstructionMethod                                  */ 1429,
+/* PresentationCreationDate                                       */ 3076,
+/* SynchronizationFrameOfReferenceUID                             */ 1539,
+/* MaterialThickness                                              */ 363,
+/* SortingOperationsSequence                                      */ 3337,
+/* LastMenstrualDate                                              */ 319,
+/* IntendedFractionStartTime                                      */ 4616,
+/* RotationOfScannedFilm                                          */ 916,
+/* ExposureInmAs                                                  */ 1232,
+/* InterpretationRecorder                                         */ 4640,
+/* ImageFilterDescription                                         */ 1499,
 /* DisplayDeviceTypeCodeSequence                                  */ 2111,
-/* DisplayEnvironmentSpatialPosition                              */ 3292,
-/* DisplayFilterPercentage                                        */ 2134,
-/* DisplayFunctionType                                            */ 2102,
-/* DisplaySetHorizontalJustification                              */ 3349,
-/* DisplaySetLabel                                                */ 3298,
-/* DisplaySetNumber                                               */ 3297,
-/* DisplaySetPatientOrientation                                   */ 3340,
-/* DisplaySetPresentationGroup                                    */ 3299,
-/* DisplaySetPresentationGroupDescription                         */ 3300,
-/* DisplaySetScrollingGroup                                       */ 3303,
-/* DisplaySetVerticalJustification                                */ 3350,
-/* DisplaySetsSequence                                            */ 3296,
-/* DisplayShadingFlag                                             */ 2256,
+/* PositionReferenceIndicator                                     */ 1549,
+/* RangeShifterNumber                                             */ 4174,
+/* ReferencedSeriesSequence                                       */ 168,
+/* FalsePositivesEstimateFlag                                     */ 1832,
+/* Item                                                           */ 4841,
+/* ApprovalStatusDateTime                                         */ 2597,
+/* RadialPosition                                                 */ 794,
+/* AssessmentSummary                                              */ 3479,
+/* PresentationStateClassificationComponentSequence               */ 3198,
+/* InterlockResolutionUserSequence                                */ 4437,
+/* VideoImageFormatAcquired                                       */ 731,
+/* AcquisitionContextDescription                                  */ 2350,
+/* RationalNumeratorValue                                         */ 2510,
+/* DetectorElementSpacing                                         */ 1012,
+/* UID                                                            */ 2501,
+/* NumberOfScanSpotPositions                                      */ 4215,
+/* TreatmentPositionGroupUID                                      */ 4276,
+/* MinimumCoordinateValue                                         */ 4756,
+/* PerformedProcedureStepEndDate                                  */ 2300,
 /* DisplaySubsystemConfigurationSequence                          */ 2087,
-/* DisplaySubsystemDescription                                    */ 2082,
-/* DisplaySubsystemID                                             */ 2080,
-/* DisplaySubsystemName                                           */ 2081,
-/* DisplaySubsystemQAResultsSequence                              */ 2093,
-/* DisplaySubsystemSequence                                       */ 2112,
-/* DisplayWindowLabelVector                                       */ 913,
-/* DisplayedAreaBottomRightHandCorner                             */ 3067,
-/* DisplayedAreaBottomRightHandCornerTrial                        */ 3065,
-/* DisplayedAreaSelectionSequence                                 */ 3068,
-/* DisplayedAreaTopLeftHandCorner                                 */ 3066,
-/* DisplayedAreaTopLeftHandCornerTrial                            */ 3064,
-/* DisplayedZValue                                                */ 922,
-/* DistalDepth                                                    */ 4256,
-/* DistalDepthFraction                                            */ 4255,
-/* DistanceBetweenBscanSlabs                                      */ 1799,
-/* DistanceBetweenFocalPlanes                                     */ 2718,
-/* DistanceObjectToTableTop                                       */ 1287,
-/* DistancePupillaryDistance                                      */ 2637,
-/* DistanceReceptorPlaneToDetectorHousing                         */ 1299,
-/* DistanceSourceToDataCollectionCenter                           */ 1235,
-/* DistanceSourceToDetector                                       */ 779,
-/* DistanceSourceToEntrance                                       */ 2320,
-/* DistanceSourceToIsocenter                                      */ 1286,
-/* DistanceSourceToPatient                                        */ 780,
-/* DistanceSourceToSupport                                        */ 2321,
-/* DistributionAddress                                            */ 4655,
-/* DistributionName                                               */ 4654,
-/* DistributionType                                               */ 355,
-/* DocumentAuthorIdentifierCodeSequenceTrial                      */ 2478,
-/* DocumentAuthorTrial                                            */ 2477,
-/* DocumentClassCodeSequence                                      */ 2577,
-/* DocumentIdentifierCodeSequenceTrial                            */ 2476,
-/* DocumentTitle                                                  */ 2588,
-/* DocumentingObserverIdentifierCodeSequenceTrial                 */ 2483,
-/* DocumentingOrganizationIdentifierCodeSequenceTrial             */ 2467,
-/* DopplerCorrectionAngle                                         */ 969,
-/* DopplerSampleVolumeXPosition                                   */ 972,
-/* DopplerSampleVolumeXPositionRetired                            */ 971,
-/* DopplerSampleVolumeYPosition                                   */ 974,
-/* DopplerSampleVolumeYPositionRetired                            */ 973,
-/* DoseCalibrationFactor                                          */ 2859,
-/* DoseComment                                                    */ 3695,
-/* DoseGridScaling                                                */ 3699,
-/* DoseMeasurementDeviceCodeSequence                              */ 4443,
-/* DoseRateDelivered                                              */ 3796,
-/* DoseRateSet                                                    */ 4018,
-/* DoseReferenceDescription                                       */ 3880,
+/* ClinicalTrialTimePointID                                       */ 342,
+/* RegionSpatialFormat                                            */ 951,
+/* ScanArc                                                        */ 795,
+/* AssessmentSummaryDescription                                   */ 3480,
+/* TotalBlockTrayWaterEquivalentThickness                         */ 3993,
+/* MultienergyCTAcquisition                                       */ 1249,
+/* AcquisitionStartConditionData                                  */ 692,
+/* ReasonForVisit                                                 */ 2178,
+/* RadiobiologicalDoseEffectSequence                              */ 4485,
+/* PresentationCreationTime                                       */ 3077,
+/* Humidity                                                       */ 595,
+/* ReferencedObjectObservationClassTrial                          */ 2519,
+/* PatientTransportArrangements                                   */ 2372,
+/* IVUSPullbackStopFrameNumber                                    */ 927,
+/* StudyReadDate                                                  */ 2158,
+/* ReasonForRequestedProcedureCodeSequence                        */ 2378,
+/* NumericValue                                                   */ 2533,
+/* Illumination                                                   */ 3590,
+/* IntendedDeliveryDuration                                       */ 4609,
+/* EquipmentReferencePointCoordinatesSequence                     */ 4385,
+/* PatientNotProperlyFixatedQuantity                              */ 1819,
+/* SelectorOBValue                                                */ 3264,
+/* OOIOwnerCreationTime                                           */ 4707,
+/* CompletionFlag                                                 */ 2551,
+/* GPSLongitude                                                   */ 629,
+/* ExaminedBodyThickness                                          */ 334,
+/* ReviewDate                                                     */ 4482,
+/* ContourUncertaintyRadius                                       */ 3139,
+/* MeasurementsSequence                                           */ 2960,
+/* BeatRejectionFlag                                              */ 768,
+/* DeviceUID                                                      */ 710,
+/* RequestedProcedurePriority                                     */ 2371,
+/* RadiopharmaceuticalRoute                                       */ 758,
+/* DeliveredDistalDepthFraction                                   */ 4261,
+/* CurveTime                                                      */ 67,
+/* IconImageSequence                                              */ 3505,
+/* AuthorObserverSequence                                         */ 2484,
+/* AcquisitionTerminationConditionData                            */ 693,
+/* TreatmentControlPointTime                                      */ 3778,
+/* RelatedSeriesSequence                                          */ 196,
+/* PreAmplifierEquipmentSequence                                  */ 440,
+/* ImagingFrequency                                               */ 698,
+/* RelevantOPTAttributesSequence                                  */ 1773,
+/* ReferringPhysicianIdentificationSequence                       */ 92,
+/* ImageFormat                                                    */ 1923,
+/* AnatomicalOrientationType                                      */ 324,
+/* ReformattingInterval                                           */ 3334,
+/* PixelDataProviderURL                                           */ 2124,
+/* ReferencedRangeShifterNumber                                   */ 4475,
+/* PredecessorStructureSetSequence                                */ 3724,
+/* ImplantTemplateGroupDescription                                */ 3449,
+/* ImageProcessingApplied                                         */ 2141,
+/* ProductName                                                    */ 2599,
+/* ImagePathFilterPassThroughWavelength                           */ 1633,
+/* ReferencedFilmSessionSequence                                  */ 3593,
 /* DoseReferenceNumber                                            */ 3876,
+/* PhaseDelay                                                     */ 2800,
+/* AmbientReflectionIntensity                                     */ 3193,
+/* ScreeningBaselineValue                                         */ 1894,
+/* WedgeInContactWidth                                            */ 547,
+/* TargetRefraction                                               */ 1694,
+/* ReferencedFilmBoxSequence                                      */ 3568,
+/* SpecifiedNumberOfPulses                                        */ 3840,
+/* OverlayDescriptorGray                                          */ 4812,
+/* AnatomicStructureSpaceOrRegionCodeSequenceTrial                */ 227,
+/* BlockType                                                      */ 3998,
+/* NonUniformRadialSamplingCorrected                              */ 1426,
+/* SeriesInstanceUID                                              */ 1510,
+/* SourceIdentifier                                               */ 2186,
+/* VolumeOfPTO                                                    */ 4691,
+/* TableTopEccentricRotationDirection                             */ 4031,
+/* ReferencedAssertionUID                                         */ 2616,
+/* ReferencedSurfaceDataSequence                                  */ 3478,
+/* BscanCycleTimeVector                                           */ 1801,
 /* DoseReferencePointCoordinates                                  */ 3881,
-/* DoseReferenceSequence                                          */ 3875,
-/* DoseReferenceStructureType                                     */ 3878,
-/* DoseReferenceType                                              */ 3883,
-/* DoseReferenceUID                                               */ 3877,
-/* DoseSummationType                                              */ 3697,
-/* DoseType                                                       */ 3693,
-/* DoseUnits                                                      */ 3692,
-/* DoseValue                                                      */ 3701,
-/* DoseValuePurpose                                               */ 4296,
-/* DoseValuesSequence                                             */ 4295,
-/* DosimetricObjectiveEvaluationScope                             */ 4583,
-/* DosimetricObjectiveParameterSequence                           */ 4596,
-/* DosimetricObjectivePurpose                                     */ 4600,
-/* DosimetricObjectiveSequence                                    */ 4592,
-/* DosimetricObjectiveTypeCodeSequence                            */ 4593,
-/* DosimetricObjectiveUID                                         */ 4594,
-/* DosimetricObjectiveWeight                                      */ 4599,
-/* DoubleExposureFieldDelta                                       */ 3410,
-/* DoubleExposureFieldDeltaTrial                                  */ 3378,
-/* DoubleExposureFlag                                             */ 3375,
-/* DoubleExposureMeterset                                         */ 3409,
-/* DoubleExposureMetersetTrial                                    */ 3377,
-/* DoubleExposureOrdering                                         */ 3376,
-/* DoubleFloatPixelData                                           */ 4829,
-/* DoubleFloatPixelPaddingRangeLimit                              */ 1962,
-/* DoubleFloatPixelPaddingValue                                   */ 1960,
-/* DoubleFloatRealWorldValueFirstValueMapped                      */ 2453,
-/* DoubleFloatRealWorldValueLastValueMapped                       */ 2452,
-/* DriveProbeSequence                                             */ 496,
-/* DriveType                                                      */ 494,
-/* DynamicRange                                                   */ 941,
-/* EXIFVersion                                                    */ 582,
-/* EchoNumbers                                                    */ 700,
-/* EchoPeakPosition                                               */ 1201,
-/* EchoPlanarPulseSequence                                        */ 1053,
-/* EchoPulseSequence                                              */ 1044,
-/* EchoTime                                                       */ 695,
-/* EchoTrainLength                                                */ 705,
-/* EdgePointIndexList                                             */ 2928,
-/* EffectiveBinEnergy                                             */ 1262,
-/* EffectiveDateTime                                              */ 2974,
-/* EffectiveDoseCalculationMethodCategoryCodeSequence             */ 4487,
-/* EffectiveDoseCalculationMethodCodeSequence                     */ 4488,
-/* EffectiveDoseCalculationMethodDescription                      */ 4489,
-/* EffectiveDuration                                              */ 690,
-/* EffectiveEchoTime                                              */ 1106,
-/* EffectiveRefractiveIndex                                       */ 2761,
-/* EffectiveWedgeAngle                                            */ 3974,
-/* ElementDimensionA                                              */ 446,
-/* ElementDimensionB                                              */ 447,
-/* ElementPitchA                                                  */ 448,
-/* ElementPitchB                                                  */ 455,
-/* ElementShape                                                   */ 445,
-/* EmmetropicMagnification                                        */ 1640,
-/* EmptyImageBoxCIELabValue                                       */ 3324,
-/* EmptyImageDensity                                              */ 3583,
-/* EncapsulatedDocument                                           */ 2589,
-/* EncapsulatedDocumentLength                                     */ 2593,
-/* EncryptedAttributesSequence                                    */ 3530,
-/* EncryptedContent                                               */ 3532,
-/* EncryptedContentTransferSyntaxUID                              */ 3531,
-/* EndAcquisitionDateTime                                         */ 1349,
-/* EndCumulativeMetersetWeight                                    */ 4452,
+/* DACAmplitude                                                   */ 470,
+/* PatientTelephoneNumbers                                        */ 312,
+/* XRayDetectorLabel                                              */ 1267,
+/* CylinderAxis                                                   */ 1639,
+/* SpatialFrequencyResponseRows                                   */ 560,
+/* IntermediatePupillaryDistance                                  */ 2639,
+/* ConcatenationUID                                               */ 1582,
+/* ReferencedAccessionSequenceTrial                               */ 2534,
+/* SetupDeviceDescription                                         */ 4077,
+/* RTImageSID                                                     */ 3679,
+/* AnomalyLocatorIndicatorSequence                                */ 4742,
+/* CoordinateSystemAxisUnits                                      */ 405,
+/* DepthSpatialResolution                                         */ 1667,
+/* InterpretationAuthor                                           */ 4646,
+/* RTBeamLimitingDeviceOffset                                     */ 4341,
+/* RequestedProcedureLocation                                     */ 2373,
+/* CassetteID                                                     */ 715,
+/* ContrastBolusIngredientCodeSequence                            */ 1237,
+/* ComponentManufacturingProcedure                                */ 361,
+/* BranchOfService                                                */ 305,
+/* PrivateDataElementDefinitionSequence                           */ 145,
+/* LowEnergyDetectors                                             */ 4662,
+/* MAUsedInGainCalibration                                        */ 426,
+/* ImplantTemplateGroupMemberID                                   */ 3455,
 /* EndCumulativeTimeWeight                                        */ 3418,
-/* EndMeterset                                                    */ 3817,
-/* EndingRespiratoryAmplitude                                     */ 1600,
-/* EndingRespiratoryPhase                                         */ 1601,
-/* EnergyUnitCodeSequence                                         */ 4398,
-/* EnergyWeightingFactor                                          */ 1247,
-/* EnergyWindowCenterline                                         */ 674,
-/* EnergyWindowInformationSequence                                */ 2786,
-/* EnergyWindowLowerLimit                                         */ 2788,
-/* EnergyWindowName                                               */ 2792,
-/* EnergyWindowNumber                                             */ 2830,
-/* EnergyWindowRangeSequence                                      */ 2787,
-/* EnergyWindowTotalWidth                                         */ 675,
-/* EnergyWindowUpperLimit                                         */ 2789,
-/* EnergyWindowVector                                             */ 2784,
-/* EnhancedPaletteColorLookupTableSequence                        */ 2043,
-/* EntityDescription                                              */ 4539,
-/* EntityLabel                                                    */ 4537,
-/* EntityLongLabel                                                */ 4540,
-/* EntityName                                                     */ 4538,
-/* EntranceDose                                                   */ 2318,
-/* EntranceDoseDerivation                                         */ 2444,
-/* EntranceDoseInmGy                                              */ 2443,
-/* EnvironmentalConditions                                        */ 385,
-/* EquipmentAdministratorSequence                                 */ 2077,
-/* EquipmentCoordinateSystemIdentification                        */ 2152,
-/* EquipmentFrameOfReferenceDescription                           */ 4384,
-/* EquipmentFrameOfReferenceUID                                   */ 4383,
-/* EquipmentModality                                              */ 127,
-/* EquipmentReferencePointCodeSequence                            */ 4386,
-/* EquipmentReferencePointCoordinatesSequence                     */ 4385,
-/* EquivalentCDADocumentSequence                                  */ 2493,
-/* EquivalentCodeSequence                                         */ 120,
-/* EquivalentConceptualVolumeInstanceReferenceSequence            */ 4493,
-/* EquivalentConceptualVolumesSequence                            */ 4494,
-/* EquivalentPupilRadius                                          */ 2682,
-/* EscapeTriplet                                                  */ 3542,
-/* EstimatedDoseSaving                                            */ 1225,
-/* EstimatedRadiographicMagnificationFactor                       */ 781,
-/* EthicsCommitteeApprovalEffectivenessEndDate                    */ 358,
-/* EthicsCommitteeApprovalEffectivenessStartDate                  */ 357,
-/* EthnicGroup                                                    */ 314,
-/* EvaluationAttempt                                              */ 389,
-/* EvaluatorName                                                  */ 388,
-/* EvaluatorNumber                                                */ 387,
-/* EvaluatorSequence                                              */ 386,
-/* EventCodeSequence                                              */ 211,
-/* EventElapsedTimes                                              */ 207,
-/* EventTimeOffset                                                */ 210,
-/* EventTimerNames                                                */ 208,
-/* EventTimerSequence                                             */ 209,
-/* ExaminedBodyThickness                                          */ 334,
-/* ExcessiveFalseNegatives                                        */ 1831,
-/* ExcessiveFalseNegativesDataFlag                                */ 1830,
-/* ExcessiveFalsePositives                                        */ 1841,
-/* ExcessiveFalsePositivesDataFlag                                */ 1840,
-/* ExcessiveFixationLosses                                        */ 1823,
-/* ExcessiveFixationLossesDataFlag                                */ 1822,
-/* ExcitationFrequency                                            */ 458,
-/* ExcludedIntervalsSequence                                      */ 1434,
-/* ExclusionDuration                                              */ 1436,
-/* ExclusionStartDateTime                                         */ 1435,
-/* ExclusiveComponentType                                         */ 3437,
-/* ExecutionStatus                                                */ 3625,
-/* ExecutionStatusInfo                                            */ 3626,
-/* ExpectedCompletionDateTime                                     */ 2411,
-/* ExpectedInVivoMeasurementValueIndex                            */ 4301,
-/* ExpectedInVivoMeasurementValuesSequence                        */ 4300,
-/* ExpiryDate                                                     */ 384,
-/* ExposedArea                                                    */ 2319,
-/* Exposure                                                       */ 803,
-/* ExposureBiasValue                                              */ 586,
-/* ExposureControlMode                                            */ 1035,
-/* ExposureControlModeDescription                                 */ 1036,
-/* ExposureControlSensingRegionLeftVerticalEdge                   */ 1308,
-/* ExposureControlSensingRegionLowerHorizontalEdge                */ 1311,
-/* ExposureControlSensingRegionRightVerticalEdge                  */ 1309,
-/* ExposureControlSensingRegionShape                              */ 1307,
-/* ExposureControlSensingRegionUpperHorizontalEdge                */ 1310,
-/* ExposureControlSensingRegionsSequence                          */ 1306,
-/* ExposureDoseSequence                                           */ 2322,
-/* ExposureIndex                                                  */ 858,
-/* ExposureInmAs                                                  */ 1232,
-/* ExposureInuAs                                                  */ 804,
-/* ExposureMode                                                   */ 607,
-/* ExposureModulationType                                         */ 1224,
-/* ExposureProgram                                                */ 572,
-/* ExposureSequence                                               */ 3682,
-/* ExposureStatus                                                 */ 1037,
-/* ExposureTime                                                   */ 801,
-/* ExposureTimeInSeconds                                          */ 554,
-/* ExposureTimeInms                                               */ 1229,
-/* ExposureTimeInuS                                               */ 1039,
-/* ExposuresOnDetectorSinceLastCalibration                        */ 1005,
-/* ExposuresOnDetectorSinceManufactured                           */ 1006,
-/* ExposuresOnPlate                                               */ 856,
-/* ExtendedCodeMeaning                                            */ 103,
-/* ExtendedCodeValue                                              */ 96,
-/* ExtendedDepthOfField                                           */ 2716,
-/* ExtendedOffsetTable                                            */ 4826,
-/* ExtendedOffsetTableLengths                                     */ 4827,
-/* ExternalContourEntryPoint                                      */ 4040,
-/* FNumber                                                        */ 555,
-/* FacetSequence                                                  */ 2943,
-/* FailedAttributesSequence                                       */ 3383,
-/* FailedSOPInstanceUIDList                                       */ 78,
-/* FailedSOPSequence                                              */ 192,
-/* FailureAttributes                                              */ 3663,
-/* FailureReason                                                  */ 191,
-/* FalseNegativesEstimate                                         */ 1827,
-/* FalseNegativesEstimateFlag                                     */ 1826,
-/* FalseNegativesQuantity                                         */ 1829,
-/* FalsePositivesEstimate                                         */ 1833,
-/* FalsePositivesEstimateFlag                                     */ 1832,
-/* FalsePositivesQuantity                                         */ 1839,
-/* FiducialDescription                                            */ 3136,
-/* FiducialIdentifier                                             */ 3137,
-/* FiducialIdentifierCodeSequence                                 */ 3138,
-/* FiducialSequence                                               */ 3145,
-/* FiducialSetSequence                                            */ 3144,
-/* FiducialUID                                                    */ 3142,
-/* FiducialsPropertyCategoryCodeSequence                          */ 3146,
-/* FieldOfViewDescription                                         */ 1305,
-/* FieldOfViewDimensions                                          */ 800,
-/* FieldOfViewDimensionsInFloat                                   */ 1323,
-/* FieldOfViewHorizontalFlip                                      */ 1020,
-/* FieldOfViewOrigin                                              */ 1018,
-/* FieldOfViewRotation                                            */ 1019,
-/* FieldOfViewSequence                                            */ 1304,
-/* FieldOfViewShape                                               */ 799,
-/* FileMetaInformationGroupLength                                 */ 0,
-/* FileMetaInformationVersion                                     */ 1,
-/* FileSetConsistencyFlag                                         */ 27,
-/* FileSetDescriptorFileID                                        */ 23,
-/* FileSetID                                                      */ 22,
-/* FileSource                                                     */ 604,
-/* FillMode                                                       */ 3113,
-/* FillPattern                                                    */ 3112,
-/* FillStyleSequence                                              */ 3095,
-/* FillerOrderNumberImagingServiceRequest                         */ 2398,
-/* FillerOrderNumberImagingServiceRequestRetired                  */ 2392,
-/* FillerOrderNumberProcedure                                     */ 2375,
-/* FilmBoxContentSequence                                         */ 3643,
-/* FilmConsumptionSequence                                        */ 2329,
-/* FilmDestination                                                */ 3553,
-/* FilmOrientation                                                */ 3572,
-/* FilmSessionLabel                                               */ 3554,
-/* FilmSizeID                                                     */ 3573,
-/* FilterBeamPathLengthMaximum                                    */ 1034,
-/* FilterBeamPathLengthMinimum                                    */ 1033,
-/* FilterByAttributePresence                                      */ 3321,
-/* FilterByCategory                                               */ 3320,
-/* FilterByOperator                                               */ 3322,
-/* FilterHighFrequency                                            */ 2246,
-/* FilterLowFrequency                                             */ 2245,
-/* FilterMaterial                                                 */ 1030,
-/* FilterMaterialUsedInGainCalibration                            */ 428,
-/* FilterOperationsSequence                                       */ 3319,
-/* FilterThicknessMaximum                                         */ 1032,
-/* FilterThicknessMinimum                                         */ 1031,
-/* FilterThicknessUsedInGainCalibration                           */ 429,
-/* FilterType                                                     */ 810,
-/* FinalCumulativeMetersetWeight                                  */ 4013,
-/* FinalCumulativeTimeWeight                                      */ 4147,
-/* FindingsFlagTrial                                              */ 2458,
-/* FindingsGroupRecordingDateTrial                                */ 2463,
-/* FindingsGroupRecordingTimeTrial                                */ 2464,
-/* FindingsGroupUIDTrial                                          */ 2461,
-/* FindingsSequenceTrial                                          */ 2460,
-/* FindingsSourceCategoryCodeSequenceTrial                        */ 2465,
-/* FiniteVolume                                                   */ 2910,
-/* FirstALineLocation                                             */ 2779,
-/* FirstOrderPhaseCorrection                                      */ 1164,
-/* FirstOrderPhaseCorrectionAngle                                 */ 4784,
-/* FirstTreatmentDate                                             */ 3799,
-/* FixationCheckedQuantity                                        */ 1818,
+/* SegmentCharacteristicsSequence                                 */ 4523,
 /* FixationDeviceDescription                                      */ 4063,
-/* FixationDeviceLabel                                            */ 4062,
-/* FixationDevicePitchAngle                                       */ 4065,
-/* FixationDevicePosition                                         */ 4064,
-/* FixationDeviceRollAngle                                        */ 4066,
-/* FixationDeviceSequence                                         */ 4060,
-/* FixationDeviceType                                             */ 4061,
-/* FixationEye                                                    */ 4050,
-/* FixationLightAzimuthalAngle                                    */ 4196,
-/* FixationLightAzimuthalAngleTolerance                           */ 4054,
-/* FixationLightPolarAngle                                        */ 4197,
-/* FixationLightPolarAngleTolerance                               */ 4055,
-/* FixationMethodCodeSequence                                     */ 3003,
-/* FixationMonitoringCodeSequence                                 */ 1816,
-/* FixationSequence                                               */ 1815,
-/* FixedRTBeamDelimiterDeviceSequence                             */ 4336,
-/* FlashEnergy                                                    */ 600,
-/* FlashFiringStatus                                              */ 567,
-/* FlashFunctionPresent                                           */ 570,
-/* FlashMode                                                      */ 569,
-/* FlashRedEyeMode                                                */ 571,
-/* FlashReturnStatus                                              */ 568,
-/* FlatCornealAxisSequence                                        */ 2661,
-/* FlatKeratometricAxisSequence                                   */ 2647,
-/* FlipAngle                                                      */ 847,
-/* FloatPixelData                                                 */ 4828,
-/* FloatPixelPaddingRangeLimit                                    */ 1961,
-/* FloatPixelPaddingValue                                         */ 1959,
-/* FloatingPointValue                                             */ 2509,
-/* FloatingPointValues                                            */ 2962,
-/* FlowCompensation                                               */ 1046,
-/* FlowCompensationDirection                                      */ 1157,
+/* IVUSPullbackStartFrameNumber                                   */ 926,
+/* TimezoneOffsetFromUTC                                          */ 124,
+/* ReferencedParentRTPrescriptionIndex                            */ 4550,
+/* CurveLabel                                                     */ 4771,
+/* DeidentificationMethodCodeSequence                             */ 349,
+/* OOIOwnerSequence                                               */ 4713,
+/* ModulationType                                                 */ 459,
+/* DischargeTime                                                  */ 2208,
+/* RescaleSlope                                                   */ 1999,
+/* RespiratoryIntervalTime                                        */ 1606,
+/* TemplateLocalVersion                                           */ 2569,
+/* TrackStatisticsSequence                                        */ 2964,
+/* DiffusionBValueZZ                                              */ 1385,
+/* OverlayCodeLabel                                               */ 4807,
+/* LossyImageCompressionRatio                                     */ 2052,
+/* TrackPointIndexList                                            */ 2963,
+/* SourceOfOphthalmicAxialLengthCodeSequence                      */ 1692,
+/* AcquisitionStatus                                              */ 4710,
+/* IntendedNumberOfFractions                                      */ 4320,
+/* OperatorIdentificationSequence                                 */ 161,
+/* NumberOfDisplaySubsystems                                      */ 2078,
+/* GantryAngle                                                    */ 4023,
+/* ReferencedXRayDetectorIndex                                    */ 1270,
+/* CornealEccentricityIndex                                       */ 2696,
+/* FilterThicknessMinimum                                         */ 1031,
+/* StudyArrivalTime                                               */ 2172,
+/* RelationshipSequenceTrial                                      */ 2562,
+/* TickLabel                                                      */ 3126,
+/* BeamAreaLimitSequence                                          */ 4403,
+/* UserContentLabel                                               */ 4535,
+/* ReasonForOmission                                              */ 4479,
+/* AverageBeamDosePointDepth                                      */ 3928,
+/* BoardingPassID                                                 */ 4683,
+/* DisplayedAreaTopLeftHandCornerTrial                            */ 3064,
+/* IdentifierTypeCode                                             */ 2289,
+/* CompensatorMapOrientation                                      */ 4365,
+/* BeamAngle                                                      */ 1317,
+/* ApplicatorOpeningY                                             */ 4245,
+/* FrameOfInterestType                                            */ 2066,
+/* BeamName                                                       */ 3950,
+/* ExpectedInVivoMeasurementValueIndex                            */ 4301,
+/* ProcessingFunction                                             */ 933,
+/* AcquisitionDeviceProcessingDescription                         */ 852,
+/* Spoiling                                                       */ 1051,
+/* RefractiveProcedureOccurred                                    */ 1695,
+/* CoefficientCodingPointers                                      */ 1977,
+/* IndicationType                                                 */ 394,
 /* FlowIdentifier                                                 */ 2183,
-/* FlowIdentifierSequence                                         */ 2182,
-/* FlowRTPSamplingRate                                            */ 2185,
-/* FlowTransferSyntaxUID                                          */ 2184,
-/* FluenceDataScale                                               */ 3687,
-/* FluenceDataSource                                              */ 3686,
-/* FluenceMapSequence                                             */ 3685,
-/* FluenceMode                                                    */ 3689,
-/* FluenceModeID                                                  */ 3690,
-/* FluoroscopyFlag                                                */ 1234,
+/* AmplifierType                                                  */ 438,
+/* RTTreatmentTechniqueCodeSequence                               */ 4611,
+/* RecordedSourceApplicatorSequence                               */ 3844,
+/* BeamType                                                       */ 3952,
+/* ConfigurationDescription                                       */ 2090,
+/* StereoBaselineAngle                                            */ 1645,
+/* OrderPlacerIdentifierSequence                                  */ 2284,
+/* FixationDevicePosition                                         */ 4064,
+/* ConceptualVolumeConstituentSequence                            */ 4492,
+/* RenderFieldOfView                                              */ 3190,
+/* OphthalmicAxialLengthVelocity                                  */ 1708,
+/* InterlockOriginDescription                                     */ 4446,
+/* AnatomicPerspectiveDescriptionTrial                            */ 230,
+/* SpecificAbsorptionRateValue                                    */ 1155,
+/* IlluminationPower                                              */ 1678,
+/* ImplantTemplateGroupIssuer                                     */ 3450,
+/* AnatomicRegionSequence                                         */ 218,
+/* SegmentedPropertyCategoryCodeSequence                          */ 2874,
+/* SourceInstanceSequence                                         */ 2591,
+/* DetectorPrimaryAngle                                           */ 874,
+/* ParallelReductionFactorInPlaneRetired                          */ 1118,
+/* DoseCalibrationFactor                                          */ 2859,
+/* ShortTermFluctuationProbability                                */ 1856,
+/* EmmetropicMagnification                                        */ 1640,
+/* SelectorULValue                                                */ 3282,
+/* ContinuationStartMeterset                                      */ 3351,
+/* ScheduledProcedureStepModificationDateTime                     */ 2410,
+/* ConfirmationSequence                                           */ 4430,
+/* SeriesInStudy                                                  */ 1541,
+/* RequestedSubsequentWorkitemCodeSequence                        */ 2426,
+/* CArmPhotonElectronControlPointSequence                         */ 4314,
+/* NumberOfWaveformChannels                                       */ 2225,
+/* StudyDescription                                               */ 148,
+/* RWavePointer                                                   */ 2068,
+/* CompensatorDistalThicknessMap                                  */ 4367,
+/* WideFieldOphthalmicPhotographyThresholdQualityRating           */ 1781,
+/* ModeOfPercutaneousAccessSequence                               */ 2770,
+/* SOPInstanceStatus                                              */ 3510,
+/* ActualHumanPerformersSequence                                  */ 2430,
+/* ContrastBolusAgentNumber                                       */ 1236,
+/* NumberOfTableEntries                                           */ 992,
+/* BlockEdgeData                                                  */ 4373,
+/* Shininess                                                      */ 3197,
+/* PerformedProcedureCodeSequence                                 */ 2543,
 /* FocalDistance                                                  */ 818,
-/* FocalLength                                                    */ 591,
-/* FocalLengthIn35mmFilm                                          */ 610,
-/* FocalSpots                                                     */ 821,
-/* FocusDepth                                                     */ 932,
-/* FocusMethod                                                    */ 2715,
-/* FontName                                                       */ 3089,
-/* FontNameType                                                   */ 3090,
-/* FovealPointNormativeDataFlag                                   */ 1889,
-/* FovealPointProbabilityValue                                    */ 1890,
-/* FovealSensitivity                                              */ 1864,
-/* FovealSensitivityMeasured                                      */ 1863,
-/* FractionBasedRelationshipIntervalAnchor                        */ 4614,
-/* FractionBasedRelationshipSequence                              */ 4613,
-/* FractionGroupDescription                                       */ 3913,
-/* FractionGroupNumber                                            */ 3912,
-/* FractionGroupSequence                                          */ 3911,
-/* FractionGroupSummarySequence                                   */ 3858,
-/* FractionGroupType                                              */ 3860,
-/* FractionNumber                                                 */ 3681,
-/* FractionPattern                                                */ 3917,
-/* FractionPatternSequence                                        */ 4604,
-/* FractionStatusSummarySequence                                  */ 3862,
-/* FractionalChannelDisplayScale                                  */ 2257,
-/* FractionationNotes                                             */ 4610,
-/* FrameAcquisitionDateTime                                       */ 1098,
-/* FrameAcquisitionDuration                                       */ 1171,
-/* FrameAcquisitionNumber                                         */ 1579,
-/* FrameAcquisitionSequence                                       */ 1294,
-/* FrameAnatomySequence                                           */ 1570,
-/* FrameComments                                                  */ 1581,
-/* FrameContentSequence                                           */ 1572,
-/* FrameDelay                                                     */ 751,
-/* FrameDetectorParametersSequence                                */ 1318,
-/* FrameDimensionPointer                                          */ 1913,
-/* FrameDisplaySequence                                           */ 256,
-/* FrameDisplayShutterSequence                                    */ 1334,
-/* FrameExtractionSequence                                        */ 186,
-/* FrameIncrementPointer                                          */ 1912,
-/* FrameLabel                                                     */ 1627,
-/* FrameLabelVector                                               */ 909,
-/* FrameLaterality                                                */ 1571,
-/* FrameNumbersOfInterest                                         */ 2064,
-/* FrameOfInterestDescription                                     */ 2065,
-/* FrameOfInterestType                                            */ 2066,
-/* FrameOfReferenceRelationshipSequence                           */ 3762,
-/* FrameOfReferenceToDisplayedCoordinateSystemTransformationMatrix */ 3133,
-/* FrameOfReferenceTransformationComment                          */ 3766,
-/* FrameOfReferenceTransformationMatrix                           */ 3765,
-/* FrameOfReferenceTransformationMatrixType                       */ 3134,
-/* FrameOfReferenceTransformationType                             */ 3764,
-/* FrameOfReferenceUID                                            */ 1530,
-/* FrameOriginTimestamp                                           */ 2187,
-/* FramePixelDataPropertiesSequence                               */ 2138,
-/* FramePixelShiftSequence                                        */ 2135,
-/* FramePrimaryAngleVector                                        */ 910,
-/* FrameReferenceDateTime                                         */ 1137,
-/* FrameReferenceTime                                             */ 2854,
-/* FrameSecondaryAngleVector                                      */ 911,
-/* FrameTime                                                      */ 748,
-/* FrameTimeVector                                                */ 750,
-/* FrameType                                                      */ 242,
-/* FrameUsefulnessGroupSequence                                   */ 2189,
-/* FrameVOILUTSequence                                            */ 2131,
-/* FrequencyCorrection                                            */ 1121,
-/* FunctionalGroupPointer                                         */ 1587,
-/* FunctionalGroupPrivateCreator                                  */ 1595,
-/* FunctionalMRSequence                                           */ 1386,
-/* FunctionalSettlingPhaseFramesPresent                           */ 1387,
-/* FunctionalSyncPulse                                            */ 1388,
-/* GPSAltitude                                                    */ 631,
-/* GPSAltitudeRef                                                 */ 630,
-/* GPSAreaInformation                                             */ 653,
-/* GPSDOP                                                         */ 636,
-/* GPSDateStamp                                                   */ 654,
-/* GPSDestBearing                                                 */ 649,
-/* GPSDestBearingRef                                              */ 648,
-/* GPSDestDistance                                                */ 651,
-/* GPSDestDistanceRef                                             */ 650,
-/* GPSDestLatitude                                                */ 645,
-/* GPSDestLatitudeRef                                             */ 644,
-/* GPSDestLongitude                                               */ 647,
-/* GPSDestLongitudeRef                                            */ 646,
-/* GPSDifferential                                                */ 655,
-/* GPSImgDirection                                                */ 642,
-/* GPSImgDirectionRef                                             */ 641,
-/* GPSLatitude                                                    */ 627,
-/* GPSLatitudeRef                                                 */ 626,
-/* GPSLongitude                                                   */ 629,
-/* GPSLongitudeRef                                                */ 628,
-/* GPSMapDatum                                                    */ 643,
-/* GPSMeasureMode                                                 */ 635,
-/* GPSProcessingMethod                                            */ 652,
-/* GPSSatellites                                                  */ 633,
-/* GPSSpeed                                                       */ 638,
-/* GPSSpeedRef                                                    */ 637,
-/* GPSStatus                                                      */ 634,
-/* GPSTimeStamp                                                   */ 632,
-/* GPSTrack                                                       */ 640,
-/* GPSTrackRef                                                    */ 639,
-/* GPSVersionID                                                   */ 625,
-/* GainControl                                                    */ 612,
-/* GainCorrectionReferenceSequence                                */ 423,
-/* GammaValue                                                     */ 2103,
-/* GantryAngle                                                    */ 4023,
-/* GantryAngleTolerance                                           */ 3898,
-/* GantryDetectorSlew                                             */ 783,
-/* GantryDetectorTilt                                             */ 782,
+/* PixelAspectRatio                                               */ 1922,
+/* ReferencedChannelShieldNumber                                  */ 3847,
+/* ReferencedSOPClassUIDInFile                                    */ 36,
+/* ImageQualityIndicatorType                                      */ 514,
+/* ThreatCategory                                                 */ 4675,
+/* DisplayCalibrationResultSequence                               */ 2099,
+/* PatientSpeciesDescription                                      */ 321,
+/* NumberOfBlockSlabItems                                         */ 4247,
+/* BscanRate                                                      */ 1803,
 /* GantryID                                                       */ 716,
-/* GantryMotionCorrected                                          */ 1422,
-/* GantryPitchAngle                                               */ 4047,
-/* GantryPitchAngleTolerance                                      */ 4049,
-/* GantryPitchRotationDirection                                   */ 4048,
-/* GantryRotationDirection                                        */ 4024,
-/* GantryType                                                     */ 4670,
-/* GapLength                                                      */ 3115,
-/* GateSettingsSequence                                           */ 482,
-/* GateThreshold                                                  */ 483,
-/* GatedInformationSequence                                       */ 2809,
-/* GeneralAccessoryDefinitionSequence                             */ 4379,
-/* GeneralAccessoryDescription                                    */ 4236,
-/* GeneralAccessoryID                                             */ 4235,
-/* GeneralAccessoryNumber                                         */ 4238,
-/* GeneralAccessorySequence                                       */ 4234,
-/* GeneralAccessoryType                                           */ 4237,
-/* GeneralMachineVerificationSequence                             */ 3380,
-/* GeneralPurposePerformedProcedureStepStatus                     */ 2402,
-/* GeneralPurposeScheduledProcedureStepPriority                   */ 2403,
-/* GeneralPurposeScheduledProcedureStepStatus                     */ 2401,
-/* GeneralizedDefectCorrectedSensitivityDeviationFlag             */ 1877,
-/* GeneralizedDefectCorrectedSensitivityDeviationProbabilityValue */ 1879,
-/* GeneralizedDefectCorrectedSensitivityDeviationValue            */ 1878,
-/* GeneralizedDefectSensitivityDeviationAlgorithmSequence         */ 1846,
-/* GeneratorID                                                    */ 713,
-/* GeneratorPower                                                 */ 815,
-/* GeneticModificationsCodeSequence                               */ 289,
-/* GeneticModificationsDescription                                */ 287,
-/* GeneticModificationsNomenclature                               */ 288,
-/* GeneticModificationsSequence                                   */ 286,
-/* GeometricMaximumDistortion                                     */ 2140,
-/* GeometricalProperties                                          */ 2139,
-/* GeometryForDisplay                                             */ 3225,
-/* GeometryOfKSpaceTraversal                                      */ 1065,
-/* GlobalCrop                                                     */ 3166,
-/* GlobalCroppingSpecificationIndex                               */ 3167,
-/* GlobalDeviationFromNormal                                      */ 1845,
-/* GlobalDeviationProbability                                     */ 1850,
-/* GlobalDeviationProbabilityNormalsFlag                          */ 1838,
-/* GlobalDeviationProbabilitySequence                             */ 1861,
-/* GradientEchoTrainLength                                        */ 1180,
-/* GradientOutput                                                 */ 1156,
-/* GradientOutputType                                             */ 1154,
-/* GraphicAnnotationSequence                                      */ 3043,
-/* GraphicAnnotationUnits                                         */ 3047,
-/* GraphicCoordinatesDataSequence                                 */ 3141,
-/* GraphicData                                                    */ 3058,
-/* GraphicDimensions                                              */ 3056,
-/* GraphicFilled                                                  */ 3060,
-/* GraphicGroupDescription                                        */ 3086,
-/* GraphicGroupID                                                 */ 3128,
-/* GraphicGroupLabel                                              */ 3085,
-/* GraphicGroupSequence                                           */ 3096,
-/* GraphicLayer                                                   */ 3044,
-/* GraphicLayerDescription                                        */ 3073,
-/* GraphicLayerOrder                                              */ 3070,
-/* GraphicLayerRecommendedDisplayCIELabValue                      */ 3147,
-/* GraphicLayerRecommendedDisplayGrayscaleValue                   */ 3071,
-/* GraphicLayerRecommendedDisplayRGBValue                         */ 3072,
-/* GraphicLayerSequence                                           */ 3069,
-/* GraphicObjectSequence                                          */ 3050,
-/* GraphicType                                                    */ 3059,
-/* GrayLookupTableData                                            */ 2014,
-/* GrayLookupTableDescriptor                                      */ 2005,
-/* GrayScale                                                      */ 2003,
-/* GreenPaletteColorLookupTableData                               */ 2016,
-/* GreenPaletteColorLookupTableDescriptor                         */ 2007,
-/* Grid                                                           */ 814,
-/* GridAbsorbingMaterial                                          */ 1023,
-/* GridAspectRatio                                                */ 1027,
-/* GridDimensions                                                 */ 2896,
-/* GridFocalDistance                                              */ 1029,
-/* GridFrameOffsetVector                                          */ 3698,
-/* GridID                                                         */ 714,
-/* GridPeriod                                                     */ 1028,
-/* GridPitch                                                      */ 1026,
-/* GridResolution                                                 */ 2897,
-/* GridSpacingMaterial                                            */ 1024,
-/* GridThickness                                                  */ 1025,
-/* GroupOfPatientsIdentificationSequence                          */ 265,
-/* HL7DocumentEffectiveTime                                       */ 2575,
-/* HL7DocumentTypeCodeSequence                                    */ 2576,
-/* HL7InstanceIdentifier                                          */ 2574,
-/* HL7StructuredDocumentReferenceSequence                         */ 2547,
-/* HPGLContourPenNumber                                           */ 2989,
-/* HPGLDocument                                                   */ 2988,
-/* HPGLDocumentID                                                 */ 2983,
-/* HPGLDocumentLabel                                              */ 2984,
-/* HPGLDocumentScaling                                            */ 2987,
-/* HPGLDocumentSequence                                           */ 2982,
-/* HPGLPenDescription                                             */ 2993,
-/* HPGLPenLabel                                                   */ 2992,
-/* HPGLPenNumber                                                  */ 2991,
-/* HPGLPenSequence                                                */ 2990,
-/* HalfValueLayer                                                 */ 2325,
-/* HangingProtocolCreationDateTime                                */ 3234,
-/* HangingProtocolCreator                                         */ 3233,
-/* HangingProtocolDefinitionSequence                              */ 3235,
-/* HangingProtocolDescription                                     */ 3231,
-/* HangingProtocolLevel                                           */ 3232,
-/* HangingProtocolName                                            */ 3230,
-/* HangingProtocolUserGroupName                                   */ 3237,
-/* HangingProtocolUserIdentificationCodeSequence                  */ 3236,
-/* HardcopyCreationDeviceID                                       */ 721,
-/* HardcopyDeviceManufacturer                                     */ 725,
-/* HardcopyDeviceManufacturerModelName                            */ 729,
-/* HardcopyDeviceSoftwareVersion                                  */ 728,
-/* HeadFixationAngle                                              */ 4046,
-/* HeadFixationAngleTolerance                                     */ 4052,
-/* HeartRate                                                      */ 775,
-/* HighBit                                                        */ 1947,
-/* HighDoseTechniqueType                                          */ 3955,
+/* PhysicalDeltaX                                                 */ 964,
+/* ScheduledStudyStopTime                                         */ 2163,
 /* HighEnergyDetectors                                            */ 4663,
-/* HighRRValue                                                    */ 770,
-/* HistogramBinWidth                                              */ 2869,
-/* HistogramData                                                  */ 2871,
-/* HistogramExplanation                                           */ 2870,
-/* HistogramFirstBinValue                                         */ 2867,
-/* HistogramLastBinValue                                          */ 2868,
-/* HistogramNumberOfBins                                          */ 2866,
-/* HistogramSequence                                              */ 2865,
-/* HomeCommunityID                                                */ 2587,
-/* HorizontalAlignment                                            */ 3098,
-/* HorizontalFieldOfView                                          */ 1642,
-/* HorizontalOffsetOfSensor                                       */ 418,
-/* HorizontalPrismBase                                            */ 2626,
-/* HorizontalPrismPower                                           */ 2625,
-/* HuffmanTableSize                                               */ 3544,
-/* HuffmanTableTriplet                                            */ 3545,
-/* HumanPerformerCodeSequence                                     */ 2409,
-/* HumanPerformerName                                             */ 2432,
-/* HumanPerformerOrganization                                     */ 2431,
-/* Humidity                                                       */ 595,
-/* ICCProfile                                                     */ 2049,
-/* IOLFormulaCodeSequence                                         */ 1689,
-/* IOLFormulaDetail                                               */ 1690,
-/* IOLManufacturer                                                */ 1713,
-/* IOLPower                                                       */ 1706,
-/* IOLPowerForExactEmmetropia                                     */ 1721,
-/* IOLPowerForExactTargetRefraction                               */ 1722,
-/* IOLPowerSequence                                               */ 1711,
-/* ISOSpeed                                                       */ 579,
-/* ISOSpeedLatitudeyyy                                            */ 580,
-/* ISOSpeedLatitudezzz                                            */ 581,
-/* IVUSAcquisition                                                */ 923,
-/* IVUSGatedRate                                                  */ 925,
-/* IVUSPullbackRate                                               */ 924,
-/* IVUSPullbackStartFrameNumber                                   */ 926,
-/* IVUSPullbackStopFrameNumber                                    */ 927,
-/* IconImageSequence                                              */ 3505,
-/* IdenticalDocumentsSequence                                     */ 2557,
-/* IdentificationDescriptionTrial                                 */ 2525,
-/* IdentifierCodeSequenceTrial                                    */ 2479,
-/* IdentifierTypeCode                                             */ 2289,
-/* IdentifyingComments                                            */ 241,
-/* IdentifyingPrivateElements                                     */ 135,
-/* Illumination                                                   */ 3590,
-/* IlluminationBandwidth                                          */ 1679,
-/* IlluminationColorCodeSequence                                  */ 2725,
-/* IlluminationPower                                              */ 1678,
-/* IlluminationTypeCodeSequence                                   */ 1651,
-/* IlluminationWaveLength                                         */ 1677,
-/* IlluminatorTypeCodeSequence                                    */ 2720,
-/* ImageAndFluoroscopyAreaDoseProduct                             */ 809,
-/* ImageBoxContentSequence                                        */ 3644,
-/* ImageBoxLargeScrollAmount                                      */ 3316,
-/* ImageBoxLargeScrollType                                        */ 3315,
-/* ImageBoxLayoutType                                             */ 3309,
-/* ImageBoxNumber                                                 */ 3308,
-/* ImageBoxOverlapPriority                                        */ 3317,
-/* ImageBoxPosition                                               */ 3596,
-/* ImageBoxPresentationLUTFlag                                    */ 3562,
-/* ImageBoxScrollDirection                                        */ 3312,
-/* ImageBoxSmallScrollAmount                                      */ 3314,
-/* ImageBoxSmallScrollType                                        */ 3313,
-/* ImageBoxSynchronizationSequence                                */ 3328,
-/* ImageBoxTileHorizontalDimension                                */ 3310,
-/* ImageBoxTileVerticalDimension                                  */ 3311,
-/* ImageBoxesSequence                                             */ 3307,
-/* ImageCenterPointCoordinatesSequence                            */ 2361,
-/* ImageComments                                                  */ 1565,
-/* ImageDataLocation                                              */ 1991,
-/* ImageDataTypeSequence                                          */ 1438,
-/* ImageDimensions                                                */ 1909,
-/* ImageDisplayFormat                                             */ 3570,
-/* ImageFilter                                                    */ 1221,
-/* ImageFilterDescription                                         */ 1499,
-/* ImageFormat                                                    */ 1923,
-/* ImageFrameOrigin                                               */ 4794,
-/* ImageGeometryType                                              */ 1533,
-/* ImageHorizontalFlip                                            */ 3062,
-/* ImageID                                                        */ 2831,
-/* ImageIndex                                                     */ 2862,
-/* ImageLaterality                                                */ 1532,
-/* ImageLocation                                                  */ 1963,
-/* ImageOrientation                                               */ 1527,
-/* ImageOrientationPatient                                        */ 1528,
-/* ImageOrientationSlide                                          */ 2721,
-/* ImageOrientationVolume                                         */ 1611,
-/* ImageOverlayBoxContentSequence                                 */ 3646,
-/* ImageOverlayFlag                                               */ 3560,
-/* ImagePathFilterPassBand                                        */ 1634,
-/* ImagePathFilterPassThroughWavelength                           */ 1633,
-/* ImagePathFilterTypeStackCodeSequence                           */ 1653,
-/* ImagePlanePixelSpacing                                         */ 3674,
-/* ImagePosition                                                  */ 1525,
-/* ImagePositionPatient                                           */ 1526,
-/* ImagePositionVolume                                            */ 1610,
-/* ImagePresentationComments                                      */ 2061,
-/* ImageProcessingApplied                                         */ 2141,
-/* ImageQualityIndicatorMaterial                                  */ 515,
-/* ImageQualityIndicatorSize                                      */ 516,
-/* ImageQualityIndicatorType                                      */ 514,
-/* ImageRotation                                                  */ 3063,
-/* ImageRotationRetired                                           */ 3061,
-/* ImageScaleRepresentation                                       */ 4738,
-/* ImageSetLabel                                                  */ 3252,
-/* ImageSetNumber                                                 */ 3246,
-/* ImageSetSelectorCategory                                       */ 3247,
-/* ImageSetSelectorSequence                                       */ 3241,
-/* ImageSetSelectorUsageFlag                                      */ 3242,
-/* ImageSetsSequence                                              */ 3240,
-/* ImageToEquipmentMappingMatrix                                  */ 2151,
-/* ImageTransformationMatrix                                      */ 947,
-/* ImageTranslationVector                                         */ 948,
-/* ImageTriggerDelay                                              */ 752,
-/* ImageType                                                      */ 45,
-/* ImageVolumeGeometry                                            */ 3163,
-/* ImagedNucleus                                                  */ 699,
-/* ImagedVolumeDepth                                              */ 2710,
-/* ImagedVolumeHeight                                             */ 2709,
-/* ImagedVolumeWidth                                              */ 2708,
-/* ImagerPixelSpacing                                             */ 813,
-/* ImagesInAcquisition                                            */ 1543,
-/* ImagesInSeries                                                 */ 1544,
-/* ImagesInStudy                                                  */ 1546,
-/* ImagingDeviceSpecificAcquisitionParameters                     */ 3958,
-/* ImagingFrequency                                               */ 698,
-/* ImagingServiceRequestComments                                  */ 2399,
-/* ImpedanceMeasurementCurrentType                                */ 2268,
-/* ImpedanceMeasurementDateTime                                   */ 2266,
-/* ImpedanceMeasurementFrequency                                  */ 2267,
-/* ImpedanceValue                                                 */ 2265,
-/* ImplantAssemblyTemplateIssuer                                  */ 3426,
-/* ImplantAssemblyTemplateName                                    */ 3425,
-/* ImplantAssemblyTemplateTargetAnatomySequence                   */ 3432,
-/* ImplantAssemblyTemplateType                                    */ 3429,
-/* ImplantAssemblyTemplateVersion                                 */ 3427,
-/* ImplantName                                                    */ 1715,
-/* ImplantPartNumber                                              */ 1717,
-/* ImplantRegulatoryDisapprovalCodeSequence                       */ 2980,
-/* ImplantSize                                                    */ 2968,
-/* ImplantTargetAnatomySequence                                   */ 2975,
-/* ImplantTemplate3DModelSurfaceNumber                            */ 2996,
-/* ImplantTemplateGroupDescription                                */ 3449,
-/* ImplantTemplateGroupIssuer                                     */ 3450,
-/* ImplantTemplateGroupMemberID                                   */ 3455,
-/* ImplantTemplateGroupMemberMatching2DCoordinatesSequence        */ 3458,
-/* ImplantTemplateGroupMembersSequence                            */ 3454,
-/* ImplantTemplateGroupName                                       */ 3448,
-/* ImplantTemplateGroupTargetAnatomySequence                      */ 3453,
-/* ImplantTemplateGroupVariationDimensionName                     */ 3462,
-/* ImplantTemplateGroupVariationDimensionRank                     */ 3465,
-/* ImplantTemplateGroupVariationDimensionRankSequence             */ 3463,
-/* ImplantTemplateGroupVariationDimensionSequence                 */ 3461,
-/* ImplantTemplateGroupVersion                                    */ 3451,
-/* ImplantTemplateVersion                                         */ 2969,
-/* ImplantType                                                    */ 2971,
-/* ImplantTypeCodeSequence                                        */ 3002,
-/* ImplementationClassUID                                         */ 5,
-/* ImplementationVersionName                                      */ 6,
-/* Impressions                                                    */ 4660,
-/* InConcatenationNumber                                          */ 1583,
-/* InConcatenationTotalNumber                                     */ 1584,
-/* InPlanePhaseEncodingDirection                                  */ 846,
-/* InStackPositionNumber                                          */ 1569,
-/* InboundArrivalType                                             */ 4720,
-/* IncidentAngle                                                  */ 474,
-/* IncludeDisplayApplication                                      */ 3658,
-/* IncludeNonDICOMObjects                                         */ 3657,
-/* IncludesImagingSubject                                         */ 2188,
-/* IncludesInformation                                            */ 2192,
-/* IndexNormalsFlag                                               */ 1903,
-/* IndexProbability                                               */ 1904,
-/* IndexProbabilitySequence                                       */ 1905,
-/* IndicationDescription                                          */ 393,
-/* IndicationDisposition                                          */ 395,
-/* IndicationLabel                                                */ 392,
-/* IndicationNumber                                               */ 391,
-/* IndicationPhysicalPropertySequence                             */ 397,
-/* IndicationROISequence                                          */ 396,
-/* IndicationSequence                                             */ 390,
-/* IndicationType                                                 */ 394,
-/* InformationFromManufacturerSequence                            */ 2976,
-/* InformationIssueDateTime                                       */ 2978,
-/* InformationSummary                                             */ 2979,
-/* InitialCineRunState                                            */ 684,
-/* InnerDiameter                                                  */ 373,
-/* InputAvailabilityFlag                                          */ 2416,
-/* InputInformationSequence                                       */ 2417,
-/* InputReadinessState                                            */ 2434,
-/* InputSequencePositionIndex                                     */ 3158,
-/* InspectionSelectionCriteria                                    */ 4745,
-/* InstanceAvailability                                           */ 77,
-/* InstanceCoercionDateTime                                       */ 50,
-/* InstanceCreationDate                                           */ 47,
-/* InstanceCreationTime                                           */ 48,
-/* InstanceCreatorUID                                             */ 49,
-/* InstanceLevelReferencedPerformedProcedureStepSequence          */ 4552,
-/* InstanceNumber                                                 */ 1514,
-/* InstanceOriginStatus                                           */ 3541,
-/* InstitutionAddress                                             */ 87,
-/* InstitutionCodeSequence                                        */ 88,
-/* InstitutionName                                                */ 86,
-/* InstitutionalDepartmentName                                    */ 152,
-/* InstitutionalDepartmentTypeCodeSequence                        */ 153,
-/* InstructionDescription                                         */ 1470,
-/* InstructionIndex                                               */ 1468,
-/* InstructionPerformanceComment                                  */ 1473,
-/* InstructionPerformedDateTime                                   */ 1472,
-/* InstructionPerformedFlag                                       */ 1471,
-/* InstructionSequence                                            */ 1467,
-/* InstructionText                                                */ 1469,
-/* InsurancePlanIdentification                                    */ 302,
-/* IntendedDeliveryDuration                                       */ 4609,
-/* IntendedFractionStartTime                                      */ 4616,
-/* IntendedNumberOfFractions                                      */ 4320,
-/* IntendedPhaseEndDate                                           */ 4561,
-/* IntendedPhaseStartDate                                         */ 4560,
-/* IntendedRTTreatmentPhaseSequence                               */ 4559,
-/* IntendedRecipientsOfResultsIdentificationSequence              */ 2380,
-/* IntendedStartDayOfWeek                                         */ 4617,
-/* IntensifierActiveDimensions                                    */ 1301,
-/* IntensifierActiveShape                                         */ 1300,
-/* IntensifierSize                                                */ 812,
-/* InterMarkerDistance                                            */ 2750,
-/* InterlockCodeSequence                                          */ 4435,
-/* InterlockDateTime                                              */ 4432,
-/* InterlockDescription                                           */ 4433,
-/* InterlockOriginDescription                                     */ 4446,
-/* InterlockOriginatingDeviceSequence                             */ 4434,
-/* InterlockResolutionCodeSequence                                */ 4436,
-/* InterlockResolutionUserSequence                                */ 4437,
-/* InterlockSequence                                              */ 4431,
-/* IntermediatePupillaryDistance                                  */ 2639,
-/* InternalDetectorFrameTime                                      */ 414,
-/* InternationalRouteSegment                                      */ 4696,
-/* InteroperabilityIndex                                          */ 623,
-/* InteroperabilityVersion                                        */ 624,
-/* InterpolationType                                              */ 2782,
-/* InterpretationApprovalDate                                     */ 4648,
-/* InterpretationApprovalTime                                     */ 4649,
-/* InterpretationApproverSequence                                 */ 4647,
-/* InterpretationAuthor                                           */ 4646,
-/* InterpretationDiagnosisCodeSequence                            */ 4652,
-/* InterpretationDiagnosisDescription                             */ 4651,
-/* InterpretationID                                               */ 4656,
-/* InterpretationIDIssuer                                         */ 4657,
-/* InterpretationRecordedDate                                     */ 4638,
-/* InterpretationRecordedTime                                     */ 4639,
-/* InterpretationRecorder                                         */ 4640,
-/* InterpretationStatusID                                         */ 4659,
-/* InterpretationText                                             */ 4645,
-/* InterpretationTranscriber                                      */ 4644,
-/* InterpretationTranscriptionDate                                */ 4642,
-/* InterpretationTranscriptionTime                                */ 4643,
-/* InterpretationTypeID                                           */ 4658,
-/* IntervalNumber                                                 */ 1517,
-/* IntervalsAcquired                                              */ 771,
-/* IntervalsRejected                                              */ 772,
-/* InterventionDescription                                        */ 682,
-/* InterventionDrugCodeSequence                                   */ 670,
-/* InterventionDrugDose                                           */ 669,
-/* InterventionDrugInformationSequence                            */ 667,
-/* InterventionDrugName                                           */ 676,
-/* InterventionDrugStartTime                                      */ 677,
-/* InterventionDrugStopTime                                       */ 668,
-/* InterventionSequence                                           */ 678,
-/* InterventionStatus                                             */ 680,
-/* IntraOcularPressure                                            */ 1641,
-/* IntraocularLensCalculationsLeftEyeSequence                     */ 1754,
-/* IntraocularLensCalculationsRightEyeSequence                    */ 1753,
-/* IntravascularFrameContentSequence                              */ 2773,
-/* IntravascularLongitudinalDistance                              */ 2774,
-/* IntravascularOCTFrameContentSequence                           */ 2775,
-/* IntravascularOCTFrameTypeSequence                              */ 2771,
-/* InversionRecovery                                              */ 1045,
-/* InversionTime                                                  */ 696,
-/* InversionTimes                                                 */ 1103,
-/* IonBeamLimitingDeviceSequence                                  */ 4225,
-/* IonBeamSequence                                                */ 4224,
-/* IonBlockSequence                                               */ 4226,
-/* IonControlPointDeliverySequence                                */ 3790,
-/* IonControlPointSequence                                        */ 4227,
-/* IonControlPointVerificationSequence                            */ 3386,
-/* IonMachineVerificationSequence                                 */ 3382,
-/* IonRangeCompensatorSequence                                    */ 4161,
-/* IonToleranceTableSequence                                      */ 4223,
-/* IonWedgePositionSequence                                       */ 4229,
-/* IonWedgeSequence                                               */ 4228,
-/* IrradiationEventIdentificationSequence                         */ 1338,
-/* IrradiationEventUID                                            */ 238,
-/* IsocenterPosition                                              */ 4035,
-/* IsocenterReferenceSystemSequence                               */ 1324,
-/* IsocenterToBeamLimitingDeviceDistance                          */ 3946,
-/* IsocenterToBlockTrayDistance                                   */ 3997,
-/* IsocenterToCompensatorDistances                                */ 4158,
-/* IsocenterToCompensatorTrayDistance                             */ 4156,
-/* IsocenterToGeneralAccessoryDistance                            */ 4240,
-/* IsocenterToLateralSpreadingDeviceDistance                      */ 4205,
-/* IsocenterToRangeModulatorDistance                              */ 4211,
-/* IsocenterToRangeShifterDistance                                */ 4201,
-/* IsocenterToWedgeTrayDistance                                   */ 3969,
-/* IsotopeNumber                                                  */ 1515,
-/* IssueDateOfImagingServiceRequest                               */ 2389,
-/* IssueTimeOfImagingServiceRequest                               */ 2390,
-/* IssuerOfAccessionNumberSequence                                */ 72,
-/* IssuerOfAdmissionID                                            */ 2197,
-/* IssuerOfAdmissionIDSequence                                    */ 2198,
-/* IssuerOfPatientID                                              */ 261,
-/* IssuerOfPatientIDQualifiersSequence                            */ 263,
-/* IssuerOfServiceEpisodeID                                       */ 2213,
-/* IssuerOfServiceEpisodeIDSequence                               */ 2215,
-/* IssuerOfTheContainerIdentifierSequence                         */ 2339,
-/* IssuerOfTheSpecimenIdentifierSequence                          */ 2352,
-/* Italic                                                         */ 3106,
-/* Item                                                           */ 4841,
-/* ItemDelimitationItem                                           */ 4842,
-/* ItemNumber                                                     */ 1520,
-/* IterativeReconstructionMethod                                  */ 1429,
-/* ItineraryID                                                    */ 4715,
-/* ItineraryIDAssigningAuthority                                  */ 4717,
-/* ItineraryIDType                                                */ 4716,
-/* KSpaceFiltering                                                */ 1091,
-/* KVP                                                            */ 686,
-/* KVUsedInGainCalibration                                        */ 425,
-/* KeratoconusPredictionIndex                                     */ 2697,
-/* KeratometerIndex                                               */ 1691,
-/* KeratometricAxis                                               */ 2646,
-/* KeratometricPower                                              */ 2645,
-/* KeratometryLeftEyeSequence                                     */ 2642,
-/* KeratometryMeasurementTypeCodeSequence                         */ 1716,
-/* KeratometryRightEyeSequence                                    */ 2641,
-/* LINACEnergy                                                    */ 517,
-/* LINACOutput                                                    */ 518,
-/* LUTData                                                        */ 2058,
-/* LUTDescriptor                                                  */ 2055,
-/* LUTExplanation                                                 */ 2056,
-/* LUTFrameRange                                                  */ 2150,
-/* LUTFunction                                                    */ 2143,
-/* LUTLabel                                                       */ 2449,
-/* LUTNumber                                                      */ 1524,
-/* LabelStyleSelection                                            */ 3652,
-/* LabelText                                                      */ 3651,
-/* LabelUsingInformationExtractedFromInstances                    */ 3650,
-/* LanguageCodeSequence                                           */ 44,
-/* LanguageCodeSequenceTrial                                      */ 2564,
-/* LargeBluePaletteColorLookupTableData                           */ 2021,
-/* LargeBluePaletteColorLookupTableDescriptor                     */ 2012,
-/* LargeGreenPaletteColorLookupTableData                          */ 2020,
-/* LargeGreenPaletteColorLookupTableDescriptor                    */ 2011,
-/* LargePaletteColorLookupTableUID                                */ 2022,
-/* LargeRedPaletteColorLookupTableData                            */ 2019,
-/* LargeRedPaletteColorLookupTableDescriptor                      */ 2010,
-/* LargestImagePixelValue                                         */ 1952,
-/* LargestImagePixelValueInPlane                                  */ 1956,
-/* LargestMonochromePixelValue                                    */ 2128,
-/* LargestPixelValueInSeries                                      */ 1954,
-/* LargestValidPixelValue                                         */ 1950,
-/* LastMenstrualDate                                              */ 319,
-/* LateralSpreadingDeviceDescription                              */ 4183,
-/* LateralSpreadingDeviceID                                       */ 4181,
-/* LateralSpreadingDeviceNumber                                   */ 4180,
-/* LateralSpreadingDeviceSequence                                 */ 4179,
-/* LateralSpreadingDeviceSetting                                  */ 4204,
-/* LateralSpreadingDeviceSettingsSequence                         */ 4203,
-/* LateralSpreadingDeviceType                                     */ 4182,
-/* LateralSpreadingDeviceWaterEquivalentThickness                 */ 4184,
-/* Laterality                                                     */ 1531,
-/* LeafJawPositions                                               */ 4022,
-/* LeafPositionBoundaries                                         */ 3948,
-/* LeftImageSequence                                              */ 1661,
-/* LeftLensSequence                                               */ 2621,
-/* LengthToEnd                                                    */ 42,
-/* LensConstantDescription                                        */ 1714,
-/* LensConstantSequence                                           */ 1712,
-/* LensDescription                                                */ 2619,
-/* LensMake                                                       */ 620,
-/* LensModel                                                      */ 621,
-/* LensSegmentType                                                */ 2629,
-/* LensSerialNumber                                               */ 622,
-/* LensSpecification                                              */ 619,
-/* LensStatusCodeSequence                                         */ 1687,
-/* LensStatusDescription                                          */ 1709,
-/* LensThickness                                                  */ 1729,
-/* LensThicknessSequence                                          */ 1724,
-/* LensesCodeSequence                                             */ 1654,
-/* LesionNumber                                                   */ 928,
-/* LightDirection                                                 */ 3194,
-/* LightPathFilterPassBand                                        */ 1632,
-/* LightPathFilterPassThroughWavelength                           */ 1631,
-/* LightPathFilterTypeStackCodeSequence                           */ 1652,
-/* LightSource                                                    */ 590,
-/* LineDashingStyle                                               */ 3110,
-/* LinePattern                                                    */ 3111,
-/* LineSequence                                                   */ 2932,
-/* LineStyleSequence                                              */ 3094,
-/* LineThickness                                                  */ 3109,
-/* ListOfMIMETypes                                                */ 2592,
-/* LocalDeviationProbabilityNormalsFlag                           */ 1851,
-/* LocalNamespaceEntityID                                         */ 2286,
-/* LocalizedDeviationFromNormal                                   */ 1847,
-/* LocalizedDeviationProbability                                  */ 1852,
-/* LocalizedDeviationProbabilitySequence                          */ 1862,
-/* LocalizingCursorPosition                                       */ 919,
-/* Location                                                       */ 1529,
-/* LocationOfMeasuredBeamDiameter                                 */ 451,
-/* LongCodeValue                                                  */ 118,
-/* LongDeviceDescription                                          */ 2757,
-/* LongEdgePointIndexList                                         */ 2950,
-/* LongPrimitivePointIndexList                                    */ 2948,
-/* LongTrianglePointIndexList                                     */ 2949,
-/* LongVertexPointIndexList                                       */ 2951,
-/* LongitudinalTemporalEventType                                  */ 345,
-/* LongitudinalTemporalInformationModified                        */ 1967,
-/* LongitudinalTemporalOffsetFromEvent                            */ 344,
-/* LossyImageCompression                                          */ 2051,
-/* LossyImageCompressionMethod                                    */ 2053,
-/* LossyImageCompressionRatio                                     */ 2052,
-/* LossyImageCompressionRetired                                   */ 197,
-/* LowEnergyDetectors                                             */ 4662,
-/* LowRRValue                                                     */ 769,
-/* LuminanceCharacteristicsID                                     */ 2086,
-/* LuminanceResponseDescription                                   */ 2109,
-/* LuminanceResponseSequence                                      */ 2105,
-/* LuminanceResultSequence                                        */ 2113,
-/* LuminanceUniformityResultSequence                              */ 2116,
-/* LuminanceValue                                                 */ 2108,
-/* MAC                                                            */ 3529,
-/* MACAlgorithm                                                   */ 3516,
-/* MACCalculationTransferSyntaxUID                                */ 3515,
-/* MACIDNumber                                                    */ 3514,
-/* MACParametersSequence                                          */ 4748,
-/* MAUsedInGainCalibration                                        */ 426,
-/* MIMETypeOfEncapsulatedDocument                                 */ 2590,
-/* MPRSlabThickness                                               */ 3178,
-/* MPRThicknessType                                               */ 3177,
-/* MPRTopLeftHandCorner                                           */ 3179,
-/* MPRViewHeight                                                  */ 3185,
-/* MPRViewHeightDirection                                         */ 3184,
-/* MPRViewWidth                                                   */ 3181,
-/* MPRViewWidthDirection                                          */ 3180,
-/* MRAcquisitionFrequencyEncodingSteps                            */ 1085,
-/* MRAcquisitionPhaseEncodingStepsInPlane                         */ 1174,
-/* MRAcquisitionPhaseEncodingStepsOutOfPlane                      */ 1175,
-/* MRAcquisitionType                                              */ 664,
-/* MRArterialSpinLabelingSequence                                 */ 1182,
-/* MRAveragesSequence                                             */ 1132,
-/* MRDRDirectoryRecordOffset                                      */ 35,
-/* MRDiffusionSequence                                            */ 1130,
-/* MREchoSequence                                                 */ 1128,
-/* MRFOVGeometrySequence                                          */ 1133,
-/* MRImageFrameTypeSequence                                       */ 1172,
-/* MRImagingModifierSequence                                      */ 1043,
-/* MRMetaboliteMapSequence                                        */ 1138,
-/* MRModifierSequence                                             */ 1129,
-/* MRReceiveCoilSequence                                          */ 1072,
-/* MRSpatialSaturationSequence                                    */ 1126,
-/* MRSpectroscopyAcquisitionType                                  */ 1166,
-/* MRSpectroscopyFOVGeometrySequence                              */ 1122,
-/* MRSpectroscopyFrameTypeSequence                                */ 1173,
-/* MRTimingAndRelatedParametersSequence                           */ 1127,
-/* MRTransmitCoilSequence                                         */ 1079,
-/* MRVelocityEncodingSequence                                     */ 1163,
-/* MachineSpecificTreatmentTerminationCodeSequence                */ 4417,
-/* MagneticFieldStrength                                          */ 701,
-/* MagnetizationTransfer                                          */ 1055,
-/* MagnificationType                                              */ 3576,
-/* MagnifyToNumberOfColumns                                       */ 3615,
-/* MainLobeAngle                                                  */ 522,
-/* MainRoofAngle                                                  */ 523,
-/* MajorTicksSequence                                             */ 3124,
-/* MakerNote                                                      */ 593,
-/* MandatoryComponentType                                         */ 3438,
-/* Manifold                                                       */ 2911,
-/* ManipulatedImage                                               */ 1924,
-/* Manufacturer                                                   */ 85,
-/* ManufacturerDeviceClassUID                                     */ 719,
-/* ManufacturerDeviceIdentifier                                   */ 4551,
-/* ManufacturerModelName                                          */ 164,
-/* ManufacturerModelVersion                                       */ 4510,
-/* ManufacturerRelatedModelGroup                                  */ 128,
-/* MappedPixelValue                                               */ 1763,
-/* MappingResource                                                */ 100,
-/* MappingResourceIdentificationSequence                          */ 123,
-/* MappingResourceName                                            */ 121,
-/* MappingResourceUID                                             */ 117,
-/* MaskFrameNumbers                                               */ 2072,
-/* MaskOperation                                                  */ 2070,
-/* MaskOperationExplanation                                       */ 2076,
-/* MaskPointers                                                   */ 2067,
-/* MaskSelectionMode                                              */ 2142,
-/* MaskSubPixelShift                                              */ 2074,
-/* MaskSubtractionSequence                                        */ 2069,
-/* MaskVisibilityPercentage                                       */ 2144,
-/* MaskingImage                                                   */ 1534,
-/* Mass                                                           */ 4680,
-/* MaterialAttenuationSequence                                    */ 1282,
-/* MaterialCodeSequence                                           */ 1277,
-/* MaterialGrade                                                  */ 366,
-/* MaterialID                                                     */ 3976,
-/* MaterialIsolationDiameter                                      */ 365,
-/* MaterialNotes                                                  */ 369,
-/* MaterialPipeDiameter                                           */ 364,
-/* MaterialPropertiesDescription                                  */ 367,
-/* MaterialPropertiesFileFormatRetired                            */ 368,
-/* MaterialThickness                                              */ 363,
-/* MaterialsCodeSequence                                          */ 3000,
-/* MatingFeatureDegreeOfFreedomSequence                           */ 3009,
-/* MatingFeatureID                                                */ 3008,
-/* MatingFeatureSequence                                          */ 3007,
-/* MatingFeatureSetID                                             */ 3005,
-/* MatingFeatureSetLabel                                          */ 3006,
-/* MatingFeatureSetsSequence                                      */ 3004,
-/* MatrixRegistrationSequence                                     */ 3131,
-/* MatrixSequence                                                 */ 3132,
-/* MaxApertureValue                                               */ 587,
-/* MaxDensity                                                     */ 3585,
-/* MaximumAcrossScanDistortion                                    */ 1675,
-/* MaximumAlongScanDistortion                                     */ 1670,
-/* MaximumCollatedFilms                                           */ 3589,
-/* MaximumCoordinateValue                                         */ 4757,
-/* MaximumCornealCurvature                                        */ 2687,
-/* MaximumCornealCurvatureLocation                                */ 2688,
-/* MaximumCornealCurvatureSequence                                */ 2686,
-/* MaximumDepthDistortion                                         */ 1668,
-/* MaximumFractionalValue                                         */ 2885,
-/* MaximumMemoryAllocation                                        */ 3556,
-/* MaximumNominalEnergy                                           */ 4396,
-/* MaximumNumberOfIntervalDays                                    */ 4565,
-/* MaximumPointDistance                                           */ 2919,
-/* MaximumStimulusLuminance                                       */ 1809,
-/* MaximumStoredValueMapped                                       */ 2029,
-/* MeanPointDistance                                              */ 2918,
-/* MeasuredAPDimension                                            */ 298,
-/* MeasuredBandwidth                                              */ 454,
-/* MeasuredBeamDimensionA                                         */ 449,
-/* MeasuredBeamDimensionB                                         */ 450,
-/* MeasuredCenterFrequency                                        */ 453,
-/* MeasuredCharacteristics                                        */ 2115,
-/* MeasuredDoseDescription                                        */ 3771,
-/* MeasuredDoseReferenceNumber                                    */ 3806,
-/* MeasuredDoseReferenceSequence                                  */ 3770,
-/* MeasuredDoseType                                               */ 3772,
-/* MeasuredDoseValue                                              */ 3773,
-/* MeasuredLateralDimension                                       */ 299,
-/* MeasuredMetersetToDoseMappingSequence                          */ 4441,
-/* MeasuredValueSequence                                          */ 2530,
-/* MeasurementAutomationTrial                                     */ 2523,
-/* MeasurementEquipmentSequence                                   */ 2095,
-/* MeasurementEquipmentType                                       */ 2097,
-/* MeasurementFunctions                                           */ 2096,
-/* MeasurementLaterality                                          */ 1886,
-/* MeasurementPatternCodeSequence                                 */ 2122,
-/* MeasurementPrecisionDescriptionTrial                           */ 2472,
-/* MeasurementUnitsCodeSequence                                   */ 2367,
-/* MeasurementValuesSequence                                      */ 2965,
-/* MeasurementsSequence                                           */ 2960,
-/* MeasuringUnitsSequence                                         */ 2314,
-/* MechanicalIndex                                                */ 935,
-/* MediaDisposition                                               */ 3653,
-/* MediaInstalledSequence                                         */ 3565,
-/* MediaStorageSOPClassUID                                        */ 2,
-/* MediaStorageSOPInstanceUID                                     */ 3,
-/* MedicalAlerts                                                  */ 308,
-/* MedicalRecordLocator                                           */ 306,
-/* MediumType                                                     */ 3552,
-/* MemoryAllocation                                               */ 3555,
-/* MemoryBitDepth                                                 */ 3563,
-/* MetaboliteMapCodeSequence                                      */ 1107,
-/* MetaboliteMapDescription                                       */ 1104,
-/* MeteringMode                                                   */ 589,
-/* MetersetExposure                                               */ 3683,
-/* MetersetRate                                                   */ 4198,
-/* MetersetRateDelivered                                          */ 3794,
-/* MetersetRateSet                                                */ 3793,
-/* MetersetToDoseMappingSequence                                  */ 4299,
-/* MidSlabPosition                                                */ 1125,
-/* MilitaryRank                                                   */ 304,
-/* MinDensity                                                     */ 3584,
-/* MinimumCoordinateValue                                         */ 4756,
-/* MinimumHoursBetweenFractions                                   */ 4615,
-/* MinimumKeratometricSequence                                    */ 2689,
-/* MinimumNominalEnergy                                           */ 4395,
-/* MinimumNumberOfIntervalDays                                    */ 4564,
-/* MinimumSensitivityValue                                        */ 1880,
-/* MinimumStoredValueMapped                                       */ 2028,
-/* ModalitiesInStudy                                              */ 80,
-/* Modality                                                       */ 79,
-/* ModalityLUTSequence                                            */ 2054,
-/* ModalityLUTType                                                */ 2057,
-/* ModeOfPercutaneousAccessSequence                               */ 2770,
-/* ModelGroupUID                                                  */ 3041,
-/* ModelMirroring                                                 */ 3039,
-/* ModelModification                                              */ 3038,
-/* ModelSpecificationSequence                                     */ 1465,
-/* ModelUsageCodeSequence                                         */ 3040,
-/* ModifiableConstraintFlag                                       */ 3502,
-/* ModifiedAttributesSequence                                     */ 3533,
-/* ModifiedImageDate                                              */ 1561,
-/* ModifiedImageDescription                                       */ 1564,
-/* ModifiedImageID                                                */ 1560,
-/* ModifiedImageTime                                              */ 1563,
-/* ModifierCodeSequence                                           */ 2524,
-/* ModifyingDeviceID                                              */ 1559,
-/* ModifyingDeviceManufacturer                                    */ 1562,
-/* ModifyingSystem                                                */ 3538,
-/* ModulatedScanModeType                                          */ 4167,
-/* ModulationType                                                 */ 459,
-/* MonoenergeticEnergyEquivalent                                  */ 1276,
-/* MostRecentTreatmentDate                                        */ 3800,
-/* MotionSynchronizationSequence                                  */ 4232,
-/* MultiCoilConfiguration                                         */ 1076,
-/* MultiCoilDefinitionSequence                                    */ 1075,
-/* MultiCoilElementName                                           */ 1077,
-/* MultiCoilElementUsed                                           */ 1078,
-/* MultiFramePresentationSequence                                 */ 2148,
-/* MultiFrameSourceSOPInstanceUID                                 */ 187,
-/* MultiPlanarExcitation                                          */ 1048,
-/* MultiPlanarReconstructionStyle                                 */ 3176,
-/* MultienergyAcquisitionDescription                              */ 1275,
-/* MultienergyCTAcquisition                                       */ 1249,
-/* MultienergyCTAcquisitionSequence                               */ 1250,
-/* MultienergyCTCharacteristicsSequence                           */ 1252,
-/* MultienergyCTPathIndex                                         */ 1274,
-/* MultienergyCTPathSequence                                      */ 1273,
-/* MultienergyCTProcessingSequence                                */ 1251,
-/* MultienergyCTXRayDetectorSequence                              */ 1263,
-/* MultienergyCTXRaySourceSequence                                */ 1253,
-/* MultienergyDetectorType                                        */ 1266,
-/* MultienergySourceTechnique                                     */ 1256,
-/* MultipleComponentApprovalSequence                              */ 380,
-/* MultipleCopiesFlag                                             */ 2406,
-/* MultipleSpinEcho                                               */ 1047,
-/* MultiplexGroupLabel                                            */ 2228,
-/* MultiplexGroupTimeOffset                                       */ 753,
-/* MultiplexGroupUID                                              */ 2262,
-/* MultiplexedAudioChannelsDescriptionCodeSequence                */ 2259,
-/* MydriaticAgentCodeSequence                                     */ 1657,
-/* MydriaticAgentConcentration                                    */ 1676,
-/* MydriaticAgentConcentrationUnitsSequence                       */ 1673,
-/* MydriaticAgentSequence                                         */ 1680,
-/* NTPSourceAddress                                               */ 907,
-/* NameOfPhysiciansReadingStudy                                   */ 158,
-/* NamesOfIntendedRecipientsOfResults                             */ 2379,
-/* NavigationDisplaySet                                           */ 3305,
-/* NavigationIndicatorSequence                                    */ 3304,
-/* NearPupillaryDistance                                          */ 2638,
-/* NegativeCatchTrialsQuantity                                    */ 1828,
-/* NetworkID                                                      */ 146,
-/* NominalBeamAngle                                               */ 537,
-/* NominalBeamEnergy                                              */ 4017,
-/* NominalBeamEnergyUnit                                          */ 3879,
-/* NominalCardiacTriggerDelayTime                                 */ 1576,
-/* NominalCardiacTriggerTimePriorToRPeak                          */ 1577,
-/* NominalEnergy                                                  */ 4394,
-/* NominalFrequency                                               */ 452,
-/* NominalInterval                                                */ 747,
-/* NominalMaxEnergy                                               */ 1268,
-/* NominalMinEnergy                                               */ 1269,
-/* NominalPercentageOfCardiacPhase                                */ 1596,
-/* NominalPercentageOfRespiratoryPhase                            */ 1597,
-/* NominalPriorDose                                               */ 3882,
-/* NominalRangeModulatedRegionDepths                              */ 4258,
-/* NominalRangeModulationFractions                                */ 4257,
-/* NominalRespiratoryTriggerDelayTime                             */ 1607,
-/* NominalScannedPixelSpacing                                     */ 914,
-/* NominalScreenDefinitionSequence                                */ 3289,
-/* NonDICOMOutputCodeSequence                                     */ 2427,
-/* NonUniformRadialSamplingCorrected                              */ 1426,
-/* NonconformingDataElementValue                                  */ 3535,
-/* NonconformingModifiedAttributesSequence                        */ 3534,
-/* NonidentifyingPrivateElements                                  */ 133,
-/* NormalizationFactorFormat                                      */ 1981,
-/* NormalizationPoint                                             */ 3696,
-/* NotchFilterBandwidth                                           */ 2248,
-/* NotchFilterFrequency                                           */ 2247,
-/* NotificationFromManufacturerSequence                           */ 2977,
-/* NuclearMedicineSeriesType                                      */ 70,
-/* NumberOfAlarmObjects                                           */ 4702,
-/* NumberOfAssessmentObservations                                 */ 3483,
-/* NumberOfAverages                                               */ 697,
-/* NumberOfBeams                                                  */ 3918,
-/* NumberOfBlockSlabItems                                         */ 4247,
-/* NumberOfBlocks                                                 */ 3991,
-/* NumberOfBoli                                                   */ 3988,
-/* NumberOfBoluses                                                */ 4382,
-/* NumberOfBrachyApplicationSetups                                */ 3936,
-/* NumberOfChannels                                               */ 4765,
-/* NumberOfCompensators                                           */ 3975,
-/* NumberOfContourPoints                                          */ 3742,
-/* NumberOfControlPoints                                          */ 4014,
-/* NumberOfCopies                                                 */ 3549,
-/* NumberOfDetectors                                              */ 2794,
-/* NumberOfDisplaySubsystems                                      */ 2078,
-/* NumberOfElements                                               */ 444,
-/* NumberOfEnergyWindows                                          */ 2785,
-/* NumberOfEventTimers                                            */ 205,
-/* NumberOfFilms                                                  */ 3632,
-/* NumberOfFocalPlanes                                            */ 2717,
-/* NumberOfFractionPatternDigitsPerDay                            */ 3915,
-/* NumberOfFractions                                              */ 4608,
-/* NumberOfFractionsDelivered                                     */ 3801,
-/* NumberOfFractionsPlanned                                       */ 3914,
-/* NumberOfFrames                                                 */ 1911,
-/* NumberOfFramesInOverlay                                        */ 4789,
-/* NumberOfFramesInPhase                                          */ 2799,
-/* NumberOfFramesInRotation                                       */ 2806,
-/* NumberOfFramesIntegrated                                       */ 415,
-/* NumberOfFramesUsedForIntegration                               */ 427,
-/* NumberOfGeneralAccessories                                     */ 4380,
-/* NumberOfGraphicPoints                                          */ 3057,
-/* NumberOfHorizontalPixels                                       */ 3291,
-/* NumberOfIntervalFractions                                      */ 4607,
-/* NumberOfIterations                                             */ 1412,
-/* NumberOfKSpaceTrajectories                                     */ 1115,
-/* NumberOfLateralSpreadingDevices                                */ 4178,
-/* NumberOfLeafJawPairs                                           */ 3947,
-/* NumberOfLuminancePoints                                        */ 2104,
-/* NumberOfMapPoints                                              */ 1784,
-/* NumberOfOpticalPaths                                           */ 2739,
-/* NumberOfPaddedALines                                           */ 2781,
-/* NumberOfPaintings                                              */ 4222,
-/* NumberOfParallelRTBeamDelimiters                               */ 4338,
-/* NumberOfPatientRelatedInstances                                */ 1554,
-/* NumberOfPatientRelatedSeries                                   */ 1553,
-/* NumberOfPatientRelatedStudies                                  */ 1552,
-/* NumberOfPatientSupportDevices                                  */ 4401,
-/* NumberOfPhaseEncodingSteps                                     */ 703,
-/* NumberOfPhases                                                 */ 2797,
-/* NumberOfPoints                                                 */ 4750,
-/* NumberOfPolygonalVertices                                      */ 894,
-/* NumberOfPriorsReferenced                                       */ 3239,
-/* NumberOfPulses                                                 */ 4128,
-/* NumberOfRRIntervals                                            */ 2808,
-/* NumberOfRTAccessoryHolders                                     */ 4378,
-/* NumberOfRTBeamLimitingDeviceOpenings                           */ 4353,
-/* NumberOfRTBeamLimitingDevices                                  */ 4331,
-/* NumberOfRTControlPoints                                        */ 4271,
-/* NumberOfRadiationGenerationModes                               */ 4399,
-/* NumberOfRangeModulators                                        */ 4185,
-/* NumberOfRangeShifters                                          */ 4172,
-/* NumberOfReferences                                             */ 40,
-/* NumberOfRotations                                              */ 2804,
-/* NumberOfSamples                                                */ 4766,
-/* NumberOfScanSpotPositions                                      */ 4215,
-/* NumberOfScreens                                                */ 3288,
-/* NumberOfSeriesRelatedInstances                                 */ 1557,
-/* NumberOfSlices                                                 */ 2816,
-/* NumberOfStages                                                 */ 202,
-/* NumberOfStudyRelatedInstances                                  */ 1556,
-/* NumberOfStudyRelatedSeries                                     */ 1555,
-/* NumberOfSubsets                                                */ 1413,
-/* NumberOfSurfacePoints                                          */ 2915,
-/* NumberOfSurfaces                                               */ 2901,
-/* NumberOfTableBreakPoints                                       */ 989,
-/* NumberOfTableEntries                                           */ 992,
-/* NumberOfTables                                                 */ 1988,
-/* NumberOfTemporalPositions                                      */ 1537,
-/* NumberOfTimeSlices                                             */ 2819,
-/* NumberOfTimeSlots                                              */ 2812,
-/* NumberOfTomosynthesisSourceImages                              */ 867,
-/* NumberOfTotalObjects                                           */ 4701,
-/* NumberOfTransformSteps                                         */ 1971,
-/* NumberOfTriggersInPhase                                        */ 2823,
-/* NumberOfVectors                                                */ 2923,
-/* NumberOfVerticalPixels                                         */ 3290,
-/* NumberOfViewsInStage                                           */ 206,
-/* NumberOfVisualStimuli                                          */ 1821,
-/* NumberOfVolumetricCurvePoints                                  */ 3182,
-/* NumberOfWaveformChannels                                       */ 2225,
-/* NumberOfWaveformSamples                                        */ 2226,
-/* NumberOfWedgePositions                                         */ 4351,
-/* NumberOfWedges                                                 */ 3960,
-/* NumberOfZeroFills                                              */ 1093,
-/* NumberofBscansPerFrame                                         */ 1797,
-/* NumericValue                                                   */ 2533,
-/* NumericValueQualifierCodeSequence                              */ 2531,
-/* OCTAcquisitionDomain                                           */ 2762,
-/* OCTBscanAnalysisAcquisitionParametersSequence                  */ 1796,
-/* OCTFocalDistance                                               */ 2759,
-/* OCTOpticalCenterWavelength                                     */ 2763,
-/* OCTZOffsetApplied                                              */ 2772,
-/* OCTZOffsetCorrection                                           */ 2776,
-/* OECFColumnNames                                                */ 558,
-/* OECFColumns                                                    */ 557,
-/* OECFRows                                                       */ 556,
-/* OECFValues                                                     */ 559,
-/* OOIOwnerCreationTime                                           */ 4707,
-/* OOIOwnerSequence                                               */ 4713,
-/* OOIOwnerType                                                   */ 4671,
-/* OOISize                                                        */ 4709,
-/* OOIType                                                        */ 4708,
-/* OOITypeDescriptor                                              */ 4728,
-/* ObjectBinaryIdentifierTrial                                    */ 2481,
-/* ObjectDirectoryBinaryIdentifierTrial                           */ 2492,
-/* ObjectPixelSpacingInCenterOfBeam                               */ 1288,
-/* ObjectThicknessSequence                                        */ 1321,
-/* ObjectiveLensNumericalAperture                                 */ 2729,
-/* ObjectiveLensPower                                             */ 2728,
-/* ObliqueCroppingPlaneSequence                                   */ 3172,
-/* ObservationBasisCodeSequence                                   */ 3494,
-/* ObservationCategoryCodeSequenceTrial                           */ 2512,
-/* ObservationDateTime                                            */ 2469,
-/* ObservationDateTrial                                           */ 2521,
-/* ObservationDescription                                         */ 3486,
-/* ObservationNumber                                              */ 3747,
-/* ObservationSignificance                                        */ 3485,
-/* ObservationSubjectClassTrial                                   */ 2549,
-/* ObservationSubjectContextFlagTrial                             */ 2558,
-/* ObservationSubjectTypeCodeSequenceTrial                        */ 2550,
-/* ObservationSubjectUIDTrial                                     */ 2548,
-/* ObservationTimeTrial                                           */ 2522,
-/* ObservationUID                                                 */ 2516,
-/* ObserverContextFlagTrial                                       */ 2559,
-/* ObserverType                                                   */ 2489,
-/* Occupation                                                     */ 315,
-/* OffsetDirection                                                */ 1452,
-/* OffsetDistance                                                 */ 1451,
-/* OffsetOfReferencedLowerLevelDirectoryEntity                    */ 31,
-/* OffsetOfTheFirstDirectoryRecordOfTheRootDirectoryEntity        */ 25,
-/* OffsetOfTheLastDirectoryRecordOfTheRootDirectoryEntity         */ 26,
-/* OffsetOfTheNextDirectoryRecord                                 */ 29,
-/* OmittedApplicationSetupSequence                                */ 3424,
-/* OmittedBeamTaskSequence                                        */ 4478,
-/* OmittedChannelSequence                                         */ 3419,
-/* OnAxisBackgroundAnatomicStructureCodeSequenceTrial             */ 235,
-/* OperatingMode                                                  */ 1152,
-/* OperatingModeSequence                                          */ 1150,
-/* OperatingModeType                                              */ 1151,
-/* OperatorIdentificationSequence                                 */ 161,
-/* OperatorsName                                                  */ 160,
-/* OphthalmicAnatomicReferencePointXCoordinate                    */ 1792,
-/* OphthalmicAnatomicReferencePointYCoordinate                    */ 1793,
-/* OphthalmicAxialLength                                          */ 1686,
-/* OphthalmicAxialLengthAcquisitionMethodCodeSequence             */ 1737,
-/* OphthalmicAxialLengthDataSourceCodeSequence                    */ 1736,
-/* OphthalmicAxialLengthDataSourceDescription                     */ 1739,
-/* OphthalmicAxialLengthMeasurementModified                       */ 1735,
-/* OphthalmicAxialLengthMeasurementsLengthSummationSequence       */ 1742,
-/* OphthalmicAxialLengthMeasurementsSegmentNameCodeSequence       */ 1719,
-/* OphthalmicAxialLengthMeasurementsSegmentalLengthSequence       */ 1741,
-/* OphthalmicAxialLengthMeasurementsSequence                      */ 1705,
-/* OphthalmicAxialLengthMeasurementsTotalLengthSequence           */ 1740,
-/* OphthalmicAxialLengthMeasurementsType                          */ 1684,
-/* OphthalmicAxialLengthMethod                                    */ 1776,
-/* OphthalmicAxialLengthQualityMetricSequence                     */ 1750,
-/* OphthalmicAxialLengthQualityMetricTypeCodeSequence             */ 1751,
-/* OphthalmicAxialLengthQualityMetricTypeDescription              */ 1752,
-/* OphthalmicAxialLengthSelectionMethodCodeSequence               */ 1746,
-/* OphthalmicAxialLengthSequence                                  */ 1685,
-/* OphthalmicAxialLengthVelocity                                  */ 1708,
-/* OphthalmicAxialMeasurementsDeviceType                          */ 1683,
-/* OphthalmicAxialMeasurementsLeftEyeSequence                     */ 1682,
-/* OphthalmicAxialMeasurementsRightEyeSequence                    */ 1681,
-/* OphthalmicEnFaceImageQualityRatingSequence                     */ 1794,
-/* OphthalmicFOV                                                  */ 1777,
-/* OphthalmicFrameLocationSequence                                */ 1665,
-/* OphthalmicImageOrientation                                     */ 1671,
-/* OphthalmicImageTypeCodeSequence                                */ 1787,
-/* OphthalmicImageTypeDescription                                 */ 1788,
-/* OphthalmicMappingDeviceType                                    */ 1756,
-/* OphthalmicPatientClinicalInformationLeftEyeSequence            */ 1887,
-/* OphthalmicPatientClinicalInformationRightEyeSequence           */ 1888,
-/* OphthalmicThicknessMapQualityRatingSequence                    */ 1772,
-/* OphthalmicThicknessMapQualityThresholdSequence                 */ 1765,
-/* OphthalmicThicknessMapThresholdQualityRating                   */ 1766,
-/* OphthalmicThicknessMapTypeCodeSequence                         */ 1759,
-/* OphthalmicThicknessMappingNormalsSequence                      */ 1760,
-/* OphthalmicUltrasoundMethodCodeSequence                         */ 1697,
-/* OphthalmicVolumetricPropertiesFlag                             */ 1791,
-/* OpticalOphthalmicAxialLengthMeasurementsSequence               */ 1744,
-/* OpticalPathDescription                                         */ 2724,
-/* OpticalPathIdentificationSequence                              */ 2734,
-/* OpticalPathIdentifier                                          */ 2723,
-/* OpticalPathSequence                                            */ 2722,
-/* OpticalSelectedOphthalmicAxialLengthSequence                   */ 1747,
-/* OpticalTransmittance                                           */ 2630,
-/* Optotype                                                       */ 2649,
-/* OptotypeDetailedDefinition                                     */ 2674,
-/* OptotypePresentation                                           */ 2650,
-/* OrderCallbackPhoneNumber                                       */ 2395,
-/* OrderCallbackTelecomInformation                                */ 2396,
-/* OrderEnteredBy                                                 */ 2393,
-/* OrderEntererLocation                                           */ 2394,
-/* OrderFillerIdentifierSequence                                  */ 2285,
-/* OrderPlacerIdentifierSequence                                  */ 2284,
-/* OrganAtRiskFullVolumeDose                                      */ 3891,
-/* OrganAtRiskLimitDose                                           */ 3892,
-/* OrganAtRiskMaximumDose                                         */ 3893,
-/* OrganAtRiskOverdoseVolumeFraction                              */ 3894,
-/* OrganDose                                                      */ 2326,
-/* OrganExposed                                                   */ 2327,
-/* OrganizationalRoleCodeSequence                                 */ 2618,
-/* OriginalAttributesSequence                                     */ 3536,
-/* OriginalImageIdentification                                    */ 1566,
-/* OriginalImageIdentificationNomenclature                        */ 1567,
-/* OriginalImageSequence                                          */ 3649,
-/* OriginalImplantAssemblyTemplateSequence                        */ 3430,
-/* OriginalImplantTemplateSequence                                */ 2973,
-/* OriginalSpecializedSOPClassUID                                 */ 54,
-/* OriginatingSOPInstanceReferenceSequence                        */ 4491,
-/* Originator                                                     */ 3629,
-/* OtherApprovalStatus                                            */ 381,
-/* OtherFailuresSequence                                          */ 194,
-/* OtherMagnificationTypesAvailable                               */ 3579,
-/* OtherMediaAvailableSequence                                    */ 3566,
-/* OtherPatientIDs                                                */ 290,
-/* OtherPatientIDsSequence                                        */ 292,
-/* OtherPatientNames                                              */ 291,
-/* OtherPupillaryDistance                                         */ 2640,
-/* OtherSecondaryApprovalStatus                                   */ 382,
-/* OtherSmoothingTypesAvailable                                   */ 3581,
-/* OtherStudyNumbers                                              */ 1551,
-/* OuterDiameter                                                  */ 372,
-/* OutlineLeftVerticalEdge                                        */ 888,
-/* OutlineLowerHorizontalEdge                                     */ 891,
-/* OutlineRightVerticalEdge                                       */ 889,
-/* OutlineShapeType                                               */ 887,
-/* OutlineUpperHorizontalEdge                                     */ 890,
-/* OutputDestinationSequence                                      */ 2438,
-/* OutputInformationSequence                                      */ 2428,
-/* OutputPower                                                    */ 930,
-/* OverallTemplateSpatialTolerance                                */ 2981,
-/* OverlayActivationLayer                                         */ 4811,
-/* OverlayBackgroundDensity                                       */ 3617,
-/* OverlayBitPosition                                             */ 4804,
-/* OverlayBitsAllocated                                           */ 4803,
-/* OverlayBitsForCodeWord                                         */ 4810,
-/* OverlayBitsGrouped                                             */ 4802,
-/* OverlayCodeLabel                                               */ 4807,
-/* OverlayCodeTableLocation                                       */ 4809,
-/* OverlayColumns                                                 */ 4787,
-/* OverlayComments                                                */ 4825,
-/* OverlayCompressionCode                                         */ 4796,
-/* OverlayCompressionDescription                                  */ 4799,
-/* OverlayCompressionLabel                                        */ 4798,
-/* OverlayCompressionOriginator                                   */ 4797,
-/* OverlayCompressionStepPointers                                 */ 4800,
-/* OverlayData                                                    */ 4824,
-/* OverlayDate                                                    */ 59,
-/* OverlayDescription                                             */ 4790,
-/* OverlayDescriptorBlue                                          */ 4815,
-/* OverlayDescriptorGray                                          */ 4812,
-/* OverlayDescriptorGreen                                         */ 4814,
-/* OverlayDescriptorRed                                           */ 4813,
-/* OverlayForegroundDensity                                       */ 3616,
-/* OverlayFormat                                                  */ 4805,
-/* OverlayLabel                                                   */ 4823,
-/* OverlayLocation                                                */ 4806,
-/* OverlayMagnificationType                                       */ 3612,
-/* OverlayMode                                                    */ 3618,
-/* OverlayNumber                                                  */ 1522,
-/* OverlayNumberOfTables                                          */ 4808,
-/* OverlayOrImageMagnification                                    */ 3614,
-/* OverlayOrigin                                                  */ 4793,
-/* OverlayPixelDataSequence                                       */ 3611,
-/* OverlayPlaneOrigin                                             */ 4795,
-/* OverlayPlanes                                                  */ 4788,
-/* OverlayRepeatInterval                                          */ 4801,
-/* OverlayRows                                                    */ 4786,
-/* OverlaySmoothingType                                           */ 3613,
-/* OverlaySubtype                                                 */ 4792,
-/* OverlayTime                                                    */ 66,
-/* OverlayType                                                    */ 4791,
-/* OverlaysBlue                                                   */ 4819,
-/* OverlaysGray                                                   */ 4816,
-/* OverlaysGreen                                                  */ 4818,
-/* OverlaysRed                                                    */ 4817,
-/* OverriddenAttributesSequence                                   */ 3384,
-/* OverrideDateTime                                               */ 4438,
-/* OverrideParameterPointer                                       */ 3804,
-/* OverrideReason                                                 */ 3808,
-/* OverrideSequence                                               */ 3802,
-/* OversamplingPhase                                              */ 1063,
-/* OwnerID                                                        */ 3631,
-/* PETDetectorMotionDetailsSequence                               */ 1406,
-/* PETFrameAcquisitionSequence                                    */ 1405,
-/* PETFrameCorrectionFactorsSequence                              */ 1409,
-/* PETFrameTypeSequence                                           */ 1415,
-/* PETPositionSequence                                            */ 1408,
-/* PETReconstructionSequence                                      */ 1414,
-/* PETTableDynamicsSequence                                       */ 1407,
-/* PRCSToRCSOrientation                                           */ 4747,
-/* PTOLocationDescription                                         */ 4741,
-/* PTORegionSequence                                              */ 4744,
-/* PTORepresentationSequence                                      */ 4703,
-/* PVCRejection                                                   */ 773,
-/* PaddleDescription                                              */ 826,
-/* PageNumberVector                                               */ 908,
-/* PaletteColorLookupTableSequence                                */ 2730,
-/* PaletteColorLookupTableUID                                     */ 2013,
-/* ParallelAcquisition                                            */ 1101,
-/* ParallelAcquisitionTechnique                                   */ 1102,
-/* ParallelRTBeamDelimiterBoundaries                              */ 4339,
-/* ParallelRTBeamDelimiterDeviceOrientationLabelCodeSequence      */ 4334,
-/* ParallelRTBeamDelimiterDeviceSequence                          */ 4337,
-/* ParallelRTBeamDelimiterLeafMountingSide                        */ 4345,
-/* ParallelRTBeamDelimiterOpeningMode                             */ 4344,
-/* ParallelRTBeamDelimiterPositions                               */ 4340,
-/* ParallelReductionFactorInPlane                                 */ 1095,
-/* ParallelReductionFactorInPlaneRetired                          */ 1118,
-/* ParallelReductionFactorOutOfPlane                              */ 1139,
-/* ParallelReductionFactorSecondInPlane                           */ 1142,
-/* ParameterItemIndex                                             */ 3805,
-/* ParameterPointer                                               */ 3807,
-/* ParameterSequencePointer                                       */ 3803,
-/* ParameterValueNumber                                           */ 3809,
-/* ParametersSpecificationSequence                                */ 1466,
-/* ParametricMapFrameTypeSequence                                 */ 2445,
-/* PartialDataDisplayHandling                                     */ 3301,
-/* PartialFourier                                                 */ 1105,
-/* PartialFourierDirection                                        */ 1069,
-/* PartialView                                                    */ 2031,
-/* PartialViewCodeSequence                                        */ 2033,
-/* PartialViewDescription                                         */ 2032,
-/* ParticipantSequence                                            */ 2485,
-/* ParticipationDateTime                                          */ 2488,
-/* ParticipationType                                              */ 2487,
-/* PatientAdditionalPosition                                      */ 4059,
-/* PatientAddress                                                 */ 301,
-/* PatientAge                                                     */ 294,
-/* PatientAlternativeCalendar                                     */ 271,
-/* PatientBirthDate                                               */ 267,
-/* PatientBirthDateInAlternativeCalendar                          */ 269,
-/* PatientBirthName                                               */ 293,
-/* PatientBirthTime                                               */ 268,
-/* PatientBodyMassIndex                                           */ 297,
-/* PatientBreedCodeSequence                                       */ 326,
-/* PatientBreedDescription                                        */ 325,
-/* PatientClinicalTrialParticipationSequence                      */ 2222,
-/* PatientComments                                                */ 333,
-/* PatientDeathDateInAlternativeCalendar                          */ 270,
-/* PatientEquipmentRelationshipCodeSequence                       */ 4532,
-/* PatientEyeMovementCommandCodeSequence                          */ 1636,
-/* PatientEyeMovementCommanded                                    */ 1635,
-/* PatientFrameOfReferenceSource                                  */ 1617,
-/* PatientGantryRelationshipCodeSequence                          */ 2834,
-/* PatientID                                                      */ 260,
-/* PatientIdentityRemoved                                         */ 347,
-/* PatientInstitutionResidence                                    */ 2220,
-/* PatientInsurancePlanCodeSequence                               */ 273,
-/* PatientLocationCoordinatesCodeSequence                         */ 3768,
-/* PatientLocationCoordinatesSequence                             */ 3767,
-/* PatientMotherBirthName                                         */ 303,
-/* PatientMotionCorrected                                         */ 1423,
-/* PatientName                                                    */ 259,
-/* PatientNotProperlyFixatedQuantity                              */ 1819,
-/* PatientOrientation                                             */ 1521,
-/* PatientOrientationCodeSequence                                 */ 2832,
-/* PatientOrientationInFrameSequence                              */ 1626,
-/* PatientOrientationModifierCodeSequence                         */ 2833,
-/* PatientPhysiologicalStateCodeSequence                          */ 1432,
-/* PatientPhysiologicalStateSequence                              */ 1431,
-/* PatientPosition                                                */ 944,
-/* PatientPositioningInstructionSequence                          */ 1474,
-/* PatientPrimaryLanguageCodeSequence                             */ 274,
-/* PatientPrimaryLanguageModifierCodeSequence                     */ 275,
-/* PatientReliabilityIndicator                                    */ 1848,
-/* PatientReligiousPreference                                     */ 320,
-/* PatientSetupLabel                                              */ 4058,
-/* PatientSetupNumber                                             */ 4057,
-/* PatientSetupSequence                                           */ 4056,
-/* PatientSetupUID                                                */ 4346,
-/* PatientSex                                                     */ 272,
-/* PatientSexNeutered                                             */ 323,
-/* PatientSize                                                    */ 295,
-/* PatientSizeCodeSequence                                        */ 296,
-/* PatientSpeciesCodeSequence                                     */ 322,
-/* PatientSpeciesDescription                                      */ 321,
-/* PatientSpecificationSequence                                   */ 1464,
-/* PatientState                                                   */ 2221,
-/* PatientSupportAccessoryCode                                    */ 4194,
-/* PatientSupportAdjustedAngle                                    */ 3369,
-/* PatientSupportAngle                                            */ 4027,
-/* PatientSupportAngleTolerance                                   */ 3903,
-/* PatientSupportDevicesSequence                                  */ 4400,
-/* PatientSupportID                                               */ 4193,
-/* PatientSupportPositionDeviceParameterSequence                  */ 4359,
-/* PatientSupportPositionDeviceToleranceSequence                  */ 4362,
-/* PatientSupportPositionParameterOrderIndex                      */ 4361,
-/* PatientSupportPositionParameterSequence                        */ 4357,
-/* PatientSupportPositionSequence                                 */ 3769,
-/* PatientSupportPositionSpecificationMethod                      */ 4358,
-/* PatientSupportPositionToleranceOrderIndex                      */ 4363,
-/* PatientSupportPositionToleranceSequence                        */ 4312,
-/* PatientSupportRotationDirection                                */ 4028,
-/* PatientSupportType                                             */ 4192,
-/* PatientTelecomInformation                                      */ 313,
-/* PatientTelephoneNumbers                                        */ 312,
-/* PatientTransportArrangements                                   */ 2372,
-/* PatientTreatmentOrientationSequence                            */ 4534,
-/* PatientWeight                                                  */ 300,
-/* PatternOffColorCIELabValue                                     */ 3108,
-/* PatternOffOpacity                                              */ 3123,
-/* PatternOnColorCIELabValue                                      */ 3107,
-/* PatternOnOpacity                                               */ 3122,
-/* PauseBetweenFrames                                             */ 2801,
-/* PerFrameFunctionalGroupsSequence                               */ 4776,
-/* PerProjectionAcquisitionSequence                               */ 1359,
-/* PercentPhaseFieldOfView                                        */ 707,
-/* PercentSampling                                                */ 706,
-/* PerformedLocation                                              */ 2297,
-/* PerformedProcedureCodeSequence                                 */ 2543,
-/* PerformedProcedureStepDescription                              */ 2304,
-/* PerformedProcedureStepDiscontinuationReasonCodeSequence        */ 2311,
-/* PerformedProcedureStepEndDate                                  */ 2300,
-/* PerformedProcedureStepEndDateTime                              */ 2436,
-/* PerformedProcedureStepEndTime                                  */ 2301,
-/* PerformedProcedureStepID                                       */ 2303,
-/* PerformedProcedureStepStartDate                                */ 2298,
-/* PerformedProcedureStepStartDateTime                            */ 2435,
-/* PerformedProcedureStepStartTime                                */ 2299,
-/* PerformedProcedureStepStatus                                   */ 2302,
-/* PerformedProcedureTypeDescription                              */ 2305,
-/* PerformedProcessingApplicationsCodeSequence                    */ 2407,
-/* PerformedProcessingParametersSequence                          */ 3396,
-/* PerformedProtocolCodeSequence                                  */ 2306,
-/* PerformedProtocolType                                          */ 2307,
-/* PerformedSeriesSequence                                        */ 2332,
-/* PerformedStationAETitle                                        */ 2295,
-/* PerformedStationClassCodeSequence                              */ 2424,
-/* PerformedStationGeographicLocationCodeSequence                 */ 2425,
-/* PerformedStationName                                           */ 2296,
-/* PerformedStationNameCodeSequence                               */ 2423,
-/* PerformedWorkitemCodeSequence                                  */ 2415,
-/* PerformingPhysicianIdentificationSequence                      */ 157,
-/* PerformingPhysicianName                                        */ 156,
-/* PerimeterTable                                                 */ 1935,
-/* PerimeterValue                                                 */ 1936,
-/* PersonAddress                                                  */ 2384,
-/* PersonIdentificationCodeSequence                               */ 2383,
-/* PersonName                                                     */ 2500,
-/* PersonTelecomInformation                                       */ 2386,
-/* PersonTelephoneNumbers                                         */ 2385,
-/* PertinentDocumentsSequence                                     */ 2216,
-/* PertinentOtherEvidenceSequence                                 */ 2546,
-/* PertinentResourcesSequence                                     */ 2217,
-/* PertinentSOPClassesInSeries                                    */ 4567,
-/* PertinentSOPClassesInStudy                                     */ 4566,
-/* PhantomType                                                    */ 4712,
-/* PhaseContrast                                                  */ 1049,
-/* PhaseDelay                                                     */ 2800,
-/* PhaseDescription                                               */ 2802,
-/* PhaseInformationSequence                                       */ 2798,
-/* PhaseNumber                                                    */ 1516,
-/* PhaseVector                                                    */ 2796,
-/* PhosphorType                                                   */ 839,
-/* PhotographicExposureIndex                                      */ 602,
-/* PhotographicSensitivity                                        */ 574,
-/* PhotometricInterpretation                                      */ 1908,
-/* PhotonEnergy                                                   */ 1283,
-/* PhototimerSetting                                              */ 1038,
-/* PhysicalDeltaX                                                 */ 964,
-/* PhysicalDeltaY                                                 */ 965,
-/* PhysicalDetectorSize                                           */ 1302,
-/* PhysicalUnitsXDirection                                        */ 960,
-/* PhysicalUnitsYDirection                                        */ 961,
-/* PhysicianApprovingInterpretation                               */ 4650,
-/* PhysiciansOfRecord                                             */ 154,
-/* PhysiciansOfRecordIdentificationSequence                       */ 155,
-/* PhysiciansReadingStudyIdentificationSequence                   */ 159,
-/* PixelAspectRatio                                               */ 1922,
-/* PixelBandwidth                                                 */ 708,
-/* PixelComponentDataType                                         */ 988,
-/* PixelComponentMask                                             */ 984,
-/* PixelComponentOrganization                                     */ 983,
-/* PixelComponentPhysicalUnits                                    */ 987,
-/* PixelComponentRangeStart                                       */ 985,
-/* PixelComponentRangeStop                                        */ 986,
-/* PixelCoordinatesSetTrial                                       */ 2529,
-/* PixelData                                                      */ 4830,
-/* PixelDataAreaOriginRelativeToFOV                               */ 1021,
-/* PixelDataAreaRotationAngleRelativeToFOV                        */ 1022,
-/* PixelDataProviderURL                                           */ 2124,
-/* PixelIntensityRelationship                                     */ 1994,
-/* PixelIntensityRelationshipLUTSequence                          */ 2137,
-/* PixelIntensityRelationshipSign                                 */ 1995,
-/* PixelMeasuresSequence                                          */ 2130,
-/* PixelOriginInterpretation                                      */ 2738,
-/* PixelPaddingRangeLimit                                         */ 1958,
-/* PixelPaddingValue                                              */ 1957,
-/* PixelPresentation                                              */ 248,
-/* PixelRepresentation                                            */ 1948,
-/* PixelShiftFrameRange                                           */ 2149,
-/* PixelShiftSequence                                             */ 2145,
-/* PixelSpacing                                                   */ 1919,
-/* PixelSpacingCalibrationDescription                             */ 1993,
-/* PixelSpacingCalibrationType                                    */ 1992,
-/* PixelSpacingSequence                                           */ 2365,
-/* PixelValueMappingCodeSequence                                  */ 2448,
-/* PixelValueMappingExplanation                                   */ 1764,
-/* PixelValueMappingToCodedConceptSequence                        */ 1762,
-/* PixelValueTransformationSequence                               */ 2132,
-/* PlacerOrderNumberImagingServiceRequest                         */ 2397,
-/* PlacerOrderNumberImagingServiceRequestRetired                  */ 2391,
-/* PlacerOrderNumberProcedure                                     */ 2374,
-/* PlanIntent                                                     */ 3871,
-/* PlanarConfiguration                                            */ 1910,
-/* Plane                                                          */ 3173,
-/* PlaneIdentification                                            */ 1322,
-/* PlaneNormal                                                    */ 3174,
-/* PlaneOrientationSequence                                       */ 1574,
-/* PlaneOrientationVolumeSequence                                 */ 1620,
-/* PlanePositionSequence                                          */ 1573,
-/* PlanePositionSlideSequence                                     */ 2735,
-/* PlanePositionVolumeSequence                                    */ 1619,
-/* Planes                                                         */ 1916,
-/* PlanesInAcquisition                                            */ 1292,
-/* PlannedVerificationImageSequence                               */ 3957,
-/* PlanningInputInformationSequence                               */ 4601,
-/* PlanningLandmarkDescription                                    */ 3026,
-/* PlanningLandmarkID                                             */ 3025,
-/* PlanningLandmarkIdentificationCodeSequence                     */ 3027,
-/* PlanningLandmarkLineSequence                                   */ 3023,
-/* PlanningLandmarkPlaneSequence                                  */ 3024,
-/* PlanningLandmarkPointSequence                                  */ 3022,
-/* PlateID                                                        */ 712,
-/* PlateType                                                      */ 838,
-/* PointCoordinatesData                                           */ 2916,
 /* PointPositionAccuracy                                          */ 2917,
-/* PointsBoundingBoxCoordinates                                   */ 2920,
-/* Polarity                                                       */ 3597,
-/* PositionMeasuringDeviceUsed                                    */ 1442,
-/* PositionOfIsocenterProjection                                  */ 1303,
-/* PositionReferenceIndicator                                     */ 1549,
-/* PositionerIsocenterDetectorRotationAngle                       */ 1327,
-/* PositionerIsocenterPrimaryAngle                                */ 1325,
-/* PositionerIsocenterSecondaryAngle                              */ 1326,
-/* PositionerMotion                                               */ 868,
-/* PositionerPositionSequence                                     */ 1289,
-/* PositionerPrimaryAngle                                         */ 870,
-/* PositionerPrimaryAngleDirection                                */ 1378,
-/* PositionerPrimaryAngleIncrement                                */ 872,
-/* PositionerSecondaryAngle                                       */ 871,
-/* PositionerSecondaryAngleIncrement                              */ 873,
-/* PositionerType                                                 */ 869,
-/* PositioningLandmarkSequence                                    */ 1476,
-/* PositioningMethodCodeSequence                                  */ 1475,
-/* PositiveCatchTrialsQuantity                                    */ 1835,
-/* PostDeformationMatrixRegistrationSequence                      */ 2900,
-/* PostprocessingFunction                                         */ 934,
-/* PotentialDiagnosticTasks                                       */ 1457,
-/* PotentialReasonsForProcedure                                   */ 1455,
-/* PotentialReasonsForProcedureCodeSequence                       */ 1456,
-/* PotentialRequestedProcedureCodeSequence                        */ 1454,
-/* PotentialScheduledProtocolCodeSequence                         */ 1453,
-/* PotentialThreatObjectID                                        */ 4673,
-/* PowerlineFrequency                                             */ 2263,
-/* PreAmplifierEquipmentSequence                                  */ 440,
-/* PreAmplifierNotes                                              */ 441,
-/* PreAmplifierSettingsSequence                                   */ 471,
-/* PreDeformationMatrixRegistrationSequence                       */ 2899,
-/* PreMedication                                                  */ 2282,
-/* PreSelectedForImplantation                                     */ 1702,
-/* PredecessorDocumentsSequence                                   */ 2541,
-/* PredecessorProtocolSequence                                    */ 1461,
-/* PredecessorStructureSetSequence                                */ 3724,
-/* PredictedRefractiveError                                       */ 1707,
-/* PredictedToricErrorSequence                                    */ 1701,
-/* PredictorColumns                                               */ 1938,
-/* PredictorConstants                                             */ 1939,
-/* PredictorRows                                                  */ 1937,
-/* PreferredPlaybackSequencing                                    */ 835,
-/* PregnancyStatus                                                */ 318,
-/* PreliminaryFlag                                                */ 2555,
-/* PrescriptionDescription                                        */ 3874,
-/* PrescriptionNotes                                              */ 4606,
-/* PrescriptionNotesSequence                                      */ 4612,
-/* PresentationAnimationStyle                                     */ 3211,
-/* PresentationCreationDate                                       */ 3076,
-/* PresentationCreationTime                                       */ 3077,
-/* PresentationDisplayCollectionUID                               */ 3152,
-/* PresentationGroupNumber                                        */ 2252,
-/* PresentationInputType                                          */ 3157,
-/* PresentationIntentType                                         */ 84,
-/* PresentationLUTContentSequence                                 */ 3647,
-/* PresentationLUTFlag                                            */ 3561,
-/* PresentationLUTSequence                                        */ 3621,
-/* PresentationLUTShape                                           */ 3622,
-/* PresentationPixelAspectRatio                                   */ 3083,
-/* PresentationPixelMagnificationRatio                            */ 3084,
-/* PresentationPixelSpacing                                       */ 3082,
-/* PresentationSequenceCollectionUID                              */ 3153,
-/* PresentationSequencePositionIndex                              */ 3154,
-/* PresentationSizeMode                                           */ 3081,
-/* PresentationStateClassificationComponentSequence               */ 3198,
-/* PresentationStateCompositorComponentSequence                   */ 3202,
-/* PresentedVisualStimuliDataFlag                                 */ 1820,
-/* PreserveCompositeInstancesAfterMediaCreation                   */ 3659,
-/* Pressure                                                       */ 596,
-/* PrimaryAnatomicStructureModifierSequence                       */ 222,
-/* PrimaryAnatomicStructureSequence                               */ 220,
-/* PrimaryChromaticities                                          */ 552,
-/* PrimaryDoseValueIndicator                                      */ 4294,
-/* PrimaryDosimeterUnit                                           */ 3941,
-/* PrimaryFluenceModeSequence                                     */ 3688,
-/* PrimaryPositionerIncrement                                     */ 1346,
-/* PrimaryPositionerIncrementSign                                 */ 1350,
-/* PrimaryPositionerScanArc                                       */ 1342,
-/* PrimaryPositionerScanStartAngle                                */ 1344,
-/* PrimaryPromptsCountsAccumulated                                */ 2855,
-/* PrimitivePointIndexList                                        */ 2933,
-/* PrintJobDescriptionSequence                                    */ 3639,
-/* PrintJobID                                                     */ 3624,
-/* PrintManagementCapabilitiesSequence                            */ 3641,
-/* PrintPriority                                                  */ 3551,
-/* PrintQueueID                                                   */ 3637,
-/* PrinterCharacteristicsSequence                                 */ 3642,
-/* PrinterConfigurationSequence                                   */ 3550,
-/* PrinterName                                                    */ 3636,
-/* PrinterPixelSpacing                                            */ 3592,
-/* PrinterResolutionID                                            */ 3574,
-/* PrinterStatus                                                  */ 3634,
-/* PrinterStatusInfo                                              */ 3635,
-/* PrintingBitDepth                                               */ 3564,
-/* PriorTreatmentDoseDescription                                  */ 4581,
-/* PriorTreatmentReferenceSequence                                */ 4582,
-/* PrismSequence                                                  */ 2624,
-/* PrivateCreatorReference                                        */ 131,
-/* PrivateDataElement                                             */ 137,
-/* PrivateDataElementCharacteristicsSequence                      */ 129,
-/* PrivateDataElementDefinitionSequence                           */ 145,
-/* PrivateDataElementDescription                                  */ 143,
-/* PrivateDataElementEncoding                                     */ 144,
-/* PrivateDataElementKeyword                                      */ 142,
-/* PrivateDataElementName                                         */ 141,
 /* PrivateDataElementNumberOfItems                                */ 140,
-/* PrivateDataElementValueMultiplicity                            */ 138,
-/* PrivateDataElementValueRepresentation                          */ 139,
-/* PrivateGroupReference                                          */ 130,
-/* PrivateInformation                                             */ 21,
-/* PrivateInformationCreatorUID                                   */ 20,
-/* PrivateRecordUID                                               */ 33,
-/* ProbeCenterLocationX                                           */ 478,
-/* ProbeCenterLocationZ                                           */ 479,
-/* ProbeDriveEquipmentSequence                                    */ 493,
-/* ProbeDriveNotes                                                */ 495,
-/* ProbeDriveSettingsSequence                                     */ 500,
-/* ProbeInductance                                                */ 497,
-/* ProbeOrientationAngle                                          */ 502,
-/* ProbeResistance                                                */ 498,
-/* ProcedureCodeSequence                                          */ 149,
-/* ProcedureContextFlagTrial                                      */ 2560,
-/* ProcedureContextSequenceTrial                                  */ 2536,
-/* ProcedureCreationDate                                          */ 488,
-/* ProcedureExpirationDate                                        */ 489,
-/* ProcedureIdentifierCodeSequenceTrial                           */ 2490,
-/* ProcedureLastModifiedDate                                      */ 490,
-/* ProcedureStepCancellationDateTime                              */ 2437,
-/* ProcedureStepCommunicationsURISequence                         */ 3358,
+/* ReferencedComparisonSOPInstanceSequence                        */ 3482,
+/* CompensatorID                                                  */ 3980,
+/* NumberOfLateralSpreadingDevices                                */ 4178,
+/* DerivationCodeSequence                                         */ 253,
+/* RevolutionTime                                                 */ 1206,
+/* SegmentationCreationTemplateLabel                              */ 4514,
+/* ReferencedSourceApplicatorNumber                               */ 3845,
+/* IssuerOfTheContainerIdentifierSequence                         */ 2339,
+/* PerformedProcedureStepEndDateTime                              */ 2436,
+/* ReferencedVOILUTBoxSequence                                    */ 3606,
+/* TransducerPositionModifierSequence                             */ 224,
+/* XRayDetectorIndex                                              */ 1264,
+/* OutlineLowerHorizontalEdge                                     */ 891,
+/* RecordedCompensatorSequence                                    */ 3824,
+/* VariableNextDataGroup                                          */ 4835,
+/* InterpretationDiagnosisDescription                             */ 4651,
+/* PerimeterValue                                                 */ 1936,
+/* AcquisitionStartLocationSequence                               */ 1485,
+/* ViewpointLookAtPoint                                           */ 3188,
+/* TerminationCardiacTriggerCountThreshold                        */ 1399,
+/* ReferencedOphthalmicAxialLengthMeasurementQCImageSequence      */ 1755,
+/* SourceEndDateTime                                              */ 1258,
+/* EndMeterset                                                    */ 3817,
+/* SOPClassUID                                                    */ 51,
+/* PatientSupportPositionDeviceParameterSequence                  */ 4359,
+/* RTAccessoryHolderDefinitionSequence                            */ 4287,
+/* ReferencedStudySequence                                        */ 166,
+/* OriginalImageIdentificationNomenclature                        */ 1567,
+/* ShieldingDevicePosition                                        */ 4071,
+/* CoincidenceWindowWidth                                         */ 2852,
+/* Component1ReferencedMatingFeatureSetID                         */ 3443,
+/* ROIElementalCompositionAtomicNumber                            */ 3759,
+/* VisualFieldTestReliabilityGlobalIndexSequence                  */ 1900,
+/* InterlockSequence                                              */ 4431,
+/* RegionLocationMaxY1                                            */ 957,
+/* GeneralAccessoryNumber                                         */ 4238,
+/* LateralSpreadingDeviceSetting                                  */ 4204,
+/* DisplaySetPresentationGroup                                    */ 3299,
+/* TomotherapeuticLeafInitialClosedDurations                      */ 4631,
+/* SegmentReferenceSequence                                       */ 4517,
+/* ReferencedFindingsGroupUIDTrial                                */ 2462,
+/* BrachyApplicationSetupDose                                     */ 3938,
+/* InterlockDescription                                           */ 4433,
+/* TableOfPixelValues                                             */ 993,
+/* RequestedDecimateCropBehavior                                  */ 3599,
+/* MRMetaboliteMapSequence                                        */ 1138,
 /* ProcedureStepDiscontinuationReasonCodeSequence                 */ 3361,
-/* ProcedureStepLabel                                             */ 3394,
-/* ProcedureStepProgress                                          */ 3355,
-/* ProcedureStepProgressDescription                               */ 3356,
-/* ProcedureStepProgressInformationSequence                       */ 3354,
-/* ProcedureStepProgressParametersSequence                        */ 3357,
-/* ProcedureStepRelationshipType                                  */ 3399,
-/* ProcedureStepState                                             */ 3353,
-/* ProcedureTypeCodeSequence                                      */ 3433,
-/* ProcedureVersion                                               */ 487,
-/* ProcessingFunction                                             */ 933,
-/* ProductDescription                                             */ 2600,
-/* ProductExpirationDateTime                                      */ 2602,
-/* ProductLotIdentifier                                           */ 2601,
-/* ProductName                                                    */ 2599,
-/* ProductPackageIdentifier                                       */ 2594,
-/* ProductParameterSequence                                       */ 2606,
-/* ProductTypeCodeSequence                                        */ 2598,
+/* TypeOfData                                                     */ 4751,
+/* RTTreatmentIntentType                                          */ 4573,
+/* PatientComments                                                */ 333,
+/* RecommendedDisplayFrameRate                                    */ 214,
 /* ProjectionEponymousNameCodeSequence                            */ 946,
-/* ProjectionPixelCalibrationSequence                             */ 1285,
-/* PropertyLabel                                                  */ 398,
-/* ProposedStudySequence                                          */ 3648,
-/* ProtocolContextSequence                                        */ 2334,
-/* ProtocolDefinedPatientPosition                                 */ 1505,
-/* ProtocolDesignRationale                                        */ 1463,
-/* ProtocolElementCharacteristicsSummary                          */ 1482,
-/* ProtocolElementName                                            */ 1481,
-/* ProtocolElementNumber                                          */ 1480,
-/* ProtocolElementPurpose                                         */ 1483,
-/* ProtocolName                                                   */ 733,
-/* ProtocolPlanningInformation                                    */ 1462,
-/* PseudoColorPaletteInstanceReferenceSequence                    */ 3343,
-/* PseudoColorType                                                */ 3342,
-/* PulseNumber                                                    */ 3854,
-/* PulseRepetitionFrequency                                       */ 968,
-/* PulseRepetitionInterval                                        */ 4129,
-/* PulseSequenceName                                              */ 1042,
-/* PulseSpecificBrachyControlPointDeliveredSequence               */ 3853,
-/* PulseWidth                                                     */ 457,
-/* PulserEquipmentSequence                                        */ 434,
-/* PulserNotes                                                    */ 436,
-/* PulserSettingsSequence                                         */ 456,
-/* PulserType                                                     */ 435,
-/* PupilCentroidXCoordinate                                       */ 2680,
-/* PupilCentroidYCoordinate                                       */ 2681,
-/* PupilDilated                                                   */ 1643,
-/* PupilSize                                                      */ 2632,
-/* PurposeOfReferenceCodeSequence                                 */ 2515,
-/* QAResultsSequence                                              */ 2092,
-/* QRMeasurementsSequence                                         */ 4735,
+/* CompensatorThicknessData                                       */ 3987,
+/* TimeBasedImageSetsSequence                                     */ 3245,
+/* StudyID                                                        */ 1511,
+/* ChannelDefinitionSequence                                      */ 2229,
+/* MetersetExposure                                               */ 3683,
+/* ApplicatorOpeningX                                             */ 4244,
+/* IssuerOfServiceEpisodeID                                       */ 2213,
+/* UrgencyOrPriorityAlertsTrial                                   */ 2474,
+/* ReferencedResultsSequence                                      */ 165,
+/* InstructionSequence                                            */ 1467,
+/* DVHData                                                        */ 3709,
+/* TimeOfLastDetectorCalibration                                  */ 1004,
+/* NumberOfTotalObjects                                           */ 4701,
+/* ObservationUID                                                 */ 2516,
+/* DiffusionBValueXY                                              */ 1381,
+/* PreMedication                                                  */ 2282,
+/* ThreeDPlaneOrigin                                              */ 3036,
+/* NonidentifyingPrivateElements                                  */ 133,
+/* DetectorTimeSinceLastExposure                                  */ 1007,
+/* StorageMediaFileSetUID                                         */ 3504,
+/* NumberOfRTBeamLimitingDevices                                  */ 4331,
+/* DataValueRepresentation                                        */ 4755,
 /* QuadratureReceiveCoil                                          */ 1074,
-/* QualityControlImage                                            */ 1964,
-/* QualityControlSubject                                          */ 276,
-/* QualityControlSubjectTypeCodeSequence                          */ 277,
-/* QualityThreshold                                               */ 1795,
-/* QuantifiedDefect                                               */ 1875,
-/* Quantity                                                       */ 2313,
-/* QuantityDefinitionSequence                                     */ 2455,
-/* QuantitySequence                                               */ 2312,
-/* QueryRetrieveLevel                                             */ 73,
-/* QueryRetrieveView                                              */ 74,
-/* QueueStatus                                                    */ 3638,
-/* RFEchoTrainLength                                              */ 1179,
-/* RGBATransferFunctionDescription                                */ 3218,
-/* RGBLUTTransferFunction                                         */ 2047,
-/* ROIArea                                                        */ 4820,
-/* ROIContourSequence                                             */ 3737,
-/* ROIDerivationAlgorithmIdentificationSequence                   */ 3735,
-/* ROIDescription                                                 */ 3729,
-/* ROIDisplayColor                                                */ 3730,
-/* ROIElementalCompositionAtomicMassFraction                      */ 3760,
-/* ROIElementalCompositionAtomicNumber                            */ 3759,
-/* ROIElementalCompositionSequence                                */ 3758,
-/* ROIGenerationAlgorithm                                         */ 3734,
-/* ROIGenerationDescription                                       */ 3736,
-/* ROIInterpreter                                                 */ 3754,
-/* ROIMean                                                        */ 4821,
-/* ROIName                                                        */ 3728,
-/* ROINumber                                                      */ 3726,
-/* ROIObservationDescription                                      */ 3751,
-/* ROIObservationLabel                                            */ 3749,
-/* ROIPhysicalPropertiesSequence                                  */ 3755,
-/* ROIPhysicalProperty                                            */ 3756,
-/* ROIPhysicalPropertyValue                                       */ 3757,
-/* ROIStandardDeviation                                           */ 4822,
-/* ROIVolume                                                      */ 3731,
-/* RRIntervalTimeNominal                                          */ 1603,
-/* RRIntervalVector                                               */ 2807,
-/* RTAccessoryDeviceSlotID                                        */ 4288,
-/* RTAccessoryHolderDefinitionSequence                            */ 4287,
-/* RTAccessoryHolderSlotDistance                                  */ 4285,
-/* RTAccessoryHolderSlotExistenceFlag                             */ 4282,
-/* RTAccessoryHolderSlotID                                        */ 4284,
-/* RTAccessoryHolderSlotSequence                                  */ 4283,
-/* RTAccessoryHolderWaterEquivalentThickness                      */ 4280,
-/* RTAccessorySlotDistance                                        */ 4286,
-/* RTAnatomicPrescriptionSequence                                 */ 4580,
-/* RTBeamDelimiterGeometrySequence                                */ 4342,
-/* RTBeamLimitingDeviceAngle                                      */ 4387,
-/* RTBeamLimitingDeviceDefinitionSequence                         */ 4343,
-/* RTBeamLimitingDeviceDistalDistance                             */ 4333,
-/* RTBeamLimitingDeviceOffset                                     */ 4341,
-/* RTBeamLimitingDeviceOpeningSequence                            */ 4352,
-/* RTBeamLimitingDeviceProximalDistance                           */ 4332,
-/* RTBeamLimitingDeviceType                                       */ 3944,
-/* RTBeamModifierDefinitionDistance                               */ 4402,
-/* RTControlPointIndex                                            */ 4267,
-/* RTDeviceDistanceReferenceLocationCodeSequence                  */ 4355,
-/* RTDiagnosisCodeSequence                                        */ 4577,
-/* RTDoseROISequence                                              */ 3700,
-/* RTImageDescription                                             */ 3668,
-/* RTImageLabel                                                   */ 3666,
-/* RTImageName                                                    */ 3667,
-/* RTImageOrientation                                             */ 3673,
-/* RTImagePlane                                                   */ 3670,
-/* RTImagePosition                                                */ 3675,
-/* RTImageSID                                                     */ 3679,
-/* RTPhysicianIntentIndex                                         */ 4572,
-/* RTPhysicianIntentInputInstanceSequence                         */ 4579,
-/* RTPhysicianIntentNarrative                                     */ 4574,
-/* RTPhysicianIntentPredecessorSequence                           */ 4569,
-/* RTPhysicianIntentSequence                                      */ 4571,
-/* RTPlanDate                                                     */ 3868,
-/* RTPlanDescription                                              */ 3867,
-/* RTPlanGeometry                                                 */ 3873,
-/* RTPlanLabel                                                    */ 3865,
-/* RTPlanName                                                     */ 3866,
-/* RTPlanRelationship                                             */ 3910,
-/* RTPlanTime                                                     */ 3869,
-/* RTPrescriptionIndex                                            */ 4544,
-/* RTPrescriptionLabel                                            */ 4568,
-/* RTPrescriptionSequence                                         */ 4591,
-/* RTProtocolCodeSequence                                         */ 4575,
-/* RTROIIdentificationCodeSequence                                */ 3750,
-/* RTROIInterpretedType                                           */ 3753,
-/* RTROIObservationsSequence                                      */ 3746,
-/* RTROIRelationship                                              */ 3733,
-/* RTRadiationPhysicalAndGeometricContentDetailFlag               */ 4322,
-/* RTRadiationSalvageRecordControlPointSequence                   */ 4418,
-/* RTRadiationSequence                                            */ 4289,
-/* RTRadiationSetDeliveryNumber                                   */ 4409,
-/* RTRadiationSetIntent                                           */ 4321,
-/* RTRadiationSetUsage                                            */ 4412,
-/* RTRadiationUsage                                               */ 4406,
-/* RTRecordFlag                                                   */ 4323,
-/* RTReferencedSeriesSequence                                     */ 3722,
-/* RTReferencedStudySequence                                      */ 3721,
-/* RTRelatedROISequence                                           */ 3732,
-/* RTSegmentAnnotationIndex                                       */ 4545,
-/* RTSegmentAnnotationSequence                                    */ 4526,
-/* RTToleranceSetLabel                                            */ 4309,
-/* RTToleranceSetSequence                                         */ 4308,
-/* RTTreatmentApproachLabel                                       */ 4570,
-/* RTTreatmentFractionCompletionStatus                            */ 4411,
-/* RTTreatmentIntentType                                          */ 4573,
-/* RTTreatmentPhaseIndex                                          */ 4542,
-/* RTTreatmentPhaseIntentPresenceFlag                             */ 4553,
-/* RTTreatmentPhaseIntervalSequence                               */ 4562,
-/* RTTreatmentPhaseUID                                            */ 4543,
-/* RTTreatmentSourceCoordinates                                   */ 4624,
-/* RTTreatmentTechniqueCodeSequence                               */ 4611,
-/* RTTreatmentTerminationReasonCodeSequence                       */ 4416,
-/* RTTreatmentTerminationStatus                                   */ 4415,
-/* RTVCommunicationSOPClassUID                                    */ 14,
-/* RTVCommunicationSOPInstanceUID                                 */ 15,
-/* RTVFlowActualFrameDuration                                     */ 19,
-/* RTVFlowIdentifier                                              */ 17,
-/* RTVFlowRTPSamplingRate                                         */ 18,
-/* RTVMetaInformationVersion                                      */ 13,
-/* RTVSourceIdentifier                                            */ 16,
-/* RWavePointer                                                   */ 2068,
-/* RWaveTimeVector                                                */ 995,
-/* RadialPosition                                                 */ 794,
-/* RadiationAtomicNumber                                          */ 4164,
-/* RadiationBeamBlockSlabThickness                                */ 4376,
-/* RadiationBeamBlockThickness                                    */ 4375,
-/* RadiationBeamCompensatorMillingToolDiameter                    */ 4371,
-/* RadiationBeamEffectiveWedgeAngle                               */ 4350,
-/* RadiationBeamWedgeAngle                                        */ 4348,
-/* RadiationBeamWedgeThinEdgeDistance                             */ 4349,
-/* RadiationChargeState                                           */ 4165,
-/* RadiationDeviceConfigurationAndCommissioningKeySequence        */ 4356,
-/* RadiationDoseCentralAxisDisplacement                           */ 4303,
-/* RadiationDoseIdentificationIndex                               */ 4270,
-/* RadiationDoseIdentificationLabel                               */ 4292,
-/* RadiationDoseIdentificationSequence                            */ 4291,
-/* RadiationDoseInVivoMeasurementLabel                            */ 4302,
-/* RadiationDoseMeasurementPointCoordinates                       */ 4306,
-/* RadiationDoseSequence                                          */ 4290,
-/* RadiationDoseSourceToExternalContourDistance                   */ 4307,
-/* RadiationDoseSourceToSkinDistance                              */ 4305,
-/* RadiationDoseValue                                             */ 4304,
-/* RadiationDoseValuesParametersSequence                          */ 4298,
-/* RadiationDosimeterUnitSequence                                 */ 4354,
-/* RadiationFluenceModifierCodeSequence                           */ 4397,
+/* SafePositionReturnTime                                         */ 3852,
+/* FilterBeamPathLengthMinimum                                    */ 1033,
+/* CodingSchemeResourcesSequence                                  */ 104,
+/* OphthalmicAxialLengthQualityMetricTypeCodeSequence             */ 1751,
+/* RotationAngle                                                  */ 3092,
+/* DeliveryRate                                                   */ 4327,
+/* OphthalmicAxialLengthMeasurementsLengthSummationSequence       */ 1742,
+/* SourceModelID                                                  */ 4092,
+/* FileMetaInformationVersion                                     */ 1,
+/* TableTopLongitudinalPosition                                   */ 4033,
+/* ReferencedMeasuredDoseReferenceNumber                          */ 3819,
+/* UltrasoundColorDataPresent                                     */ 1917,
+/* SelectorSequencePointer                                        */ 3254,
+/* ImplementationClassUID                                         */ 5,
+/* ReferencedReferenceImageSequence                               */ 4459,
+/* XRayTubeCurrentInuA                                            */ 1040,
+/* OverlayPixelDataSequence                                       */ 3611,
+/* RegionFlags                                                    */ 953,
+/* ReconstructionEndLocationSequence                              */ 1496,
+/* WaterEquivalentDiameter                                        */ 840,
+/* EquipmentCoordinateSystemIdentification                        */ 2152,
+/* PlanePositionSequence                                          */ 1573,
+/* LateralSpreadingDeviceWaterEquivalentThickness                 */ 4184,
+/* CurveNumber                                                    */ 1523,
+/* ProductExpirationDateTime                                      */ 2602,
+/* FieldOfViewOrigin                                              */ 1018,
+/* LeafJawPositions                                               */ 4022,
+/* ReferencedDoseSequence                                         */ 4465,
+/* HumanPerformerCodeSequence                                     */ 2409,
+/* ChannelMinimumValue                                            */ 4778,
+/* PixelRepresentation                                            */ 1948,
+/* TransmitterFrequency                                           */ 1119,
+/* ApprovalSubjectSequence                                        */ 2617,
+/* NumberOfControlPoints                                          */ 4014,
+/* ChannelSettingsSequence                                        */ 507,
+/* SubjectiveRefractionRightEyeSequence                           */ 2651,
+/* ImplantTemplateGroupMembersSequence                            */ 3454,
+/* AdditionalPatientHistory                                       */ 317,
+/* SelectorUCValue                                                */ 3274,
+/* StudyComments                                                  */ 2181,
+/* PhantomType                                                    */ 4712,
+/* EffectiveDateTime                                              */ 2974,
+/* DataCollectionDiameter                                         */ 704,
+/* ReferencedSurfaceSequence                                      */ 2935,
+/* DataSetName                                                    */ 1896,
+/* PositionerIsocenterDetectorRotationAngle                       */ 1327,
+/* TriggerTimeOffset                                              */ 754,
+/* RequestedProcedureID                                           */ 2369,
+/* DriveProbeSequence                                             */ 496,
+/* ManufacturerDeviceIdentifier                                   */ 4551,
 /* RadiationGenerationModeDescription                             */ 4391,
-/* RadiationGenerationModeIndex                                   */ 4268,
-/* RadiationGenerationModeLabel                                   */ 4390,
-/* RadiationGenerationModeMachineCodeSequence                     */ 4392,
-/* RadiationGenerationModeSequence                                */ 4389,
-/* RadiationMachineName                                           */ 3676,
-/* RadiationMachineSAD                                            */ 3677,
-/* RadiationMachineSSD                                            */ 3678,
-/* RadiationMassNumber                                            */ 4163,
-/* RadiationMode                                                  */ 808,
-/* RadiationSetting                                               */ 806,
-/* RadiationSourceAxisDistance                                    */ 4330,
-/* RadiationSourceCoordinateSystemPitchAngle                      */ 4627,
-/* RadiationSourceCoordinateSystemRollAngle                       */ 4626,
-/* RadiationSourceCoordinateSystemYawAngle                        */ 4625,
-/* RadiationType                                                  */ 3954,
-/* RadiationTypeCodeSequence                                      */ 4393,
-/* RadiobiologicalDoseEffectFlag                                  */ 4486,
-/* RadiobiologicalDoseEffectSequence                              */ 4485,
-/* Radionuclide                                                   */ 672,
-/* RadionuclideCodeSequence                                       */ 2826,
-/* RadionuclideHalfLife                                           */ 763,
-/* RadionuclidePositronFraction                                   */ 764,
-/* RadionuclideTotalDose                                          */ 762,
-/* Radiopharmaceutical                                            */ 673,
-/* RadiopharmaceuticalAdministrationEventUID                      */ 240,
-/* RadiopharmaceuticalAgentNumber                                 */ 1404,
-/* RadiopharmaceuticalCodeSequence                                */ 2828,
-/* RadiopharmaceuticalInformationSequence                         */ 2790,
-/* RadiopharmaceuticalRoute                                       */ 758,
-/* RadiopharmaceuticalSpecificActivity                            */ 765,
-/* RadiopharmaceuticalStartDateTime                               */ 766,
-/* RadiopharmaceuticalStartTime                                   */ 760,
-/* RadiopharmaceuticalStopDateTime                                */ 767,
-/* RadiopharmaceuticalStopTime                                    */ 761,
-/* RadiopharmaceuticalUsageSequence                               */ 1410,
-/* RadiopharmaceuticalVolume                                      */ 759,
-/* RadiotherapyTreatmentType                                      */ 4554,
-/* RadiusAlongWedge                                               */ 550,
-/* RadiusOfCircularCollimator                                     */ 902,
-/* RadiusOfCircularExposureControlSensingRegion                   */ 1313,
-/* RadiusOfCircularShutter                                        */ 882,
-/* RadiusOfCurvature                                              */ 2644,
-/* RandomsCorrected                                               */ 1425,
-/* RandomsCorrectionMethod                                        */ 2842,
-/* RangeModulatorDescription                                      */ 4190,
-/* RangeModulatorGatingStartValue                                 */ 4207,
-/* RangeModulatorGatingStartWaterEquivalentThickness              */ 4209,
-/* RangeModulatorGatingStopValue                                  */ 4208,
-/* RangeModulatorGatingStopWaterEquivalentThickness               */ 4210,
-/* RangeModulatorID                                               */ 4188,
-/* RangeModulatorNumber                                           */ 4187,
-/* RangeModulatorSequence                                         */ 4186,
-/* RangeModulatorSettingsSequence                                 */ 4206,
+/* FrameDetectorParametersSequence                                */ 1318,
+/* StationName                                                    */ 147,
+/* DepthDoseParametersSequence                                    */ 4259,
+/* SafePositionReturnDate                                         */ 3851,
+/* ProbeDriveSettingsSequence                                     */ 500,
+/* MediumType                                                     */ 3552,
+/* OverrideParameterPointer                                       */ 3804,
+/* SpecifiedTreatmentTime                                         */ 3787,
+/* TickPosition                                                   */ 3125,
+/* ContactURI                                                     */ 3359,
+/* ProjectionPixelCalibrationSequence                             */ 1285,
+/* OffsetOfTheLastDirectoryRecordOfTheRootDirectoryEntity         */ 26,
+/* ColumnsForNthOrderCoefficients                                 */ 1975,
+/* ScheduledDischargeTime                                         */ 2203,
+/* Planes                                                         */ 1916,
+/* TopLeftHandCornerOfLocalizerArea                               */ 2732,
+/* OrganAtRiskFullVolumeDose                                      */ 3891,
+/* ConsultingPhysicianName                                        */ 93,
+/* DetectorActivationOffsetFromExposure                           */ 1009,
+/* PrimaryAnatomicStructureModifierSequence                       */ 222,
+/* VirtualSourceAxisDistances                                     */ 4168,
+/* ApplicableSafetyStandardDescription                            */ 1149,
+/* RTPhysicianIntentNarrative                                     */ 4574,
+/* ExternalContourEntryPoint                                      */ 4040,
+/* DocumentClassCodeSequence                                      */ 2577,
+/* VariableCoefficientsSDHN                                       */ 4837,
+/* BrachyAccessoryDeviceNominalTransmission                       */ 4118,
+/* AdvancedBlendingSequence                                       */ 3219,
+/* GPSImgDirection                                                */ 642,
+/* GraphicAnnotationUnits                                         */ 3047,
+/* TrackingAlgorithmIdentificationSequence                        */ 2955,
+/* PrimaryPositionerIncrement                                     */ 1346,
+/* ReferencedChannelNumber                                        */ 3416,
+/* LensMake                                                       */ 620,
+/* SegmentAnnotationCategoryCodeSequence                          */ 4527,
+/* VerticalPrismBase                                              */ 2628,
+/* NumberOfBoluses                                                */ 4382,
+/* MultiPlanarExcitation                                          */ 1048,
+/* TemporalResolution                                             */ 1538,
+/* TwoDMatingAxes                                                 */ 3015,
+/* BscanCycleTime                                                 */ 1800,
+/* ExecutionStatusInfo                                            */ 3626,
+/* OwnerID                                                        */ 3631,
+/* MotionSynchronizationSequence                                  */ 4232,
+/* CombinationSegmentReferenceSequence                            */ 4520,
+/* CIExyWhitePoint                                                */ 2101,
+/* ReferenceDisplaySets                                           */ 3306,
+/* LuminanceResultSequence                                        */ 2113,
 /* RangeModulatorType                                             */ 4189,
-/* RangeOfFreedom                                                 */ 3018,
-/* RangeShifterDescription                                        */ 4177,
-/* RangeShifterID                                                 */ 4175,
-/* RangeShifterNumber                                             */ 4174,
-/* RangeShifterSequence                                           */ 4173,
-/* RangeShifterSetting                                            */ 4200,
-/* RangeShifterSettingsSequence                                   */ 4199,
-/* RangeShifterType                                               */ 4176,
-/* RangeShifterWaterEquivalentThickness                           */ 4202,
-/* RangingDepth                                                   */ 2765,
-/* RationalDenominatorValue                                       */ 2511,
-/* RationalNumeratorValue                                         */ 2510,
-/* RawDataHandling                                                */ 2433,
-/* RealTimeBulkDataFlowSequence                                   */ 2190,
-/* RealWorldValueFirstValueMapped                                 */ 2454,
-/* RealWorldValueIntercept                                        */ 2456,
-/* RealWorldValueLUTData                                          */ 2451,
-/* RealWorldValueLastValueMapped                                  */ 2450,
-/* RealWorldValueMappingSequence                                  */ 2447,
-/* RealWorldValueSlope                                            */ 2457,
-/* ReasonForCancellation                                          */ 3404,
+/* FieldOfViewHorizontalFlip                                      */ 1020,
+/* ContinuationStartTotalReferenceAirKerma                        */ 3412,
+/* TreatmentDeviceIdentificationSequence                          */ 4324,
+/* DetectorActiveAreaTLHCPosition                                 */ 1376,
+/* BeamLimitingDeviceSequence                                     */ 3943,
+/* FixationLightPolarAngle                                        */ 4197,
+/* InterventionDrugName                                           */ 676,
+/* BlockTransmission                                              */ 4005,
+/* SetupDeviceType                                                */ 4075,
+/* WindowWidth                                                    */ 1997,
+/* FractionPatternSequence                                        */ 4604,
+/* OrganDose                                                      */ 2326,
+/* LateralSpreadingDeviceSequence                                 */ 4179,
+/* TableFeedPerRotation                                           */ 1211,
+/* BlendingLUT1Sequence                                           */ 2038,
+/* ReferencedInterpretationSequence                               */ 4636,
+/* NumberOfRangeShifters                                          */ 4172,
+/* ImageQualityIndicatorSize                                      */ 516,
+/* TreatmentDeliveryType                                          */ 3959,
+/* OpticalSelectedOphthalmicAxialLengthSequence                   */ 1747,
+/* SelectorOLValue                                                */ 3280,
+/* DosimetricObjectiveEvaluationScope                             */ 4583,
+/* SampleRate                                                     */ 4767,
+/* DoseRateDelivered                                              */ 3796,
+/* NominalBeamAngle                                               */ 537,
+/* SpecialNeeds                                                   */ 2211,
+/* PrinterPixelSpacing                                            */ 3592,
+/* AnnotationPosition                                             */ 3607,
+/* ViewOrientationModifierCodeSequence                            */ 2986,
+/* PatientEyeMovementCommandCodeSequence                          */ 1636,
+/* DoubleExposureFieldDelta                                       */ 3410,
+/* OphthalmicThicknessMappingNormalsSequence                      */ 1760,
+/* EntranceDose                                                   */ 2318,
+/* ThreatSequence                                                 */ 4674,
+/* ChannelDeliveryOrderSequence                                   */ 3415,
+/* SpecifiedPulseRepetitionInterval                               */ 3842,
+/* LargePaletteColorLookupTableUID                                */ 2022,
+/* ShowPatientDemographicsFlag                                    */ 3347,
+/* RescaleType                                                    */ 2000,
+/* ImagePosition                                                  */ 1525,
+/* IssueTimeOfImagingServiceRequest                               */ 2390,
+/* MeasuredCharacteristics                                        */ 2115,
+/* ReferencedPrintJobSequencePullStoredPrint                      */ 3633,
+/* RecommendedAbsentPixelCIELabValue                              */ 2719,
+/* DetectorActiveShape                                            */ 1013,
+/* ShutterPresentationColorCIELabValue                            */ 886,
+/* WedgePosition                                                  */ 4020,
+/* ImagePresentationComments                                      */ 2061,
+/* QualityThreshold                                               */ 1795,
+/* BlockRows                                                      */ 1941,
+/* LuminanceValue                                                 */ 2108,
+/* PixelSpacingCalibrationDescription                             */ 1993,
+/* DeliveredPulseRepetitionInterval                               */ 3843,
+/* DetectorActiveOrigin                                           */ 1015,
+/* RadiationMachineSSD                                            */ 3678,
+/* BadPixelImage                                                  */ 432,
+/* SystemStatusComment                                            */ 2084,
+/* ApplicationMaximumRepaintTime                                  */ 3295,
+/* MPRTopLeftHandCorner                                           */ 3179,
+/* OphthalmicAxialLengthAcquisitionMethodCodeSequence             */ 1737,
+/* ControlPoint3DPosition                                         */ 4150,
+/* OrderCallbackPhoneNumber                                       */ 2395,
+/* ToleranceValue                                                 */ 4311,
+/* FilterType                                                     */ 810,
+/* RoboticNodeIdentifier                                          */ 4623,
+/* CollimatorRightVerticalEdge                                    */ 898,
+/* AssertionComments                                              */ 2614,
+/* CTDIvolNotificationTrigger                                     */ 1500,
+/* MaterialAttenuationSequence                                    */ 1282,
+/* ObservationDateTrial                                           */ 2521,
+/* ReferencedDosimetricObjectiveUID                               */ 4595,
+/* CalculatedDoseReferenceNumber                                  */ 3813,
+/* ArterialSpinLabelingContrast                                   */ 1181,
+/* CardiacRRIntervalSpecified                                     */ 1096,
+/* LineDashingStyle                                               */ 3110,
+/* StartingRespiratoryAmplitude                                   */ 1598,
+/* LargeRedPaletteColorLookupTableData                            */ 2019,
+/* FixationDevicePitchAngle                                       */ 4065,
+/* ReferencedInstanceSequence                                     */ 176,
+/* PatientClinicalTrialParticipationSequence                      */ 2222,
+/* ExposureControlSensingRegionLowerHorizontalEdge                */ 1311,
+/* SubstanceAdministrationDeviceID                                */ 2605,
+/* RTROIInterpretedType                                           */ 3753,
+/* DeviceAlternateIdentifier                                      */ 4511,
+/* MPRSlabThickness                                               */ 3178,
+/* AnchorPoint                                                    */ 3054,
+/* PhaseVector                                                    */ 2796,
+/* TableSpeed                                                     */ 1210,
+/* ProcedureStepLabel                                             */ 3394,
+/* IntensifierSize                                                */ 812,
+/* SpecimenAccessionNumber                                        */ 2337,
+/* ExposureTimeInuS                                               */ 1039,
+/* TableTopVerticalSetupDisplacement                              */ 4080,
+/* MetaboliteMapCodeSequence                                      */ 1107,
+/* ImpedanceMeasurementFrequency                                  */ 2267,
+/* ObserverType                                                   */ 2489,
+/* RTVCommunicationSOPInstanceUID                                 */ 15,
+/* DoseValuesSequence                                             */ 4295,
+/* BreedRegistrationNumber                                        */ 328,
+/* StimulusArea                                                   */ 1813,
+/* ConceptualVolumeTypeCodeSequence                               */ 4589,
+/* WedgeMaterial                                                  */ 530,
+/* ResponsiblePerson                                              */ 330,
+/* NumberOfParallelRTBeamDelimiters                               */ 4338,
+/* ProcedureStepCommunicationsURISequence                         */ 3358,
+/* RecordedRangeShifterSequence                                   */ 3828,
 /* ReasonForChannelOmission                                       */ 3420,
-/* ReasonForChannelOmissionDescription                            */ 3421,
-/* ReasonForOmission                                              */ 4479,
-/* ReasonForOmissionDescription                                   */ 4480,
-/* ReasonForPerformedProcedureCodeSequence                        */ 2381,
-/* ReasonForRequestedProcedureCodeSequence                        */ 2378,
-/* ReasonForStudy                                                 */ 2166,
-/* ReasonForSuperseding                                           */ 4576,
-/* ReasonForTheAttributeModification                              */ 3540,
-/* ReasonForTheImagingServiceRequest                              */ 2388,
-/* ReasonForTheRequestedProcedure                                 */ 2370,
-/* ReasonForVisit                                                 */ 2178,
-/* ReasonForVisitCodeSequence                                     */ 2179,
-/* ReceiveCoilManufacturerName                                    */ 1071,
-/* ReceiveCoilName                                                */ 836,
-/* ReceiveCoilType                                                */ 1073,
-/* ReceiveProbeSequence                                           */ 499,
-/* ReceiveTransducerSequence                                      */ 443,
-/* ReceiveTransducerSettingsSequence                              */ 473,
-/* ReceiverEquipmentSequence                                      */ 437,
-/* ReceiverNotes                                                  */ 439,
-/* ReceiverSettingsSequence                                       */ 461,
-/* ReceivingAE                                                    */ 3402,
-/* ReceivingApplicationEntityTitle                                */ 9,
-/* ReceivingPresentationAddress                                   */ 12,
-/* RecognitionCode                                                */ 46,
-/* RecognizableVisualFeatures                                     */ 1966,
-/* RecommendedAbsentPixelCIELabValue                              */ 2719,
-/* RecommendedAnimationRate                                       */ 3212,
+/* ScheduledStationName                                           */ 2280,
+/* PatientBirthDateInAlternativeCalendar                          */ 269,
+/* ImageHorizontalFlip                                            */ 3062,
+/* NumberOfDetectors                                              */ 2794,
+/* MeasurementUnitsCodeSequence                                   */ 2367,
+/* TransducerFrequency                                            */ 966,
+/* MaximumStimulusLuminance                                       */ 1809,
+/* RTAccessoryHolderWaterEquivalentThickness                      */ 4280,
+/* ComponentAssemblySequence                                      */ 3441,
+/* LocalDeviationProbabilityNormalsFlag                           */ 1851,
+/* DetectorID                                                     */ 1002,
+/* ScheduledAdmissionDate                                         */ 2200,
+/* RefractivePower                                                */ 2705,
+/* EquivalentConceptualVolumeInstanceReferenceSequence            */ 4493,
+/* GraphicCoordinatesDataSequence                                 */ 3141,
+/* ResonantNucleus                                                */ 1120,
+/* RadiusAlongWedge                                               */ 550,
+/* RTROIRelationship                                              */ 3733,
+/* StartTrim                                                      */ 212,
+/* NumberOfSlices                                                 */ 2816,
+/* ShutterOverlayGroup                                            */ 885,
+/* ReconstructionType                                             */ 1417,
+/* OriginalImageSequence                                          */ 3649,
+/* ContextGroupLocalVersion                                       */ 102,
+/* ResidualSyringeCounts                                          */ 2791,
+/* NumberOfFramesUsedForIntegration                               */ 427,
+/* SourceDescription                                              */ 4093,
+/* SubjectArea                                                    */ 592,
+/* ChannelNumber                                                  */ 4124,
+/* ConcatenationFrameOffsetNumber                                 */ 1594,
+/* RadiationBeamEffectiveWedgeAngle                               */ 4350,
+/* OmittedChannelSequence                                         */ 3419,
+/* NumberOfSamples                                                */ 4766,
+/* AcquisitionTimeSynchronized                                    */ 904,
+/* ReferencedCalculatedDoseReferenceSequence                      */ 3820,
+/* IntravascularOCTFrameTypeSequence                              */ 2771,
+/* PredictorRows                                                  */ 1937,
+/* PlaneIdentification                                            */ 1322,
+/* ImplantTemplateGroupVariationDimensionName                     */ 3462,
+/* IOLPowerSequence                                               */ 1711,
+/* DoubleFloatPixelPaddingRangeLimit                              */ 1962,
+/* PatientOrientationCodeSequence                                 */ 2832,
+/* MagneticFieldStrength                                          */ 701,
+/* DisplaySetNumber                                               */ 3297,
+/* IntendedPhaseEndDate                                           */ 4561,
+/* RegistrationToLocalizerSequence                                */ 1768,
+/* NumberOfVolumetricCurvePoints                                  */ 3182,
+/* CameraPositionGroupSequence                                    */ 2191,
+/* AcquisitionDuration                                            */ 1097,
+/* ConstraintType                                                 */ 3496,
+/* ApplicationVersion                                             */ 1353,
+/* MainLobeAngle                                                  */ 522,
+/* RadiopharmaceuticalStopTime                                    */ 761,
+/* SliceLocation                                                  */ 1550,
+/* ChannelSensitivityUnitsSequence                                */ 2238,
+/* RotationVector                                                 */ 2803,
+/* CodingSchemeName                                               */ 114,
+/* CompositingMethod                                              */ 3161,
+/* IntraocularLensCalculationsRightEyeSequence                    */ 1753,
+/* GraphicLayerRecommendedDisplayRGBValue                         */ 3072,
+/* IonBlockSequence                                               */ 4226,
+/* RadiationBeamBlockThickness                                    */ 4375,
 /* RecommendedDefaultValueSequence                                */ 3499,
-/* RecommendedDisplayCIELabValue                                  */ 2884,
-/* RecommendedDisplayCIELabValueList                              */ 2954,
-/* RecommendedDisplayFrameRate                                    */ 214,
-/* RecommendedDisplayFrameRateInFloat                             */ 257,
-/* RecommendedDisplayGrayscaleValue                               */ 2883,
-/* RecommendedExposureIndex                                       */ 578,
-/* RecommendedLineThickness                                       */ 2947,
-/* RecommendedPointRadius                                         */ 2946,
-/* RecommendedPresentationOpacity                                 */ 2908,
-/* RecommendedPresentationType                                    */ 2909,
-/* RecommendedRotationPoint                                       */ 2994,
-/* RecommendedViewingMode                                         */ 2004,
-/* ReconstructionAlgorithm                                        */ 1216,
+/* ThreeDMatingPoint                                              */ 3019,
+/* ExposureDoseSequence                                           */ 2322,
+/* BreastSupportYPositionToIsocenter                              */ 1367,
+/* OperatorsName                                                  */ 160,
+/* ExecutionStatus                                                */ 3625,
+/* WholeBodyTechnique                                             */ 843,
+/* SubjectRelativePositionInImage                                 */ 266,
+/* ReferencedStopControlPointIndex                                */ 4474,
+/* AxisLabels                                                     */ 4754,
+/* VerifyingOrganization                                          */ 2466,
+/* ImageOrientationVolume                                         */ 1611,
+/* WideFieldOphthalmicPhotographyQualityThresholdSequence         */ 1780,
+/* ManufacturerModelVersion                                       */ 4510,
+/* SelectorAEValue                                                */ 3257,
+/* ContrastFlowDuration                                           */ 741,
+/* ExpectedInVivoMeasurementValuesSequence                        */ 4300,
+/* MRSpectroscopyFOVGeometrySequence                              */ 1122,
+/* RTAccessorySlotDistance                                        */ 4286,
+/* LightPathFilterPassThroughWavelength                           */ 1631,
+/* PixelValueMappingExplanation                                   */ 1764,
+/* ImageOverlayBoxContentSequence                                 */ 3646,
+/* MaterialsCodeSequence                                          */ 3000,
+/* AxialResolution                                                */ 2764,
+/* AverageBeamDosePointEquivalentDepth                            */ 3929,
+/* LightDirection                                                 */ 3194,
+/* NumberOfFramesIntegrated                                       */ 415,
+/* MaskVisibilityPercentage                                       */ 2144,
+/* XRayTubeCurrent                                                */ 802,
+/* StartingRespiratoryPhase                                       */ 1599,
+/* TreatmentSiteCodeSequence                                      */ 4603,
+/* BillingSuppliesAndDevicesSequence                              */ 2330,
+/* ViewNumber                                                     */ 204,
+/* ExclusionStartDateTime                                         */ 1435,
+/* EffectiveDoseCalculationMethodCategoryCodeSequence             */ 4487,
+/* MRReceiveCoilSequence                                          */ 1072,
+/* NumberOfViewsInStage                                           */ 206,
+/* TransverseMash                                                 */ 2850,
+/* TextString                                                     */ 3608,
+/* IncludeDisplayApplication                                      */ 3658,
+/* WaveformSequence                                               */ 4777,
+/* RadiationGenerationModeMachineCodeSequence                     */ 4392,
+/* RecordedRTControlPointDateTime                                 */ 4427,
+/* MRTransmitCoilSequence                                         */ 1079,
+/* LensesCodeSequence                                             */ 1654,
+/* NominalFrequency                                               */ 452,
+/* BlockSequence                                                  */ 3994,
+/* CollimatorLowerHorizontalEdge                                  */ 900,
+/* MedicalRecordLocator                                           */ 306,
+/* ModifiedAttributesSequence                                     */ 3533,
+/* ReferencedRawDataSequence                                      */ 244,
+/* OECFColumns                                                    */ 557,
+/* DistalDepthFraction                                            */ 4255,
+/* ParameterSequencePointer                                       */ 3803,
+/* DoubleExposureMeterset                                         */ 3409,
+/* ImagedVolumeDepth                                              */ 2710,
+/* ImageRotation                                                  */ 3063,
+/* SourceStrengthUnits                                            */ 4098,
+/* DerivationDescription                                          */ 198,
+/* DVHMeanDose                                                    */ 3714,
+/* MeasuredBandwidth                                              */ 454,
+/* ReferencedFrameNumbers                                         */ 2505,
+/* GlobalDeviationProbabilitySequence                             */ 1861,
+/* XRayReceptorType                                               */ 1295,
+/* OutlineRightVerticalEdge                                       */ 889,
+/* AuthorizationEquipmentCertificationNumber                      */ 3513,
+/* ScanSpotReorderingAllowed                                      */ 4218,
+/* GeneralAccessoryID                                             */ 4235,
+/* SegmentedPropertyTypeModifierCodeSequence                      */ 2888,
+/* PositionerPrimaryAngleIncrement                                */ 872,
+/* AgeCorrectedSensitivityDeviationAlgorithmSequence              */ 1844,
+/* TopicKeywords                                                  */ 3509,
+/* PerformedStationNameCodeSequence                               */ 2423,
+/* TableTopLateralAdjustedPosition                                */ 3368,
+/* ImageBoxPosition                                               */ 3596,
+/* OutputInformationSequence                                      */ 2428,
+/* TriggerTime                                                    */ 745,
+/* DisplaySetLabel                                                */ 3298,
+/* ImageDisplayFormat                                             */ 3570,
+/* ClinicalTrialProtocolID                                        */ 336,
+/* ResultsDistributionListSequence                                */ 4653,
+/* RTPlanDate                                                     */ 3868,
+/* OtherMediaAvailableSequence                                    */ 3566,
+/* CassetteOrientation                                            */ 854,
+/* PatientSpecificationSequence                                   */ 1464,
+/* DiffusionBMatrixSequence                                       */ 1379,
+/* TemporalPositionIdentifier                                     */ 1536,
+/* RepresentativeFrameNumber                                      */ 2063,
+/* NumberOfSurfacePoints                                          */ 2915,
+/* ClinicalTrialProtocolEthicsCommitteeName                       */ 352,
+/* BurnedInAnnotation                                             */ 1965,
+/* ScheduledStudyLocationAETitle                                  */ 2165,
+/* AnteriorChamberDepthDefinitionCodeSequence                     */ 1723,
+/* UnspecifiedLateralityLensSequence                              */ 2622,
+/* BlendingDisplaySequence                                        */ 3222,
+/* ObjectBinaryIdentifierTrial                                    */ 2481,
+/* ChannelShieldID                                                */ 4143,
+/* DoseGridScaling                                                */ 3699,
+/* ShowGrayscaleInverted                                          */ 3344,
+/* GateThreshold                                                  */ 483,
+/* ReferencedPatientAliasSequence                                 */ 2194,
+/* ReferencedExpectedInVivoMeasurementValueIndex                  */ 4442,
 /* ReconstructionAlgorithmSequence                                */ 1497,
-/* ReconstructionAngle                                            */ 1220,
-/* ReconstructionDescription                                      */ 1358,
-/* ReconstructionDiameter                                         */ 778,
-/* ReconstructionEndLocationSequence                              */ 1496,
+/* UltrasoundAcquisitionGeometry                                  */ 1612,
+/* ConceptualVolumeCombinationDescription                         */ 4499,
+/* Modality                                                       */ 79,
+/* TimeOfFrameGroupSequence                                       */ 2193,
+/* TargetPrescriptionDose                                         */ 3888,
+/* PlateType                                                      */ 838,
+/* NonconformingModifiedAttributesSequence                        */ 3534,
+/* BlockTrayID                                                    */ 3995,
+/* IncidentAngle                                                  */ 474,
+/* FrameDelay                                                     */ 751,
+/* CalciumScoringMassFactorPatient                                */ 1245,
+/* CompressionOriginator                                          */ 1928,
+/* FirstOrderPhaseCorrection                                      */ 1164,
+/* VisualEvaluationResultSequence                                 */ 2098,
+/* LeafPositionBoundaries                                         */ 3948,
+/* BeamDosePointSSD                                               */ 3925,
+/* FieldOfViewDescription                                         */ 1305,
+/* AvailableTransferSyntaxUID                                     */ 237,
+/* OverlayMagnificationType                                       */ 3612,
+/* RTRadiationSetDeliveryNumber                                   */ 4409,
+/* Arbitrary                                                      */ 4632,
+/* FixationLightAzimuthalAngle                                    */ 4196,
+/* AnnotationContentSequence                                      */ 3645,
+/* OmittedApplicationSetupSequence                                */ 3424,
+/* GeneralPurposeScheduledProcedureStepPriority                   */ 2403,
+/* RouteOfAdmissions                                              */ 2199,
+/* TMLinePositionY0                                               */ 978,
+/* InterpolationType                                              */ 2782,
+/* DataPathID                                                     */ 2046,
+/* SimpleFrameList                                                */ 183,
+/* CumulativeDoseToDoseReference                                  */ 3798,
+/* TableOfYBreakPoints                                            */ 991,
+/* ProcedureVersion                                               */ 487,
+/* SubscriptionListStatus                                         */ 3406,
+/* ShadowColorCIELabValue                                         */ 3103,
+/* TreatmentToleranceViolationTypeCodeSequence                    */ 4439,
+/* SpatialFrequencyResponseValues                                 */ 563,
+/* GantryRotationDirection                                        */ 4024,
+/* PatientLocationCoordinatesCodeSequence                         */ 3768,
+/* ServiceEpisodeID                                               */ 2212,
+/* PlanningLandmarkLineSequence                                   */ 3023,
+/* BlockSlabNumber                                                */ 4250,
+/* VisualFieldTestPointSequence                                   */ 1866,
+/* OriginalSpecializedSOPClassUID                                 */ 54,
+/* TreatmentToleranceViolationIdentification                      */ 4425,
 /* ReconstructionFieldOfView                                      */ 1218,
-/* ReconstructionIndex                                            */ 1630,
-/* ReconstructionMethod                                           */ 2845,
-/* ReconstructionPixelSpacing                                     */ 1223,
-/* ReconstructionProtocolElementSequence                          */ 1488,
-/* ReconstructionProtocolElementSpecificationSequence             */ 1487,
-/* ReconstructionStartLocationSequence                            */ 1495,
-/* ReconstructionTargetCenterLocationSequence                     */ 1498,
-/* ReconstructionTargetCenterPatient                              */ 1219,
-/* ReconstructionType                                             */ 1417,
-/* RecordInUseFlag                                                */ 30,
-/* RecordedBlockSequence                                          */ 3825,
-/* RecordedBrachyAccessoryDeviceSequence                          */ 3835,
-/* RecordedChannelSequence                                        */ 3837,
-/* RecordedChannelShieldSequence                                  */ 3846,
-/* RecordedCompensatorSequence                                    */ 3824,
-/* RecordedLateralSpreadingDeviceSequence                         */ 3829,
-/* RecordedRTControlPointDateTime                                 */ 4427,
-/* RecordedRangeModulatorSequence                                 */ 3830,
-/* RecordedRangeShifterSequence                                   */ 3828,
-/* RecordedSnoutSequence                                          */ 3827,
-/* RecordedSourceApplicatorSequence                               */ 3844,
+/* TreatmentToleranceViolationAttributeSequence                   */ 4423,
+/* RegionLocationMinX0                                            */ 954,
+/* SlabOrientation                                                */ 1124,
+/* GeometryForDisplay                                             */ 3225,
+/* DVHMaximumDose                                                 */ 3713,
+/* FilmDestination                                                */ 3553,
+/* MRAveragesSequence                                             */ 1132,
+/* SpecimenLabelInImage                                           */ 2714,
+/* TreatmentVerificationStatus                                    */ 3781,
+/* TomoAngle                                                      */ 863,
+/* ImageOverlayFlag                                               */ 3560,
+/* SourceStrength                                                 */ 4100,
+/* DeviceMotionObservationMode                                    */ 4253,
+/* IonMachineVerificationSequence                                 */ 3382,
+/* MultiFrameSourceSOPInstanceUID                                 */ 187,
+/* WedgeElement1Position                                          */ 528,
+/* BasicColorImageSequence                                        */ 3604,
+/* SelectorLOValue                                                */ 3265,
+/* DisplaySetPatientOrientation                                   */ 3340,
+/* FocalSpots                                                     */ 821,
+/* TreatmentStatusComment                                         */ 3857,
 /* RecordedSourceSequence                                         */ 3831,
-/* RecordedWedgeSequence                                          */ 3823,
-/* RectificationType                                              */ 807,
-/* RectifierSmoothing                                             */ 465,
-/* RectilinearPhaseEncodeReordering                               */ 1067,
-/* RedPaletteColorLookupTableData                                 */ 2015,
-/* RedPaletteColorLookupTableDescriptor                           */ 2006,
-/* Reference                                                      */ 1547,
-/* ReferenceAirKermaRate                                          */ 4099,
-/* ReferenceBasisCodeSequence                                     */ 1449,
-/* ReferenceCoordinates                                           */ 1666,
-/* ReferenceDisplaySets                                           */ 3306,
-/* ReferenceDoseDefinition                                        */ 4266,
-/* ReferenceDosePointCoordinates                                  */ 4297,
-/* ReferenceDoseType                                              */ 4293,
-/* ReferenceGeometryCodeSequence                                  */ 1450,
+/* ParallelRTBeamDelimiterPositions                               */ 4340,
+/* MultiplexGroupTimeOffset                                       */ 753,
+/* SourceSequence                                                 */ 4086,
+/* SelectorUIValue                                                */ 3286,
+/* ApprovalStatus                                                 */ 4481,
+/* GridResolution                                                 */ 2897,
+/* BlendingPosition                                               */ 3151,
+/* XRay3DFrameTypeSequence                                        */ 1339,
+/* ScheduledProcessingApplicationsCodeSequence                    */ 2404,
+/* SeamLineLocation                                               */ 2778,
+/* RequestingPhysician                                            */ 2168,
+/* ConstraintValueSequence                                        */ 3498,
+/* ProtocolElementCharacteristicsSummary                          */ 1482,
+/* SurfaceModelLabel                                              */ 2998,
+/* Allergies                                                      */ 309,
+/* OphthalmicAxialLengthMeasurementsTotalLengthSequence           */ 1740,
+/* ReferencedRTPatientSetupSequence                               */ 4317,
+/* ImageDataLocation                                              */ 1991,
+/* NumberOfChannels                                               */ 4765,
+/* RTBeamLimitingDeviceAngle                                      */ 4387,
+/* B1rms                                                          */ 851,
+/* BlindSpotLocalized                                             */ 1881,
+/* FillStyleSequence                                              */ 3095,
+/* SpecimenDescriptionTrial                                       */ 2347,
+/* HighDoseTechniqueType                                          */ 3955,
+/* TwoDPointCoordinatesSequence                                   */ 3028,
+/* RTBeamLimitingDeviceDefinitionSequence                         */ 4343,
+/* ReferencedTreatmentPositionIndex                               */ 4278,
+/* EndCumulativeMetersetWeight                                    */ 4452,
+/* WedgeTotalWidth                                                */ 546,
+/* LineSequence                                                   */ 2932,
+/* IssuerOfAdmissionID                                            */ 2197,
+/* ActiveAperture                                                 */ 519,
+/* ParallelRTBeamDelimiterOpeningMode                             */ 4344,
+/* CompressionPressure                                            */ 825,
+/* TableTopLateralSetupDisplacement                               */ 4082,
+/* StudyStatusID                                                  */ 2153,
+/* Acceleration                                                   */ 598,
+/* NumberOfWaveformSamples                                        */ 2226,
+/* PlanePositionSlideSequence                                     */ 2735,
+/* PrintPriority                                                  */ 3551,
+/* TransmitTransducerSequence                                     */ 442,
+/* EquipmentModality                                              */ 127,
+/* RecommendedPresentationType                                    */ 2909,
+/* CardiacNumberOfImages                                          */ 776,
+/* VerticesOfThePolygonalShutter                                  */ 883,
+/* DegreeOfFreedomID                                              */ 3010,
+/* FontNameType                                                   */ 3090,
+/* ReferencedRealWorldValueMappingInstanceSequence                */ 177,
+/* RespiratoryTriggerType                                         */ 1602,
+/* VolumeFrameOfReferenceUID                                      */ 1623,
+/* DVHROIContributionType                                         */ 3711,
+/* YFocusCenter                                                   */ 820,
+/* ShortTermFluctuation                                           */ 1854,
+/* RunLengthTriplet                                               */ 3543,
+/* OverlaysRed                                                    */ 4817,
+/* TimeSource                                                     */ 905,
+/* TotalPixelMatrixColumns                                        */ 2711,
+/* AnatomicStructureSpaceOrRegionSequence                         */ 221,
+/* AdditionalInspectionSelectionCriteria                          */ 4732,
+/* KeratometricPower                                              */ 2645,
+/* DimensionIndexValues                                           */ 1580,
+/* IndicationROISequence                                          */ 396,
+/* RTImagePlane                                                   */ 3670,
+/* CalibrationProcedure                                           */ 486,
+/* ApplicatorGeometrySequence                                     */ 4241,
+/* LightSource                                                    */ 590,
+/* MaximumStoredValueMapped                                       */ 2029,
+/* AirCounts                                                      */ 424,
+/* TargetExposureIndex                                            */ 859,
+/* AcquisitionProtocolDescription                                 */ 1297,
+/* ReferringPhysicianTelephoneNumbers                             */ 91,
+/* PotentialScheduledProtocolCodeSequence                         */ 1453,
+/* ThresholdValue                                                 */ 3229,
+/* FloatPixelData                                                 */ 4828,
+/* UltrasoundOphthalmicAxialLengthMeasurementsSequence            */ 1743,
+/* ROIElementalCompositionAtomicMassFraction                      */ 3760,
+/* TableTopRollAngleTolerance                                     */ 3906,
+/* TransformationMethodCodeSequence                               */ 1774,
+/* TableType                                                      */ 791,
+/* SOPClassesSupported                                            */ 181,
+/* ExposureSequence                                               */ 3682,
+/* AdditionalScreeningPerformed                                   */ 4731,
+/* VerticesOfThePolygonalCollimator                               */ 903,
+/* RequestedProcedureDescription                                  */ 2176,
+/* RetestSensitivityValue                                         */ 1873,
+/* PotentialReasonsForProcedure                                   */ 1455,
+/* IndicationSequence                                             */ 390,
+/* TotalPixelMatrixOriginSequence                                 */ 2713,
+/* EvaluatorNumber                                                */ 387,
+/* UltrasoundSelectedOphthalmicAxialLengthSequence                */ 1745,
+/* ReconstructionStartLocationSequence                            */ 1495,
+/* InterpretationTranscriptionDate                                */ 4642,
+/* DoubleExposureMetersetTrial                                    */ 3377,
+/* MatingFeatureSetID                                             */ 3005,
+/* AlternateValueSequence                                         */ 4429,
+/* BitsForCodeWord                                                */ 1990,
+/* RTPhysicianIntentIndex                                         */ 4572,
+/* ModifyingDeviceManufacturer                                    */ 1562,
+/* SamplesPerPixel                                                */ 1906,
+/* SelectorSHValue                                                */ 3271,
+/* MeasuredDoseValue                                              */ 3773,
+/* OphthalmicAxialLengthQualityMetricSequence                     */ 1750,
+/* FractionBasedRelationshipIntervalAnchor                        */ 4614,
+/* TableAngle                                                     */ 790,
+/* ImageCenterPointCoordinatesSequence                            */ 2361,
+/* DocumentingObserverIdentifierCodeSequenceTrial                 */ 2483,
+/* ChannelOffset                                                  */ 2243,
+/* AddIntermediateSequence                                        */ 2654,
+/* StageName                                                      */ 200,
 /* ReferenceImageNumber                                           */ 3956,
-/* ReferenceLocationDescription                                   */ 1448,
-/* ReferenceLocationLabel                                         */ 1447,
-/* ReferencePixelPhysicalValueX                                   */ 962,
-/* ReferencePixelPhysicalValueY                                   */ 963,
-/* ReferencePixelX0                                               */ 958,
-/* ReferencePixelY0                                               */ 959,
-/* ReferenceToRecordedSound                                       */ 4641,
-/* ReferencedAccessionSequenceTrial                               */ 2534,
-/* ReferencedAssertionUID                                         */ 2616,
-/* ReferencedBasicAnnotationBoxSequence                           */ 3595,
-/* ReferencedBeamNumber                                           */ 4449,
-/* ReferencedBeamSequence                                         */ 4448,
-/* ReferencedBlockNumber                                          */ 4470,
-/* ReferencedBolusSequence                                        */ 4467,
-/* ReferencedBrachyAccessoryDeviceNumber                          */ 3836,
-/* ReferencedBrachyApplicationSetupNumber                         */ 4454,
-/* ReferencedBrachyApplicationSetupSequence                       */ 4453,
-/* ReferencedCalculatedDoseReferenceNumber                        */ 3821,
-/* ReferencedCalculatedDoseReferenceSequence                      */ 3820,
-/* ReferencedChannelNumber                                        */ 3416,
-/* ReferencedChannelShieldNumber                                  */ 3847,
-/* ReferencedColorPaletteInstanceUID                              */ 1968,
-/* ReferencedComparisonSOPInstanceSequence                        */ 3482,
-/* ReferencedCompensatorNumber                                    */ 4469,
-/* ReferencedConceptualVolumeUID                                  */ 4495,
-/* ReferencedContentItem                                          */ 3208,
-/* ReferencedContentItemIdentifier                                */ 2573,
-/* ReferencedControlPointIndex                                    */ 4471,
-/* ReferencedControlPointSequence                                 */ 4472,
-/* ReferencedCurveSequence                                        */ 175,
-/* ReferencedDateTime                                             */ 2507,
-/* ReferencedDefinedDeviceIndex                                   */ 4269,
-/* ReferencedDefinedProtocolSequence                              */ 1459,
-/* ReferencedDeviceIndex                                          */ 4274,
-/* ReferencedDigitalSignatureSequence                             */ 3527,
-/* ReferencedDirectSegmentInstanceSequence                        */ 4558,
-/* ReferencedDoseReferenceNumber                                  */ 4461,
-/* ReferencedDoseReferenceSequence                                */ 4460,
-/* ReferencedDoseReferenceUID                                     */ 3920,
-/* ReferencedDoseSequence                                         */ 4465,
-/* ReferencedDosimetricObjectiveUID                               */ 4595,
-/* ReferencedDosimetricObjectivesSequence                         */ 4597,
-/* ReferencedExpectedInVivoMeasurementValueIndex                  */ 4442,
-/* ReferencedFiducialUID                                          */ 3143,
-/* ReferencedFiducialsUID                                         */ 4533,
-/* ReferencedFileID                                               */ 34,
-/* ReferencedFilmBoxSequence                                      */ 3568,
-/* ReferencedFilmSessionSequence                                  */ 3593,
-/* ReferencedFindingsGroupUIDTrial                                */ 2462,
-/* ReferencedFirstFrameSequence                                   */ 3327,
-/* ReferencedFractionGroupNumber                                  */ 4457,
-/* ReferencedFractionGroupSequence                                */ 4456,
-/* ReferencedFractionNumber                                       */ 3859,
-/* ReferencedFrameNumber                                          */ 182,
-/* ReferencedFrameNumbers                                         */ 2505,
-/* ReferencedFrameOfReferenceSequence                             */ 3720,
-/* ReferencedFrameOfReferenceUID                                  */ 3727,
-/* ReferencedGeneralPurposeScheduledProcedureStepSequence         */ 2413,
-/* ReferencedGeneralPurposeScheduledProcedureStepTransactionUID   */ 2419,
-/* ReferencedHPGLDocumentID                                       */ 3013,
+/* ShutterRightVerticalEdge                                       */ 878,
+/* CalculationCommentSequence                                     */ 1726,
+/* SupportedImageDisplayFormatsSequence                           */ 3567,
+/* MeasuredDoseReferenceSequence                                  */ 3770,
+/* MetersetRateDelivered                                          */ 3794,
+/* ImageLaterality                                                */ 1532,
+/* MeasurementEquipmentSequence                                   */ 2095,
+/* TreatmentTerminationDescription                                */ 4420,
+/* QuantitySequence                                               */ 2312,
+/* FocusDepth                                                     */ 932,
+/* ChannelImpedanceSequence                                       */ 2264,
+/* VOILUTFunction                                                 */ 2002,
+/* SharedFunctionalGroupsSequence                                 */ 4775,
+/* BrachytherapySourceType                                        */ 4556,
+/* StereoPairsPresent                                             */ 1663,
+/* PatientSupportAngle                                            */ 4027,
+/* FixationLightPolarAngleTolerance                               */ 4055,
+/* NumberOfTransformSteps                                         */ 1971,
+/* ShotDurationTime                                               */ 3469,
+/* PatientSupportPositionParameterSequence                        */ 4357,
+/* MRArterialSpinLabelingSequence                                 */ 1182,
+/* Exposure                                                       */ 803,
+/* TestResultComment                                              */ 2119,
+/* PhysicianApprovingInterpretation                               */ 4650,
+/* XOffsetInSlideCoordinateSystem                                 */ 2362,
+/* BluePaletteColorLookupTableDescriptor                          */ 2008,
+/* AttenuationCorrected                                           */ 1419,
+/* MRImageFrameTypeSequence                                       */ 1172,
+/* PhysiciansOfRecord                                             */ 154,
+/* FiniteVolume                                                   */ 2910,
+/* NumberOfStudyRelatedInstances                                  */ 1556,
+/* BeamSpotSize                                                   */ 2760,
+/* ExposedArea                                                    */ 2319,
 /* ReferencedImageBoxSequence                                     */ 3594,
-/* ReferencedImageBoxSequenceRetired                              */ 3620,
-/* ReferencedImageEvidenceSequence                                */ 243,
-/* ReferencedImageNavigationSequence                              */ 2731,
-/* ReferencedImageOverlayBoxSequence                              */ 3605,
-/* ReferencedImageRealWorldValueMappingSequence                   */ 2446,
-/* ReferencedImageSequence                                        */ 174,
-/* ReferencedImplantTemplateGroupMemberID                         */ 3464,
-/* ReferencedInstanceSequence                                     */ 176,
-/* ReferencedInterpretationSequence                               */ 4636,
-/* ReferencedLateralSpreadingDeviceNumber                         */ 4476,
-/* ReferencedMeasuredDoseReferenceNumber                          */ 3819,
-/* ReferencedMeasuredDoseReferenceSequence                        */ 3818,
+/* InformationSummary                                             */ 2979,
 /* ReferencedNonImageCompositeSOPInstanceSequence                 */ 2294,
-/* ReferencedObjectObservationClassTrial                          */ 2519,
-/* ReferencedObservationClassTrial                                */ 2518,
-/* ReferencedObservationUIDTrial                                  */ 2517,
-/* ReferencedOphthalmicAxialLengthMeasurementQCImageSequence      */ 1755,
-/* ReferencedOphthalmicAxialMeasurementsSequence                  */ 1718,
-/* ReferencedOtherPlaneSequence                                   */ 255,
-/* ReferencedOverlayPlaneGroups                                   */ 3610,
-/* ReferencedOverlayPlaneSequence                                 */ 3609,
-/* ReferencedOverlaySequence                                      */ 171,
-/* ReferencedPTOSequence                                          */ 4739,
-/* ReferencedParentRTPrescriptionIndex                            */ 4550,
-/* ReferencedPathIndex                                            */ 1272,
-/* ReferencedPatientAliasSequence                                 */ 2194,
-/* ReferencedPatientPhotoSequence                                 */ 307,
-/* ReferencedPatientSequence                                      */ 169,
-/* ReferencedPatientSetupNumber                                   */ 4464,
-/* ReferencedPerformedProcedureStepSequence                       */ 167,
-/* ReferencedPerformedProtocolSequence                            */ 1460,
-/* ReferencedPresentationLUTSequence                              */ 3623,
-/* ReferencedPresentationStateSequence                            */ 254,
-/* ReferencedPrintJobSequence                                     */ 3640,
-/* ReferencedPrintJobSequencePullStoredPrint                      */ 3633,
-/* ReferencedProcedureStepSequence                                */ 2331,
-/* ReferencedROINumber                                            */ 3748,
-/* ReferencedRTAccessoryHolderDeviceIndex                         */ 4281,
-/* ReferencedRTInstanceSequence                                   */ 4316,
-/* ReferencedRTPatientSetupSequence                               */ 4317,
-/* ReferencedRTPhysicianIntentIndex                               */ 4578,
-/* ReferencedRTPhysicianIntentSequence                            */ 4325,
-/* ReferencedRTPlanSequence                                       */ 4447,
+/* SteepKeratometricAxisSequence                                  */ 2643,
+/* PerformedProcedureStepStartTime                                */ 2299,
+/* SourceApplicatorWallNominalTransmission                        */ 4137,
+/* DopplerSampleVolumeYPosition                                   */ 974,
+/* ChemicalShiftMaximumIntegrationLimitInHz                       */ 1162,
+/* RequestedProcedureComments                                     */ 2387,
+/* OpticalPathDescription                                         */ 2724,
+/* BrachyAccessoryDeviceNumber                                    */ 4113,
+/* RadiobiologicalDoseEffectFlag                                  */ 4486,
 /* ReferencedRTPrescriptionIndex                                  */ 4549,
-/* ReferencedRTPrescriptionSequence                               */ 4404,
-/* ReferencedRTRadiationRecordSequence                            */ 4408,
-/* ReferencedRTRadiationSequence                                  */ 4315,
-/* ReferencedRTRadiationSetSequence                               */ 4407,
+/* SpecimenPreparationSequence                                    */ 2356,
+/* SubstanceAdministrationParameterSequence                       */ 2607,
+/* LightPathFilterTypeStackCodeSequence                           */ 1652,
+/* FlatKeratometricAxisSequence                                   */ 2647,
+/* FileSource                                                     */ 604,
+/* ConceptualVolumeSequence                                       */ 4521,
+/* StructureSetLabel                                              */ 3715,
+/* ProtocolContextSequence                                        */ 2334,
+/* WedgeFrontHeight                                               */ 544,
+/* GraphicLayerSequence                                           */ 3069,
+/* ColorFilterArrayPatternColumns                                 */ 565,
+/* RangeShifterSequence                                           */ 4173,
+/* RedPaletteColorLookupTableData                                 */ 2015,
+/* ThreeDLineCoordinates                                          */ 3033,
+/* EffectiveWedgeAngle                                            */ 3974,
+/* DiffusionGradientDirectionSequence                             */ 1100,
+/* VisualAcuityRightEyeSequence                                   */ 2668,
+/* TreatmentPositionGroupSequence                                 */ 4277,
+/* ROIInterpreter                                                 */ 3754,
+/* VelocityEncodingMaximumValue                                   */ 1168,
+/* MaterialGrade                                                  */ 366,
+/* TimeRange                                                      */ 185,
+/* AlternateRepresentationSequence                                */ 236,
+/* MPRViewHeight                                                  */ 3185,
+/* RadionuclideHalfLife                                           */ 763,
+/* CodingSchemeRegistry                                           */ 112,
+/* NavigationDisplaySet                                           */ 3305,
+/* DoseReferenceStructureType                                     */ 3878,
+/* RTRecordFlag                                                   */ 4323,
+/* MRImagingModifierSequence                                      */ 1043,
+/* RTProtocolCodeSequence                                         */ 4575,
+/* MaximumCornealCurvatureLocation                                */ 2688,
+/* RetrieveURI                                                    */ 2578,
+/* WedgeCurve                                                     */ 549,
+/* PulserType                                                     */ 435,
+/* StereoPairsSequence                                            */ 1660,
+/* RangeModulatorGatingStopValue                                  */ 4208,
+/* CarrierIDAssigningAuthority                                    */ 4722,
+/* ConfigurationName                                              */ 2089,
+/* ManipulatedImage                                               */ 1924,
+/* OOISize                                                        */ 4709,
+/* RegisteredLocalizerUnits                                       */ 1769,
+/* ObjectiveLensPower                                             */ 2728,
+/* NumberOfPaddedALines                                           */ 2781,
+/* UserSelectedOffsetY                                            */ 506,
+/* AcquisitionDateTime                                            */ 61,
+/* DoseSummationType                                              */ 3697,
+/* PulseRepetitionInterval                                        */ 4129,
+/* ConceptualVolumeSegmentationReferenceSequence                  */ 4501,
+/* MaskSubPixelShift                                              */ 2074,
+/* StorageProtocolElementSpecificationSequence                    */ 1489,
+/* MilitaryRank                                                   */ 304,
+/* SpatialPresaturation                                           */ 1061,
+/* PatientReliabilityIndicator                                    */ 1848,
+/* DecayCorrection                                                */ 2844,
+/* MultiCoilConfiguration                                         */ 1076,
 /* ReferencedRTTreatmentPhaseIndex                                */ 4548,
-/* ReferencedRTTreatmentPhaseSequence                             */ 4557,
-/* ReferencedRadiationDoseIdentificationIndex                     */ 4279,
+/* LateralSpreadingDeviceNumber                                   */ 4180,
+/* DataSetVersion                                                 */ 1897,
+/* IncludeNonDICOMObjects                                         */ 3657,
+/* SetupImageComment                                              */ 4231,
+/* CorneaMeasurementsSequence                                     */ 2658,
+/* OphthalmicAxialLengthDataSourceCodeSequence                    */ 1736,
+/* DimensionIndexSequence                                         */ 1593,
+/* DerivationImplantTemplateSequence                              */ 2972,
+/* CompoundGraphicUnits                                           */ 3121,
 /* ReferencedRadiationGenerationModeIndex                         */ 4272,
-/* ReferencedRadiationRTControlPointIndex                         */ 4428,
-/* ReferencedRangeModulatorNumber                                 */ 4477,
-/* ReferencedRangeShifterNumber                                   */ 4475,
-/* ReferencedRawDataSequence                                      */ 244,
-/* ReferencedRealWorldValueMappingInstanceSequence                */ 177,
-/* ReferencedReferenceImageNumber                                 */ 4450,
-/* ReferencedReferenceImageSequence                               */ 4459,
-/* ReferencedRefractiveMeasurementsSequence                       */ 2675,
-/* ReferencedRelatedGeneralSOPClassUIDInFile                      */ 39,
-/* ReferencedRequestSequence                                      */ 2542,
-/* ReferencedResultsSequence                                      */ 165,
-/* ReferencedSOPClassUID                                          */ 178,
-/* ReferencedSOPClassUIDInFile                                    */ 36,
-/* ReferencedSOPInstanceMACSequence                               */ 3528,
-/* ReferencedSOPInstanceUID                                       */ 179,
-/* ReferencedSOPInstanceUIDInFile                                 */ 37,
-/* ReferencedSOPSequence                                          */ 193,
-/* ReferencedSamplePositions                                      */ 2504,
+/* TreatmentPositionSequence                                      */ 4329,
+/* SelectorSTValue                                                */ 3273,
+/* FunctionalSyncPulse                                            */ 1388,
+/* PatientSetupSequence                                           */ 4056,
+/* OphthalmicAxialLengthMethod                                    */ 1776,
+/* PatternOffOpacity                                              */ 3123,
+/* ReferencedPerformedProtocolSequence                            */ 1460,
+/* ReasonForCancellation                                          */ 3404,
+/* SpatialFrequencyResponseColumnNames                            */ 562,
+/* TwoDDegreeOfFreedomSequence                                    */ 3016,
+/* RTDiagnosisCodeSequence                                        */ 4577,
+/* PatientID                                                      */ 260,
+/* PixelIntensityRelationshipSign                                 */ 1995,
+/* DistalDepth                                                    */ 4256,
+/* SegmentedPropertyTypeCodeSequence                              */ 2886,
+/* BlendingLookupTableDescriptor                                  */ 2041,
+/* DisplayedAreaSelectionSequence                                 */ 3068,
+/* LargeRedPaletteColorLookupTableDescriptor                      */ 2010,
+/* PotentialReasonsForProcedureCodeSequence                       */ 1456,
+/* PixelSpacing                                                   */ 1919,
+/* LocalizedDeviationProbabilitySequence                          */ 1862,
+/* TwoDLineCoordinatesSequence                                    */ 3031,
+/* OtherPatientNames                                              */ 291,
+/* AssessedAttributeValueSequence                                 */ 3488,
+/* SourceOfRefractiveMeasurementsSequence                         */ 1733,
+/* PerformedProcedureStepID                                       */ 2303,
+/* ResponsiblePersonRole                                          */ 331,
+/* GPSDestDistanceRef                                             */ 650,
+/* DisplaySetHorizontalJustification                              */ 3349,
+/* VectorDimensionality                                           */ 2924,
+/* SeriesDate                                                     */ 56,
+/* InternationalRouteSegment                                      */ 4696,
+/* ProbeDriveEquipmentSequence                                    */ 493,
+/* RegistrationMethodCodeSequence                                 */ 3468,
+/* ContributingSOPInstancesReferenceSequence                      */ 1629,
+/* ModifiedImageDescription                                       */ 1564,
+/* SurfaceProcessing                                              */ 2905,
+/* DirectoryRecordSequence                                        */ 28,
+/* ReferringPhysicianName                                         */ 89,
+/* ThresholdSequence                                              */ 3226,
+/* SourceOfPreviousValues                                         */ 3539,
+/* AlphaPaletteColorLookupTableData                               */ 2018,
+/* BlindSpotXCoordinate                                           */ 1882,
+/* AllowMediaSplitting                                            */ 3656,
+/* ASLCrusherFlag                                                 */ 1190,
+/* FluenceDataScale                                               */ 3687,
+/* FlipAngle                                                      */ 847,
+/* TypeOfFilters                                                  */ 811,
+/* CoordinateSystemAxisDescription                                */ 401,
+/* RecommendedRotationPoint                                       */ 2994,
+/* WedgeName                                                      */ 534,
+/* DarkCurrentSequence                                            */ 421,
+/* CreationDate                                                   */ 3627,
+/* FractionPattern                                                */ 3917,
+/* TrackSetDescription                                            */ 2958,
+/* ReasonForOmissionDescription                                   */ 4480,
+/* FrameOfReferenceTransformationMatrix                           */ 3765,
+/* TreatmentTechniqueNotes                                        */ 4605,
+/* TemplateExtensionOrganizationUID                               */ 2571,
+/* NumberOfGraphicPoints                                          */ 3057,
 /* ReferencedSegmentNumber                                        */ 2882,
-/* ReferencedSegmentReferenceIndex                                */ 4516,
-/* ReferencedSeriesSequence                                       */ 168,
-/* ReferencedSetupImageSequence                                   */ 4230,
-/* ReferencedSourceApplicatorNumber                               */ 3845,
-/* ReferencedSourceNumber                                         */ 4455,
-/* ReferencedSpatialRegistrationSequence                          */ 3150,
-/* ReferencedStartControlPointIndex                               */ 4473,
-/* ReferencedStereometricInstanceSequence                         */ 172,
-/* ReferencedStopControlPointIndex                                */ 4474,
-/* ReferencedStorageMediaSequence                                 */ 3662,
-/* ReferencedStoredPrintSequence                                  */ 3569,
-/* ReferencedStructureSetSequence                                 */ 4463,
+/* XRay3DReconstructionSequence                                   */ 1357,
+/* EnergyWindowLowerLimit                                         */ 2788,
+/* ParticipantSequence                                            */ 2485,
+/* DICOMStorageSequence                                           */ 2439,
+/* Contrast                                                       */ 613,
+/* FillerOrderNumberImagingServiceRequest                         */ 2398,
+/* RTBeamLimitingDeviceType                                       */ 3944,
+/* SurfaceModelDescriptionSequence                                */ 2997,
+/* MultipleComponentApprovalSequence                              */ 380,
+/* PaletteColorLookupTableSequence                                */ 2730,
+/* NumberOfVectors                                                */ 2923,
+/* DocumentAuthorTrial                                            */ 2477,
+/* EthicsCommitteeApprovalEffectivenessStartDate                  */ 357,
+/* FractionBasedRelationshipSequence                              */ 4613,
+/* ReferencedReferenceImageNumber                                 */ 4450,
+/* FrameOfReferenceTransformationMatrixType                       */ 3134,
+/* BlockNumberOfPoints                                            */ 4006,
+/* ContextIdentifier                                              */ 110,
+/* DerivationImplantAssemblyTemplateSequence                      */ 3431,
+/* CompensatorColumns                                             */ 3983,
+/* VisualFieldHorizontalExtent                                    */ 1805,
+/* LateralSpreadingDeviceType                                     */ 4182,
+/* ChannelSensitivity                                             */ 2237,
+/* GridDimensions                                                 */ 2896,
+/* NumberofBscansPerFrame                                         */ 1797,
+/* MagnificationType                                              */ 3576,
+/* RoboticPathControlPointSequence                                */ 4628,
+/* ALinesPerFrame                                                 */ 2767,
+/* CorrectedLocalizedDeviationFromNormal                          */ 1858,
+/* WindowCenterWidthExplanation                                   */ 2001,
+/* ScatterCorrected                                               */ 1420,
+/* TwoDLineCoordinates                                            */ 3032,
+/* SpectroscopyData                                               */ 4785,
+/* XRayAcquisitionDoseSequence                                    */ 1361,
+/* ImagesInSeries                                                 */ 1544,
+/* PseudoColorType                                                */ 3342,
+/* AttributeOccurrenceSequence                                    */ 3387,
+/* AcquisitionMotion                                              */ 1484,
 /* ReferencedStructuredContextSequence                            */ 3207,
-/* ReferencedStudySequence                                        */ 166,
-/* ReferencedSurfaceDataSequence                                  */ 3478,
-/* ReferencedSurfaceMeshIdentificationSequence                    */ 1790,
-/* ReferencedSurfaceNumber                                        */ 2936,
-/* ReferencedSurfaceSequence                                      */ 2935,
-/* ReferencedTDRInstanceSequence                                  */ 4740,
-/* ReferencedTargetLuminanceCharacteristicsID                     */ 2091,
-/* ReferencedTextureSequence                                      */ 3477,
-/* ReferencedTimeOffsets                                          */ 2506,
-/* ReferencedToleranceTableNumber                                 */ 4466,
-/* ReferencedTransferSyntaxUIDInFile                              */ 38,
-/* ReferencedTreatmentPositionIndex                               */ 4278,
-/* ReferencedTreatmentRecordSequence                              */ 3782,
-/* ReferencedVOILUTBoxSequence                                    */ 3606,
-/* ReferencedVerificationImageSequence                            */ 4458,
-/* ReferencedVisitSequence                                        */ 170,
-/* ReferencedWaveformChannels                                     */ 2494,
-/* ReferencedWaveformSequence                                     */ 173,
-/* ReferencedWedgeNumber                                          */ 4468,
-/* ReferencedXRayDetectorIndex                                    */ 1270,
+/* TimeDistributionProtocol                                       */ 906,
+/* ChannelMaximumValue                                            */ 4779,
+/* FrameTime                                                      */ 748,
+/* BrachyTreatmentType                                            */ 4084,
+/* ExtendedCodeValue                                              */ 96,
+/* TemplateNumber                                                 */ 4108,
+/* BlendingLUT2Sequence                                           */ 2044,
+/* ReferencedFileID                                               */ 34,
+/* DataPathAssignment                                             */ 2036,
+/* XCoordinatesCenterPixelViewAngle                               */ 1782,
+/* LensConstantDescription                                        */ 1714,
+/* ReceiveCoilManufacturerName                                    */ 1071,
+/* GPSDateStamp                                                   */ 654,
+/* MeasuringUnitsSequence                                         */ 2314,
+/* LuminanceCharacteristicsID                                     */ 2086,
+/* ScheduledProcedureStepStatus                                   */ 2283,
+/* SceneType                                                      */ 605,
+/* SettlingPhaseFrame                                             */ 1389,
+/* SeriesDescriptionCodeSequence                                  */ 151,
+/* RelationshipTypeCodeSequenceTrial                              */ 2563,
+/* RadiationDoseIdentificationLabel                               */ 4292,
+/* AssessedSOPInstanceSequence                                    */ 3481,
+/* StoredValueColorRangeSequence                                  */ 2027,
+/* WedgeOffsetZ                                                   */ 531,
+/* TrackingUID                                                    */ 2892,
+/* PerformedSeriesSequence                                        */ 2332,
+/* KSpaceFiltering                                                */ 1091,
+/* CalculatedTargetPosition                                       */ 920,
+/* RecordedChannelSequence                                        */ 3837,
+/* SurfaceEntryPoint                                              */ 4036,
+/* TwoDPlaneCoordinatesSequence                                   */ 3034,
+/* RequestingPhysicianIdentificationSequence                      */ 2167,
+/* UniversalEntityIDType                                          */ 2288,
 /* ReferencedXRaySourceIndex                                      */ 1271,
-/* ReferringPhysicianAddress                                      */ 90,
-/* ReferringPhysicianIdentificationSequence                       */ 92,
-/* ReferringPhysicianName                                         */ 89,
-/* ReferringPhysicianTelephoneNumbers                             */ 91,
-/* ReflectedAmbientLight                                          */ 3591,
-/* ReformattingInterval                                           */ 3334,
+/* PixelComponentRangeStart                                       */ 985,
+/* PositionerPrimaryAngleDirection                                */ 1378,
+/* SecondaryPositionerIncrement                                   */ 1347,
+/* NominalRangeModulatedRegionDepths                              */ 4258,
+/* ViewOrientationCodeSequence                                    */ 2985,
+/* PerformedStationGeographicLocationCodeSequence                 */ 2425,
+/* LargeGreenPaletteColorLookupTableDescriptor                    */ 2011,
+/* OverlayBitPosition                                             */ 4804,
+/* BasicGrayscaleImageSequence                                    */ 3603,
+/* ContainerIdentifier                                            */ 2338,
+/* TransmitCoilType                                               */ 1081,
+/* ShortTermFluctuationProbabilityCalculated                      */ 1855,
+/* ROIElementalCompositionSequence                                */ 3758,
+/* FrameReferenceDateTime                                         */ 1137,
+/* CurrentFractionNumber                                          */ 3776,
+/* Saturation                                                     */ 614,
+/* ImplantTemplateGroupMemberMatching2DCoordinatesSequence        */ 3458,
+/* DateOfDocumentOrVerbalTransactionTrial                         */ 2495,
+/* OriginalImplantAssemblyTemplateSequence                        */ 3430,
+/* CodingSchemeDesignator                                         */ 97,
+/* AttenuationCorrectionMethod                                    */ 2843,
+/* SpectralWidth                                                  */ 1082,
+/* CoordinateSystemTransformTranslationMatrix                     */ 413,
+/* OverlaysGreen                                                  */ 4818,
+/* BlendingWeightConstant                                         */ 2040,
+/* BeamDosePointSourceToExternalContourDistance                   */ 3935,
+/* ScheduledDischargeDate                                         */ 2202,
+/* DistanceSourceToDataCollectionCenter                           */ 1235,
+/* PregnancyStatus                                                */ 318,
+/* PatientPhysiologicalStateSequence                              */ 1431,
+/* SeriesNumber                                                   */ 1512,
+/* VariablePixelData                                              */ 4834,
+/* TimeOfDocumentCreationOrVerbalTransactionTrial                 */ 2496,
+/* ReportStatusIDTrial                                            */ 2502,
+/* HorizontalPrismBase                                            */ 2626,
+/* EthnicGroup                                                    */ 314,
+/* RadiationBeamBlockSlabThickness                                */ 4376,
+/* ViewingDistanceType                                            */ 2671,
+/* InterventionStatus                                             */ 680,
+/* AbortFlag                                                      */ 4692,
+/* NumberOfRangeModulators                                        */ 4185,
+/* ChannelDeliveryOrderIndex                                      */ 3422,
+/* MemoryAllocation                                               */ 3555,
+/* OtherFailuresSequence                                          */ 194,
+/* ExposureTimeInSeconds                                          */ 554,
+/* CenterOfCircularCollimator                                     */ 901,
+/* MeasurementFunctions                                           */ 2096,
+/* AnteriorChamberDepthSequence                                   */ 1725,
+/* VolumeCroppingSequence                                         */ 3169,
+/* RespiratorySignalSource                                        */ 1145,
+/* SpectrallySelectedSuppression                                  */ 1059,
+/* SourceApplicatorNumber                                         */ 4130,
+/* GPSDestBearingRef                                              */ 648,
+/* RadiationBeamWedgeThinEdgeDistance                             */ 4349,
+/* InConcatenationNumber                                          */ 1583,
+/* ReasonForPerformedProcedureCodeSequence                        */ 2381,
+/* ConceptNameCodeSequence                                        */ 2471,
+/* ImplantSize                                                    */ 2968,
+/* PresentationLUTContentSequence                                 */ 3647,
+/* ReferencedStructureSetSequence                                 */ 4463,
+/* ImageBoxNumber                                                 */ 3308,
+/* NameOfPhysiciansReadingStudy                                   */ 158,
+/* PatientDeathDateInAlternativeCalendar                          */ 270,
+/* RouteIDAssigningAuthority                                      */ 4719,
+/* ExpectedCompletionDateTime                                     */ 2411,
+/* PerformedLocation                                              */ 2297,
+/* DetectorConfiguration                                          */ 999,
+/* LeftImageSequence                                              */ 1661,
+/* DefinitionSourceSequence                                       */ 180,
+/* ExcessiveFalseNegatives                                        */ 1831,
+/* ElementPitchA                                                  */ 448,
+/* SpatialFrequencyResponseColumns                                */ 561,
+/* DarkCurrentCounts                                              */ 422,
+/* PointsBoundingBoxCoordinates                                   */ 2920,
+/* ClinicalTrialSiteID                                            */ 338,
+/* GPSAltitude                                                    */ 631,
+/* ModelModification                                              */ 3038,
+/* RealWorldValueLastValueMapped                                  */ 2450,
+/* ApplicationSetupSequence                                       */ 4103,
+/* ConvolutionKernelGroup                                         */ 1217,
+/* PlaneOrientationVolumeSequence                                 */ 1620,
+/* ScatterCorrectionMethod                                        */ 2847,
+/* FrameAnatomySequence                                           */ 1570,
+/* AlgorithmFamilyCodeSequence                                    */ 2939,
+/* SeriesType                                                     */ 2837,
+/* ReferencedSamplePositions                                      */ 2504,
+/* VolumetricProperties                                           */ 249,
+/* RegisteredLocalizerTopLeftHandCorner                           */ 1770,
+/* FluenceMapSequence                                             */ 3685,
+/* ImagingServiceRequestComments                                  */ 2399,
+/* FilterByOperator                                               */ 3322,
+/* MinimumNominalEnergy                                           */ 4395,
+/* ReferencedBrachyAccessoryDeviceNumber                          */ 3836,
+/* PatientAlternativeCalendar                                     */ 271,
+/* ReferencedTargetLuminanceCharacteristicsID                     */ 2091,
+/* TargetFrameOfReferenceUID                                      */ 1477,
+/* SetupDeviceLabel                                               */ 4076,
+/* ExtendedOffsetTable                                            */ 4826,
+/* MappingResourceName                                            */ 121,
+/* PatientAge                                                     */ 294,
+/* ImageIndex                                                     */ 2862,
+/* BeamLimitingDeviceAngleTolerance                               */ 3899,
+/* LowRRValue                                                     */ 769,
+/* TableMotion                                                    */ 786,
+/* EnergyWindowInformationSequence                                */ 2786,
+/* OphthalmicAxialLengthMeasurementsSegmentalLengthSequence       */ 1741,
+/* TotalCompensatorTrayWaterEquivalentThickness                   */ 4155,
+/* GeneralizedDefectCorrectedSensitivityDeviationFlag             */ 1877,
+/* CalibrationDataSequence                                        */ 2829,
+/* NumberOfRTBeamLimitingDeviceOpenings                           */ 4353,
+/* StartRelativeDensityDifferenceThreshold                        */ 1392,
+/* DecouplingFrequency                                            */ 1088,
+/* DeadTimeFactor                                                 */ 2861,
+/* VisualFieldTestDuration                                        */ 1865,
+/* WedgeModelNumber                                               */ 525,
+/* SelectorUNValue                                                */ 3272,
+/* ContentDate                                                    */ 58,
+/* ContrastBolusIngredient                                        */ 742,
+/* RecordedLateralSpreadingDeviceSequence                         */ 3829,
+/* RadiusOfCurvature                                              */ 2644,
+/* CertifiedTimestampType                                         */ 3523,
+/* DateOfSecondaryCapture                                         */ 722,
+/* RefractiveStateSequence                                        */ 1656,
+/* NumberOfFractionsPlanned                                       */ 3914,
+/* DiffusionDirectionality                                        */ 1099,
+/* MeasurementEquipmentType                                       */ 2097,
+/* DoseValuePurpose                                               */ 4296,
+/* ClinicalFractionNumber                                         */ 4410,
+/* ApplicatorOpening                                              */ 4243,
+/* ExcessiveFalseNegativesDataFlag                                */ 1830,
+/* DetectorActiveTime                                             */ 1008,
+/* WaterEquivalentDiameterCalculationMethodCodeSequence           */ 841,
+/* RangeModulatorID                                               */ 4188,
+/* NumberOfPhaseEncodingSteps                                     */ 703,
+/* ControlPointIndex                                              */ 4016,
+/* PlanningLandmarkIdentificationCodeSequence                     */ 3027,
+/* DimensionDescriptionLabel                                      */ 1625,
+/* PatientSupportAngleTolerance                                   */ 3903,
+/* TreatmentTime                                                  */ 3864,
+/* OriginatingSOPInstanceReferenceSequence                        */ 4491,
+/* ScanSpotMetersetsDelivered                                     */ 3795,
+/* RouteSegmentStartTime                                          */ 4693,
+/* RadiationDosimeterUnitSequence                                 */ 4354,
+/* ReferencedRadiationRTControlPointIndex                         */ 4428,
+/* ImplantTemplateGroupVariationDimensionRank                     */ 3465,
+/* GlobalCrop                                                     */ 3166,
+/* NumberOfPatientRelatedSeries                                   */ 1553,
+/* IsocenterToLateralSpreadingDeviceDistance                      */ 4205,
+/* TreatmentPositionGroupLabel                                    */ 4275,
+/* BrachyAccessoryDeviceID                                        */ 4114,
+/* ShieldingDeviceLabel                                           */ 4069,
+/* UnassignedSharedConvertedAttributesSequence                    */ 1588,
+/* RadiationMachineName                                           */ 3676,
+/* UVMappingSequence                                              */ 3473,
+/* WorklistLabel                                                  */ 3393,
+/* CompletionFlagDescription                                      */ 2552,
+/* DVHDoseScaling                                                 */ 3706,
+/* DoseComment                                                    */ 3695,
+/* NumberOfBrachyApplicationSetups                                */ 3936,
+/* MydriaticAgentCodeSequence                                     */ 1657,
+/* FieldOfViewRotation                                            */ 1019,
+/* OverlaySubtype                                                 */ 4792,
+/* ScanProcedure                                                  */ 510,
+/* DecoupledNucleus                                               */ 1087,
+/* PositionerSecondaryAngle                                       */ 871,
+/* TMLinePositionY1                                               */ 982,
+/* PatientPositioningInstructionSequence                          */ 1474,
+/* InterpretationApproverSequence                                 */ 4647,
+/* AfterloaderChannelID                                           */ 4121,
+/* AttributeItemSelector                                          */ 3389,
+/* RowOverlap                                                     */ 1943,
+/* DeviceTypeCodeSequence                                         */ 4530,
+/* CoatingMaterialsCodeSequence                                   */ 3001,
+/* SynchronizedScrollingSequence                                  */ 3302,
+/* ContrastBolusTotalDose                                         */ 738,
+/* SystemStatus                                                   */ 2083,
+/* EventTimeOffset                                                */ 210,
+/* PositionMeasuringDeviceUsed                                    */ 1442,
+/* OphthalmicFrameLocationSequence                                */ 1665,
+/* NumberOfTriggersInPhase                                        */ 2823,
+/* ImplantRegulatoryDisapprovalCodeSequence                       */ 2980,
+/* HorizontalFieldOfView                                          */ 1642,
+/* FilterLowFrequency                                             */ 2245,
+/* SubjectLocation                                                */ 601,
+/* ConceptualVolumeOptimizationPrecedence                         */ 4586,
+/* AssignedLocation                                               */ 4698,
+/* WideFieldOphthalmicPhotographyQualityRatingSequence            */ 1779,
+/* CompressionRecognitionCode                                     */ 1926,
+/* SpectroscopyAcquisitionOutOfPlanePhaseSteps                    */ 1140,
+/* ObservationCategoryCodeSequenceTrial                           */ 2512,
+/* GantryPitchAngleTolerance                                      */ 4049,
+/* InstructionIndex                                               */ 1468,
+/* ReferencedFrameOfReferenceUID                                  */ 3727,
+/* CoordinateSystemAxisType                                       */ 404,
+/* SliceLocationVector                                            */ 912,
+/* RTRadiationSetIntent                                           */ 4321,
+/* PriorTreatmentReferenceSequence                                */ 4582,
+/* OverlayDescriptorRed                                           */ 4813,
+/* PulseWidth                                                     */ 457,
+/* ControlPointDeliverySequence                                   */ 3789,
+/* MultiCoilElementName                                           */ 1077,
+/* ReceiveTransducerSettingsSequence                              */ 473,
+/* CardiacBeatRejectionTechnique                                  */ 1143,
+/* WhiteBalance                                                   */ 608,
+/* MultipleCopiesFlag                                             */ 2406,
+/* MaterialID                                                     */ 3976,
+/* SelectorUSValue                                                */ 3283,
+/* FrameOfInterestDescription                                     */ 2065,
+/* TickLabelAlignment                                             */ 3120,
+/* Radiopharmaceutical                                            */ 673,
+/* PlacerOrderNumberImagingServiceRequestRetired                  */ 2391,
+/* PrimaryFluenceModeSequence                                     */ 3688,
+/* ContrastFrameAveraging                                         */ 2073,
+/* HeadFixationAngleTolerance                                     */ 4052,
+/* NumberOfFrames                                                 */ 1911,
+/* MeasuredBeamDimensionB                                         */ 450,
+/* PatientBreedCodeSequence                                       */ 326,
+/* MPRViewHeightDirection                                         */ 3184,
+/* SourceAcquisitionBeamNumber                                    */ 1493,
+/* StudyComponentStatusID                                         */ 2175,
+/* PixelPresentation                                              */ 248,
+/* InterMarkerDistance                                            */ 2750,
+/* BeamDoseVerificationControlPointSequence                       */ 3927,
+/* NumberOfSurfaces                                               */ 2901,
+/* DataCollectionCenterPatient                                    */ 1214,
+/* NominalMaxEnergy                                               */ 1268,
+/* UnifiedProcedureStepPerformedProcedureSequence                 */ 3397,
+/* LossyImageCompression                                          */ 2051,
+/* TransducerGeometryCodeSequence                                 */ 1443,
+/* FillerOrderNumberImagingServiceRequestRetired                  */ 2392,
+/* InboundArrivalType                                             */ 4720,
+/* ShutterPresentationValue                                       */ 884,
+/* OutlineUpperHorizontalEdge                                     */ 890,
+/* ThresholdType                                                  */ 3228,
+/* TelephoneNumberTrial                                           */ 2539,
+/* CountRate                                                      */ 834,
+/* SensitivityType                                                */ 576,
+/* ImageFilter                                                    */ 1221,
+/* CommentsOnRadiationDose                                        */ 2323,
+/* ContrastBolusStopTime                                          */ 737,
+/* CTPositionSequence                                             */ 1227,
+/* MaterialPropertiesDescription                                  */ 367,
+/* SubtractionItemID                                              */ 2136,
+/* DoubleFloatPixelPaddingValue                                   */ 1960,
+/* ChemicalShiftMinimumIntegrationLimitInHz                       */ 1161,
+/* WaveformPaddingValue                                           */ 4782,
+/* TwoDMatingPoint                                                */ 3014,
+/* CornealSize                                                    */ 2633,
+/* ItemNumber                                                     */ 1520,
+/* BottomRightHandCornerOfLocalizerArea                           */ 2733,
+/* ReferenceLocationLabel                                         */ 1447,
+/* NotificationFromManufacturerSequence                           */ 2977,
+/* SourceOfCorneaMeasurementDataCodeSequence                      */ 2659,
+/* DoseValue                                                      */ 3701,
+/* VolumetricPresentationInputIndex                               */ 3201,
+/* HangingProtocolCreator                                         */ 3233,
+/* TableHeadTiltAngle                                             */ 1332,
+/* BreastSupportZPositionToIsocenter                              */ 1368,
+/* MedicalAlerts                                                  */ 308,
+/* TableXPositionToIsocenter                                      */ 1328,
+/* ToricIOLPowerSequence                                          */ 1700,
+/* SpecimenSequence                                               */ 2344,
+/* TotalWedgeTrayWaterEquivalentThickness                         */ 3967,
+/* HuffmanTableSize                                               */ 3544,
+/* ComponentSequence                                              */ 3439,
+/* CalculatedFrameList                                            */ 184,
+/* TemplateExtensionCreatorUID                                    */ 2572,
+/* PixelComponentMask                                             */ 984,
+/* ExposureModulationType                                         */ 1224,
+/* EffectiveEchoTime                                              */ 1106,
+/* ManufacturerModelName                                          */ 164,
+/* ApplicatorSequence                                             */ 4008,
+/* DosimetricObjectiveWeight                                      */ 4599,
+/* DistanceSourceToDetector                                       */ 779,
+/* ProbeCenterLocationZ                                           */ 479,
+/* ShutterShape                                                   */ 876,
+/* PositionerPrimaryAngle                                         */ 870,
+/* PhosphorType                                                   */ 839,
+/* CurrentConfigurationID                                         */ 2079,
+/* ImageBoxTileHorizontalDimension                                */ 3310,
+/* GPSTrackRef                                                    */ 639,
+/* PrimaryChromaticities                                          */ 552,
+/* TrackSetStatisticsSequence                                     */ 2961,
+/* ExclusiveComponentType                                         */ 3437,
+/* DACSequence                                                    */ 466,
 /* ReformattingOperationInitialViewDirection                      */ 3335,
-/* ReformattingOperationType                                      */ 3332,
-/* ReformattingThickness                                          */ 3333,
-/* RefractiveErrorBeforeRefractiveSurgeryCodeSequence             */ 1720,
-/* RefractiveIndexApplied                                         */ 2783,
-/* RefractiveIndexOfAqueousHumor                                  */ 2666,
-/* RefractiveIndexOfCornea                                        */ 2665,
-/* RefractiveParametersUsedOnPatientSequence                      */ 1885,
-/* RefractivePower                                                */ 2705,
-/* RefractiveProcedureOccurred                                    */ 1695,
-/* RefractiveStateSequence                                        */ 1656,
-/* RefractiveSurgeryTypeCodeSequence                              */ 1696,
-/* RegionDataType                                                 */ 952,
-/* RegionFlags                                                    */ 953,
-/* RegionLocationMaxX1                                            */ 956,
-/* RegionLocationMaxY1                                            */ 957,
-/* RegionLocationMinX0                                            */ 954,
-/* RegionLocationMinY0                                            */ 955,
-/* RegionOfResidence                                              */ 311,
-/* RegionPixelShiftSequence                                       */ 2146,
-/* RegionSpatialFormat                                            */ 951,
-/* RegisteredLocalizerBottomRightHandCorner                       */ 1771,
-/* RegisteredLocalizerTopLeftHandCorner                           */ 1770,
-/* RegisteredLocalizerUnits                                       */ 1769,
-/* RegistrationMethodCodeSequence                                 */ 3468,
-/* RegistrationSequence                                           */ 3130,
-/* RegistrationToLocalizerSequence                                */ 1768,
-/* RegistrationTypeCodeSequence                                   */ 3135,
-/* RelatedAssertionSequence                                       */ 2615,
-/* RelatedFrameOfReferenceUID                                     */ 3763,
-/* RelatedGeneralSOPClassUID                                      */ 53,
-/* RelatedProcedureStepSequence                                   */ 3398,
-/* RelatedRTROIObservationsSequence                               */ 3752,
-/* RelatedRTTreatmentPhaseIndex                                   */ 4547,
-/* RelatedReferenceRTImageSequence                                */ 3379,
-/* RelatedSegmentCharacteristicsSequence                          */ 4524,
-/* RelatedSeriesSequence                                          */ 196,
-/* RelationshipSequenceTrial                                      */ 2562,
-/* RelationshipType                                               */ 2459,
-/* RelationshipTypeCodeSequenceTrial                              */ 2563,
-/* RelativeElevation                                              */ 2706,
-/* RelativeImagePositionCodeSequence                              */ 1658,
-/* RelativeOpacity                                                */ 3149,
-/* RelativeTime                                                   */ 3248,
-/* RelativeTimeUnits                                              */ 3249,
-/* RelativeURIReferenceWithinEncapsulatedDocument                 */ 3042,
-/* RelativeXRayExposure                                           */ 857,
-/* RelevantInformationSequence                                    */ 2418,
-/* RelevantOPTAttributesSequence                                  */ 1773,
-/* RenderFieldOfView                                              */ 3190,
-/* RenderProjection                                               */ 3186,
-/* RenderedImageReferenceSequence                                 */ 3155,
-/* RenderingMethod                                                */ 3168,
-/* RepairID                                                       */ 379,
-/* RepeatFractionCycleLength                                      */ 3916,
-/* RepeatInterval                                                 */ 1933,
-/* RepetitionTime                                                 */ 694,
-/* ReplacedImplantAssemblyTemplateSequence                        */ 3428,
-/* ReplacedImplantTemplateGroupSequence                           */ 3452,
-/* ReplacedImplantTemplateSequence                                */ 2970,
-/* ReplacedProcedureStepSequence                                  */ 3400,
-/* ReportDetailSequenceTrial                                      */ 2545,
-/* ReportNumber                                                   */ 1535,
-/* ReportProductionStatusTrial                                    */ 4637,
-/* ReportStatusCommentTrial                                       */ 2535,
-/* ReportStatusIDTrial                                            */ 2502,
-/* ReportedValuesOrigin                                           */ 3669,
-/* ReportingPriority                                              */ 2377,
-/* RepositoryUniqueID                                             */ 2586,
-/* RepresentativeFrameNumber                                      */ 2063,
-/* ReprojectionMethod                                             */ 2840,
-/* RequestAttributesSequence                                      */ 2309,
-/* RequestPriority                                                */ 3665,
-/* RequestedContrastAgent                                         */ 2180,
-/* RequestedDecimateCropBehavior                                  */ 3599,
-/* RequestedImageSize                                             */ 3598,
-/* RequestedImageSizeFlag                                         */ 3601,
-/* RequestedMediaApplicationProfile                               */ 3661,
-/* RequestedProcedureCodeSequence                                 */ 2177,
-/* RequestedProcedureComments                                     */ 2387,
-/* RequestedProcedureDescription                                  */ 2176,
-/* RequestedProcedureDescriptionTrial                             */ 2382,
-/* RequestedProcedureID                                           */ 2369,
-/* RequestedProcedureLocation                                     */ 2373,
-/* RequestedProcedurePriority                                     */ 2371,
-/* RequestedResolutionID                                          */ 3600,
-/* RequestedSeriesDescription                                     */ 1491,
-/* RequestedSubsequentWorkitemCodeSequence                        */ 2426,
-/* RequestingAE                                                   */ 3403,
-/* RequestingPhysician                                            */ 2168,
-/* RequestingPhysicianIdentificationSequence                      */ 2167,
-/* RequestingService                                              */ 2169,
-/* RequestingServiceCodeSequence                                  */ 2170,
-/* RescaleIntercept                                               */ 1998,
-/* RescaleSlope                                                   */ 1999,
-/* RescaleType                                                    */ 2000,
-/* ResidualSyringeCounts                                          */ 2791,
-/* ResonantNucleus                                                */ 1120,
-/* ResourceDescription                                            */ 2218,
-/* RespiratoryCyclePosition                                       */ 1167,
-/* RespiratoryIntervalTime                                        */ 1606,
-/* RespiratoryMotionCompensationTechnique                         */ 1144,
-/* RespiratoryMotionCompensationTechniqueDescription              */ 1159,
-/* RespiratorySignalSource                                        */ 1145,
-/* RespiratorySignalSourceID                                      */ 1160,
-/* RespiratorySynchronizationSequence                             */ 1605,
-/* RespiratoryTriggerDelayThreshold                               */ 1608,
-/* RespiratoryTriggerType                                         */ 1602,
-/* ResponsibleGroupCodeSequence                                   */ 126,
-/* ResponsibleOrganization                                        */ 332,
-/* ResponsiblePerson                                              */ 330,
-/* ResponsiblePersonRole                                          */ 331,
-/* ResultingGeneralPurposePerformedProcedureStepsSequence         */ 2412,
-/* ResultsComments                                                */ 4661,
-/* ResultsDistributionListSequence                                */ 4653,
-/* ResultsID                                                      */ 4634,
-/* ResultsIDIssuer                                                */ 4635,
-/* ResultsNormalsSequence                                         */ 1843,
-/* RetestSensitivityValue                                         */ 1873,
-/* RetestStimulusSeen                                             */ 1872,
-/* RetinalThicknessDefinitionCodeSequence                         */ 1761,
-/* RetrieveAETitle                                                */ 75,
-/* RetrieveLocationUID                                            */ 2579,
-/* RetrieveURI                                                    */ 2578,
-/* RetrieveURL                                                    */ 188,
-/* ReviewDate                                                     */ 4482,
-/* ReviewTime                                                     */ 4483,
+/* BlendingMode                                                   */ 3223,
+/* ThreatROIBitmap                                                */ 4668,
+/* VisualAcuityMeasurementSequence                                */ 1884,
+/* ScreenMinimumGrayscaleBitDepth                                 */ 3293,
+/* SyringeCounts                                                  */ 739,
+/* RadiationDoseValue                                             */ 4304,
+/* InterpretationTypeID                                           */ 4658,
+/* ActiveSourceLength                                             */ 4091,
+/* IndicationNumber                                               */ 391,
+/* ConversionSourceAttributesSequence                             */ 1590,
+/* DoubleExposureOrdering                                         */ 3376,
+/* OrganAtRiskOverdoseVolumeFraction                              */ 3894,
+/* BulkMotionSignalSource                                         */ 1147,
+/* TMLinePositionY0Retired                                        */ 977,
+/* RadiationDeviceConfigurationAndCommissioningKeySequence        */ 4356,
+/* ApertureElevation                                              */ 521,
+/* OverlayRows                                                    */ 4786,
+/* ChannelTotalTime                                               */ 4126,
+/* ASLPulseTrainDuration                                          */ 1189,
+/* ReferencedTimeOffsets                                          */ 2506,
+/* SkipFrameRangeFlag                                             */ 258,
+/* TargetPositionReferenceIndicator                               */ 1548,
+/* TMLinePositionX1                                               */ 980,
+/* GantryPitchRotationDirection                                   */ 4048,
+/* PatientSize                                                    */ 295,
+/* CArmPositionerTabletopRelationship                             */ 1336,
+/* GraphicData                                                    */ 3058,
+/* CollimatorLeftVerticalEdge                                     */ 897,
+/* GeneticModificationsDescription                                */ 287,
+/* FiducialSetSequence                                            */ 3144,
+/* ReconstructionProtocolElementSpecificationSequence             */ 1487,
+/* AlgorithmDescriptionTrial                                      */ 2528,
+/* PatientSupportType                                             */ 4192,
+/* SpecimenLocalizationContentItemSequence                        */ 2358,
+/* InstanceCoercionDateTime                                       */ 50,
+/* AnatomicLocationOfExaminingInstrumentCodeSequenceTrial         */ 233,
+/* MinimumHoursBetweenFractions                                   */ 4615,
+/* PlanningLandmarkID                                             */ 3025,
+/* RecommendedDisplayFrameRateInFloat                             */ 257,
+/* CodingSchemeIdentificationSequence                             */ 111,
 /* ReviewerName                                                   */ 4484,
-/* RevolutionTime                                                 */ 1206,
-/* RightImageSequence                                             */ 1662,
-/* RightLensSequence                                              */ 2620,
-/* RoboticBaseLocationIndicator                                   */ 4621,
-/* RoboticNodeIdentifier                                          */ 4623,
-/* RoboticPathControlPointSequence                                */ 4628,
-/* RoboticPathNodeSetCodeSequence                                 */ 4622,
-/* RotationAngle                                                  */ 3092,
-/* RotationDirection                                              */ 792,
-/* RotationInformationSequence                                    */ 2805,
-/* RotationOfScannedFilm                                          */ 916,
-/* RotationOffset                                                 */ 798,
-/* RotationPoint                                                  */ 3117,
-/* RotationVector                                                 */ 2803,
-/* RouteID                                                        */ 4718,
-/* RouteIDAssigningAuthority                                      */ 4719,
-/* RouteOfAdmissions                                              */ 2199,
-/* RouteSegmentEndLocationID                                      */ 4688,
-/* RouteSegmentEndTime                                            */ 4694,
-/* RouteSegmentID                                                 */ 4669,
-/* RouteSegmentLocationIDType                                     */ 4689,
-/* RouteSegmentSequence                                           */ 4672,
-/* RouteSegmentStartLocationID                                    */ 4687,
-/* RouteSegmentStartTime                                          */ 4693,
-/* RowOverlap                                                     */ 1943,
-/* RowPositionInTotalImagePixelMatrix                             */ 2737,
-/* Rows                                                           */ 1914,
-/* RowsForNthOrderCoefficients                                    */ 1974,
-/* RunLengthTriplet                                               */ 3543,
-/* SAR                                                            */ 849,
-/* SCPStatus                                                      */ 3405,
-/* SNRThreshold                                                   */ 4737,
-/* SOPAuthorizationComment                                        */ 3512,
-/* SOPAuthorizationDateTime                                       */ 3511,
-/* SOPClassUID                                                    */ 51,
-/* SOPClassesInStudy                                              */ 81,
-/* SOPClassesSupported                                            */ 181,
-/* SOPInstanceStatus                                              */ 3510,
-/* SOPInstanceUID                                                 */ 52,
-/* SOPInstanceUIDOfConcatenationSource                            */ 1540,
+/* IOLManufacturer                                                */ 1713,
+/* RTAccessoryHolderSlotDistance                                  */ 4285,
+/* IssuerOfPatientIDQualifiersSequence                            */ 263,
+/* ProcedureStepCancellationDateTime                              */ 2437,
+/* OtherPatientIDsSequence                                        */ 292,
+/* DosimetricObjectiveSequence                                    */ 4592,
+/* ImagedVolumeHeight                                             */ 2709,
+/* VerbalSourceIdentifierCodeSequenceTrial                        */ 2540,
+/* ConceptualVolumeCombinationFlag                                */ 4498,
+/* FillPattern                                                    */ 3112,
+/* BlockThickness                                                 */ 4004,
+/* NumberOfStages                                                 */ 202,
+/* BackgroundColor                                                */ 2648,
+/* DetectorGeometrySequence                                       */ 4664,
+/* NumberOfRTControlPoints                                        */ 4271,
+/* EntityLongLabel                                                */ 4540,
+/* PreAmplifierNotes                                              */ 441,
+/* ReferencedStartControlPointIndex                               */ 4473,
+/* ReasonForTheImagingServiceRequest                              */ 2388,
 /* STOWRSStorageSequence                                          */ 2440,
-/* SUVType                                                        */ 2841,
-/* SafePositionExitDate                                           */ 3849,
-/* SafePositionExitTime                                           */ 3850,
-/* SafePositionReturnDate                                         */ 3851,
-/* SafePositionReturnTime                                         */ 3852,
-/* SampleRate                                                     */ 4767,
-/* SamplesPerPixel                                                */ 1906,
-/* SamplesPerPixelUsed                                            */ 1907,
-/* SamplingFrequency                                              */ 2227,
-/* SamplingStepSize                                               */ 3191,
-/* Saturation                                                     */ 614,
-/* SaturationRecovery                                             */ 1058,
-/* ScanArc                                                        */ 795,
-/* ScanLength                                                     */ 844,
-/* ScanMode                                                       */ 4166,
-/* ScanOptions                                                    */ 663,
-/* ScanPatternTypeCodeSequence                                    */ 1789,
-/* ScanProcedure                                                  */ 510,
-/* ScanProgressionDirection                                       */ 2836,
-/* ScanSpotMetersetWeights                                        */ 4219,
-/* ScanSpotMetersetsDelivered                                     */ 3795,
-/* ScanSpotPositionMap                                            */ 4217,
-/* ScanSpotPrescribedIndices                                      */ 4214,
-/* ScanSpotReordered                                              */ 4216,
-/* ScanSpotReorderingAllowed                                      */ 4218,
-/* ScanSpotSizesDelivered                                         */ 4221,
-/* ScanSpotTimeOffset                                             */ 4212,
-/* ScanSpotTuneID                                                 */ 4213,
+/* TreatmentSessionIonBeamSequence                                */ 3775,
+/* AssessmentSetID                                                */ 3489,
+/* SecondaryInspectionMethodSequence                              */ 4746,
+/* ProcedureCreationDate                                          */ 488,
+/* ReferenceAirKermaRate                                          */ 4099,
+/* TableTopRollAngle                                              */ 4044,
+/* ReplacedImplantAssemblyTemplateSequence                        */ 3428,
+/* PatientIdentityRemoved                                         */ 347,
+/* ToleranceTableSequence                                         */ 3895,
+/* BillingProcedureStepSequence                                   */ 2328,
+/* CoefficientsSDDN                                               */ 4833,
+/* ScheduledProcedureStepExpirationDateTime                       */ 2408,
+/* ImageBoxSynchronizationSequence                                */ 3328,
+/* AcquisitionDeviceTypeCodeSequence                              */ 1650,
+/* FractionGroupType                                              */ 3860,
+/* MPRViewWidth                                                   */ 3181,
+/* GeneralPurposeScheduledProcedureStepStatus                     */ 2401,
+/* StrainNomenclature                                             */ 279,
+/* ContrastBolusAgentAdministered                                 */ 1240,
+/* DataBlockDescription                                           */ 1979,
+/* ContourData                                                    */ 3745,
+/* AuthorIdentificationSequence                                   */ 4509,
+/* ReferenceDoseDefinition                                        */ 4266,
+/* CompensatorSequence                                            */ 3978,
+/* CornealPointLocation                                           */ 2701,
+/* SelectorValueNumber                                            */ 3244,
+/* OphthalmicImageOrientation                                     */ 1671,
+/* Date                                                           */ 2498,
+/* PatientSpeciesCodeSequence                                     */ 322,
+/* ImplantTemplateGroupName                                       */ 3448,
+/* Columns                                                        */ 1915,
+/* MaskingImage                                                   */ 1534,
+/* RelatedAssertionSequence                                       */ 2615,
+/* PulseSpecificBrachyControlPointDeliveredSequence               */ 3853,
+/* EntranceDoseDerivation                                         */ 2444,
+/* ImageSetSelectorUsageFlag                                      */ 3242,
+/* FilterThicknessUsedInGainCalibration                           */ 429,
+/* CatheterRotationalRate                                         */ 2768,
+/* ItineraryIDAssigningAuthority                                  */ 4717,
+/* ReferencedOtherPlaneSequence                                   */ 255,
+/* FiducialsPropertyCategoryCodeSequence                          */ 3146,
+/* UpperLowerPixelValues                                          */ 832,
+/* TreatmentSessionApplicationSetupSequence                       */ 3833,
+/* TransformLabel                                                 */ 1969,
+/* dBdt                                                           */ 850,
+/* ContrastBolusAgent                                             */ 656,
+/* TriangleStripSequence                                          */ 2930,
+/* DiffusionGradientOrientation                                   */ 1111,
+/* KeratometryMeasurementTypeCodeSequence                         */ 1716,
+/* RadiusOfCircularShutter                                        */ 882,
+/* OrganizationalRoleCodeSequence                                 */ 2618,
+/* ChannelSourceModifiersSequence                                 */ 2234,
+/* CompressionDescription                                         */ 1930,
+/* ProcedureStepState                                             */ 3353,
+/* PulserEquipmentSequence                                        */ 434,
+/* PrivateDataElementDescription                                  */ 143,
+/* DateOfLastDetectorCalibration                                  */ 1003,
+/* RouteSegmentID                                                 */ 4669,
+/* PlanningLandmarkDescription                                    */ 3026,
+/* RealWorldValueFirstValueMapped                                 */ 2454,
+/* InspectionSelectionCriteria                                    */ 4745,
+/* SelectorLTValue                                                */ 3267,
+/* ServiceEpisodeDescription                                      */ 2214,
+/* SignalDomainColumns                                            */ 2127,
+/* PatientSetupLabel                                              */ 4058,
+/* OverlayTime                                                    */ 66,
+/* PositionerSecondaryAngleIncrement                              */ 873,
+/* NuclearMedicineSeriesType                                      */ 70,
+/* LocationOfMeasuredBeamDiameter                                 */ 451,
+/* RadiopharmaceuticalSpecificActivity                            */ 765,
+/* SliceProgressionDirection                                      */ 2835,
+/* AcquiredSoundpathLength                                        */ 462,
+/* TargetMaximumLuminance                                         */ 2107,
+/* HPGLContourPenNumber                                           */ 2989,
+/* ObservationSubjectTypeCodeSequenceTrial                        */ 2550,
+/* NominalMinEnergy                                               */ 1269,
+/* OtherSecondaryApprovalStatus                                   */ 382,
+/* ProtocolDesignRationale                                        */ 1463,
+/* OverlayCodeTableLocation                                       */ 4809,
+/* RadiationDoseSequence                                          */ 4290,
+/* TriggerSourceOrType                                            */ 746,
+/* CylinderLensPower                                              */ 1638,
+/* GlobalDeviationProbabilityNormalsFlag                          */ 1838,
+/* TreatmentSessionUID                                            */ 4405,
+/* SmallestValidPixelValue                                        */ 1949,
+/* InstitutionAddress                                             */ 87,
+/* ReferencedImageOverlayBoxSequence                              */ 3605,
+/* ObservationNumber                                              */ 3747,
+/* TimeSlotInformationSequence                                    */ 2813,
+/* XRayFilterSequence                                             */ 1375,
+/* SegmentationFractionalType                                     */ 2887,
+/* GPSDifferential                                                */ 655,
+/* IsocenterToRangeShifterDistance                                */ 4201,
+/* ParallelRTBeamDelimiterBoundaries                              */ 4339,
+/* RTPlanTime                                                     */ 3869,
+/* ApplicationManufacturer                                        */ 1354,
+/* GPSDestLongitude                                               */ 647,
+/* ControlPointOrientation                                        */ 4233,
+/* BeamDescription                                                */ 3951,
+/* OtherMagnificationTypesAvailable                               */ 3579,
+/* RadiopharmaceuticalUsageSequence                               */ 1410,
+/* CompoundGraphicInstanceID                                      */ 3088,
+/* NumberOfEventTimers                                            */ 205,
+/* ObservationSubjectUIDTrial                                     */ 2548,
+/* WedgeNumber                                                    */ 3962,
+/* AnteriorChamberDepth                                           */ 1730,
+/* TMLinePositionX1Retired                                        */ 979,
+/* FilterMaterial                                                 */ 1030,
+/* IndexNormalsFlag                                               */ 1903,
+/* OverlaysGray                                                   */ 4816,
+/* GPSSpeedRef                                                    */ 637,
+/* RadiopharmaceuticalAdministrationEventUID                      */ 240,
+/* GantryMotionCorrected                                          */ 1422,
+/* BeamLimitingDevicePositionTolerance                            */ 3901,
+/* SelectorAttributePrivateCreator                                */ 3256,
+/* OphthalmicAxialLengthSelectionMethodCodeSequence               */ 1746,
+/* DateOfLastCalibration                                          */ 828,
+/* UnifiedProcedureStepListStatus                                 */ 3407,
+/* GridID                                                         */ 714,
+/* DataType                                                       */ 1439,
+/* AmbientLightValueSource                                        */ 2114,
+/* AnatomicPortalOfEntranceCodeSequenceTrial                      */ 228,
+/* TransmitCoilManufacturerName                                   */ 1080,
+/* SelectorAttributeKeyword                                       */ 3492,
+/* RTVSourceIdentifier                                            */ 16,
+/* LineThickness                                                  */ 3109,
+/* PVCRejection                                                   */ 773,
+/* BarcodeValue                                                   */ 3654,
+/* TableTopRollAdjustedAngle                                      */ 3372,
+/* OtherApprovalStatus                                            */ 381,
+/* ElementPitchB                                                  */ 455,
+/* ReferencedControlPointSequence                                 */ 4472,
+/* FilmSessionLabel                                               */ 3554,
+/* LongVertexPointIndexList                                       */ 2951,
+/* ModelMirroring                                                 */ 3039,
+/* ImplantTemplateVersion                                         */ 2969,
+/* ImplantAssemblyTemplateIssuer                                  */ 3426,
+/* ALineRate                                                      */ 2766,
+/* PrimaryDosimeterUnit                                           */ 3941,
+/* OverlayDescriptorGreen                                         */ 4814,
+/* SelectorCodeSequenceValue                                      */ 3287,
+/* SensitivityCalibrated                                          */ 1427,
+/* SoftTissueThermalIndex                                         */ 938,
+/* InterpretationApprovalDate                                     */ 4648,
+/* OCTOpticalCenterWavelength                                     */ 2763,
+/* ROIName                                                        */ 3728,
+/* SmoothingType                                                  */ 3577,
+/* RTBeamLimitingDeviceProximalDistance                           */ 4332,
+/* BrightnessValue                                                */ 585,
+/* RTAccessoryHolderSlotID                                        */ 4284,
+/* ReceivingAE                                                    */ 3402,
+/* GrayScale                                                      */ 2003,
+/* SourceImageEvidenceSequence                                    */ 247,
+/* AnnotationDisplayFormatID                                      */ 3571,
+/* ContentTemplateSequence                                        */ 2556,
+/* Manufacturer                                                   */ 85,
+/* ProcedureIdentifierCodeSequenceTrial                           */ 2490,
+/* ApplicationSetupType                                           */ 4104,
+/* FillMode                                                       */ 3113,
+/* VisualFieldMeanSensitivity                                     */ 1849,
+/* Italic                                                         */ 3106,
+/* RespiratorySynchronizationSequence                             */ 1605,
+/* SelectorOFValue                                                */ 3266,
+/* PersonAddress                                                  */ 2384,
+/* BrachyAccessoryDeviceType                                      */ 4115,
+/* HardcopyCreationDeviceID                                       */ 721,
+/* ReferencedOverlaySequence                                      */ 171,
+/* DecompositionDescription                                       */ 1279,
+/* ObserverContextFlagTrial                                       */ 2559,
+/* TableTopPitchRotationDirection                                 */ 4043,
+/* GraphicGroupLabel                                              */ 3085,
+/* OtherPatientIDs                                                */ 290,
+/* PositioningMethodCodeSequence                                  */ 1475,
+/* StartAcquisitionDateTime                                       */ 1348,
+/* DimensionOrganizationUID                                       */ 1585,
+/* SelectorODValue                                                */ 3278,
+/* SOPAuthorizationDateTime                                       */ 3511,
+/* NumberOfVerticalPixels                                         */ 3290,
+/* CornealTopographyMappingNormalsSequence                        */ 2685,
 /* ScanType                                                       */ 4714,
-/* ScanVelocity                                                   */ 842,
-/* ScannerSettingsSequence                                        */ 509,
-/* ScanningSequence                                               */ 661,
-/* ScanningSpotSize                                               */ 4220,
-/* ScatterCorrected                                               */ 1420,
-/* ScatterCorrectionMethod                                        */ 2847,
-/* ScatterFractionFactor                                          */ 2860,
-/* SceneCaptureType                                               */ 611,
-/* SceneType                                                      */ 605,
-/* ScheduledAdmissionDate                                         */ 2200,
-/* ScheduledAdmissionTime                                         */ 2201,
-/* ScheduledDischargeDate                                         */ 2202,
-/* ScheduledDischargeTime                                         */ 2203,
-/* ScheduledHumanPerformersSequence                               */ 2429,
-/* ScheduledPatientInstitutionResidence                           */ 2204,
-/* ScheduledPerformingPhysicianIdentificationSequence             */ 2279,
-/* ScheduledPerformingPhysicianName                               */ 2274,
-/* ScheduledProcedureStepDescription                              */ 2275,
-/* ScheduledProcedureStepEndDate                                  */ 2272,
-/* ScheduledProcedureStepEndTime                                  */ 2273,
-/* ScheduledProcedureStepExpirationDateTime                       */ 2408,
-/* ScheduledProcedureStepID                                       */ 2277,
-/* ScheduledProcedureStepLocation                                 */ 2281,
-/* ScheduledProcedureStepModificationDateTime                     */ 2410,
-/* ScheduledProcedureStepPriority                                 */ 3392,
-/* ScheduledProcedureStepSequence                                 */ 2293,
-/* ScheduledProcedureStepStartDate                                */ 2270,
-/* ScheduledProcedureStepStartDateTime                            */ 2405,
-/* ScheduledProcedureStepStartTime                                */ 2271,
-/* ScheduledProcedureStepStatus                                   */ 2283,
-/* ScheduledProcessingApplicationsCodeSequence                    */ 2404,
-/* ScheduledProcessingParametersSequence                          */ 3395,
-/* ScheduledProtocolCodeSequence                                  */ 2276,
+/* WaveformBitsStored                                             */ 2244,
+/* AccessionNumber                                                */ 71,
+/* RFEchoTrainLength                                              */ 1179,
+/* SourceToReferenceObjectDistance                                */ 3680,
+/* StrainSource                                                   */ 283,
+/* DischargeDiagnosisCodeSequence                                 */ 2210,
+/* NumberOfTableBreakPoints                                       */ 989,
+/* RotationOffset                                                 */ 798,
+/* PupilCentroidXCoordinate                                       */ 2680,
+/* StrainCodeSequence                                             */ 285,
+/* SteeringAngle                                                  */ 970,
+/* ThreatROIBase                                                  */ 4666,
+/* PatientPosition                                                */ 944,
+/* ObjectPixelSpacingInCenterOfBeam                               */ 1288,
+/* MIMETypeOfEncapsulatedDocument                                 */ 2590,
+/* TargetMinimumLuminance                                         */ 2106,
+/* CADFileFormat                                                  */ 359,
+/* ComponentManufacturer                                          */ 362,
+/* ReferencedRTAccessoryHolderDeviceIndex                         */ 4281,
+/* RangeShifterDescription                                        */ 4177,
+/* TwoDPlaneIntersection                                          */ 3035,
+/* RadionuclideCodeSequence                                       */ 2826,
+/* StructuredDisplayBackgroundCIELabValue                         */ 3323,
+/* ChannelPosition                                                */ 2255,
+/* IonRangeCompensatorSequence                                    */ 4161,
+/* SourceOfRefractiveMeasurementsCodeSequence                     */ 1734,
+/* IndexProbabilitySequence                                       */ 1905,
+/* CalibrationImage                                               */ 2741,
+/* ImageDimensions                                                */ 1909,
+/* ZonalMapFormat                                                 */ 1984,
+/* EquipmentFrameOfReferenceDescription                           */ 4384,
+/* CompressionSequence                                            */ 1931,
+/* ViewPosition                                                   */ 945,
+/* NumberOfAverages                                               */ 697,
+/* OperatingMode                                                  */ 1152,
+/* ContainerComponentID                                           */ 2752,
+/* RWaveTimeVector                                                */ 995,
+/* AttenuationCorrectionTemporalRelationship                      */ 1430,
+/* UValueData                                                     */ 3475,
+/* DistanceSourceToEntrance                                       */ 2320,
+/* QueueStatus                                                    */ 3638,
+/* FieldOfViewDimensions                                          */ 800,
+/* DoseType                                                       */ 3693,
+/* SimulatedKeratometricCylinderSequence                          */ 2690,
+/* RTTreatmentApproachLabel                                       */ 4570,
+/* DischargeDate                                                  */ 2207,
+/* BoundingBoxCrop                                                */ 3171,
+/* PotentialDiagnosticTasks                                       */ 1457,
+/* NumberOfPolygonalVertices                                      */ 894,
+/* WedgeAngleFloat                                                */ 526,
+/* SubstanceAdministrationDateTime                                */ 2603,
+/* NumericValueQualifierCodeSequence                              */ 2531,
+/* FlashEnergy                                                    */ 600,
+/* CassetteSize                                                   */ 855,
+/* ProtocolName                                                   */ 733,
+/* ROIMean                                                        */ 4821,
+/* MPRViewWidthDirection                                          */ 3180,
+/* FileSetID                                                      */ 22,
+/* OverlayDescription                                             */ 4790,
+/* WedgeManufacturerName                                          */ 535,
+/* ReceiveTransducerSequence                                      */ 443,
+/* SelfTimerMode                                                  */ 575,
+/* SourceIsotopeHalfLife                                          */ 4097,
+/* MACParametersSequence                                          */ 4748,
+/* OphthalmicImageTypeCodeSequence                                */ 1787,
+/* SurfaceProcessingDescription                                   */ 2907,
+/* PatternOnOpacity                                               */ 3122,
+/* AssigningFacilitySequence                                      */ 2290,
+/* PTORepresentationSequence                                      */ 4703,
+/* MydriaticAgentSequence                                         */ 1680,
+/* ModalityLUTType                                                */ 2057,
+/* PlanIntent                                                     */ 3871,
+/* GeometricMaximumDistortion                                     */ 2140,
+/* SourceApplicatorTipLength                                      */ 4122,
+/* MatingFeatureSetsSequence                                      */ 3004,
+/* FocusMethod                                                    */ 2715,
+/* TreatmentMachineSequence                                       */ 4085,
+/* LensSpecification                                              */ 619,
+/* WedgePositionSequence                                          */ 4019,
+/* ApprovalSequence                                               */ 2608,
+/* TreatmentSiteModifierCodeSequence                              */ 4620,
+/* RelativeElevation                                              */ 2706,
+/* MaximumAcrossScanDistortion                                    */ 1675,
+/* CouplingTechnique                                              */ 475,
+/* PatientSupportPositionDeviceToleranceSequence                  */ 4362,
+/* ReflectedAmbientLight                                          */ 3591,
+/* TypeOfSynchronization                                          */ 3330,
+/* ChairHeadFramePosition                                         */ 4051,
+/* FlashReturnStatus                                              */ 568,
+/* PatientSupportPositionToleranceOrderIndex                      */ 4363,
+/* TreatmentToleranceViolationDescription                         */ 4424,
+/* DataRepresentation                                             */ 2129,
+/* TableTopEccentricAngleTolerance                                */ 3904,
+/* BulkMotionStatus                                               */ 1141,
+/* ModifyingDeviceID                                              */ 1559,
+/* SurgicallyInducedAstigmatismSequence                           */ 1698,
+/* AutoKVPUpperBound                                              */ 1503,
+/* TriggerVector                                                  */ 2822,
+/* RRIntervalTimeNominal                                          */ 1603,
+/* PertinentSOPClassesInStudy                                     */ 4566,
+/* SurfaceProcessingAlgorithmIdentificationSequence               */ 2944,
+/* NumberOfLuminancePoints                                        */ 2104,
+/* ReasonForSuperseding                                           */ 4576,
+/* HardcopyDeviceSoftwareVersion                                  */ 728,
+/* ReferencedDirectSegmentInstanceSequence                        */ 4558,
+/* PertinentResourcesSequence                                     */ 2217,
+/* ShotOffsetTime                                                 */ 3470,
+/* RTAccessoryDeviceSlotID                                        */ 4288,
+/* RTPlanGeometry                                                 */ 3873,
+/* UnassignedPerFrameConvertedAttributesSequence                  */ 1589,
+/* FrameExtractionSequence                                        */ 186,
+/* ThreeDPlaneNormal                                              */ 3037,
+/* InStackPositionNumber                                          */ 1569,
+/* SourceApplicatorWallNominalThickness                           */ 4136,
+/* EquivalentCDADocumentSequence                                  */ 2493,
+/* BlendingDisplayInputSequence                                   */ 3221,
+/* SpectroscopyAcquisitionPhaseColumns                            */ 1176,
+/* BlockIdentifyingInformationStatus                              */ 132,
+/* RequestedMediaApplicationProfile                               */ 3661,
+/* ContainerComponentDescription                                  */ 2755,
+/* PotentialRequestedProcedureCodeSequence                        */ 1454,
+/* ImageBoxOverlapPriority                                        */ 3317,
+/* ActualEnvironmentalConditions                                  */ 383,
+/* PlacerOrderNumberProcedure                                     */ 2374,
 /* ScheduledSpecimenSequence                                      */ 2336,
-/* ScheduledStationAETitle                                        */ 2269,
-/* ScheduledStationClassCodeSequence                              */ 2421,
-/* ScheduledStationGeographicLocationCodeSequence                 */ 2422,
-/* ScheduledStationName                                           */ 2280,
-/* ScheduledStationNameCodeSequence                               */ 2420,
-/* ScheduledStepAttributesSequence                                */ 2308,
-/* ScheduledStudyLocation                                         */ 2164,
-/* ScheduledStudyLocationAETitle                                  */ 2165,
-/* ScheduledStudyStartDate                                        */ 2160,
-/* ScheduledStudyStartTime                                        */ 2161,
-/* ScheduledStudyStopDate                                         */ 2162,
-/* ScheduledStudyStopTime                                         */ 2163,
-/* ScheduledWorkitemCodeSequence                                  */ 2414,
-/* ScreenMinimumColorBitDepth                                     */ 3294,
-/* ScreenMinimumGrayscaleBitDepth                                 */ 3293,
-/* ScreeningBaselineMeasured                                      */ 1891,
-/* ScreeningBaselineMeasuredSequence                              */ 1892,
-/* ScreeningBaselineType                                          */ 1893,
-/* ScreeningBaselineValue                                         */ 1894,
-/* ScreeningTestModeCodeSequence                                  */ 1808,
-/* SeamLineIndex                                                  */ 2780,
-/* SeamLineLocation                                               */ 2778,
-/* SecondaryApprovalStatus                                        */ 375,
-/* SecondaryCaptureDeviceID                                       */ 720,
-/* SecondaryCaptureDeviceManufacturer                             */ 724,
-/* SecondaryCaptureDeviceManufacturerModelName                    */ 726,
-/* SecondaryCaptureDeviceSoftwareVersions                         */ 727,
-/* SecondaryCountsAccumulated                                     */ 2856,
-/* SecondaryCountsType                                            */ 2853,
-/* SecondaryInspectionMethodSequence                              */ 4746,
-/* SecondaryPositionerIncrement                                   */ 1347,
-/* SecondaryPositionerIncrementSign                               */ 1351,
-/* SecondaryPositionerScanArc                                     */ 1343,
+/* ApplicationName                                                */ 1352,
+/* OptotypeDetailedDefinition                                     */ 2674,
+/* ConfidentialityCode                                            */ 2376,
+/* PrivateDataElementValueRepresentation                          */ 139,
+/* EchoPulseSequence                                              */ 1044,
+/* ConfigurationInformation                                       */ 3587,
+/* ExposureStatus                                                 */ 1037,
+/* CorrectedLocalizedDeviationFromNormalCalculated                */ 1857,
+/* TransferSyntaxUID                                              */ 4,
+/* IndicationDescription                                          */ 393,
+/* TomoTime                                                       */ 864,
+/* RelativeTime                                                   */ 3248,
+/* CalculatedAnatomyThickness                                     */ 1319,
+/* RadiationDoseSourceToExternalContourDistance                   */ 4307,
+/* OrganAtRiskMaximumDose                                         */ 3893,
+/* WedgeOrientation                                               */ 3968,
+/* WeekdayFractionPatternSequence                                 */ 4618,
+/* MidSlabPosition                                                */ 1125,
+/* CollationFlag                                                  */ 3558,
+/* StudyPriorityID                                                */ 2154,
+/* InterpretationApprovalTime                                     */ 4649,
+/* GradientOutputType                                             */ 1154,
+/* SurfaceNumber                                                  */ 2903,
+/* RadiationSourceCoordinateSystemPitchAngle                      */ 4627,
+/* CompensatorTrayID                                              */ 3990,
+/* IsocenterToWedgeTrayDistance                                   */ 3969,
+/* PositioningLandmarkSequence                                    */ 1476,
+/* FinalCumulativeTimeWeight                                      */ 4147,
+/* DistributionName                                               */ 4654,
+/* ExtendedDepthOfField                                           */ 2716,
+/* VolumetricPresentationInputAnnotationSequence                  */ 3209,
+/* NumberOfPhases                                                 */ 2797,
+/* PatientSupportID                                               */ 4193,
+/* ImplantTemplateGroupVariationDimensionSequence                 */ 3461,
+/* ImageAndFluoroscopyAreaDoseProduct                             */ 809,
+/* DisplayedAreaBottomRightHandCornerTrial                        */ 3065,
+/* SelectorDAValue                                                */ 3260,
+/* OphthalmicThicknessMapTypeCodeSequence                         */ 1759,
+/* LargestPixelValueInSeries                                      */ 1954,
+/* BodyPartThickness                                              */ 823,
+/* ContinuationEndMeterset                                        */ 3352,
+/* EntranceDoseInmGy                                              */ 2443,
+/* ObservationBasisCodeSequence                                   */ 3494,
+/* PatientName                                                    */ 259,
+/* RadiationDoseInVivoMeasurementLabel                            */ 4302,
+/* FixationMonitoringCodeSequence                                 */ 1816,
+/* PositionOfIsocenterProjection                                  */ 1303,
+/* SourceOfAnteriorChamberDepthDataCodeSequence                   */ 1732,
+/* GeometricalProperties                                          */ 2139,
+/* SourceMovementType                                             */ 4127,
+/* ReferencePixelX0                                               */ 958,
+/* ComponentWelderIDs                                             */ 374,
+/* OtherStudyNumbers                                              */ 1551,
+/* RangeModulatorSequence                                         */ 4186,
 /* SecondaryPositionerScanStartAngle                              */ 1345,
-/* SecondaryReviewDate                                            */ 376,
-/* SecondaryReviewTime                                            */ 377,
-/* SecondaryReviewerName                                          */ 378,
-/* SegmentAlgorithmName                                           */ 2880,
-/* SegmentAlgorithmType                                           */ 2879,
-/* SegmentAnnotationCategoryCodeSequence                          */ 4527,
-/* SegmentAnnotationTypeCodeSequence                              */ 4528,
-/* SegmentAnnotationTypeModifierCodeSequence                      */ 4531,
-/* SegmentCharacteristicsPrecedence                               */ 4525,
-/* SegmentCharacteristicsSequence                                 */ 4523,
-/* SegmentDescription                                             */ 2877,
-/* SegmentIdentificationSequence                                  */ 2881,
-/* SegmentLabel                                                   */ 2876,
+/* AbsoluteDosimetricObjectiveFlag                                */ 4598,
+/* ReferencedSegmentReferenceIndex                                */ 4516,
+/* PlaneNormal                                                    */ 3174,
+/* HuffmanTableTriplet                                            */ 3545,
+/* ViewCodeSequence                                               */ 2824,
+/* DiameterOfCircularOutline                                      */ 893,
+/* GPSDestLatitude                                                */ 645,
+/* ReferencedTransferSyntaxUIDInFile                              */ 38,
+/* SmokingStatus                                                  */ 316,
+/* ROIContourSequence                                             */ 3737,
+/* FractionationNotes                                             */ 4610,
+/* AcquisitionEndLocationSequence                                 */ 1486,
+/* AnalyzedArea                                                   */ 2693,
+/* DataBlock                                                      */ 1980,
+/* InformationFromManufacturerSequence                            */ 2976,
+/* DoubleExposureFlag                                             */ 3375,
+/* DimensionOrganizationType                                      */ 1622,
+/* PatientOrientation                                             */ 1521,
+/* SpecimenIdentifier                                             */ 2345,
+/* ApplicationSetupCheck                                          */ 3834,
+/* DetectorElementSize                                            */ 2851,
+/* ShowTickLabel                                                  */ 3119,
+/* AcquisitionProtocolName                                        */ 1296,
+/* IntervalsAcquired                                              */ 771,
 /* SegmentNumber                                                  */ 2875,
-/* SegmentReferenceIndex                                          */ 4518,
-/* SegmentReferenceSequence                                       */ 4517,
-/* SegmentSequence                                                */ 2873,
-/* SegmentSurfaceGenerationAlgorithmIdentificationSequence        */ 2937,
-/* SegmentSurfaceSourceInstanceSequence                           */ 2938,
-/* SegmentationAlgorithmIdentificationSequence                    */ 2878,
-/* SegmentationCreationTemplateLabel                              */ 4514,
-/* SegmentationFractionalType                                     */ 2887,
-/* SegmentationTemplateUID                                        */ 4515,
-/* SegmentationType                                               */ 2872,
-/* SegmentedAlphaPaletteColorLookupTableData                      */ 2026,
-/* SegmentedBluePaletteColorLookupTableData                       */ 2025,
-/* SegmentedGreenPaletteColorLookupTableData                      */ 2024,
-/* SegmentedKSpaceTraversal                                       */ 1066,
-/* SegmentedPropertyCategoryCodeSequence                          */ 2874,
-/* SegmentedPropertyTypeCodeSequence                              */ 2886,
-/* SegmentedPropertyTypeModifierCodeSequence                      */ 2888,
-/* SegmentedRTAccessoryDeviceSequence                             */ 4522,
-/* SegmentedRedPaletteColorLookupTableData                        */ 2023,
+/* HeartRate                                                      */ 775,
+/* AngularPosition                                                */ 793,
+/* ReferencedRTPrescriptionSequence                               */ 4404,
+/* CompensatorDefinitionSequence                                  */ 4364,
+/* CountsAccumulated                                              */ 688,
+/* DeliveryRateUnitSequence                                       */ 4328,
+/* IonToleranceTableSequence                                      */ 4223,
+/* NumberOfHorizontalPixels                                       */ 3291,
+/* ParametersSpecificationSequence                                */ 1466,
+/* VisitStatusID                                                  */ 2195,
+/* TransducerOrientationModifierSequence                          */ 226,
+/* VisualFieldVerticalExtent                                      */ 1806,
+/* UniversalEntityID                                              */ 2287,
+/* ApplicatorID                                                   */ 4009,
+/* PrimaryPositionerScanStartAngle                                */ 1344,
 /* SegmentsOverlap                                                */ 2890,
-/* SelectedSegmentalOphthalmicAxialLengthSequence                 */ 1748,
-/* SelectedTotalOphthalmicAxialLengthSequence                     */ 1749,
-/* SelectorAEValue                                                */ 3257,
-/* SelectorASValue                                                */ 3258,
-/* SelectorATValue                                                */ 3259,
-/* SelectorAttribute                                              */ 3243,
-/* SelectorAttributeKeyword                                       */ 3492,
-/* SelectorAttributeName                                          */ 3491,
-/* SelectorAttributePrivateCreator                                */ 3256,
-/* SelectorAttributeVR                                            */ 3253,
-/* SelectorCSValue                                                */ 3261,
-/* SelectorCodeSequenceValue                                      */ 3287,
-/* SelectorDAValue                                                */ 3260,
-/* SelectorDSValue                                                */ 3277,
-/* SelectorDTValue                                                */ 3262,
-/* SelectorFDValue                                                */ 3279,
-/* SelectorFLValue                                                */ 3281,
-/* SelectorISValue                                                */ 3263,
-/* SelectorLOValue                                                */ 3265,
-/* SelectorLTValue                                                */ 3267,
-/* SelectorOBValue                                                */ 3264,
-/* SelectorODValue                                                */ 3278,
-/* SelectorOFValue                                                */ 3266,
-/* SelectorOLValue                                                */ 3280,
-/* SelectorOWValue                                                */ 3268,
-/* SelectorPNValue                                                */ 3269,
-/* SelectorSHValue                                                */ 3271,
-/* SelectorSLValue                                                */ 3284,
-/* SelectorSSValue                                                */ 3285,
-/* SelectorSTValue                                                */ 3273,
-/* SelectorSequencePointer                                        */ 3254,
-/* SelectorSequencePointerItems                                   */ 3391,
-/* SelectorSequencePointerPrivateCreator                          */ 3255,
-/* SelectorTMValue                                                */ 3270,
-/* SelectorUCValue                                                */ 3274,
-/* SelectorUIValue                                                */ 3286,
-/* SelectorULValue                                                */ 3282,
-/* SelectorUNValue                                                */ 3272,
-/* SelectorURValue                                                */ 3276,
-/* SelectorUSValue                                                */ 3283,
-/* SelectorUTValue                                                */ 3275,
-/* SelectorValueNumber                                            */ 3244,
-/* SelfTimerMode                                                  */ 575,
-/* SendingApplicationEntityTitle                                  */ 8,
-/* SendingPresentationAddress                                     */ 11,
-/* SensingMethod                                                  */ 603,
-/* Sensitivity                                                    */ 949,
-/* SensitivityCalibrated                                          */ 1427,
-/* SensitivityType                                                */ 576,
-/* SensitivityValue                                               */ 1871,
-/* SensorName                                                     */ 417,
-/* SensorTemperature                                              */ 420,
-/* SequenceDelimitationItem                                       */ 4843,
-/* SequenceName                                                   */ 665,
-/* SequenceOfCompressedData                                       */ 1972,
-/* SequenceOfUltrasoundRegions                                    */ 950,
-/* SequenceVariant                                                */ 662,
+/* VolumeToTransducerRelationship                                 */ 1616,
+/* ReferencedCalculatedDoseReferenceNumber                        */ 3821,
+/* PulserSettingsSequence                                         */ 456,
+/* MinimumKeratometricSequence                                    */ 2689,
+/* HumanPerformerName                                             */ 2432,
+/* SpecimenShortDescription                                       */ 2354,
+/* NumberOfBlocks                                                 */ 3991,
+/* DeliveredSecondaryMeterset                                     */ 3786,
+/* InterlockDateTime                                              */ 4432,
+/* TrackSequence                                                  */ 2953,
+/* VolumetricCurveUpDirections                                    */ 3216,
+/* LanguageCodeSequenceTrial                                      */ 2564,
+/* ToricIOLPowerForExactEmmetropiaSequence                        */ 1703,
+/* SourceApplicatorType                                           */ 4132,
+/* RTVMetaInformationVersion                                      */ 13,
+/* ImageSetsSequence                                              */ 3240,
+/* DimensionIndexPointer                                          */ 1586,
+/* EffectiveDoseCalculationMethodDescription                      */ 4489,
+/* TotalBlockTrayFactor                                           */ 3992,
+/* DoubleFloatPixelData                                           */ 4829,
+/* NumberOfSeriesRelatedInstances                                 */ 1557,
+/* NumberOfPatientRelatedInstances                                */ 1554,
+/* AnnotationGroupNumber                                          */ 2520,
+/* TranslationRateX                                               */ 511,
+/* ElementDimensionA                                              */ 446,
+/* BlendingLUT1TransferFunction                                   */ 2039,
+/* PrinterStatusInfo                                              */ 3635,
+/* TransducerScanPatternCodeSequence                              */ 1440,
+/* AutosequenceFlag                                               */ 3365,
+/* XAXRFFrameCharacteristicsSequence                              */ 1293,
+/* ViewName                                                       */ 203,
+/* StudyDate                                                      */ 55,
+/* ProbeOrientationAngle                                          */ 502,
+/* FixationDeviceRollAngle                                        */ 4066,
+/* VisualFieldTestPointYCoordinate                                */ 1868,
+/* ReconstructionAlgorithm                                        */ 1216,
+/* BorderDensity                                                  */ 3582,
+/* CTReconstructionSequence                                       */ 1215,
+/* MeasurementLaterality                                          */ 1886,
+/* DistanceSourceToPatient                                        */ 780,
+/* CumulativeTimeWeight                                           */ 4151,
+/* PatientTreatmentOrientationSequence                            */ 4534,
+/* FramePrimaryAngleVector                                        */ 910,
+/* ReferenceBasisCodeSequence                                     */ 1449,
 /* SequencingIndicatorTrial                                       */ 2475,
-/* SeriesDate                                                     */ 56,
-/* SeriesDescription                                              */ 150,
-/* SeriesDescriptionCodeSequence                                  */ 151,
-/* SeriesInStudy                                                  */ 1541,
-/* SeriesInstanceUID                                              */ 1510,
-/* SeriesNumber                                                   */ 1512,
-/* SeriesTime                                                     */ 63,
-/* SeriesType                                                     */ 2837,
-/* ServiceEpisodeDescription                                      */ 2214,
-/* ServiceEpisodeID                                               */ 2212,
-/* SettlingPhaseFrame                                             */ 1389,
-/* SetupDeviceDescription                                         */ 4077,
-/* SetupDeviceLabel                                               */ 4076,
-/* SetupDeviceParameter                                           */ 4078,
-/* SetupDeviceSequence                                            */ 4074,
-/* SetupDeviceType                                                */ 4075,
-/* SetupImageComment                                              */ 4231,
-/* SetupReferenceDescription                                      */ 4079,
-/* SetupTechnique                                                 */ 4072,
-/* SetupTechniqueDescription                                      */ 4073,
-/* ShadingStyle                                                   */ 3192,
-/* ShadowColorCIELabValue                                         */ 3103,
-/* ShadowOffsetX                                                  */ 3101,
-/* ShadowOffsetY                                                  */ 3102,
+/* PrescriptionNotesSequence                                      */ 4612,
+/* TrayAccessoryCode                                              */ 4195,
+/* BlendingLUT2TransferFunction                                   */ 2045,
+/* AliasedDataType                                                */ 1441,
+/* SegmentationType                                               */ 2872,
+/* RTRadiationSalvageRecordControlPointSequence                   */ 4418,
+/* ICCProfile                                                     */ 2049,
+/* TrackSetAnatomicalTypeCodeSequence                             */ 2959,
+/* FractionGroupNumber                                            */ 3912,
+/* AcquiredImageAreaDoseProduct                                   */ 1335,
+/* ClinicalTrialSubjectReadingID                                  */ 341,
+/* DepthsOfFocus                                                  */ 1433,
+/* RoboticBaseLocationIndicator                                   */ 4621,
+/* GPSTimeStamp                                                   */ 632,
+/* ConceptualVolumeUID                                            */ 4490,
+/* VolumeBasedCalculationTechnique                                */ 250,
+/* CompensatorTransmissionData                                    */ 3986,
+/* PixelData                                                      */ 4830,
+/* EvaluationAttempt                                              */ 389,
+/* DerivationConceptualVolumeSequence                             */ 4504,
+/* PartialFourier                                                 */ 1105,
+/* WaveformOriginality                                            */ 2224,
+/* ExposureControlModeDescription                                 */ 1036,
+/* ContourSequence                                                */ 3738,
+/* CoordinateSystemAxisNumber                                     */ 403,
+/* ReferencedMeasuredDoseReferenceSequence                        */ 3818,
+/* ImageOrientation                                               */ 1527,
+/* UserSelectedPhase                                              */ 504,
+/* ImagePathFilterTypeStackCodeSequence                           */ 1653,
+/* TwoDDegreeOfFreedomAxis                                        */ 3021,
+/* SelectorFLValue                                                */ 3281,
+/* CTTableDynamicsSequence                                        */ 1209,
+/* ClinicalTrialSeriesID                                          */ 350,
+/* VerifyingObserverIdentificationCodeSequence                    */ 2491,
+/* RTBeamLimitingDeviceDistalDistance                             */ 4333,
+/* NominalPercentageOfCardiacPhase                                */ 1596,
+/* ImagePositionPatient                                           */ 1526,
+/* OutputPower                                                    */ 930,
+/* PrimitivePointIndexList                                        */ 2933,
+/* BolusID                                                        */ 3972,
+/* ParameterPointer                                               */ 3807,
+/* RRIntervalVector                                               */ 2807,
+/* DeliveryVerificationImageSequence                              */ 3373,
+/* PaddleDescription                                              */ 826,
+/* ResourceDescription                                            */ 2218,
+/* ReferencedStereometricInstanceSequence                         */ 172,
+/* SourcePresentationAddress                                      */ 10,
+/* EnergyUnitCodeSequence                                         */ 4398,
+/* RectificationType                                              */ 807,
+/* WeightingTransferFunctionSequence                              */ 3203,
+/* ReconstructionTargetCenterPatient                              */ 1219,
+/* ApplicatorDescription                                          */ 4011,
+/* TemplateVersion                                                */ 2568,
+/* ActiveSourceDiameter                                           */ 4090,
+/* RealTimeBulkDataFlowSequence                                   */ 2190,
+/* TimeSliceVector                                                */ 2818,
+/* ROIGenerationAlgorithm                                         */ 3734,
+/* VolumetricCurvePoints                                          */ 3183,
+/* ConceptualVolumeDerivationAlgorithmSequence                    */ 4506,
+/* AdditionalParameterRecordingInstanceSequence                   */ 4444,
+/* DetectorElementPhysicalSize                                    */ 1011,
+/* ExposureControlSensingRegionRightVerticalEdge                  */ 1309,
+/* GradientEchoTrainLength                                        */ 1180,
+/* RecommendedDisplayCIELabValue                                  */ 2884,
+/* AlphaLUTTransferFunction                                       */ 2048,
+/* SourceIsotopeName                                              */ 4096,
+/* LuminanceUniformityResultSequence                              */ 2116,
+/* IOLFormulaDetail                                               */ 1690,
+/* DecompositionAlgorithmIdentificationSequence                   */ 1280,
+/* AveragePulseWidth                                              */ 805,
+/* FixationDeviceLabel                                            */ 4062,
+/* OverlayNumber                                                  */ 1522,
+/* TMLinePositionX0                                               */ 976,
+/* DICOMRetrievalSequence                                         */ 2581,
+/* WaveformChannelNumber                                          */ 2230,
+/* OperatingModeSequence                                          */ 1150,
+/* TargetMaterialSequence                                         */ 4736,
+/* TomoLayerHeight                                                */ 862,
+/* TemplateType                                                   */ 4109,
+/* PrinterResolutionID                                            */ 3574,
+/* DVHSequence                                                    */ 3705,
+/* PatientInstitutionResidence                                    */ 2220,
+/* RectifierSmoothing                                             */ 465,
+/* PrimaryPromptsCountsAccumulated                                */ 2855,
+/* RTTreatmentPhaseIndex                                          */ 4542,
+/* ReferencedOverlayPlaneGroups                                   */ 3610,
+/* RespiratorySignalSourceID                                      */ 1160,
+/* TwoDMatingFeatureCoordinatesSequence                           */ 3012,
+/* NumberOfTimeSlices                                             */ 2819,
+/* NumberOfWedges                                                 */ 3960,
+/* TestPointNormalsSequence                                       */ 1837,
+/* TotalGain                                                      */ 942,
+/* StartCumulativeTimeWeight                                      */ 3417,
+/* ContainerComponentTypeCodeSequence                             */ 2743,
+/* CommentsOnThePerformedProcedureStep                            */ 2310,
+/* IonBeamLimitingDeviceSequence                                  */ 4225,
+/* RelatedRTTreatmentPhaseIndex                                   */ 4547,
+/* AddNearSequence                                                */ 2653,
+/* RadiopharmaceuticalAgentNumber                                 */ 1404,
+/* ReferencedBrachyApplicationSetupNumber                         */ 4454,
+/* SelectorISValue                                                */ 3263,
+/* RealWorldValueIntercept                                        */ 2456,
+/* RelatedGeneralSOPClassUID                                      */ 53,
+/* ModalityLUTSequence                                            */ 2054,
+/* IssuerOfPatientID                                              */ 261,
+/* PETFrameTypeSequence                                           */ 1415,
+/* PatientSupportPositionSequence                                 */ 3769,
+/* SwitchingPhaseNumber                                           */ 1259,
+/* GPSDOP                                                         */ 636,
+/* ROIDerivationAlgorithmIdentificationSequence                   */ 3735,
+/* InversionTime                                                  */ 696,
+/* OCTZOffsetApplied                                              */ 2772,
+/* PointCoordinatesData                                           */ 2916,
+/* OpticalTransmittance                                           */ 2630,
+/* GraphicFilled                                                  */ 3060,
+/* SourcePatientGroupIdentificationSequence                       */ 264,
+/* ASLBolusCutoffTechnique                                        */ 1195,
+/* DeviceMotionControlSequence                                    */ 4251,
+/* TableTopEccentricAngle                                         */ 4030,
+/* FixationSequence                                               */ 1815,
+/* PETFrameAcquisitionSequence                                    */ 1405,
+/* GlobalDeviationProbability                                     */ 1850,
+/* PreSelectedForImplantation                                     */ 1702,
+/* DetectorLinesOfResponseUsed                                    */ 2846,
+/* BrachyAccessoryDeviceName                                      */ 4116,
+/* LargeBluePaletteColorLookupTableData                           */ 2021,
+/* OtherSmoothingTypesAvailable                                   */ 3581,
+/* ScanSpotTimeOffset                                             */ 4212,
 /* ShadowOpacity                                                  */ 3114,
-/* ShadowStyle                                                    */ 3100,
-/* ShapeType                                                      */ 3129,
-/* SharedFunctionalGroupsSequence                                 */ 4775,
-/* Sharpness                                                      */ 615,
-/* ShieldingDeviceDescription                                     */ 4070,
-/* ShieldingDeviceLabel                                           */ 4069,
-/* ShieldingDevicePosition                                        */ 4071,
-/* ShieldingDeviceSequence                                        */ 4067,
-/* ShieldingDeviceType                                            */ 4068,
-/* ShiftTableSize                                                 */ 3546,
-/* ShiftTableTriplet                                              */ 3547,
-/* Shininess                                                      */ 3197,
-/* ShortTermFluctuation                                           */ 1854,
-/* ShortTermFluctuationCalculated                                 */ 1853,
-/* ShortTermFluctuationProbability                                */ 1856,
-/* ShortTermFluctuationProbabilityCalculated                      */ 1855,
-/* ShotDurationTime                                               */ 3469,
-/* ShotOffsetTime                                                 */ 3470,
+/* HPGLDocumentLabel                                              */ 2984,
+/* StimulusPresentationTime                                       */ 1814,
+/* FractionGroupSequence                                          */ 3911,
+/* TextColorCIELabValue                                           */ 3097,
+/* LongitudinalTemporalInformationModified                        */ 1967,
+/* PresentationSequencePositionIndex                              */ 3154,
+/* BarcodeSymbology                                               */ 3655,
+/* Signature                                                      */ 3522,
+/* CorrectedLocalizedDeviationFromNormalProbability               */ 1860,
+/* FixationDeviceType                                             */ 4061,
+/* QualityControlSubject                                          */ 276,
+/* AdditionalRTROIIdentificationCodeSequence                      */ 3761,
+/* FunctionalGroupPrivateCreator                                  */ 1595,
+/* SourceApplicatorStepSize                                       */ 4138,
+/* VolumeLocalizationSequence                                     */ 1134,
+/* DoseReferenceUID                                               */ 3877,
+/* ImageVolumeGeometry                                            */ 3163,
+/* SourceApplicatorLength                                         */ 4134,
+/* PredictedToricErrorSequence                                    */ 1701,
+/* SelectorCSValue                                                */ 3261,
+/* EstimatedDoseSaving                                            */ 1225,
+/* AcquisitionDeviceProcessingCode                                */ 853,
+/* CodeValue                                                      */ 95,
+/* BloodSignalNulling                                             */ 1057,
+/* CameraOwnerName                                                */ 618,
+/* CalciumScoringMassFactorDevice                                 */ 1246,
+/* IlluminationBandwidth                                          */ 1679,
+/* EndingRespiratoryPhase                                         */ 1601,
+/* ModifiedImageDate                                              */ 1561,
+/* RelatedReferenceRTImageSequence                                */ 3379,
+/* ReasonForChannelOmissionDescription                            */ 3421,
+/* PatientSupportDevicesSequence                                  */ 4400,
+/* FilterOperationsSequence                                       */ 3319,
+/* PauseBetweenFrames                                             */ 2801,
+/* CurveDescription                                               */ 4752,
+/* ExposureTimeInms                                               */ 1229,
+/* SurfaceMeshPrimitivesSequence                                  */ 2914,
+/* EquivalentConceptualVolumesSequence                            */ 4494,
+/* Temperature                                                    */ 594,
+/* DistancePupillaryDistance                                      */ 2637,
+/* FixationMethodCodeSequence                                     */ 3003,
+/* Originator                                                     */ 3629,
+/* BreastImplantPresent                                           */ 2030,
+/* TransducerType                                                 */ 967,
+/* ImplantTemplateGroupTargetAnatomySequence                      */ 3453,
+/* CumulativeMeterset                                             */ 4326,
+/* ProtocolElementNumber                                          */ 1480,
+/* RecommendedDisplayCIELabValueList                              */ 2954,
+/* InstanceCreatorUID                                             */ 49,
+/* RTROIIdentificationCodeSequence                                */ 3750,
+/* CalibrationTime                                                */ 491,
+/* CTXRayDetailsSequence                                          */ 1226,
+/* XRayDetectorID                                                 */ 1265,
+/* ColorFilterArrayPatternValues                                  */ 566,
+/* SpecifiedSecondaryMeterset                                     */ 3784,
+/* TriangleFanSequence                                            */ 2931,
+/* FrameUsefulnessGroupSequence                                   */ 2189,
+/* FilterByAttributePresence                                      */ 3321,
+/* VisualFieldTestNormalsFlag                                     */ 1842,
+/* OphthalmicUltrasoundMethodCodeSequence                         */ 1697,
+/* ReferencedLateralSpreadingDeviceNumber                         */ 4476,
+/* SAR                                                            */ 849,
+/* Crop                                                           */ 3159,
+/* SelectorAttributeName                                          */ 3491,
+/* CouplingVelocity                                               */ 477,
+/* InstitutionCodeSequence                                        */ 88,
+/* DiffusionAcquisitionCodeSequence                               */ 2966,
+/* OverlayBitsForCodeWord                                         */ 4810,
+/* ModelGroupUID                                                  */ 3041,
+/* OriginalAttributesSequence                                     */ 3536,
+/* DeviceID                                                       */ 711,
+/* CornealPower                                                   */ 2662,
+/* AcquisitionTerminationCondition                                */ 689,
+/* Mass                                                           */ 4680,
+/* CorrectedImage                                                 */ 1925,
+/* PatientWeight                                                  */ 300,
+/* IonWedgeSequence                                               */ 4228,
+/* MeasuredValueSequence                                          */ 2530,
+/* EchoTrainLength                                                */ 705,
+/* VisualEvaluationMethodCodeSequence                             */ 2123,
+/* TransformVersionNumber                                         */ 1970,
+/* DeliveredDistalDepth                                           */ 4262,
+/* GPSMapDatum                                                    */ 643,
+/* GPSAltitudeRef                                                 */ 630,
+/* BeamDoseMeaning                                                */ 3926,
+/* OverlayColumns                                                 */ 4787,
+/* RegionLocationMinY0                                            */ 955,
+/* GridPeriod                                                     */ 1028,
+/* SourceConceptualVolumeUID                                      */ 4505,
+/* RetrieveLocationUID                                            */ 2579,
+/* PatientSupportPositionParameterOrderIndex                      */ 4361,
+/* MultienergyCTPathSequence                                      */ 1273,
+/* OphthalmicAxialLengthMeasurementsSegmentNameCodeSequence       */ 1719,
+/* ReasonForVisitCodeSequence                                     */ 2179,
+/* PrivateInformation                                             */ 21,
+/* WedgeTimeDelay                                                 */ 533,
+/* PixelValueTransformationSequence                               */ 2132,
+/* DeletionLock                                                   */ 3401,
+/* ComponentTypeCodeSequence                                      */ 3436,
+/* OverlayForegroundDensity                                       */ 3616,
+/* GeneratorPower                                                 */ 815,
+/* GapLength                                                      */ 3115,
+/* OOITypeDescriptor                                              */ 4728,
+/* PatientAdditionalPosition                                      */ 4059,
+/* ConfigurationID                                                */ 2088,
+/* SegmentedRedPaletteColorLookupTableData                        */ 2023,
+/* PatientBirthDate                                               */ 267,
+/* CroppingSpecificationNumber                                    */ 3175,
+/* HPGLDocumentSequence                                           */ 2982,
+/* RequestingAE                                                   */ 3403,
+/* BrachyPulseControlPointDeliveredSequence                       */ 3855,
+/* FindingsFlagTrial                                              */ 2458,
+/* ModifyingSystem                                                */ 3538,
+/* PlanePositionVolumeSequence                                    */ 1619,
+/* StartCardiacTriggerCountThreshold                              */ 1393,
+/* TableTopLateralPositionTolerance                               */ 3909,
+/* RepeatInterval                                                 */ 1933,
+/* EmptyImageDensity                                              */ 3583,
+/* IOLPowerForExactTargetRefraction                               */ 1722,
+/* RGBATransferFunctionDescription                                */ 3218,
+/* ChannelInnerLength                                             */ 4120,
+/* MultiplexGroupLabel                                            */ 2228,
+/* TargetLabel                                                    */ 921,
+/* NumberOfElements                                               */ 444,
+/* PositionerIsocenterSecondaryAngle                              */ 1326,
+/* DeliveryMaximumDose                                            */ 3886,
+/* TableTopPitchAdjustedAngle                                     */ 3371,
+/* SecondaryReviewerName                                          */ 378,
+/* CountLossNormalizationCorrected                                */ 1424,
+/* TotalNumberOfExposures                                         */ 2317,
+/* MultienergySourceTechnique                                     */ 1256,
+/* NumberOfTables                                                 */ 1988,
+/* RegisteredLocalizerBottomRightHandCorner                       */ 1771,
+/* IonControlPointSequence                                        */ 4227,
+/* ConstraintViolationSignificance                                */ 3500,
+/* GraphicGroupDescription                                        */ 3086,
+/* DoseReferenceType                                              */ 3883,
+/* QueryRetrieveView                                              */ 74,
+/* DDLValue                                                       */ 2100,
+/* ImpedanceMeasurementCurrentType                                */ 2268,
+/* RGBLUTTransferFunction                                         */ 2047,
+/* BeltHeight                                                     */ 4725,
+/* AcquisitionDate                                                */ 57,
+/* DecimalPotentialVisualAcuity                                   */ 2698,
+/* NominalBeamEnergy                                              */ 4017,
+/* StorageURL                                                     */ 2441,
+/* DecouplingChemicalShiftReference                               */ 1090,
+/* RegionLocationMaxX1                                            */ 956,
+/* ParallelRTBeamDelimiterDeviceOrientationLabelCodeSequence      */ 4334,
+/* CoefficientCoding                                              */ 1976,
+/* FindingsGroupRecordingDateTrial                                */ 2463,
+/* ScheduledStepAttributesSequence                                */ 2308,
+/* IdentifierCodeSequenceTrial                                    */ 2479,
+/* DiffusionAnisotropyType                                        */ 1136,
+/* PatientMotionCorrected                                         */ 1423,
+/* TimeOfFlightInformationUsed                                    */ 1416,
+/* GPSVersionID                                                   */ 625,
+/* BeamLimitingDeviceToleranceSequence                            */ 3900,
+/* TemplateName                                                   */ 4110,
+/* ReceiverSettingsSequence                                       */ 461,
+/* CollimatorUpperHorizontalEdge                                  */ 899,
+/* CTGeometrySequence                                             */ 1213,
+/* OverlayMode                                                    */ 3618,
+/* SpecificCharacterSetOfFileSetDescriptorFile                    */ 24,
+/* PerformingPhysicianIdentificationSequence                      */ 157,
+/* HumanPerformerOrganization                                     */ 2431,
+/* RTSegmentAnnotationIndex                                       */ 4545,
+/* Tagging                                                        */ 1062,
+/* DirectSegmentReferenceSequence                                 */ 4519,
+/* BiPlaneAcquisitionSequence                                     */ 2062,
+/* MRSpectroscopyFrameTypeSequence                                */ 1173,
+/* ROIObservationLabel                                            */ 3749,
+/* MatrixSequence                                                 */ 3132,
+/* CoordinateSystemDataSetMapping                                 */ 402,
+/* PixelMeasuresSequence                                          */ 2130,
+/* ROIDescription                                                 */ 3729,
+/* ConnectorType                                                  */ 524,
+/* BrachyControlPointDeliveredSequence                            */ 3848,
+/* MRVelocityEncodingSequence                                     */ 1163,
+/* ConfigurationInformationDescription                            */ 3588,
+/* IlluminationColorCodeSequence                                  */ 2725,
+/* LocalNamespaceEntityID                                         */ 2286,
+/* InterpretationID                                               */ 4656,
+/* CenterOfRotation                                               */ 2922,
+/* SelectorAttribute                                              */ 3243,
+/* ImageGeometryType                                              */ 1533,
+/* AdmittingDiagnosesDescription                                  */ 162,
+/* ActualFrameDuration                                            */ 833,
+/* AlternateBeamDoseType                                          */ 3933,
+/* FindingsSourceCategoryCodeSequenceTrial                        */ 2465,
+/* TotalNumberOfPiecesOfMediaCreated                              */ 3660,
+/* MediaDisposition                                               */ 3653,
+/* FilterByCategory                                               */ 3320,
+/* SecondaryPositionerScanArc                                     */ 1343,
+/* FractionNumber                                                 */ 3681,
+/* FrameLaterality                                                */ 1571,
+/* TableTraverse                                                  */ 785,
+/* AudioType                                                      */ 4763,
+/* ImagedVolumeWidth                                              */ 2708,
+/* SourceManufacturer                                             */ 4089,
+/* ProductPackageIdentifier                                       */ 2594,
+/* ReferencedHPGLDocumentID                                       */ 3013,
+/* RetrieveAETitle                                                */ 75,
+/* CurrentObserverTrial                                           */ 2532,
+/* OverlayRepeatInterval                                          */ 4801,
+/* EventTimerNames                                                */ 208,
+/* AlgorithmRoutingCodeSequence                                   */ 4726,
+/* RadiationMode                                                  */ 808,
+/* EXIFVersion                                                    */ 582,
+/* AlphaPaletteColorLookupTableDescriptor                         */ 2009,
+/* IntendedStartDayOfWeek                                         */ 4617,
+/* CompensatorRows                                                */ 3982,
+/* NonconformingDataElementValue                                  */ 3535,
+/* XFocusCenter                                                   */ 819,
+/* PrivateDataElementEncoding                                     */ 144,
+/* ExposureControlSensingRegionsSequence                          */ 1306,
+/* TableTopLongitudinalSetupDisplacement                          */ 4081,
+/* ApexPosition                                                   */ 1613,
+/* ReferencedPTOSequence                                          */ 4739,
+/* Density                                                        */ 4681,
+/* AverageBeamDosePointSSD                                        */ 3930,
+/* SteadyStatePulseSequence                                       */ 1052,
+/* MachineSpecificTreatmentTerminationCodeSequence                */ 4417,
+/* TreatmentControlPointDate                                      */ 3777,
+/* OriginalImplantTemplateSequence                                */ 2973,
+/* TableTopVerticalPositionTolerance                              */ 3907,
+/* DischargeDiagnosisDescription                                  */ 2209,
+/* OperatingModeType                                              */ 1151,
+/* PlateID                                                        */ 712,
+/* OphthalmicThicknessMapQualityThresholdSequence                 */ 1765,
+/* PresentationLUTFlag                                            */ 3561,
+/* MaximumCornealCurvatureSequence                                */ 2686,
+/* VerticalOffsetOfSensor                                         */ 419,
+/* DetectorTemperature                                            */ 997,
+/* FrameLabel                                                     */ 1627,
+/* VOIType                                                        */ 3341,
+/* PatientBirthTime                                               */ 268,
+/* AllowLossyCompression                                          */ 3664,
+/* ReasonForTheRequestedProcedure                                 */ 2370,
+/* RadiationSourceAxisDistance                                    */ 4330,
+/* CompensatorPixelSpacing                                        */ 3984,
+/* RTTreatmentTerminationReasonCodeSequence                       */ 4416,
+/* RTImageName                                                    */ 3667,
+/* DoseRateSet                                                    */ 4018,
+/* OffsetOfTheFirstDirectoryRecordOfTheRootDirectoryEntity        */ 25,
+/* SecondaryCaptureDeviceManufacturer                             */ 724,
+/* RectilinearPhaseEncodeReordering                               */ 1067,
+/* ScheduledStationNameCodeSequence                               */ 2420,
+/* DosimetricObjectiveTypeCodeSequence                            */ 4593,
+/* RTBeamLimitingDeviceOpeningSequence                            */ 4352,
+/* OCTAcquisitionDomain                                           */ 2762,
+/* IlluminationTypeCodeSequence                                   */ 1651,
+/* RTAccessoryHolderSlotSequence                                  */ 4283,
+/* OverlayPlanes                                                  */ 4788,
+/* MeasuredDoseReferenceNumber                                    */ 3806,
+/* ProcedureTypeCodeSequence                                      */ 3433,
+/* TissueHeterogeneityCorrection                                  */ 3702,
+/* QRMeasurementsSequence                                         */ 4735,
+/* DisplaySetScrollingGroup                                       */ 3303,
+/* ScheduledStudyStartDate                                        */ 2160,
+/* ReceiveCoilType                                                */ 1073,
+/* FiducialDescription                                            */ 3136,
 /* ShowAcquisitionTechniquesFlag                                  */ 3348,
-/* ShowGraphicAnnotationFlag                                      */ 3346,
-/* ShowGrayscaleInverted                                          */ 3344,
-/* ShowImageTrueSizeFlag                                          */ 3345,
-/* ShowPatientDemographicsFlag                                    */ 3347,
-/* ShowTickLabel                                                  */ 3119,
-/* ShutterLeftVerticalEdge                                        */ 877,
-/* ShutterLowerHorizontalEdge                                     */ 880,
-/* ShutterOverlayGroup                                            */ 885,
-/* ShutterPresentationColorCIELabValue                            */ 886,
-/* ShutterPresentationValue                                       */ 884,
-/* ShutterRightVerticalEdge                                       */ 878,
-/* ShutterShape                                                   */ 876,
-/* ShutterSpeedValue                                              */ 583,
-/* ShutterUpperHorizontalEdge                                     */ 879,
-/* SignalDomainColumns                                            */ 2127,
-/* SignalDomainRows                                               */ 2133,
-/* SignalToNoiseRatio                                             */ 1738,
-/* Signature                                                      */ 3522,
-/* SimpleFrameList                                                */ 183,
-/* SimulatedKeratometricCylinderSequence                          */ 2690,
-/* SingleCollimationWidth                                         */ 1207,
-/* SkipBeats                                                      */ 774,
-/* SkipFrameRangeFlag                                             */ 258,
-/* SlabOrientation                                                */ 1124,
-/* SlabThickness                                                  */ 1123,
-/* SliceLocation                                                  */ 1550,
-/* SliceLocationVector                                            */ 912,
-/* SliceProgressionDirection                                      */ 2835,
-/* SliceSensitivityFactor                                         */ 2857,
-/* SliceThickness                                                 */ 685,
-/* SliceVector                                                    */ 2815,
-/* SlideIdentifier                                                */ 2359,
-/* SmallestImagePixelValue                                        */ 1951,
-/* SmallestImagePixelValueInPlane                                 */ 1955,
-/* SmallestPixelValueInSeries                                     */ 1953,
-/* SmallestValidPixelValue                                        */ 1949,
-/* SmokingStatus                                                  */ 316,
-/* SmoothingType                                                  */ 3577,
-/* SnoutID                                                        */ 4171,
-/* SnoutPosition                                                  */ 4170,
-/* SnoutPositionTolerance                                         */ 3902,
-/* SnoutSequence                                                  */ 4169,
-/* SoftTissueFocusThermalIndex                                    */ 939,
-/* SoftTissueSurfaceThermalIndex                                  */ 940,
-/* SoftTissueThermalIndex                                         */ 938,
-/* SoftcopyVOILUTSequence                                         */ 2060,
-/* SoftwareVersions                                               */ 730,
-/* SortByCategory                                                 */ 3338,
-/* SortingDirection                                               */ 3339,
-/* SortingOperationsSequence                                      */ 3337,
-/* SoundPathLength                                                */ 480,
-/* SourceAcquisitionBeamNumber                                    */ 1493,
-/* SourceAcquisitionProtocolElementNumber                         */ 1492,
-/* SourceApplicationEntityTitle                                   */ 7,
-/* SourceApplicatorID                                             */ 4131,
-/* SourceApplicatorLength                                         */ 4134,
-/* SourceApplicatorManufacturer                                   */ 4135,
-/* SourceApplicatorName                                           */ 4133,
-/* SourceApplicatorNumber                                         */ 4130,
-/* SourceApplicatorStepSize                                       */ 4138,
-/* SourceApplicatorTipLength                                      */ 4122,
-/* SourceApplicatorType                                           */ 4132,
-/* SourceApplicatorWallNominalThickness                           */ 4136,
-/* SourceApplicatorWallNominalTransmission                        */ 4137,
-/* SourceAxisDistance                                             */ 3942,
-/* SourceConceptualVolumeSequence                                 */ 4508,
-/* SourceConceptualVolumeUID                                      */ 4505,
-/* SourceDescription                                              */ 4093,
-/* SourceEncapsulationNominalThickness                            */ 4094,
-/* SourceEncapsulationNominalTransmission                         */ 4095,
-/* SourceEndDateTime                                              */ 1258,
-/* SourceFrameOfReferenceUID                                      */ 2894,
-/* SourceHangingProtocolSequence                                  */ 3238,
-/* SourceIdentifier                                               */ 2186,
-/* SourceImageCornealProcessedDataSequence                        */ 2700,
-/* SourceImageEvidenceSequence                                    */ 247,
+/* MaximumNominalEnergy                                           */ 4396,
 /* SourceImageIDs                                                 */ 1558,
-/* SourceImageSequence                                            */ 199,
-/* SourceInstanceSequence                                         */ 2591,
-/* SourceIrradiationEventSequence                                 */ 239,
-/* SourceIsotopeHalfLife                                          */ 4097,
-/* SourceIsotopeName                                              */ 4096,
-/* SourceManufacturer                                             */ 4089,
-/* SourceModelID                                                  */ 4092,
-/* SourceMovementType                                             */ 4127,
-/* SourceNumber                                                   */ 4087,
-/* SourceOfAnteriorChamberDepthDataCodeSequence                   */ 1732,
-/* SourceOfCorneaMeasurementDataCodeSequence                      */ 2659,
-/* SourceOfCornealSizeDataCodeSequence                            */ 1693,
-/* SourceOfLensThicknessDataCodeSequence                          */ 1731,
-/* SourceOfOphthalmicAxialLengthCodeSequence                      */ 1692,
-/* SourceOfPreviousValues                                         */ 3539,
-/* SourceOfRefractiveMeasurementsCodeSequence                     */ 1734,
-/* SourceOfRefractiveMeasurementsSequence                         */ 1733,
-/* SourceOrientation                                              */ 4723,
-/* SourcePatientGroupIdentificationSequence                       */ 264,
-/* SourcePosition                                                 */ 4724,
-/* SourcePresentationAddress                                      */ 10,
-/* SourceReconstructionProtocolElementNumber                      */ 1494,
+/* KeratometricAxis                                               */ 2646,
+/* UserSelectedOffsetX                                            */ 505,
+/* ChannelWidth                                                   */ 2631,
+/* TestResult                                                     */ 2118,
+/* AudioSampleData                                                */ 4769,
+/* StructureSetName                                               */ 3716,
+/* DetectorZPositionToIsocenter                                   */ 1373,
+/* PrescriptionNotes                                              */ 4606,
+/* SourceStrengthReferenceDate                                    */ 4101,
+/* ApplicatorType                                                 */ 4010,
+/* ProbeCenterLocationX                                           */ 478,
+/* ImageBoxSmallScrollAmount                                      */ 3314,
+/* FindingsGroupRecordingTimeTrial                                */ 2464,
+/* ScheduledProcedureStepStartDateTime                            */ 2405,
+/* DetectorPositionSequence                                       */ 1360,
+/* RTTreatmentTerminationStatus                                   */ 4415,
+/* CompensatorRelativeStoppingPowerRatio                          */ 4159,
+/* ReferencedGeneralPurposeScheduledProcedureStepSequence         */ 2413,
+/* SamplingStepSize                                               */ 3191,
+/* RadiopharmaceuticalInformationSequence                         */ 2790,
+/* WaveformAnnotationSequence                                     */ 2566,
+/* RelatedFrameOfReferenceUID                                     */ 3763,
+/* DataSetType                                                    */ 68,
+/* CalibrationSequence                                            */ 1320,
+/* ReferencedFractionNumber                                       */ 3859,
+/* Component1ReferencedID                                         */ 3442,
+/* PatientOrientationModifierCodeSequence                         */ 2833,
+/* Sharpness                                                      */ 615,
+/* GeneticModificationsSequence                                   */ 286,
+/* SeriesDescription                                              */ 150,
+/* CoefficientsSDVN                                               */ 4831,
+/* EffectiveRefractiveIndex                                       */ 2761,
+/* OptotypePresentation                                           */ 2650,
+/* DVHNumberOfBins                                                */ 3708,
+/* SurfaceCount                                                   */ 2934,
+/* VisitComments                                                  */ 2223,
+/* GreenPaletteColorLookupTableData                               */ 2016,
+/* ScheduledPatientInstitutionResidence                           */ 2204,
+/* ReferencedRTRadiationSequence                                  */ 4315,
+/* OrderEnteredBy                                                 */ 2393,
+/* TimeSlotVector                                                 */ 2811,
+/* HistogramExplanation                                           */ 2870,
+/* PrivateDataElementCharacteristicsSequence                      */ 129,
+/* PresentationPixelMagnificationRatio                            */ 3084,
+/* ParameterItemIndex                                             */ 3805,
+/* MonoenergeticEnergyEquivalent                                  */ 1276,
+/* MeasuredMetersetToDoseMappingSequence                          */ 4441,
+/* NumberOfStudyRelatedSeries                                     */ 1555,
+/* ObliqueCroppingPlaneSequence                                   */ 3172,
+/* NumberOfRRIntervals                                            */ 2808,
+/* VerificationFlag                                               */ 2553,
+/* AssigningJurisdictionCodeSequence                              */ 2291,
+/* CardiacFramingType                                             */ 749,
+/* AcquisitionContextSequence                                     */ 2349,
+/* PixelDataAreaOriginRelativeToFOV                               */ 1021,
+/* MACAlgorithm                                                   */ 3516,
+/* BeamLimitingDeviceRotationDirection                            */ 4026,
+/* MRAcquisitionPhaseEncodingStepsInPlane                         */ 1174,
+/* RTBeamDelimiterGeometrySequence                                */ 4342,
+/* DetectorGeometry                                               */ 1401,
+/* ReferencedFractionGroupNumber                                  */ 4457,
+/* DataSetTrailingPadding                                         */ 4840,
+/* RTImageDescription                                             */ 3668,
+/* RangeModulatorGatingStartValue                                 */ 4207,
+/* TransducerData                                                 */ 931,
+/* MatingFeatureID                                                */ 3008,
+/* IVUSAcquisition                                                */ 923,
+/* ReferencedSOPInstanceUID                                       */ 179,
+/* TreatmentToleranceViolationCauseCodeSequence                   */ 4440,
 /* SourceRollAngle                                                */ 4388,
-/* SourceSequence                                                 */ 4086,
-/* SourceSerialNumber                                             */ 3832,
-/* SourceStartDateTime                                            */ 1257,
-/* SourceStrength                                                 */ 4100,
-/* SourceStrengthReferenceDate                                    */ 4101,
-/* SourceStrengthReferenceTime                                    */ 4102,
-/* SourceStrengthUnits                                            */ 4098,
-/* SourceToApplicatorMountingPositionDistance                     */ 4246,
-/* SourceToBeamLimitingDeviceDistance                             */ 3945,
-/* SourceToBlockTrayDistance                                      */ 3996,
-/* SourceToCompensatorDistance                                    */ 4154,
-/* SourceToCompensatorTrayDistance                                */ 3981,
-/* SourceToExternalContourDistance                                */ 4039,
-/* SourceToGeneralAccessoryDistance                               */ 4239,
-/* SourceToPatientSurfaceDistance                                 */ 4318,
-/* SourceToReferenceObjectDistance                                */ 3680,
-/* SourceToSurfaceDistance                                        */ 4037,
-/* SourceToWedgeTrayDistance                                      */ 3970,
-/* SourceType                                                     */ 4088,
-/* SourceWaveformSequence                                         */ 2235,
-/* SpacingBetweenSlices                                           */ 702,
-/* SpatialFrequencyResponseColumnNames                            */ 562,
-/* SpatialFrequencyResponseColumns                                */ 561,
-/* SpatialFrequencyResponseRows                                   */ 560,
-/* SpatialFrequencyResponseValues                                 */ 563,
-/* SpatialLocationsPreserved                                      */ 2034,
-/* SpatialPresaturation                                           */ 1061,
-/* SpatialResolution                                              */ 744,
-/* SpatialTransformOfDose                                         */ 3694,
-/* SpecialNeeds                                                   */ 2211,
-/* SpecificAbsorptionRateDefinition                               */ 1153,
-/* SpecificAbsorptionRateSequence                                 */ 1178,
-/* SpecificAbsorptionRateValue                                    */ 1155,
-/* SpecificCharacterSet                                           */ 43,
-/* SpecificCharacterSetOfFileSetDescriptorFile                    */ 24,
-/* SpecificationSelectionGuidance                                 */ 3497,
-/* SpecifiedChannelTotalTime                                      */ 3838,
-/* SpecifiedMeterset                                              */ 3791,
-/* SpecifiedNumberOfPulses                                        */ 3840,
-/* SpecifiedPrimaryMeterset                                       */ 3783,
-/* SpecifiedPulseRepetitionInterval                               */ 3842,
-/* SpecifiedSecondaryMeterset                                     */ 3784,
-/* SpecifiedTreatmentTime                                         */ 3787,
-/* SpecimenAccessionNumber                                        */ 2337,
+/* RightLensSequence                                              */ 2620,
+/* RadiationDoseIdentificationIndex                               */ 4270,
+/* SurfacePointColorCIELabValueData                               */ 3472,
+/* ViewModifierCodeSequence                                       */ 2825,
+/* SortingDirection                                               */ 3339,
+/* ArchiveRequested                                               */ 2554,
+/* VolumetricPresentationInputNumber                              */ 3162,
+/* LensModel                                                      */ 621,
+/* DynamicRange                                                   */ 941,
+/* ObservationTimeTrial                                           */ 2522,
+/* SourceFrameOfReferenceUID                                      */ 2894,
+/* ReportNumber                                                   */ 1535,
+/* SourceApplicatorID                                             */ 4131,
+/* SOPInstanceUID                                                 */ 52,
+/* IsocenterToBlockTrayDistance                                   */ 3997,
+/* RealWorldValueLUTData                                          */ 2451,
+/* BoneThermalIndex                                               */ 936,
+/* TopicAuthor                                                    */ 3508,
+/* ImageScaleRepresentation                                       */ 4738,
+/* ParallelReductionFactorSecondInPlane                           */ 1142,
+/* EffectiveBinEnergy                                             */ 1262,
+/* RadiationDoseIdentificationSequence                            */ 4291,
+/* DirectoryRecordType                                            */ 32,
+/* ASLBolusCutoffDelayTime                                        */ 1196,
+/* CardiacSignalSource                                            */ 1109,
+/* TranslationRateY                                               */ 512,
+/* StereoHorizontalPixelOffset                                    */ 1647,
+/* AlgorithmCodeSequenceTrial                                     */ 2527,
+/* VitalStainCodeSequenceTrial                                    */ 2368,
+/* DocumentAuthorIdentifierCodeSequenceTrial                      */ 2478,
+/* MaterialNotes                                                  */ 369,
+/* CustomRendered                                                 */ 606,
+/* ScheduledHumanPerformersSequence                               */ 2429,
+/* ImplantTemplate3DModelSurfaceNumber                            */ 2996,
+/* TotalPixelMatrixRows                                           */ 2712,
+/* PerformedStationAETitle                                        */ 2295,
+/* InstanceLevelReferencedPerformedProcedureStepSequence          */ 4552,
+/* TypeOfInstances                                                */ 2580,
+/* UnformattedTextValue                                           */ 3048,
+/* ZoomFactor                                                     */ 1920,
+/* ASLCrusherFlowLimit                                            */ 1191,
+/* SynchronizationChannel                                         */ 756,
+/* EnergyWeightingFactor                                          */ 1247,
+/* CodingSchemeURLType                                            */ 105,
+/* OutlineShapeType                                               */ 887,
+/* RouteSegmentEndLocationID                                      */ 4688,
+/* PerformedStationName                                           */ 2296,
+/* TransducerBeamSteeringCodeSequence                             */ 1444,
+/* ReasonForStudy                                                 */ 2166,
+/* InstructionDescription                                         */ 1470,
+/* Component2ReferencedID                                         */ 3445,
+/* RadiationSetting                                               */ 806,
 /* SpecimenDescriptionSequence                                    */ 2351,
-/* SpecimenDescriptionSequenceTrial                               */ 2346,
-/* SpecimenDescriptionTrial                                       */ 2347,
-/* SpecimenDetailedDescription                                    */ 2355,
-/* SpecimenIdentifier                                             */ 2345,
-/* SpecimenLabelInImage                                           */ 2714,
-/* SpecimenLocalizationContentItemSequence                        */ 2358,
-/* SpecimenPreparationSequence                                    */ 2356,
-/* SpecimenPreparationStepContentItemSequence                     */ 2357,
-/* SpecimenReferenceSequence                                      */ 2726,
-/* SpecimenSequence                                               */ 2344,
-/* SpecimenShortDescription                                       */ 2354,
+/* ReferencedPresentationStateSequence                            */ 254,
+/* MetersetRateSet                                                */ 3793,
+/* ProductParameterSequence                                       */ 2606,
+/* BolusDefinitionSequence                                        */ 4381,
+/* TotalReferenceAirKerma                                         */ 4111,
+/* ZonalMapNumberFormat                                           */ 1982,
+/* ChannelMode                                                    */ 2261,
+/* CodeLabel                                                      */ 1987,
+/* VerticalAlignment                                              */ 3099,
+/* ThreeDImplantTemplateGroupMemberMatchingPoint                  */ 3456,
+/* ImageComments                                                  */ 1565,
+/* NonDICOMOutputCodeSequence                                     */ 2427,
+/* OffsetOfReferencedLowerLevelDirectoryEntity                    */ 31,
+/* ExcessiveFixationLosses                                        */ 1823,
+/* ExtendedOffsetTableLengths                                     */ 4827,
+/* MediaInstalledSequence                                         */ 3565,
+/* DistanceReceptorPlaneToDetectorHousing                         */ 1299,
+/* Underlined                                                     */ 3104,
+/* GainControl                                                    */ 612,
+/* ShowGraphicAnnotationFlag                                      */ 3346,
+/* DisplaySetPresentationGroupDescription                         */ 3300,
+/* ImageSetNumber                                                 */ 3246,
+/* FloatPixelPaddingRangeLimit                                    */ 1961,
+/* ParallelAcquisitionTechnique                                   */ 1102,
+/* FailedSOPInstanceUIDList                                       */ 78,
+/* ProcedureStepRelationshipType                                  */ 3399,
+/* VolumetricAnnotationSequence                                   */ 3206,
+/* SourceApplicatorManufacturer                                   */ 4135,
+/* WholeSlideMicroscopyImageFrameTypeSequence                     */ 2360,
+/* HangingProtocolCreationDateTime                                */ 3234,
+/* ScanSpotPrescribedIndices                                      */ 4214,
+/* DeadTimeCorrected                                              */ 1421,
+/* FrequencyCorrection                                            */ 1121,
+/* RouteSegmentLocationIDType                                     */ 4689,
+/* CodeNumberFormat                                               */ 1986,
+/* TableZPositionToIsocenter                                      */ 1330,
+/* GPSStatus                                                      */ 634,
+/* ReferencedSetupImageSequence                                   */ 4230,
+/* FractionGroupDescription                                       */ 3913,
+/* TimeSlotTime                                                   */ 2814,
+/* FrameDisplaySequence                                           */ 256,
+/* NumberOfTomosynthesisSourceImages                              */ 867,
+/* PatientPhysiologicalStateCodeSequence                          */ 1432,
+/* NumberOfCompensators                                           */ 3975,
+/* TreatmentSite                                                  */ 4602,
+/* ShutterLeftVerticalEdge                                        */ 877,
+/* Component1ReferencedMatingFeatureID                            */ 3444,
+/* ObservationDescription                                         */ 3486,
+/* ContentQualification                                           */ 1041,
+/* ThreatDetectionAlgorithmandVersion                             */ 4697,
+/* OpticalOphthalmicAxialLengthMeasurementsSequence               */ 1744,
+/* SaturationRecovery                                             */ 1058,
+/* TestImageValidation                                            */ 2120,
+/* ProcedureStepProgressInformationSequence                       */ 3354,
+/* ReferenceGeometryCodeSequence                                  */ 1450,
+/* UsedFiducialsSequence                                          */ 3140,
+/* RTRadiationSequence                                            */ 4289,
+/* HorizontalPrismPower                                           */ 2625,
+/* FluenceDataSource                                              */ 3686,
+/* NumberOfBeams                                                  */ 3918,
+/* ScanLength                                                     */ 844,
+/* WedgeDefinitionSequence                                        */ 4347,
+/* ChannelStatus                                                  */ 2232,
+/* FiducialIdentifier                                             */ 3137,
+/* ReferencedDosimetricObjectivesSequence                         */ 4597,
+/* IntervalNumber                                                 */ 1517,
+/* FrameContentSequence                                           */ 1572,
+/* AcquisitionMethodAlgorithmSequence                             */ 1758,
+/* OrderEntererLocation                                           */ 2394,
+/* PrintJobDescriptionSequence                                    */ 3639,
+/* OnAxisBackgroundAnatomicStructureCodeSequenceTrial             */ 235,
+/* ScanMode                                                       */ 4166,
+/* IOLFormulaCodeSequence                                         */ 1689,
+/* FrameOfReferenceRelationshipSequence                           */ 3762,
+/* PrintQueueID                                                   */ 3637,
+/* ShieldingDeviceSequence                                        */ 4067,
+/* ChannelDisplaySequence                                         */ 2253,
+/* MeteringMode                                                   */ 589,
+/* DataSetSource                                                  */ 1898,
+/* ComponentReferenceSystem                                       */ 360,
+/* PerformedProcedureStepStartDate                                */ 2298,
+/* RefractiveErrorBeforeRefractiveSurgeryCodeSequence             */ 1720,
+/* ClinicalTrialSubjectID                                         */ 340,
+/* TargetLuminanceCharacteristicsSequence                         */ 2085,
+/* ActualCardiacTriggerTimePriorToRPeak                           */ 1578,
+/* GraphicObjectSequence                                          */ 3050,
+/* ProcedureStepProgressParametersSequence                        */ 3357,
+/* TwoDImplantTemplateGroupMemberMatchingPoint                    */ 3459,
+/* CTAcquisitionDetailsSequence                                   */ 1205,
+/* DistributionType                                               */ 355,
+/* CurveData                                                      */ 4774,
+/* HL7DocumentEffectiveTime                                       */ 2575,
+/* OverlayFormat                                                  */ 4805,
+/* CameraElevationAngle                                           */ 599,
+/* IOLPowerForExactEmmetropia                                     */ 1721,
+/* ResultsComments                                                */ 4661,
+/* ConceptCodeSequence                                            */ 2513,
+/* ComponentType                                                  */ 3199,
+/* IonControlPointDeliverySequence                                */ 3790,
+/* SegmentAlgorithmType                                           */ 2879,
+/* CornealAxis                                                    */ 2663,
+/* SelectorTMValue                                                */ 3270,
+/* DetailsOfCoefficients                                          */ 1973,
+/* PatientSizeCodeSequence                                        */ 296,
+/* GridFocalDistance                                              */ 1029,
+/* DisplayedAreaTopLeftHandCorner                                 */ 3066,
+/* MultiCoilDefinitionSequence                                    */ 1075,
+/* SelectorDTValue                                                */ 3262,
+/* PostDeformationMatrixRegistrationSequence                      */ 2900,
+/* CoordinateSystemAxisCodeSequence                               */ 2366,
+/* InterventionDrugCodeSequence                                   */ 670,
+/* WedgeMaterialVelocity                                          */ 529,
+/* SamplingFrequency                                              */ 2227,
+/* CornealVertexLocation                                          */ 2679,
+/* FloatingPointValue                                             */ 2509,
+/* TimeOfLastCalibration                                          */ 829,
+/* MaskFrameNumbers                                               */ 2072,
+/* CodeTableLocation                                              */ 1989,
+/* YCoordinatesCenterPixelViewAngle                               */ 1783,
+/* PrivateCreatorReference                                        */ 131,
+/* ContextGroupExtensionFlag                                      */ 106,
+/* QAResultsSequence                                              */ 2092,
+/* AssessmentTypeCodeSequence                                     */ 3493,
+/* SourcePosition                                                 */ 4724,
+/* CouplingMedium                                                 */ 476,
+/* RequestedSeriesDescription                                     */ 1491,
+/* EventElapsedTimes                                              */ 207,
+/* BreastSupportXPositionToIsocenter                              */ 1366,
+/* CompensatorShapeFabricationCodeSequence                        */ 4369,
+/* MREchoSequence                                                 */ 1128,
+/* ClinicalTrialProtocolEthicsCommitteeApprovalNumber             */ 353,
+/* VerifyingObserverSequence                                      */ 2480,
+/* PercentSampling                                                */ 706,
+/* SegmentAnnotationTypeModifierCodeSequence                      */ 4531,
+/* FieldOfViewSequence                                            */ 1304,
+/* HangingProtocolName                                            */ 3230,
+/* PlanesInAcquisition                                            */ 1292,
+/* ReplacedImplantTemplateGroupSequence                           */ 3452,
+/* DiffusionBValueYZ                                              */ 1384,
+/* AutoKVPLowerBound                                              */ 1504,
+/* FluoroscopyFlag                                                */ 1234,
+/* DriveType                                                      */ 494,
+/* AccessoryCode                                                  */ 3999,
+/* ScheduledPerformingPhysicianIdentificationSequence             */ 2279,
+/* ExposureMode                                                   */ 607,
+/* LeftLensSequence                                               */ 2621,
+/* PertinentDocumentsSequence                                     */ 2216,
+/* HeadFixationAngle                                              */ 4046,
+/* CommentsOnTheScheduledProcedureStep                            */ 2333,
+/* SequenceOfUltrasoundRegions                                    */ 950,
+/* NominalPercentageOfRespiratoryPhase                            */ 1597,
+/* AssessmentObservationsSequence                                 */ 3484,
+/* OphthalmicAxialLengthDataSourceDescription                     */ 1739,
+/* OphthalmicVolumetricPropertiesFlag                             */ 1791,
+/* CalculationComment                                             */ 1728,
+/* CountsIncluded                                                 */ 2863,
+/* ReferencedBolusSequence                                        */ 4467,
+/* NumberOfFractionPatternDigitsPerDay                            */ 3915,
+/* AttachedContours                                               */ 3744,
+/* SurgicalTechnique                                              */ 3434,
+/* TIDOffset                                                      */ 2075,
+/* IntendedPhaseStartDate                                         */ 4560,
+/* RecordedSnoutSequence                                          */ 3827,
+/* GraphicLayerOrder                                              */ 3070,
+/* AutorefractionRightEyeSequence                                 */ 2635,
+/* RefractiveIndexOfAqueousHumor                                  */ 2666,
+/* HistogramLastBinValue                                          */ 2868,
+/* TriggerWindow                                                  */ 777,
+/* MaskOperation                                                  */ 2070,
+/* BrachyApplicationSetupDoseSpecificationPoint                   */ 3937,
+/* ScreeningBaselineMeasured                                      */ 1891,
+/* ChannelTimeSkew                                                */ 2241,
+/* OverlayCompressionLabel                                        */ 4798,
+/* ChannelDeliveryContinuationSequence                            */ 3423,
+/* MaximumCornealCurvature                                        */ 2687,
+/* ExposureControlSensingRegionUpperHorizontalEdge                */ 1310,
+/* CompensatorDescription                                         */ 4162,
+/* PrimaryPositionerScanArc                                       */ 1342,
+/* DimensionOrganizationSequence                                  */ 1592,
+/* PrivateRecordUID                                               */ 33,
+/* BolusDescription                                               */ 3973,
+/* FrameLabelVector                                               */ 909,
+/* PupilDilated                                                   */ 1643,
+/* AsserterIdentificationSequence                                 */ 2611,
+/* ROIPhysicalProperty                                            */ 3756,
+/* ReferencedStorageMediaSequence                                 */ 3662,
+/* ReferencedFiducialUID                                          */ 3143,
+/* PositionerType                                                 */ 869,
+/* FrameSecondaryAngleVector                                      */ 911,
+/* FixedRTBeamDelimiterDeviceSequence                             */ 4336,
+/* ImplantTargetAnatomySequence                                   */ 2975,
+/* AttributeModificationDateTime                                  */ 3537,
 /* SpecimenTypeCodeSequence                                       */ 2353,
+/* InConcatenationTotalNumber                                     */ 1584,
+/* RequestedImageSizeFlag                                         */ 3601,
+/* AngularStep                                                    */ 796,
+/* GroupOfPatientsIdentificationSequence                          */ 265,
 /* SpecimenUID                                                    */ 2348,
-/* SpectralSensitivity                                            */ 573,
-/* SpectralWidth                                                  */ 1082,
-/* SpectrallySelectedExcitation                                   */ 1060,
-/* SpectrallySelectedSuppression                                  */ 1059,
-/* SpectroscopyAcquisitionDataColumns                             */ 1135,
-/* SpectroscopyAcquisitionOutOfPlanePhaseSteps                    */ 1140,
-/* SpectroscopyAcquisitionPhaseColumns                            */ 1176,
-/* SpectroscopyAcquisitionPhaseRows                               */ 1117,
-/* SpectroscopyData                                               */ 4785,
-/* SpecularReflectionIntensity                                    */ 3196,
-/* SpherePower                                                    */ 2676,
-/* SphericalLensPower                                             */ 1637,
-/* SpiralPitchFactor                                              */ 1212,
-/* Spoiling                                                       */ 1051,
-/* StackID                                                        */ 1568,
-/* StageCodeSequence                                              */ 2278,
-/* StageName                                                      */ 200,
-/* StageNumber                                                    */ 201,
-/* StandardOutputSensitivity                                      */ 577,
-/* StartAcquisitionDateTime                                       */ 1348,
-/* StartAngle                                                     */ 2820,
-/* StartCardiacTriggerCountThreshold                              */ 1393,
-/* StartCumulativeMetersetWeight                                  */ 4451,
-/* StartCumulativeTimeWeight                                      */ 3417,
+/* TherapeuticRoleCategoryCodeSequence                            */ 4584,
+/* SecondaryCountsType                                            */ 2853,
+/* WaveformDataDisplayScale                                       */ 2249,
+/* ClinicalTrialSiteName                                          */ 339,
+/* DestinationAE                                                  */ 3630,
+/* OffsetDirection                                                */ 1452,
+/* DoseReferenceDescription                                       */ 3880,
+/* FixationCheckedQuantity                                        */ 1818,
+/* PersonIdentificationCodeSequence                               */ 2383,
+/* DetectorConditionsNominalFlag                                  */ 996,
+/* SafePositionExitTime                                           */ 3850,
+/* SpecifiedChannelTotalTime                                      */ 3838,
+/* DeviceSerialNumber                                             */ 709,
+/* ImplantType                                                    */ 2971,
+/* TimeDomainFiltering                                            */ 1092,
+/* ConversionType                                                 */ 83,
+/* VectorCoordinateData                                           */ 2926,
+/* AlongScanSpatialResolution                                     */ 1669,
+/* CTAdditionalXRaySourceSequence                                 */ 1248,
+/* PhototimerSetting                                              */ 1038,
+/* HangingProtocolUserGroupName                                   */ 3237,
+/* RTVFlowRTPSamplingRate                                         */ 18,
+/* ManufacturerDeviceClassUID                                     */ 719,
+/* FileSetConsistencyFlag                                         */ 27,
+/* PredecessorProtocolSequence                                    */ 1461,
+/* AlgorithmType                                                  */ 1355,
+/* GantryType                                                     */ 4670,
+/* SurfaceSequence                                                */ 2902,
+/* InstructionPerformedDateTime                                   */ 1472,
+/* ToricIOLPowerForExactTargetRefractionSequence                  */ 1704,
+/* UniqueDeviceIdentifier                                         */ 717,
+/* ShieldingDeviceDescription                                     */ 4070,
+/* Radionuclide                                                   */ 672,
+/* InstanceAvailability                                           */ 77,
+/* FrameDimensionPointer                                          */ 1913,
+/* LengthToEnd                                                    */ 42,
+/* DataPointColumns                                               */ 2126,
+/* SourceHangingProtocolSequence                                  */ 3238,
+/* MaximumMemoryAllocation                                        */ 3556,
+/* PresentationSequenceCollectionUID                              */ 3153,
+/* GPSDestDistance                                                */ 651,
+/* HangingProtocolUserIdentificationCodeSequence                  */ 3236,
+/* PrinterName                                                    */ 3636,
+/* ReferencedSOPInstanceMACSequence                               */ 3528,
+/* StudyCompletionTime                                            */ 2174,
+/* StereoBaselineDisplacement                                     */ 1646,
+/* DerivationAlgorithmSequence                                    */ 1786,
+/* WedgeFactor                                                    */ 3966,
+/* ContourOffsetVector                                            */ 3741,
+/* ResultsNormalsSequence                                         */ 1843,
+/* RadiationMassNumber                                            */ 4163,
+/* GPSTrack                                                       */ 640,
+/* ApplicableFrameRange                                           */ 2071,
+/* AdditionalInspectionMethodSequence                             */ 4733,
+/* MeasuredCenterFrequency                                        */ 453,
+/* VolumeToTableMappingMatrix                                     */ 1615,
+/* ModifierCodeSequence                                           */ 2524,
+/* RetinalThicknessDefinitionCodeSequence                         */ 1761,
+/* DVHReferencedROISequence                                       */ 3710,
+/* ContentTime                                                    */ 65,
+/* USImageDescriptionSequence                                     */ 1437,
+/* DeviceIndex                                                    */ 4541,
+/* ContourGeometricType                                           */ 3739,
+/* RealWorldValueSlope                                            */ 2457,
+/* GradientOutput                                                 */ 1156,
+/* BlendingSequence                                               */ 3148,
+/* GraphicLayerRecommendedDisplayCIELabValue                      */ 3147,
+/* AverageBeamDosePointSourceToExternalContourDistance            */ 4038,
+/* NumberOfFocalPlanes                                            */ 2717,
+/* OOIOwnerType                                                   */ 4671,
+/* DisplaySetVerticalJustification                                */ 3350,
+/* RadionuclideTotalDose                                          */ 762,
+/* IntervalsRejected                                              */ 772,
+/* PartialViewDescription                                         */ 2032,
+/* TotalPixelMatrixFocalPlanes                                    */ 2740,
+/* TableTopEccentricAdjustedAngle                                 */ 3370,
+/* CurveDimensions                                                */ 4749,
+/* CenterOfCircularOutline                                        */ 892,
+/* ResponsibleGroupCodeSequence                                   */ 126,
+/* ISOSpeedLatitudeyyy                                            */ 580,
+/* IntraocularLensCalculationsLeftEyeSequence                     */ 1754,
+/* RelativeImagePositionCodeSequence                              */ 1658,
+/* InputReadinessState                                            */ 2434,
+/* ReplacedImplantTemplateSequence                                */ 2970,
+/* PatientBreedDescription                                        */ 325,
+/* MinimumNumberOfIntervalDays                                    */ 4564,
+/* DetectorActiveAreaOrientation                                  */ 1377,
+/* ChannelSequence                                                */ 4123,
+/* ProtocolDefinedPatientPosition                                 */ 1505,
+/* ROINumber                                                      */ 3726,
+/* InstitutionalDepartmentTypeCodeSequence                        */ 153,
+/* SynchronizedImageBoxList                                       */ 3329,
+/* SpatialResolution                                              */ 744,
 /* StartDensityThreshold                                          */ 1391,
-/* StartMeterset                                                  */ 3816,
-/* StartRelativeDensityDifferenceThreshold                        */ 1392,
+/* AngularViewVector                                              */ 2817,
+/* MeasurementPatternCodeSequence                                 */ 2122,
+/* LensSegmentType                                                */ 2629,
+/* SelectorATValue                                                */ 3259,
+/* RouteSegmentEndTime                                            */ 4694,
+/* OECFRows                                                       */ 556,
+/* DisplayFilterPercentage                                        */ 2134,
+/* ReferencedDoseReferenceSequence                                */ 4460,
+/* FrameOfReferenceToDisplayedCoordinateSystemTransformationMatrix */ 3133,
+/* TopicTitle                                                     */ 3506,
+/* RepetitionTime                                                 */ 694,
+/* ContrastBolusIngredientOpaque                                  */ 1298,
+/* SliceVector                                                    */ 2815,
+/* ChairHeadFramePositionTolerance                                */ 4053,
+/* ComponentID                                                    */ 3440,
+/* SubjectiveRefractionLeftEyeSequence                            */ 2652,
+/* ShieldingDeviceType                                            */ 4068,
+/* SegmentAnnotationTypeCodeSequence                              */ 4528,
+/* StimulusColorCodeSequence                                      */ 1811,
+/* TeletherapyRadiationType                                       */ 4555,
+/* ChemicalShiftSequence                                          */ 1108,
+/* DefaultSmoothingType                                           */ 3580,
+/* ChannelSourceSequence                                          */ 2233,
+/* ContributionDescription                                        */ 1508,
+/* InteroperabilityIndex                                          */ 623,
+/* TextValue                                                      */ 2508,
+/* TransducerApplicationCodeSequence                              */ 1445,
+/* PerFrameFunctionalGroupsSequence                               */ 4776,
+/* ConceptualVolumeBlockingConstraint                             */ 4588,
+/* ProcedureLastModifiedDate                                      */ 490,
+/* OphthalmicAxialMeasurementsDeviceType                          */ 1683,
+/* SpherePower                                                    */ 2676,
+/* DICOSVersion                                                   */ 4706,
 /* StartRespiratoryTriggerCountThreshold                          */ 1394,
-/* StartTrim                                                      */ 212,
-/* StartingMetersetValueKnownFlag                                 */ 4419,
-/* StartingRespiratoryAmplitude                                   */ 1598,
-/* StartingRespiratoryPhase                                       */ 1599,
+/* StudyVerifiedTime                                              */ 2157,
+/* NumberOfTemporalPositions                                      */ 1537,
+/* ChannelSensitivityCorrectionFactor                             */ 2239,
+/* IrradiationEventUID                                            */ 238,
+/* MAC                                                            */ 3529,
+/* ImplantName                                                    */ 1715,
+/* RequestedImageSize                                             */ 3598,
+/* TagAngleFirstAxis                                              */ 1054,
+/* HistogramSequence                                              */ 2865,
+/* EncapsulatedDocumentLength                                     */ 2593,
+/* CineRelativeToRealTime                                         */ 3318,
+/* TransducerOrientationSequence                                  */ 225,
+/* QualityControlSubjectTypeCodeSequence                          */ 277,
+/* NumberOfZeroFills                                              */ 1093,
+/* MagnifyToNumberOfColumns                                       */ 3615,
+/* ShutterSpeedValue                                              */ 583,
+/* OverlayBitsGrouped                                             */ 4802,
 /* StationAETitle                                                 */ 76,
-/* StationName                                                    */ 147,
-/* SteadyStatePulseSequence                                       */ 1052,
-/* SteepCornealAxisSequence                                       */ 2660,
-/* SteepKeratometricAxisSequence                                  */ 2643,
-/* SteeringAngle                                                  */ 970,
-/* StereoBaselineAngle                                            */ 1645,
-/* StereoBaselineDisplacement                                     */ 1646,
-/* StereoHorizontalPixelOffset                                    */ 1647,
-/* StereoPairsPresent                                             */ 1663,
-/* StereoPairsSequence                                            */ 1660,
-/* StereoRotation                                                 */ 1649,
-/* StereoVerticalPixelOffset                                      */ 1648,
-/* StimuliRetestingQuantity                                       */ 1824,
-/* StimulusArea                                                   */ 1813,
-/* StimulusColorCodeSequence                                      */ 1811,
-/* StimulusPresentationTime                                       */ 1814,
+/* RadiationSourceCoordinateSystemYawAngle                        */ 4625,
+/* TransverseDetectorSeparation                                   */ 1402,
+/* IssuerOfTheSpecimenIdentifierSequence                          */ 2352,
+/* DisplaySubsystemDescription                                    */ 2082,
+/* DecouplingMethod                                               */ 1089,
+/* TransformationAlgorithmSequence                                */ 1775,
+/* FovealSensitivity                                              */ 1864,
+/* ExposureTime                                                   */ 801,
+/* DigitizingDeviceTransportDirection                             */ 915,
+/* ContentCreatorName                                             */ 3078,
+/* InterpretationDiagnosisCodeSequence                            */ 4652,
+/* AnnotationClipping                                             */ 3210,
+/* EncryptedContentTransferSyntaxUID                              */ 3531,
 /* StimulusResults                                                */ 1870,
-/* StopTrim                                                       */ 213,
-/* StorageMediaFileSetID                                          */ 3503,
-/* StorageMediaFileSetUID                                         */ 3504,
-/* StorageProtocolElementSequence                                 */ 1490,
-/* StorageProtocolElementSpecificationSequence                    */ 1489,
-/* StorageURL                                                     */ 2441,
-/* StoredValueColorRangeSequence                                  */ 2027,
-/* StrainAdditionalInformation                                    */ 284,
-/* StrainCodeSequence                                             */ 285,
-/* StrainDescription                                              */ 278,
-/* StrainNomenclature                                             */ 279,
-/* StrainSource                                                   */ 283,
-/* StrainSourceRegistryCodeSequence                               */ 281,
-/* StrainStockNumber                                              */ 280,
-/* StrainStockSequence                                            */ 282,
-/* StructureSetDate                                               */ 3718,
-/* StructureSetDescription                                        */ 3717,
-/* StructureSetLabel                                              */ 3715,
-/* StructureSetName                                               */ 3716,
-/* StructureSetROISequence                                        */ 3725,
-/* StructureSetTime                                               */ 3719,
-/* StructuredConstraintObservationSequence                        */ 3487,
-/* StructuredDisplayBackgroundCIELabValue                         */ 3323,
+/* SourceWaveformSequence                                         */ 2235,
+/* DoseUnits                                                      */ 3692,
+/* ReconstructionTargetCenterLocationSequence                     */ 1498,
+/* XRayGridSequence                                               */ 1374,
+/* FractionGroupSummarySequence                                   */ 3858,
+/* OverlaySmoothingType                                           */ 3613,
+/* LocalizedDeviationProbability                                  */ 1852,
+/* InterpretationRecordedTime                                     */ 4639,
+/* ParallelReductionFactorOutOfPlane                              */ 1139,
+/* MydriaticAgentConcentration                                    */ 1676,
 /* StructuredDisplayImageBoxSequence                              */ 3325,
-/* StructuredDisplayTextBoxSequence                               */ 3326,
-/* StudiesContainingOtherReferencedInstancesSequence              */ 195,
-/* StudyArrivalDate                                               */ 2171,
-/* StudyArrivalTime                                               */ 2172,
-/* StudyComments                                                  */ 2181,
-/* StudyCompletionDate                                            */ 2173,
-/* StudyCompletionTime                                            */ 2174,
-/* StudyComponentStatusID                                         */ 2175,
-/* StudyDate                                                      */ 55,
-/* StudyDescription                                               */ 148,
-/* StudyID                                                        */ 1511,
-/* StudyIDIssuer                                                  */ 2155,
-/* StudyInstanceUID                                               */ 1509,
-/* StudyPriorityID                                                */ 2154,
-/* StudyReadDate                                                  */ 2158,
-/* StudyReadTime                                                  */ 2159,
-/* StudyStatusID                                                  */ 2153,
-/* StudyTime                                                      */ 62,
-/* StudyVerifiedDate                                              */ 2156,
-/* StudyVerifiedTime                                              */ 2157,
-/* SubjectArea                                                    */ 592,
-/* SubjectDistance                                                */ 588,
-/* SubjectDistanceRange                                           */ 617,
-/* SubjectLocation                                                */ 601,
-/* SubjectRelativePositionInImage                                 */ 266,
-/* SubjectiveRefractionLeftEyeSequence                            */ 2652,
-/* SubjectiveRefractionRightEyeSequence                           */ 2651,
-/* SubscriptionListStatus                                         */ 3406,
-/* SubstanceAdministrationApproval                                */ 2595,
-/* SubstanceAdministrationDateTime                                */ 2603,
-/* SubstanceAdministrationDeviceID                                */ 2605,
-/* SubstanceAdministrationNotes                                   */ 2604,
-/* SubstanceAdministrationParameterSequence                       */ 2607,
-/* SubtractionItemID                                              */ 2136,
-/* SupportedImageDisplayFormatsSequence                           */ 3567,
+/* TrianglePointIndexList                                         */ 2927,
+/* BitsGrouped                                                    */ 1934,
+/* ReferencedROINumber                                            */ 3748,
+/* ItineraryID                                                    */ 4715,
+/* RangeModulatorSettingsSequence                                 */ 4206,
+/* PerimeterTable                                                 */ 1935,
+/* InterpretationTranscriber                                      */ 4644,
+/* TreatmentPositionIndex                                         */ 4273,
+/* ContinuationPulseNumber                                        */ 3414,
+/* WADORSRetrievalSequence                                        */ 2585,
+/* ReferencedTDRInstanceSequence                                  */ 4740,
+/* XDSRetrievalSequence                                           */ 2584,
+/* SourceStrengthReferenceTime                                    */ 4102,
+/* RenderingMethod                                                */ 3168,
+/* MACIDNumber                                                    */ 3514,
+/* IndicationPhysicalPropertySequence                             */ 397,
+/* WedgeRearHeight                                                */ 545,
+/* DeliveredMeterset                                              */ 3792,
+/* MappingResource                                                */ 100,
+/* ImageOrientationPatient                                        */ 1528,
+/* ScheduledProcedureStepSequence                                 */ 2293,
+/* ThreeDDegreeOfFreedomAxis                                      */ 3017,
+/* RadiationChargeState                                           */ 4165,
+/* PatientBodyMassIndex                                           */ 297,
+/* PersonName                                                     */ 2500,
+/* TreatmentDeliveryContinuationFlag                              */ 4413,
+/* ClinicalTrialProtocolName                                      */ 337,
+/* VisualFieldCatchTrialSequence                                  */ 1817,
+/* PatientAddress                                                 */ 301,
+/* DimensionIndexPrivateCreator                                   */ 1591,
+/* OphthalmicFOV                                                  */ 1777,
+/* XRayGeometrySequence                                           */ 1337,
+/* SegmentedRTAccessoryDeviceSequence                             */ 4522,
+/* PurposeOfReferenceCodeSequence                                 */ 2515,
+/* TerminationTimeThreshold                                       */ 1398,
+/* PresentationPixelSpacing                                       */ 3082,
+/* OverlayComments                                                */ 4825,
+/* RTVFlowActualFrameDuration                                     */ 19,
+/* MetersetRate                                                   */ 4198,
+/* MRDiffusionSequence                                            */ 1130,
+/* VitreousStatusCodeSequence                                     */ 1688,
+/* AlgorithmParameters                                            */ 2942,
+/* TickAlignment                                                  */ 3118,
+/* ItineraryIDType                                                */ 4716,
+/* PhysicalDeltaY                                                 */ 965,
+/* ContrastBolusRoute                                             */ 734,
+/* TableTopVerticalPosition                                       */ 4032,
+/* FixationLightAzimuthalAngleTolerance                           */ 4054,
+/* ImplantAssemblyTemplateTargetAnatomySequence                   */ 3432,
+/* HL7StructuredDocumentReferenceSequence                         */ 2547,
+/* ReceivingPresentationAddress                                   */ 12,
+/* CompensatorMountingPosition                                    */ 4153,
+/* PerformingPhysicianName                                        */ 156,
+/* TrackSetNumber                                                 */ 2956,
+/* OpticalPathSequence                                            */ 2722,
+/* BoundingRectangle                                              */ 2995,
+/* PerformedProtocolType                                          */ 2307,
+/* RepairID                                                       */ 379,
+/* ROIObservationDescription                                      */ 3751,
+/* CompoundGraphicType                                            */ 3127,
+/* DeidentificationAction                                         */ 136,
+/* WaterReferencedPhaseCorrection                                 */ 1165,
+/* LongitudinalTemporalEventType                                  */ 345,
+/* DoubleFloatRealWorldValueFirstValueMapped                      */ 2453,
+/* FillerOrderNumberProcedure                                     */ 2375,
+/* ContentSequence                                                */ 2561,
+/* OuterDiameter                                                  */ 372,
+/* ImageType                                                      */ 45,
+/* PatientBirthName                                               */ 293,
+/* PrivateDataElementKeyword                                      */ 142,
+/* AdaptiveMapFormat                                              */ 1985,
+/* FrameIncrementPointer                                          */ 1912,
+/* CodingSchemeVersion                                            */ 98,
+/* NumberOfAlarmObjects                                           */ 4702,
+/* EventTimerSequence                                             */ 209,
+/* ColumnAngulationPatient                                        */ 1316,
+/* SnoutSequence                                                  */ 4169,
+/* FieldOfViewDimensionsInFloat                                   */ 1323,
+/* RecordedRangeModulatorSequence                                 */ 3830,
+/* ShowImageTrueSizeFlag                                          */ 3345,
+/* RegionOfResidence                                              */ 311,
+/* OphthalmicEnFaceImageQualityRatingSequence                     */ 1794,
+/* MaskSelectionMode                                              */ 2142,
+/* ContrastAdministrationProfileSequence                          */ 1238,
+/* CodingSchemeURL                                                */ 109,
+/* ImplantAssemblyTemplateVersion                                 */ 3427,
+/* BitsMappedToColorLookupTable                                   */ 2037,
+/* Impressions                                                    */ 4660,
+/* FunctionalGroupPointer                                         */ 1587,
+/* CTExposureSequence                                             */ 1222,
+/* TransmitTransducerSettingsSequence                             */ 472,
+/* CustodialOrganizationSequence                                  */ 2486,
+/* GridThickness                                                  */ 1025,
+/* CompensatorType                                                */ 3989,
+/* SpacingBetweenSlices                                           */ 702,
+/* ExcessiveFalsePositivesDataFlag                                */ 1840,
+/* ExposureBiasValue                                              */ 586,
+/* MultienergyDetectorType                                        */ 1266,
+/* PhotographicExposureIndex                                      */ 602,
+/* PatientSupportPositionToleranceSequence                        */ 4312,
+/* StrainDescription                                              */ 278,
+/* SourceReconstructionProtocolElementNumber                      */ 1494,
+/* FlashRedEyeMode                                                */ 571,
 /* SurfaceAsymmetryIndex                                          */ 2695,
-/* SurfaceComments                                                */ 2904,
-/* SurfaceCount                                                   */ 2934,
-/* SurfaceEntryPoint                                              */ 4036,
-/* SurfaceMeshPrimitivesSequence                                  */ 2914,
-/* SurfaceMeshZPixelOffset                                        */ 1804,
-/* SurfaceModelDescriptionSequence                                */ 2997,
-/* SurfaceModelLabel                                              */ 2998,
-/* SurfaceModelScalingFactor                                      */ 2999,
-/* SurfaceNumber                                                  */ 2903,
-/* SurfacePointColorCIELabValueData                               */ 3472,
-/* SurfacePointPresentationValueData                              */ 3471,
-/* SurfacePointsNormalsSequence                                   */ 2913,
-/* SurfacePointsSequence                                          */ 2912,
-/* SurfaceProcessing                                              */ 2905,
-/* SurfaceProcessingAlgorithmIdentificationSequence               */ 2944,
-/* SurfaceProcessingDescription                                   */ 2907,
-/* SurfaceProcessingRatio                                         */ 2906,
-/* SurfaceRegularityIndex                                         */ 2694,
-/* SurfaceScanAcquisitionTypeCodeSequence                         */ 3466,
-/* SurfaceScanModeCodeSequence                                    */ 3467,
-/* SurfaceSequence                                                */ 2902,
-/* SurgicalTechnique                                              */ 3434,
-/* SurgicallyInducedAstigmatismSequence                           */ 1698,
-/* SwitchingPhaseNominalDuration                                  */ 1260,
-/* SwitchingPhaseNumber                                           */ 1259,
-/* SwitchingPhaseTransitionDuration                               */ 1261,
-/* SwivelRange                                                    */ 3215,
-/* SynchronizationChannel                                         */ 756,
-/* SynchronizationFrameOfReferenceUID                             */ 1539,
-/* SynchronizationTrigger                                         */ 755,
-/* SynchronizedImageBoxList                                       */ 3329,
-/* SynchronizedScrollingSequence                                  */ 3302,
-/* SyringeCounts                                                  */ 739,
-/* SystemStatus                                                   */ 2083,
-/* SystemStatusComment                                            */ 2084,
-/* T2Preparation                                                  */ 1056,
-/* TDRType                                                        */ 4695,
-/* TIDOffset                                                      */ 2075,
-/* TIPType                                                        */ 4705,
-/* TMLinePositionX0                                               */ 976,
-/* TMLinePositionX0Retired                                        */ 975,
-/* TMLinePositionX1                                               */ 980,
-/* TMLinePositionX1Retired                                        */ 979,
-/* TMLinePositionY0                                               */ 978,
-/* TMLinePositionY0Retired                                        */ 977,
-/* TMLinePositionY1                                               */ 982,
-/* TMLinePositionY1Retired                                        */ 981,
-/* TableAngle                                                     */ 790,
-/* TableCradleTiltAngle                                           */ 1333,
-/* TableFeedPerRotation                                           */ 1211,
-/* TableFrameOfReferenceUID                                       */ 1624,
-/* TableHeadTiltAngle                                             */ 1332,
-/* TableHeight                                                    */ 784,
-/* TableHorizontalRotationAngle                                   */ 1331,
-/* TableLateralIncrement                                          */ 788,
-/* TableLongitudinalIncrement                                     */ 789,
-/* TableMotion                                                    */ 786,
-/* TableOfParameterValues                                         */ 994,
-/* TableOfPixelValues                                             */ 993,
-/* TableOfXBreakPoints                                            */ 990,
-/* TableOfYBreakPoints                                            */ 991,
-/* TablePosition                                                  */ 1228,
-/* TablePositionSequence                                          */ 1290,
-/* TableSpeed                                                     */ 1210,
-/* TableTopEccentricAdjustedAngle                                 */ 3370,
-/* TableTopEccentricAngle                                         */ 4030,
-/* TableTopEccentricAngleTolerance                                */ 3904,
-/* TableTopEccentricAxisDistance                                  */ 4029,
-/* TableTopEccentricRotationDirection                             */ 4031,
-/* TableTopLateralAdjustedPosition                                */ 3368,
-/* TableTopLateralPosition                                        */ 4034,
-/* TableTopLateralPositionTolerance                               */ 3909,
-/* TableTopLateralSetupDisplacement                               */ 4082,
-/* TableTopLongitudinalAdjustedPosition                           */ 3367,
-/* TableTopLongitudinalPosition                                   */ 4033,
+/* SeriesTime                                                     */ 63,
+/* IndexProbability                                               */ 1904,
+/* Optotype                                                       */ 2649,
+/* StudyCompletionDate                                            */ 2173,
+/* AdmittingTime                                                  */ 2206,
+/* VelocityEncodingDirection                                      */ 1112,
+/* VerifyingObserverName                                          */ 2482,
+/* CatheterDirectionOfRotation                                    */ 2777,
+/* ReferencedColorPaletteInstanceUID                              */ 1968,
+/* EquipmentReferencePointCodeSequence                            */ 4386,
+/* InsurancePlanIdentification                                    */ 302,
+/* OrganAtRiskLimitDose                                           */ 3892,
+/* RTControlPointIndex                                            */ 4267,
+/* CTDIPhantomTypeCodeSequence                                    */ 1244,
+/* DateOfGainCalibration                                          */ 430,
+/* BoundingBoxAnnotationUnits                                     */ 3045,
+/* HPGLDocumentID                                                 */ 2983,
+/* ReferencedBeamNumber                                           */ 4449,
+/* InstanceNumber                                                 */ 1514,
+/* PatientTelecomInformation                                      */ 313,
+/* TypeOfPatientID                                                */ 262,
+/* CompressionForce                                               */ 824,
+/* DataElementsSigned                                             */ 3517,
+/* FiducialSequence                                               */ 3145,
+/* ApplicableSafetyStandardAgency                                 */ 1148,
+/* VisualEvaluationTestSequence                                   */ 2117,
+/* ItemDelimitationItem                                           */ 4842,
+/* RTReferencedStudySequence                                      */ 3721,
+/* Manifold                                                       */ 2911,
+/* SegmentLabel                                                   */ 2876,
+/* HighBit                                                        */ 1947,
+/* ReceivingApplicationEntityTitle                                */ 9,
+/* SubjectDistance                                                */ 588,
+/* TreatmentMachineName                                           */ 3940,
+/* BeamDoseSpecificationPoint                                     */ 3919,
+/* BaselineCorrection                                             */ 1094,
+/* SpecimenReferenceSequence                                      */ 2726,
+/* ReferencedStoredPrintSequence                                  */ 3569,
+/* SensorTemperature                                              */ 420,
+/* ScheduledProcessingParametersSequence                          */ 3395,
+/* FailureAttributes                                              */ 3663,
+/* EvaluatorSequence                                              */ 386,
+/* SurfaceComments                                                */ 2904,
+/* CreatorVersionUID                                              */ 245,
+/* ReferencedWaveformChannels                                     */ 2494,
+/* IsocenterToCompensatorDistances                                */ 4158,
+/* WaveformPresentationGroupSequence                              */ 2251,
+/* InnerDiameter                                                  */ 373,
+/* MeasuredLateralDimension                                       */ 299,
+/* MappingResourceUID                                             */ 117,
+/* SpecificCharacterSet                                           */ 43,
+/* SetupTechnique                                                 */ 4072,
+/* DVHType                                                        */ 3691,
+/* BoundingBoxBottomRightHandCorner                               */ 3052,
+/* PrimaryDoseValueIndicator                                      */ 4294,
+/* ScheduledStudyStopDate                                         */ 2162,
+/* RadiationGenerationModeSequence                                */ 4389,
+/* InterlockCodeSequence                                          */ 4435,
+/* MRSpatialSaturationSequence                                    */ 1126,
+/* ContentDescription                                             */ 3075,
+/* GlobalCroppingSpecificationIndex                               */ 3167,
+/* LUTFunction                                                    */ 2143,
+/* NominalCardiacTriggerDelayTime                                 */ 1576,
+/* MultienergyCTXRaySourceSequence                                */ 1253,
+/* ReferencedFiducialsUID                                         */ 4533,
+/* SourceToWedgeTrayDistance                                      */ 3970,
+/* NominalEnergy                                                  */ 4394,
+/* RTAnatomicPrescriptionSequence                                 */ 4580,
+/* DataObservationSequence                                        */ 1902,
+/* VolumetricPresentationStateInputSequence                       */ 3156,
+/* SecondaryApprovalStatus                                        */ 375,
+/* VelocityOfSound                                                */ 484,
+/* DopplerSampleVolumeXPositionRetired                            */ 971,
+/* DecayFactor                                                    */ 2858,
+/* ResultingGeneralPurposePerformedProcedureStepsSequence         */ 2412,
+/* ShadingStyle                                                   */ 3192,
+/* VerificationImageTiming                                        */ 3374,
+/* SoftTissueSurfaceThermalIndex                                  */ 940,
+/* ScanSpotReordered                                              */ 4216,
+/* ExposureControlMode                                            */ 1035,
+/* CompensatorDivergence                                          */ 4152,
+/* AnatomicPerspectiveCodeSequenceTrial                           */ 231,
+/* BitsAllocated                                                  */ 1945,
+/* AlternateContentDescriptionSequence                            */ 3080,
+/* ContentItemModifierSequence                                    */ 2335,
+/* TreatmentSummaryCalculatedDoseReferenceSequence                */ 3797,
+/* PrimaryPositionerIncrementSign                                 */ 1350,
+/* Component2ReferencedMatingFeatureSetID                         */ 3446,
+/* SegmentedKSpaceTraversal                                       */ 1066,
+/* DopplerSampleVolumeXPosition                                   */ 972,
+/* RenderedImageReferenceSequence                                 */ 3155,
+/* PTOLocationDescription                                         */ 4741,
+/* EquipmentAdministratorSequence                                 */ 2077,
+/* RadiationDoseSourceToSkinDistance                              */ 4305,
+/* RTTreatmentPhaseIntervalSequence                               */ 4562,
+/* IsocenterToBeamLimitingDeviceDistance                          */ 3946,
 /* TableTopLongitudinalPositionTolerance                          */ 3908,
-/* TableTopLongitudinalSetupDisplacement                          */ 4081,
-/* TableTopPitchAdjustedAngle                                     */ 3371,
-/* TableTopPitchAngle                                             */ 4042,
+/* OphthalmicMappingDeviceType                                    */ 1756,
+/* InstanceCreationDate                                           */ 47,
+/* GantryDetectorSlew                                             */ 783,
+/* PhotographicSensitivity                                        */ 574,
+/* WaveformSampleInterpretation                                   */ 4781,
+/* HistogramFirstBinValue                                         */ 2867,
+/* StructureSetTime                                               */ 3719,
+/* RefractiveSurgeryTypeCodeSequence                              */ 1696,
+/* InstructionPerformedFlag                                       */ 1471,
+/* PageNumberVector                                               */ 908,
+/* ValueType                                                      */ 2470,
+/* MeanPointDistance                                              */ 2918,
+/* NegativeCatchTrialsQuantity                                    */ 1828,
+/* GraphicGroupID                                                 */ 3128,
+/* EdgePointIndexList                                             */ 2928,
+/* AssessmentRequesterSequence                                    */ 3490,
+/* TreatmentMachineSpecialModeCodeSequence                        */ 4319,
+/* ApprovalStatusFurtherDescription                               */ 2596,
 /* TableTopPitchAngleTolerance                                    */ 3905,
-/* TableTopPitchRotationDirection                                 */ 4043,
-/* TableTopRollAdjustedAngle                                      */ 3372,
-/* TableTopRollAngle                                              */ 4044,
-/* TableTopRollAngleTolerance                                     */ 3906,
-/* TableTopRollRotationDirection                                  */ 4045,
-/* TableTopVerticalAdjustedPosition                               */ 3366,
-/* TableTopVerticalPosition                                       */ 4032,
-/* TableTopVerticalPositionTolerance                              */ 3907,
-/* TableTopVerticalSetupDisplacement                              */ 4080,
-/* TableTraverse                                                  */ 785,
-/* TableType                                                      */ 791,
-/* TableVerticalIncrement                                         */ 787,
-/* TableXPositionToIsocenter                                      */ 1328,
-/* TableYPositionToIsocenter                                      */ 1329,
-/* TableZPositionToIsocenter                                      */ 1330,
-/* TagAngleFirstAxis                                              */ 1054,
-/* TagAngleSecondAxis                                             */ 1170,
-/* TagSpacingFirstDimension                                       */ 1064,
-/* TagSpacingSecondDimension                                      */ 1169,
-/* TagThickness                                                   */ 1068,
-/* Tagging                                                        */ 1062,
-/* TaggingDelay                                                   */ 1158,
-/* TangentialPower                                                */ 2704,
-/* TargetExposureIndex                                            */ 859,
-/* TargetFrameOfReferenceUID                                      */ 1477,
-/* TargetLabel                                                    */ 921,
-/* TargetLuminanceCharacteristicsSequence                         */ 2085,
-/* TargetMaterialSequence                                         */ 4736,
-/* TargetMaximumDose                                              */ 3889,
-/* TargetMaximumLuminance                                         */ 2107,
-/* TargetMinimumDose                                              */ 3887,
-/* TargetMinimumLuminance                                         */ 2106,
-/* TargetPositionReferenceIndicator                               */ 1548,
-/* TargetPrescriptionDose                                         */ 3888,
-/* TargetRefraction                                               */ 1694,
-/* TargetUID                                                      */ 918,
+/* TwoDPointCoordinates                                           */ 3029,
+/* IonWedgePositionSequence                                       */ 4229,
+/* PatientOrientationInFrameSequence                              */ 1626,
+/* SourceToGeneralAccessoryDistance                               */ 4239,
+/* PixelComponentPhysicalUnits                                    */ 987,
+/* WADORetrievalSequence                                          */ 2583,
+/* HPGLDocument                                                   */ 2988,
+/* TriggerSamplePosition                                          */ 757,
+/* DisplayedAreaBottomRightHandCorner                             */ 3067,
+/* DistanceSourceToSupport                                        */ 2321,
+/* ContrastBolusT1Relaxivity                                      */ 658,
+/* SourceConceptualVolumeSequence                                 */ 4508,
+/* CylinderPower                                                  */ 2677,
+/* DVHNormalizationDoseValue                                      */ 3704,
+/* ShiftTableTriplet                                              */ 3547,
+/* Decoupling                                                     */ 1086,
+/* BeamMeterset                                                   */ 3922,
+/* AnimationStepSize                                              */ 3214,
+/* DVHVolumeUnits                                                 */ 3707,
+/* NominalInterval                                                */ 747,
+/* ReferencedRTRadiationSetSequence                               */ 4407,
+/* InterpretationStatusID                                         */ 4659,
+/* SetupDeviceSequence                                            */ 4074,
+/* EnergyWindowCenterline                                         */ 674,
+/* GraphicAnnotationSequence                                      */ 3043,
+/* SecondaryReviewDate                                            */ 376,
+/* NumberOfBoli                                                   */ 3988,
+/* ScanOptions                                                    */ 663,
+/* SetupTechniqueDescription                                      */ 4073,
+/* ParameterValueNumber                                           */ 3809,
+/* MaterialIsolationDiameter                                      */ 365,
+/* DiffusionBValueYY                                              */ 1383,
+/* RecommendedPresentationOpacity                                 */ 2908,
+/* InterventionDescription                                        */ 682,
+/* MultienergyCTAcquisitionSequence                               */ 1250,
+/* DoubleExposureFieldDeltaTrial                                  */ 3378,
+/* SourceApplicatorName                                           */ 4133,
+/* RandomsCorrected                                               */ 1425,
+/* ReferencedObservationUIDTrial                                  */ 2517,
+/* YOffsetInSlideCoordinateSystem                                 */ 2363,
+/* MeasuredDoseDescription                                        */ 3771,
+/* StartCumulativeMetersetWeight                                  */ 4451,
+/* ScheduledProcedureStepStartDate                                */ 2270,
+/* CylinderSequence                                               */ 2623,
+/* TableTopEccentricAxisDistance                                  */ 4029,
+/* RegionPixelShiftSequence                                       */ 2146,
+/* RangeModulatorDescription                                      */ 4190,
+/* KeratometerIndex                                               */ 1691,
+/* ReconstructionIndex                                            */ 1630,
+/* ChannelEffectiveLength                                         */ 4119,
+/* SurfaceProcessingRatio                                         */ 2906,
+/* ApplicationSetupManufacturer                                   */ 4107,
+/* PreliminaryFlag                                                */ 2555,
+/* EquipmentFrameOfReferenceUID                                   */ 4383,
+/* AttributeToleranceValuesSequence                               */ 4310,
+/* LensSerialNumber                                               */ 622,
+/* NumberOfFilms                                                  */ 3632,
+/* CodingSchemeExternalID                                         */ 113,
+/* FloatPixelPaddingValue                                         */ 1959,
+/* RespiratoryCyclePosition                                       */ 1167,
+/* ExcessiveFixationLossesDataFlag                                */ 1822,
+/* SOPAuthorizationComment                                        */ 3512,
+/* PixelShiftSequence                                             */ 2145,
+/* CompressionCode                                                */ 1927,
+/* SceneCaptureType                                               */ 611,
+/* ColumnPositionInTotalImagePixelMatrix                          */ 2736,
+/* FilmSizeID                                                     */ 3573,
+/* ReferencedObservationClassTrial                                */ 2518,
+/* ClinicalTrialCoordinatingCenterName                            */ 346,
+/* RTPlanLabel                                                    */ 3865,
+/* SourceToExternalContourDistance                                */ 4039,
+/* CompensatorShapeSequence                                       */ 4370,
+/* ApplicatorApertureShape                                        */ 4242,
+/* ReconstructionDiameter                                         */ 778,
+/* CreationTime                                                   */ 3628,
+/* RangingDepth                                                   */ 2765,
+/* RationalDenominatorValue                                       */ 2511,
+/* ShapeType                                                      */ 3129,
+/* GateSettingsSequence                                           */ 482,
+/* WedgeRoofAngle                                                 */ 527,
+/* PhotometricInterpretation                                      */ 1908,
+/* ReferencedWaveformSequence                                     */ 173,
+/* DeliveryWarningDose                                            */ 3885,
+/* ImageBoxPresentationLUTFlag                                    */ 3562,
+/* CompressionLabel                                               */ 1929,
+/* EscapeTriplet                                                  */ 3542,
+/* ImageBoxLargeScrollAmount                                      */ 3316,
+/* BeamOrderIndex                                                 */ 3408,
+/* ChannelDerivationDescription                                   */ 2236,
+/* StimuliRetestingQuantity                                       */ 1824,
+/* RespiratoryTriggerDelayThreshold                               */ 1608,
+/* SliceSensitivityFactor                                         */ 2857,
+/* Damping                                                        */ 460,
+/* OphthalmicPatientClinicalInformationRightEyeSequence           */ 1888,
+/* FrameOfReferenceTransformationComment                          */ 3766,
+/* CTDIvol                                                        */ 1243,
+/* MaskSubtractionSequence                                        */ 2069,
+/* GPSLatitude                                                    */ 627,
+/* GraphicType                                                    */ 3059,
+/* MRFOVGeometrySequence                                          */ 1133,
+/* DeviceDiameterUnits                                            */ 2748,
+/* PatientSupportAdjustedAngle                                    */ 3369,
+/* WedgeID                                                        */ 3964,
+/* LongCodeValue                                                  */ 118,
+/* ApplicationSetupName                                           */ 4106,
+/* RadiopharmaceuticalVolume                                      */ 759,
+/* DocumentTitle                                                  */ 2588,
+/* PerformedWorkitemCodeSequence                                  */ 2415,
+/* IsocenterPosition                                              */ 4035,
+/* Laterality                                                     */ 1531,
+/* FilmOrientation                                                */ 3572,
+/* SpectroscopyAcquisitionPhaseRows                               */ 1117,
+/* IOLPower                                                       */ 1706,
+/* DosimetricObjectiveUID                                         */ 4594,
+/* ReferencePixelPhysicalValueX                                   */ 962,
+/* FluenceModeID                                                  */ 3690,
+/* OffsetDistance                                                 */ 1451,
+/* IntensifierActiveShape                                         */ 1300,
+/* FalseNegativesEstimateFlag                                     */ 1826,
+/* AnatomicRegionModifierSequence                                 */ 219,
 /* TargetUnderdoseVolumeFraction                                  */ 3890,
-/* TelephoneNumberTrial                                           */ 2539,
-/* TeletherapyRadiationType                                       */ 4555,
-/* Temperature                                                    */ 594,
-/* TemplateExtensionCreatorUID                                    */ 2572,
-/* TemplateExtensionFlag                                          */ 2570,
-/* TemplateExtensionOrganizationUID                               */ 2571,
-/* TemplateIdentifier                                             */ 2567,
-/* TemplateLocalVersion                                           */ 2569,
-/* TemplateName                                                   */ 4110,
-/* TemplateNumber                                                 */ 4108,
-/* TemplateType                                                   */ 4109,
-/* TemplateVersion                                                */ 2568,
-/* TemporalPositionIdentifier                                     */ 1536,
-/* TemporalPositionIndex                                          */ 1575,
-/* TemporalPositionSequence                                       */ 1621,
-/* TemporalPositionTimeOffset                                     */ 1618,
-/* TemporalRangeType                                              */ 2503,
-/* TemporalRelationshipIntervalAnchor                             */ 4563,
-/* TemporalResolution                                             */ 1538,
-/* TerminationCardiacTriggerCountThreshold                        */ 1399,
-/* TerminationCountsThreshold                                     */ 1395,
-/* TerminationDensityThreshold                                    */ 1396,
-/* TerminationRelativeDensityThreshold                            */ 1397,
-/* TerminationRespiratoryTriggerCountThreshold                    */ 1400,
-/* TerminationTimeThreshold                                       */ 1398,
-/* TestImageValidation                                            */ 2120,
-/* TestPatternCodeSequence                                        */ 2121,
-/* TestPointNormalsDataFlag                                       */ 1836,
-/* TestPointNormalsSequence                                       */ 1837,
-/* TestResult                                                     */ 2118,
-/* TestResultComment                                              */ 2119,
-/* TextColorCIELabValue                                           */ 3097,
-/* TextComments                                                   */ 4633,
-/* TextObjectSequence                                             */ 3049,
-/* TextString                                                     */ 3608,
-/* TextStyleSequence                                              */ 3093,
-/* TextValue                                                      */ 2508,
-/* TextureLabel                                                   */ 3474,
-/* TherapeuticRoleCategoryCodeSequence                            */ 4584,
-/* TherapeuticRoleTypeCodeSequence                                */ 4585,
-/* TherapyDescription                                             */ 681,
-/* TherapyType                                                    */ 679,
-/* ThreatCategory                                                 */ 4675,
-/* ThreatCategoryDescription                                      */ 4676,
-/* ThreatDetectionAlgorithmandVersion                             */ 4697,
-/* ThreatROIBase                                                  */ 4666,
-/* ThreatROIBitmap                                                */ 4668,
-/* ThreatROIExtents                                               */ 4667,
-/* ThreatROIVoxelSequence                                         */ 4665,
-/* ThreatSequence                                                 */ 4674,
-/* ThreeDDegreeOfFreedomAxis                                      */ 3017,
-/* ThreeDImplantTemplateGroupMemberMatchingAxes                   */ 3457,
-/* ThreeDImplantTemplateGroupMemberMatchingPoint                  */ 3456,
-/* ThreeDLineCoordinates                                          */ 3033,
-/* ThreeDMatingAxes                                               */ 3020,
-/* ThreeDMatingPoint                                              */ 3019,
-/* ThreeDPlaneNormal                                              */ 3037,
-/* ThreeDPlaneOrigin                                              */ 3036,
-/* ThreeDPointCoordinates                                         */ 3030,
-/* ThreeDRenderingType                                            */ 3336,
-/* ThresholdDensity                                               */ 3619,
-/* ThresholdSequence                                              */ 3226,
-/* ThresholdType                                                  */ 3228,
-/* ThresholdValue                                                 */ 3229,
-/* ThresholdValueSequence                                         */ 3227,
-/* TickAlignment                                                  */ 3118,
-/* TickLabel                                                      */ 3126,
-/* TickLabelAlignment                                             */ 3120,
-/* TickPosition                                                   */ 3125,
-/* Time                                                           */ 2499,
-/* TimeBasedImageSetsSequence                                     */ 3245,
-/* TimeDistributionProtocol                                       */ 906,
-/* TimeDomainFiltering                                            */ 1092,
-/* TimeOfDocumentCreationOrVerbalTransactionTrial                 */ 2496,
-/* TimeOfFlightContrast                                           */ 1050,
-/* TimeOfFlightInformationUsed                                    */ 1416,
-/* TimeOfFrameGroupSequence                                       */ 2193,
-/* TimeOfGainCalibration                                          */ 431,
-/* TimeOfLastCalibration                                          */ 829,
-/* TimeOfLastDetectorCalibration                                  */ 1004,
-/* TimeOfSecondaryCapture                                         */ 723,
-/* TimeRange                                                      */ 185,
-/* TimeSeriesBlending                                             */ 3224,
-/* TimeSliceVector                                                */ 2818,
-/* TimeSlotInformationSequence                                    */ 2813,
-/* TimeSlotNumber                                                 */ 1518,
-/* TimeSlotTime                                                   */ 2814,
-/* TimeSlotVector                                                 */ 2811,
-/* TimeSource                                                     */ 905,
-/* TimezoneOffsetFromUTC                                          */ 124,
-/* TissueHeterogeneityCorrection                                  */ 3702,
-/* ToleranceTableLabel                                            */ 3897,
-/* ToleranceTableNumber                                           */ 3896,
-/* ToleranceTableSequence                                         */ 3895,
-/* ToleranceValue                                                 */ 4311,
-/* TomoAngle                                                      */ 863,
-/* TomoClass                                                      */ 866,
-/* TomoLayerHeight                                                */ 862,
-/* TomoTime                                                       */ 864,
-/* TomoType                                                       */ 865,
-/* TomotherapeuticControlPointSequence                            */ 4629,
-/* TomotherapeuticLeafInitialClosedDurations                      */ 4631,
-/* TomotherapeuticLeafOpenDurations                               */ 4630,
-/* TopLeftHandCornerOfLocalizerArea                               */ 2732,
-/* TopicAuthor                                                    */ 3508,
-/* TopicKeywords                                                  */ 3509,
-/* TopicSubject                                                   */ 3507,
-/* TopicTitle                                                     */ 3506,
-/* ToricIOLPowerForExactEmmetropiaSequence                        */ 1703,
-/* ToricIOLPowerForExactTargetRefractionSequence                  */ 1704,
-/* ToricIOLPowerSequence                                          */ 1700,
-/* TotalAperture                                                  */ 520,
-/* TotalBlockTrayFactor                                           */ 3992,
-/* TotalBlockTrayWaterEquivalentThickness                         */ 3993,
-/* TotalCollimationWidth                                          */ 1208,
-/* TotalCompensatorTrayFactor                                     */ 3977,
-/* TotalCompensatorTrayWaterEquivalentThickness                   */ 4155,
-/* TotalGain                                                      */ 942,
-/* TotalNumberOfExposures                                         */ 2317,
-/* TotalNumberOfPiecesOfMediaCreated                              */ 3660,
-/* TotalPixelMatrixColumns                                        */ 2711,
-/* TotalPixelMatrixFocalPlanes                                    */ 2740,
-/* TotalPixelMatrixOriginSequence                                 */ 2713,
-/* TotalPixelMatrixRows                                           */ 2712,
-/* TotalProcessingTime                                            */ 4729,
-/* TotalReferenceAirKerma                                         */ 4111,
-/* TotalTime                                                      */ 4768,
-/* TotalTimeOfFluoroscopy                                         */ 2316,
-/* TotalWedgeTrayWaterEquivalentThickness                         */ 3967,
-/* TrackPointIndexList                                            */ 2963,
-/* TrackSequence                                                  */ 2953,
-/* TrackSetAnatomicalTypeCodeSequence                             */ 2959,
-/* TrackSetDescription                                            */ 2958,
-/* TrackSetLabel                                                  */ 2957,
-/* TrackSetNumber                                                 */ 2956,
-/* TrackSetSequence                                               */ 2952,
-/* TrackSetStatisticsSequence                                     */ 2961,
-/* TrackStatisticsSequence                                        */ 2964,
-/* TrackingAlgorithmIdentificationSequence                        */ 2955,
-/* TrackingID                                                     */ 2891,
-/* TrackingUID                                                    */ 2892,
-/* TransactionUID                                                 */ 189,
-/* TransducerApplicationCodeSequence                              */ 1445,
-/* TransducerBeamSteeringCodeSequence                             */ 1444,
-/* TransducerData                                                 */ 931,
-/* TransducerFrequency                                            */ 966,
-/* TransducerGeometryCodeSequence                                 */ 1443,
-/* TransducerOrientation                                          */ 216,
-/* TransducerOrientationModifierSequence                          */ 226,
-/* TransducerOrientationSequence                                  */ 225,
-/* TransducerPosition                                             */ 215,
-/* TransducerPositionModifierSequence                             */ 224,
+/* ApertureValue                                                  */ 584,
+/* ISOSpeed                                                       */ 579,
+/* MetaboliteMapDescription                                       */ 1104,
+/* PresentationDisplayCollectionUID                               */ 3152,
+/* IonControlPointVerificationSequence                            */ 3386,
+/* DeviceDiameter                                                 */ 2747,
 /* TransducerPositionSequence                                     */ 223,
-/* TransducerScanPatternCodeSequence                              */ 1440,
-/* TransducerType                                                 */ 967,
-/* TransferSyntaxUID                                              */ 4,
-/* TransferTubeLength                                             */ 4140,
-/* TransferTubeNumber                                             */ 4139,
-/* TransformDescription                                           */ 408,
-/* TransformLabel                                                 */ 1969,
+/* MandatoryComponentType                                         */ 3438,
+/* VelocityEncodingMinimumValue                                   */ 1113,
+/* WedgeTotalLength                                               */ 540,
+/* SwitchingPhaseTransitionDuration                               */ 1261,
+/* PhysicalUnitsXDirection                                        */ 960,
+/* LuminanceResponseDescription                                   */ 2109,
+/* ContainerComponentLength                                       */ 2753,
+/* RTVFlowIdentifier                                              */ 17,
+/* WedgeOriginOffsetX                                             */ 532,
+/* AlgorithmNameCodeSequence                                      */ 2940,
+/* BrachyTreatmentTechnique                                       */ 4083,
+/* ImpedanceValue                                                 */ 2265,
+/* ChannelBaseline                                                */ 2240,
+/* ScheduledProtocolCodeSequence                                  */ 2276,
+/* SourceIrradiationEventSequence                                 */ 239,
+/* AdmittingDiagnosesCodeSequence                                 */ 163,
+/* MRModifierSequence                                             */ 1129,
+/* BlendingInputNumber                                            */ 3220,
+/* ReferencedRequestSequence                                      */ 2542,
+/* RTImageOrientation                                             */ 3673,
+/* ImageRotationRetired                                           */ 3061,
+/* ContrastBolusAdministrationRouteSequence                       */ 659,
+/* GraphicDimensions                                              */ 3056,
+/* LensStatusCodeSequence                                         */ 1687,
+/* LongEdgePointIndexList                                         */ 2950,
+/* FunctionalSettlingPhaseFramesPresent                           */ 1387,
+/* DetectorCalibrationData                                        */ 4730,
+/* EffectiveDuration                                              */ 690,
+/* ImageFrameOrigin                                               */ 4794,
+/* RTSegmentAnnotationSequence                                    */ 4526,
+/* NumberOfIntervalFractions                                      */ 4607,
+/* FailureReason                                                  */ 191,
+/* FixationEye                                                    */ 4050,
+/* XDSStorageSequence                                             */ 2442,
+/* MajorTicksSequence                                             */ 3124,
+/* PatientSetupNumber                                             */ 4057,
+/* ChannelShieldNominalTransmission                               */ 4146,
+/* TDRType                                                        */ 4695,
+/* ImageDataTypeSequence                                          */ 1438,
+/* IsocenterToRangeModulatorDistance                              */ 4211,
+/* ConceptualVolumeTypeModifierCodeSequence                       */ 4590,
+/* SourceImageCornealProcessedDataSequence                        */ 2700,
+/* VisualFieldTestPointXCoordinate                                */ 1867,
+/* ScheduledProcedureStepLocation                                 */ 2281,
+/* ListOfMIMETypes                                                */ 2592,
+/* ReceiveProbeSequence                                           */ 499,
+/* ContainerComponentWidth                                        */ 2746,
+/* TransactionUID                                                 */ 189,
+/* DecimalVisualAcuity                                            */ 2673,
+/* ProductLotIdentifier                                           */ 2601,
+/* PseudoColorPaletteInstanceReferenceSequence                    */ 3343,
+/* ScheduledProcedureStepID                                       */ 2277,
+/* PETDetectorMotionDetailsSequence                               */ 1406,
+/* GraphicGroupSequence                                           */ 3096,
+/* ApplicationSetupNumber                                         */ 4105,
+/* AbortReason                                                    */ 4690,
+/* ExposuresOnDetectorSinceManufactured                           */ 1006,
+/* ReferencedSOPSequence                                          */ 193,
+/* PatientSexNeutered                                             */ 323,
+/* SignalDomainRows                                               */ 2133,
+/* GPSLatitudeRef                                                 */ 626,
+/* XRayImageReceptorAngle                                         */ 3672,
+/* DisplaySubsystemID                                             */ 2080,
+/* ReferencedBrachyApplicationSetupSequence                       */ 4453,
+/* AcquisitionStartCondition                                      */ 691,
+/* RandomsCorrectionMethod                                        */ 2842,
+/* PresentationGroupNumber                                        */ 2252,
+/* TableYPositionToIsocenter                                      */ 1329,
+/* FlowCompensation                                               */ 1046,
+/* ParametricMapFrameTypeSequence                                 */ 2445,
+/* PhaseInformationSequence                                       */ 2798,
+/* StopTrim                                                       */ 213,
+/* VisualAcuityModifiers                                          */ 2672,
+/* NetworkID                                                      */ 146,
+/* EvaluatorName                                                  */ 388,
+/* ScheduledPerformingPhysicianName                               */ 2274,
+/* ImplantTemplateGroupVariationDimensionRankSequence             */ 3463,
+/* PlannedVerificationImageSequence                               */ 3957,
+/* VolumetricPresentationInputSetSequence                         */ 3165,
+/* TwoDimensionalToThreeDimensionalMapData                        */ 1785,
+/* ExcessiveFalsePositives                                        */ 1841,
+/* LUTNumber                                                      */ 1524,
+/* FailedAttributesSequence                                       */ 3383,
+/* VisualAcuityBothEyesOpenSequence                               */ 2670,
+/* RequestedResolutionID                                          */ 3600,
+/* ReferencedFrameOfReferenceSequence                             */ 3720,
+/* ReferencedConceptualVolumeUID                                  */ 4495,
+/* RequestedProcedureCodeSequence                                 */ 2177,
+/* SegmentSurfaceGenerationAlgorithmIdentificationSequence        */ 2937,
+/* RecordedBlockSequence                                          */ 3825,
+/* ScanSpotPositionMap                                            */ 4217,
+/* MaskOperationExplanation                                       */ 2076,
+/* ChemicalShiftMaximumIntegrationLimitInppm                      */ 1199,
+/* RadionuclidePositronFraction                                   */ 764,
+/* CoverageOfKSpace                                               */ 1116,
+/* ReferencedPatientSetupNumber                                   */ 4464,
+/* CTImageFrameTypeSequence                                       */ 1230,
+/* TotalProcessingTime                                            */ 4729,
+/* AcquisitionIndex                                               */ 1628,
+/* PatternOnColorCIELabValue                                      */ 3107,
+/* PlanningLandmarkPointSequence                                  */ 3022,
+/* RadiationTypeCodeSequence                                      */ 4393,
+/* MatingFeatureDegreeOfFreedomSequence                           */ 3009,
+/* InputInformationSequence                                       */ 2417,
 /* TransformNumberOfAxes                                          */ 409,
-/* TransformOrderOfAxes                                           */ 410,
-/* TransformVersionNumber                                         */ 1970,
-/* TransformationAlgorithmSequence                                */ 1775,
-/* TransformationMethodCodeSequence                               */ 1774,
-/* TransformedAxisUnits                                           */ 411,
-/* TranslationRateX                                               */ 511,
-/* TranslationRateY                                               */ 512,
-/* TransmitCoilManufacturerName                                   */ 1080,
-/* TransmitCoilName                                               */ 837,
-/* TransmitCoilType                                               */ 1081,
-/* TransmitTransducerSequence                                     */ 442,
-/* TransmitTransducerSettingsSequence                             */ 472,
-/* TransmitterFrequency                                           */ 1119,
-/* TransportClassification                                        */ 4727,
-/* TransverseDetectorSeparation                                   */ 1402,
-/* TransverseMash                                                 */ 2850,
-/* TrayAccessoryCode                                              */ 4195,
-/* TreatmentControlPointDate                                      */ 3777,
-/* TreatmentControlPointTime                                      */ 3778,
-/* TreatmentDate                                                  */ 3863,
-/* TreatmentDeliveryContinuationFlag                              */ 4413,
-/* TreatmentDeliveryType                                          */ 3959,
-/* TreatmentDeviceIdentificationSequence                          */ 4324,
-/* TreatmentMachineName                                           */ 3940,
-/* TreatmentMachineSequence                                       */ 4085,
-/* TreatmentMachineSpecialModeCodeSequence                        */ 4319,
-/* TreatmentPositionGroupLabel                                    */ 4275,
-/* TreatmentPositionGroupSequence                                 */ 4277,
-/* TreatmentPositionGroupUID                                      */ 4276,
-/* TreatmentPositionIndex                                         */ 4273,
-/* TreatmentPositionSequence                                      */ 4329,
-/* TreatmentProtocols                                             */ 3870,
-/* TreatmentRecordContentOrigin                                   */ 4414,
-/* TreatmentSessionApplicationSetupSequence                       */ 3833,
+/* AcquisitionCompressionType                                     */ 463,
+/* Bold                                                           */ 3105,
+/* FrameVOILUTSequence                                            */ 2131,
+/* LabelText                                                      */ 3651,
+/* SwivelRange                                                    */ 3215,
+/* SetupReferenceDescription                                      */ 4079,
+/* CompensatorProximalThicknessMap                                */ 4366,
+/* ChannelIdentificationCode                                      */ 2260,
+/* DetectorNormalizationCorrection                                */ 1428,
+/* DetectorActiveDimensions                                       */ 1014,
+/* ContributingEquipmentSequence                                  */ 1506,
+/* RadiationBeamCompensatorMillingToolDiameter                    */ 4371,
+/* IssuerOfAccessionNumberSequence                                */ 72,
+/* GeometryOfKSpaceTraversal                                      */ 1065,
+/* OpticalPathIdentifier                                          */ 2723,
+/* StandardOutputSensitivity                                      */ 577,
+/* ActualCardiacTriggerDelayTime                                  */ 1604,
+/* ThreeDRenderingType                                            */ 3336,
+/* ExposureProgram                                                */ 572,
+/* TableOfParameterValues                                         */ 994,
+/* EnvironmentalConditions                                        */ 385,
+/* LossyImageCompressionMethod                                    */ 2053,
+/* StereoVerticalPixelOffset                                      */ 1648,
+/* OverriddenAttributesSequence                                   */ 3384,
+/* CorneaMeasurementMethodCodeSequence                            */ 2664,
+/* InstitutionalDepartmentName                                    */ 152,
+/* OverlayLocation                                                */ 4806,
+/* MRTimingAndRelatedParametersSequence                           */ 1127,
+/* CenterOfMass                                                   */ 4684,
+/* DiffusionBValueXZ                                              */ 1382,
+/* SourceEncapsulationNominalTransmission                         */ 4095,
+/* MaxDensity                                                     */ 3585,
+/* ContrastBolusVolume                                            */ 735,
+/* ReplacedProcedureStepSequence                                  */ 3400,
+/* OverlayNumberOfTables                                          */ 4808,
+/* PatientGantryRelationshipCodeSequence                          */ 2834,
+/* ModalitiesInStudy                                              */ 80,
+/* ShiftTableSize                                                 */ 3546,
+/* SegmentationTemplateUID                                        */ 4515,
+/* OutputDestinationSequence                                      */ 2438,
+/* RangeShifterWaterEquivalentThickness                           */ 4202,
+/* CumulativeDoseReferenceCoefficient                             */ 4012,
+/* DeliveredPrimaryMeterset                                       */ 3785,
+/* ChannelSampleSkew                                              */ 2242,
+/* ContourSlabThickness                                           */ 3740,
+/* ReferencedBlockNumber                                          */ 4470,
+/* ZoomCenter                                                     */ 1921,
+/* DefaultMagnificationType                                       */ 3578,
+/* SmallestImagePixelValue                                        */ 1951,
+/* ImageSetSelectorCategory                                       */ 3247,
+/* SelectorURValue                                                */ 3276,
+/* ContextGroupVersion                                            */ 101,
+/* RetrieveURL                                                    */ 188,
+/* EnergyWindowName                                               */ 2792,
+/* PupilSize                                                      */ 2632,
+/* RadiationType                                                  */ 3954,
+/* AssertionDateTime                                              */ 2612,
+/* BackgroundLuminance                                            */ 1810,
+/* StudyInstanceUID                                               */ 1509,
+/* RecommendedPointRadius                                         */ 2946,
+/* FirstTreatmentDate                                             */ 3799,
+/* OECFValues                                                     */ 559,
+/* CoordinateSystemAxisValues                                     */ 406,
+/* Occupation                                                     */ 315,
+/* ProtocolElementPurpose                                         */ 1483,
+/* RecommendedAnimationRate                                       */ 3212,
+/* IntendedRTTreatmentPhaseSequence                               */ 4559,
+/* OphthalmicAnatomicReferencePointYCoordinate                    */ 1793,
+/* AdmissionID                                                    */ 2196,
+/* ReferencedVisitSequence                                        */ 170,
+/* ClinicalTrialSeriesDescription                                 */ 351,
+/* TableTopPitchAngle                                             */ 4042,
+/* IdenticalDocumentsSequence                                     */ 2557,
+/* FovealPointProbabilityValue                                    */ 1890,
+/* OtherPupillaryDistance                                         */ 2640,
+/* GeneralMachineVerificationSequence                             */ 3380,
+/* ShutterUpperHorizontalEdge                                     */ 879,
+/* WeightingLookupTableDescriptor                                 */ 3204,
+/* FalsePositivesEstimate                                         */ 1833,
+/* FilterMaterialUsedInGainCalibration                            */ 428,
+/* MediaStorageSOPClassUID                                        */ 2,
+/* EnergyWindowUpperLimit                                         */ 2789,
+/* SelectorAttributeVR                                            */ 3253,
+/* TotalTimeOfFluoroscopy                                         */ 2316,
+/* LightPathFilterPassBand                                        */ 1632,
+/* AxisUnits                                                      */ 4753,
+/* NumberOfFractionsDelivered                                     */ 3801,
+/* ZonalMapLocation                                               */ 1983,
+/* ZEffective                                                     */ 4682,
+/* ReferencedPatientPhotoSequence                                 */ 307,
+/* MappedPixelValue                                               */ 1763,
+/* DosimetricObjectivePurpose                                     */ 4600,
+/* RouteSegmentStartLocationID                                    */ 4687,
+/* TomotherapeuticLeafOpenDurations                               */ 4630,
+/* BitsStored                                                     */ 1946,
+/* CoordinateStepValue                                            */ 4761,
+/* PixelValueMappingToCodedConceptSequence                        */ 1762,
+/* SourceAxisDistance                                             */ 3942,
+/* AcquisitionContrast                                            */ 252,
+/* ContainerDescription                                           */ 2342,
+/* TherapyDescription                                             */ 681,
+/* LINACEnergy                                                    */ 517,
+/* SequenceName                                                   */ 665,
+/* HL7DocumentTypeCodeSequence                                    */ 2576,
+/* GeneticModificationsCodeSequence                               */ 289,
+/* SelectorOWValue                                                */ 3268,
+/* ParallelRTBeamDelimiterLeafMountingSide                        */ 4345,
+/* GantryPitchAngle                                               */ 4047,
+/* GPSLongitudeRef                                                */ 628,
+/* BlockName                                                      */ 4003,
+/* DisplayWindowLabelVector                                       */ 913,
+/* SpatialLocationsPreserved                                      */ 2034,
+/* ChannelRecommendedDisplayCIELabValue                           */ 2254,
+/* VolumetricPresentationInputSetUID                              */ 3164,
+/* IncludesInformation                                            */ 2192,
+/* DisplaySubsystemQAResultsSequence                              */ 2093,
+/* MultiCoilElementUsed                                           */ 1078,
+/* HomeCommunityID                                                */ 2587,
+/* XRaySourceIsocenterSecondaryAngle                              */ 1363,
 /* TreatmentSessionBeamSequence                                   */ 3774,
-/* TreatmentSessionIonBeamSequence                                */ 3775,
-/* TreatmentSessionUID                                            */ 4405,
-/* TreatmentSite                                                  */ 4602,
-/* TreatmentSiteCodeSequence                                      */ 4603,
-/* TreatmentSiteModifierCodeSequence                              */ 4620,
-/* TreatmentSites                                                 */ 3872,
-/* TreatmentStatusComment                                         */ 3857,
-/* TreatmentSummaryCalculatedDoseReferenceSequence                */ 3797,
-/* TreatmentSummaryMeasuredDoseReferenceSequence                  */ 3826,
-/* TreatmentTechniqueNotes                                        */ 4605,
-/* TreatmentTerminationCode                                       */ 3780,
-/* TreatmentTerminationDescription                                */ 4420,
-/* TreatmentTerminationStatus                                     */ 3779,
-/* TreatmentTime                                                  */ 3864,
-/* TreatmentTimeLimit                                             */ 4313,
-/* TreatmentToleranceViolationAttributeSequence                   */ 4423,
+/* FacetSequence                                                  */ 2943,
+/* ViewpointPosition                                              */ 3187,
+/* DisplayEnvironmentSpatialPosition                              */ 3292,
+/* BeamDose                                                       */ 3921,
+/* RadiationFluenceModifierCodeSequence                           */ 4397,
+/* MeasuredBeamDimensionA                                         */ 449,
+/* ASLSlabSequence                                                */ 1197,
+/* AssertionExpirationDateTime                                    */ 2613,
+/* LargestImagePixelValueInPlane                                  */ 1956,
+/* FilterBeamPathLengthMaximum                                    */ 1034,
+/* FrameComments                                                  */ 1581,
+/* CalibrationDate                                                */ 492,
+/* NominalPriorDose                                               */ 3882,
+/* NominalRespiratoryTriggerDelayTime                             */ 1607,
+/* CurrentTreatmentStatus                                         */ 3856,
+/* ProductTypeCodeSequence                                        */ 2598,
+/* FlashFunctionPresent                                           */ 570,
+/* DetectorIsocenterSecondaryAngle                                */ 1370,
+/* ReferencedPatientSequence                                      */ 169,
+/* HPGLPenDescription                                             */ 2993,
+/* FilmBoxContentSequence                                         */ 3643,
+/* BeamLimitingDevicePositionSequence                             */ 4021,
+/* VariableCoefficientsSDDN                                       */ 4838,
+/* AttributeOccurrencePointer                                     */ 3388,
+/* ChannelLength                                                  */ 4125,
+/* RetestStimulusSeen                                             */ 1872,
+/* MaximumCoordinateValue                                         */ 4757,
+/* EntityName                                                     */ 4538,
+/* SourceToSurfaceDistance                                        */ 4037,
+/* PlanarConfiguration                                            */ 1910,
+/* CalculatedDoseReferenceSequence                                */ 3812,
+/* SequenceOfCompressedData                                       */ 1972,
+/* DepthValueAveragingFlag                                        */ 3934,
+/* NominalRangeModulationFractions                                */ 4257,
+/* SelectorUTValue                                                */ 3275,
+/* DecompositionMaterialSequence                                  */ 1281,
+/* TableTopLateralPosition                                        */ 4034,
+/* IntravascularFrameContentSequence                              */ 2773,
+/* IntraOcularPressure                                            */ 1641,
+/* DeliveredNumberOfPulses                                        */ 3841,
+/* MeasurementAutomationTrial                                     */ 2523,
+/* HorizontalAlignment                                            */ 3098,
+/* CumulativeMetersetWeight                                       */ 4041,
+/* SegmentCharacteristicsPrecedence                               */ 4525,
+/* WarningReason                                                  */ 190,
+/* PrivateDataElementName                                         */ 141,
+/* LargestMonochromePixelValue                                    */ 2128,
+/* PersonTelecomInformation                                       */ 2386,
+/* ASLSlabNumber                                                  */ 1184,
+/* RenderProjection                                               */ 3186,
+/* CompressionStepPointers                                        */ 1932,
+/* CollimatorShapeSequence                                        */ 1291,
+/* SNRThreshold                                                   */ 4737,
+/* DeliveredReferenceDoseDefinition                               */ 4265,
+/* ControlPointSequence                                           */ 4015,
+/* ReportStatusCommentTrial                                       */ 2535,
+/* EthicsCommitteeApprovalEffectivenessEndDate                    */ 358,
+/* IntravascularLongitudinalDistance                              */ 2774,
+/* FramePixelDataPropertiesSequence                               */ 2138,
+/* GammaValue                                                     */ 2103,
+/* SpectrallySelectedExcitation                                   */ 1060,
+/* HorizontalOffsetOfSensor                                       */ 418,
+/* StartMeterset                                                  */ 3816,
+/* ThreatROIExtents                                               */ 4667,
+/* HardcopyDeviceManufacturerModelName                            */ 729,
+/* PresentationPixelAspectRatio                                   */ 3083,
+/* ControlPointRelativePosition                                   */ 4149,
+/* TextObjectSequence                                             */ 3049,
+/* DetectorBinning                                                */ 1010,
+/* OphthalmicAxialLengthSequence                                  */ 1685,
+/* PixelComponentDataType                                         */ 988,
+/* ConfidentialityConstraintOnPatientDataDescription              */ 2400,
+/* XRayOutput                                                     */ 2324,
+/* SourceToBlockTrayDistance                                      */ 3996,
+/* GPSSpeed                                                       */ 638,
+/* FlashMode                                                      */ 569,
+/* ChannelShieldSequence                                          */ 4141,
+/* DACGainPoints                                                  */ 468,
+/* PrivateDataElementValueMultiplicity                            */ 138,
+/* ImageSetSelectorSequence                                       */ 3241,
+/* ChannelShieldName                                              */ 4144,
+/* CalibrationSettingsSequence                                    */ 485,
+/* PresentationIntentType                                         */ 84,
+/* AcrossScanSpatialResolution                                    */ 1674,
+/* GatedInformationSequence                                       */ 2809,
+/* TwoDImplantTemplateGroupMemberMatchingAxes                     */ 3460,
+/* AbstractPriorCodeSequence                                      */ 3251,
+/* RequestingServiceCodeSequence                                  */ 2170,
+/* PatientSetupUID                                                */ 4346,
+/* RecognitionCode                                                */ 46,
+/* DopplerCorrectionAngle                                         */ 969,
+/* FindingsSequenceTrial                                          */ 2460,
+/* OmittedBeamTaskSequence                                        */ 4478,
+/* ScheduledProcedureStepDescription                              */ 2275,
+/* SourceImageSequence                                            */ 199,
+/* GridFrameOffsetVector                                          */ 3698,
+/* CompensatorMillingToolDiameter                                 */ 4160,
+/* ChannelOverlap                                                 */ 513,
+/* PerformedProcedureStepDescription                              */ 2304,
+/* SnoutID                                                        */ 4171,
+/* DistanceBetweenFocalPlanes                                     */ 2718,
+/* IdentificationDescriptionTrial                                 */ 2525,
+/* DeidentificationMethod                                         */ 348,
+/* ROIPhysicalPropertiesSequence                                  */ 3755,
+/* Component2ReferencedMatingFeatureID                            */ 3447,
+/* DegreeOfDilation                                               */ 1644,
+/* Location                                                       */ 1529,
+/* ISOSpeedLatitudezzz                                            */ 581,
+/* GantryDetectorTilt                                             */ 782,
+/* DeliveredChannelTotalTime                                      */ 3839,
+/* AutorefractionLeftEyeSequence                                  */ 2636,
+/* FlatCornealAxisSequence                                        */ 2661,
+/* DetectorYPositionToIsocenter                                   */ 1372,
+/* NumberOfRTAccessoryHolders                                     */ 4378,
+/* ThreeDPointCoordinates                                         */ 3030,
+/* ReferencedRelatedGeneralSOPClassUIDInFile                      */ 39,
+/* StructureSetROISequence                                        */ 3725,
+/* ContrastBolusIngredientPercentByVolume                         */ 2758,
+/* InteroperabilityVersion                                        */ 624,
+/* RTTreatmentPhaseUID                                            */ 4543,
 /* TreatmentToleranceViolationCategory                            */ 4422,
-/* TreatmentToleranceViolationCauseCodeSequence                   */ 4440,
-/* TreatmentToleranceViolationDateTime                            */ 4426,
-/* TreatmentToleranceViolationDescription                         */ 4424,
-/* TreatmentToleranceViolationIdentification                      */ 4425,
-/* TreatmentToleranceViolationSequence                            */ 4421,
-/* TreatmentToleranceViolationTypeCodeSequence                    */ 4439,
-/* TreatmentVerificationStatus                                    */ 3781,
-/* TriangleFanSequence                                            */ 2931,
-/* TrianglePointIndexList                                         */ 2927,
-/* TriangleStripSequence                                          */ 2930,
-/* TriggerSamplePosition                                          */ 757,
-/* TriggerSourceOrType                                            */ 746,
-/* TriggerTime                                                    */ 745,
-/* TriggerTimeOffset                                              */ 754,
-/* TriggerVector                                                  */ 2822,
-/* TriggerWindow                                                  */ 777,
-/* Trim                                                           */ 3586,
+/* PredictorColumns                                               */ 1938,
+/* SelectorASValue                                                */ 3258,
+/* CountsSource                                                   */ 2839,
+/* TIPType                                                        */ 4705,
+/* TablePositionSequence                                          */ 1290,
+/* SliceThickness                                                 */ 685,
+/* RTPrescriptionIndex                                            */ 4544,
+/* AnatomicStructureReferencePoint                                */ 1767,
+/* XRayTubeCurrentInmA                                            */ 1231,
+/* WedgeFrontGap                                                  */ 542,
+/* IlluminatorTypeCodeSequence                                    */ 2720,
+/* IssuerOfAdmissionIDSequence                                    */ 2198,
+/* OverlayCompressionOriginator                                   */ 4797,
+/* RangeShifterID                                                 */ 4175,
+/* PulseRepetitionFrequency                                       */ 968,
+/* InterlockResolutionCodeSequence                                */ 4436,
+/* PositionerPositionSequence                                     */ 1289,
+/* FrameOfReferenceUID                                            */ 1530,
+/* BluePaletteColorLookupTableData                                */ 2017,
+/* TableLateralIncrement                                          */ 788,
+/* ShadowOffsetX                                                  */ 3101,
+/* CenterOfCircularExposureControlSensingRegion                   */ 1312,
+/* SensorName                                                     */ 417,
+/* RadiopharmaceuticalCodeSequence                                */ 2828,
+/* IssueDateOfImagingServiceRequest                               */ 2389,
+/* RadiationGenerationModeLabel                                   */ 4390,
+/* ConfigurationQAResultsSequence                                 */ 2094,
+/* SendingPresentationAddress                                     */ 11,
+/* ConceptualVolumeCombinationExpression                          */ 4496,
+/* DCTLabel                                                       */ 1978,
+/* OphthalmicAxialMeasurementsRightEyeSequence                    */ 1681,
+/* WhitePointFlag                                                 */ 2110,
+/* AscanRate                                                      */ 1802,
+/* AxisOfRotation                                                 */ 2921,
+/* VariableCoefficientsSDVN                                       */ 4836,
+/* NumberOfPulses                                                 */ 4128,
+/* ClinicalTrialTimePointDescription                              */ 343,
+/* AgeCorrectedSensitivityDeviationValue                          */ 1869,
+/* DefaultPrinterResolutionID                                     */ 3575,
+/* PatientEyeMovementCommanded                                    */ 1635,
+/* LanguageCodeSequence                                           */ 44,
+/* DigitalSignaturePurposeCodeSequence                            */ 3526,
+/* SecondaryPositionerIncrementSign                               */ 1351,
+/* ReconstructionMethod                                           */ 2845,
+/* ElementDimensionB                                              */ 447,
+/* KeratoconusPredictionIndex                                     */ 2697,
+/* VisualAcuityTypeCodeSequence                                   */ 2667,
+/* MechanicalIndex                                                */ 935,
+/* RangeShifterSetting                                            */ 4200,
+/* DistanceBetweenBscanSlabs                                      */ 1799,
+/* ExclusionDuration                                              */ 1436,
+/* RTToleranceSetLabel                                            */ 4309,
+/* ContourImageSequence                                           */ 3723,
+/* LensThicknessSequence                                          */ 1724,
+/* CurveDataDescriptor                                            */ 4759,
+/* LateralSpreadingDeviceDescription                              */ 4183,
+/* TrackSetLabel                                                  */ 2957,
+/* SelectorSequencePointerItems                                   */ 3391,
+/* DVHNormalizationPoint                                          */ 3703,
+/* ReferencedRTPhysicianIntentIndex                               */ 4578,
+/* GeneralizedDefectCorrectedSensitivityDeviationProbabilityValue */ 1879,
+/* InstructionPerformanceComment                                  */ 1473,
+/* CorrectedLocalizedDeviationFromNormalProbabilityCalculated     */ 1859,
+/* SecondaryReviewTime                                            */ 377,
+/* ChannelShieldNominalThickness                                  */ 4145,
+/* SelectorPNValue                                                */ 3269,
+/* IonBeamSequence                                                */ 4224,
+/* PartialViewCodeSequence                                        */ 2033,
+/* LocalizingCursorPosition                                       */ 919,
+/* DeformableRegistrationSequence                                 */ 2893,
+/* CalculationCommentType                                         */ 1727,
+/* RTRadiationUsage                                               */ 4406,
+/* SurfacePointsSequence                                          */ 2912,
 /* TubeAngle                                                      */ 1204,
-/* TwoDDegreeOfFreedomAxis                                        */ 3021,
-/* TwoDDegreeOfFreedomSequence                                    */ 3016,
-/* TwoDImplantTemplateGroupMemberMatchingAxes                     */ 3460,
-/* TwoDImplantTemplateGroupMemberMatchingPoint                    */ 3459,
-/* TwoDLineCoordinates                                            */ 3032,
-/* TwoDLineCoordinatesSequence                                    */ 3031,
-/* TwoDMatingAxes                                                 */ 3015,
-/* TwoDMatingFeatureCoordinatesSequence                           */ 3012,
-/* TwoDMatingPoint                                                */ 3014,
-/* TwoDPlaneCoordinatesSequence                                   */ 3034,
-/* TwoDPlaneIntersection                                          */ 3035,
-/* TwoDPointCoordinates                                           */ 3029,
-/* TwoDPointCoordinatesSequence                                   */ 3028,
-/* TwoDimensionalToThreeDimensionalMapData                        */ 1785,
-/* TwoDimensionalToThreeDimensionalMapSequence                    */ 1778,
-/* TypeOfData                                                     */ 4751,
-/* TypeOfDetectorMotion                                           */ 2821,
-/* TypeOfFilters                                                  */ 811,
-/* TypeOfInstances                                                */ 2580,
-/* TypeOfOpticalCorrection                                        */ 1699,
-/* TypeOfPatientID                                                */ 262,
-/* TypeOfSynchronization                                          */ 3330,
-/* UDISequence                                                    */ 718,
-/* UID                                                            */ 2501,
-/* URNCodeValue                                                   */ 119,
-/* USImageDescriptionSequence                                     */ 1437,
-/* UVMappingSequence                                              */ 3473,
-/* UValueData                                                     */ 3475,
-/* UltrasoundAcquisitionGeometry                                  */ 1612,
-/* UltrasoundColorDataPresent                                     */ 1917,
-/* UltrasoundOphthalmicAxialLengthMeasurementsSequence            */ 1743,
-/* UltrasoundSelectedOphthalmicAxialLengthSequence                */ 1745,
-/* UnassignedPerFrameConvertedAttributesSequence                  */ 1589,
-/* UnassignedSharedConvertedAttributesSequence                    */ 1588,
-/* Underlined                                                     */ 3104,
-/* UnformattedTextValue                                           */ 3048,
-/* UnifiedProcedureStepListStatus                                 */ 3407,
-/* UnifiedProcedureStepPerformedProcedureSequence                 */ 3397,
-/* UniformResourceLocatorTrial                                    */ 2565,
-/* UniqueDeviceIdentifier                                         */ 717,
-/* Units                                                          */ 2838,
-/* UniversalEntityID                                              */ 2287,
-/* UniversalEntityIDType                                          */ 2288,
-/* UnspecifiedLateralityLensSequence                              */ 2622,
-/* UpperLowerPixelValues                                          */ 832,
-/* UrgencyOrPriorityAlertsTrial                                   */ 2474,
-/* UsedFiducialsSequence                                          */ 3140,
-/* UsedSegmentsSequence                                           */ 2889,
-/* UserContentLabel                                               */ 4535,
+/* DeviceLength                                                   */ 2745,
+/* RadiopharmaceuticalStopDateTime                                */ 767,
+/* SpecificAbsorptionRateDefinition                               */ 1153,
+/* RTPlanRelationship                                             */ 3910,
+/* OphthalmicThicknessMapThresholdQualityRating                   */ 1766,
+/* NumberOfFramesInPhase                                          */ 2799,
+/* PreDeformationMatrixRegistrationSequence                       */ 2899,
+/* RespiratoryMotionCompensationTechnique                         */ 1144,
+/* ParallelRTBeamDelimiterDeviceSequence                          */ 4337,
+/* RangeModulatorGatingStopWaterEquivalentThickness               */ 4210,
+/* ASLTechniqueDescription                                        */ 1183,
+/* GeneralAccessoryDescription                                    */ 4236,
+/* NumberOfRadiationGenerationModes                               */ 4399,
+/* ReferencedDateTime                                             */ 2507,
+/* OphthalmicPatientClinicalInformationLeftEyeSequence            */ 1887,
+/* TableHorizontalRotationAngle                                   */ 1331,
+/* RequestAttributesSequence                                      */ 2309,
+/* SnoutPositionTolerance                                         */ 3902,
+/* NumberOfWedgePositions                                         */ 4351,
+/* OverlayCompressionCode                                         */ 4796,
+/* NumberOfIterations                                             */ 1412,
+/* DeviceMotionExecutionMode                                      */ 4252,
+/* ASLSlabThickness                                               */ 1185,
+/* HL7InstanceIdentifier                                          */ 2574,
+/* ROIGenerationDescription                                       */ 3736,
+/* ConvolutionKernel                                              */ 831,
+/* PatientInsurancePlanCodeSequence                               */ 273,
+/* XRaySourceID                                                   */ 1255,
+/* GPSAreaInformation                                             */ 653,
+/* TMLinePositionX0Retired                                        */ 975,
+/* ReferencedImageBoxSequenceRetired                              */ 3620,
+/* MultiFramePresentationSequence                                 */ 2148,
+/* InterventionSequence                                           */ 678,
+/* ContraindicationsCodeSequence                                  */ 1458,
+/* ContributionDateTime                                           */ 1507,
+/* AbstractPriorValue                                             */ 3250,
+/* EchoPlanarPulseSequence                                        */ 1053,
+/* RadiopharmaceuticalStartDateTime                               */ 766,
+/* AxialAcceptance                                                */ 2848,
+/* InterventionDrugDose                                           */ 669,
+/* FrameAcquisitionNumber                                         */ 1579,
+/* PlacerOrderNumberImagingServiceRequest                         */ 2397,
+/* AITDeviceType                                                  */ 4734,
+/* FrameOriginTimestamp                                           */ 2187,
+/* CurveRange                                                     */ 4758,
+/* FalseNegativesEstimate                                         */ 1827,
+/* ImageBoxesSequence                                             */ 3307,
+/* NominalCardiacTriggerTimePriorToRPeak                          */ 1577,
+/* ExposureControlSensingRegionShape                              */ 1307,
+/* PatientLocationCoordinatesSequence                             */ 3767,
+/* SurfaceRegularityIndex                                         */ 2694,
+/* DopplerSampleVolumeYPositionRetired                            */ 973,
+/* RTPrescriptionLabel                                            */ 4568,
+/* PupilCentroidYCoordinate                                       */ 2681,
+/* CompensatorPosition                                            */ 3985,
+/* SingleCollimationWidth                                         */ 1207,
+/* TransducerOrientation                                          */ 216,
+/* WedgeOffsetX                                                   */ 538,
+/* PixelIntensityRelationshipLUTSequence                          */ 2137,
+/* ConstraintWeight                                               */ 3884,
+/* BeamNumber                                                     */ 3949,
+/* GlobalDeviationFromNormal                                      */ 1845,
+/* NumberOfPatientRelatedStudies                                  */ 1552,
+/* RelatedProcedureStepSequence                                   */ 3398,
+/* RTROIObservationsSequence                                      */ 3746,
+/* FlowTransferSyntaxUID                                          */ 2184,
+/* RecommendedDisplayGrayscaleValue                               */ 2883,
+/* SecondaryCaptureDeviceManufacturerModelName                    */ 726,
+/* NumberOfPaintings                                              */ 4222,
+/* SegmentIdentificationSequence                                  */ 2881,
+/* ReferencedWedgeNumber                                          */ 4468,
+/* TotalCollimationWidth                                          */ 1208,
+/* RightImageSequence                                             */ 1662,
+/* PerformedProcedureStepStatus                                   */ 2302,
+/* ReconstructionPixelSpacing                                     */ 1223,
+/* CurrentPatientLocation                                         */ 2219,
+/* ComponentShape                                                 */ 370,
+/* ToleranceTableNumber                                           */ 3896,
+/* HistogramData                                                  */ 2871,
+/* CurrentRequestedProcedureEvidenceSequence                      */ 2544,
+/* PositionerIsocenterPrimaryAngle                                */ 1325,
+/* InterlockOriginatingDeviceSequence                             */ 4434,
+/* WaveformData                                                   */ 4783,
+/* DepthOfTransverseImage                                         */ 1672,
+/* HangingProtocolDescription                                     */ 3231,
+/* ScheduledStudyStartTime                                        */ 2161,
+/* CornealTopographyMapTypeCodeSequence                           */ 2683,
+/* ReferencedOphthalmicAxialMeasurementsSequence                  */ 1718,
+/* VerificationDateTime                                           */ 2468,
+/* ReportProductionStatusTrial                                    */ 4637,
+/* ParticipationDateTime                                          */ 2488,
+/* BlockEdgeDataSequence                                          */ 4377,
+/* ObjectThicknessSequence                                        */ 1321,
+/* FilmConsumptionSequence                                        */ 2329,
+/* RTPhysicianIntentSequence                                      */ 4571,
+/* EstimatedRadiographicMagnificationFactor                       */ 781,
 /* UserContentLongLabel                                           */ 4536,
-/* UserSelectedGainY                                              */ 503,
-/* UserSelectedOffsetX                                            */ 505,
-/* UserSelectedOffsetY                                            */ 506,
-/* UserSelectedPhase                                              */ 504,
-/* VOILUTFunction                                                 */ 2002,
+/* AdmittingDate                                                  */ 2205,
+/* QueryRetrieveLevel                                             */ 73,
+/* PlanningLandmarkPlaneSequence                                  */ 3024,
+/* TemporalRelationshipIntervalAnchor                             */ 4563,
+/* BlockedPixels                                                  */ 1940,
+/* OCTZOffsetCorrection                                           */ 2776,
+/* OphthalmicAxialMeasurementsLeftEyeSequence                     */ 1682,
+/* RecordedWedgeSequence                                          */ 3823,
+/* OphthalmicThicknessMapQualityRatingSequence                    */ 1772,
+/* ConsentForClinicalTrialUseSequence                             */ 354,
+/* GantryAngleTolerance                                           */ 3898,
+/* AttributeOccurrencePrivateCreator                              */ 3390,
+/* TransformOrderOfAxes                                           */ 410,
+/* FluenceMode                                                    */ 3689,
+/* BlockSlabSequence                                              */ 4248,
+/* TreatmentTimeLimit                                             */ 4313,
+/* FlowRTPSamplingRate                                            */ 2185,
+/* ReceiverNotes                                                  */ 439,
+/* TagSpacingFirstDimension                                       */ 1064,
+/* ScheduledProcedureStepEndTime                                  */ 2273,
+/* HardcopyDeviceManufacturer                                     */ 725,
+/* TimeSeriesBlending                                             */ 3224,
+/* FilterHighFrequency                                            */ 2246,
+/* ObservationSubjectClassTrial                                   */ 2549,
+/* AnatomicApproachDirectionCodeSequenceTrial                     */ 229,
+/* RTToleranceSetSequence                                         */ 4308,
+/* IntendedRecipientsOfResultsIdentificationSequence              */ 2380,
+/* RTVCommunicationSOPClassUID                                    */ 14,
+/* CranialThermalIndex                                            */ 937,
+/* CatchTrialsDataFlag                                            */ 1834,
+/* HighRRValue                                                    */ 770,
+/* PhaseDescription                                               */ 2802,
+/* LesionNumber                                                   */ 928,
+/* CoordinateSystemTransformSequence                              */ 407,
+/* DiffusionBValueXX                                              */ 1380,
+/* ConceptualVolumeConstituentSegmentationReferenceSequence       */ 4502,
+/* ReferencedBasicAnnotationBoxSequence                           */ 3595,
+/* InformationIssueDateTime                                       */ 2978,
+/* ROIArea                                                        */ 4820,
+/* ImplantPartNumber                                              */ 1717,
+/* OverlayDescriptorBlue                                          */ 4815,
+/* SpecimenDescriptionSequenceTrial                               */ 2346,
+/* SourceToBeamLimitingDeviceDistance                             */ 3945,
+/* RTTreatmentPhaseIntentPresenceFlag                             */ 4553,
+/* StudyVerifiedDate                                              */ 2156,
+/* PatientSupportAccessoryCode                                    */ 4194,
+/* ConsultingPhysicianIdentificationSequence                      */ 94,
+/* WeightingLookupTableData                                       */ 3205,
+/* FrameTimeVector                                                */ 750,
+/* GreenPaletteColorLookupTableDescriptor                         */ 2007,
+/* PartialView                                                    */ 2031,
+/* ChannelThreshold                                               */ 508,
+/* ConceptualVolumeDescription                                    */ 4507,
+/* SegmentAlgorithmName                                           */ 2880,
+/* FiducialUID                                                    */ 3142,
+/* PredictedRefractiveError                                       */ 1707,
+/* SourceAcquisitionProtocolElementNumber                         */ 1492,
+/* NumberOfSubsets                                                */ 1413,
+/* InstanceOriginStatus                                           */ 3541,
+/* ColorSpace                                                     */ 2050,
+/* CardiacSynchronizationSequence                                 */ 1131,
+/* InversionTimes                                                 */ 1103,
+/* SourceToApplicatorMountingPositionDistance                     */ 4246,
 /* VOILUTSequence                                                 */ 2059,
-/* VOIType                                                        */ 3341,
-/* VValueData                                                     */ 3476,
-/* ValueType                                                      */ 2470,
-/* VariableCoefficientsSDDN                                       */ 4838,
-/* VariableCoefficientsSDHN                                       */ 4837,
-/* VariableCoefficientsSDVN                                       */ 4836,
-/* VariableFlipAngleFlag                                          */ 848,
-/* VariableNextDataGroup                                          */ 4835,
-/* VariablePixelData                                              */ 4834,
-/* VectorAccuracy                                                 */ 2925,
-/* VectorCoordinateData                                           */ 2926,
-/* VectorDimensionality                                           */ 2924,
-/* VectorGridData                                                 */ 2898,
-/* VelocityEncodingAcquisitionSequence                            */ 1114,
-/* VelocityEncodingDirection                                      */ 1112,
-/* VelocityEncodingMaximumValue                                   */ 1168,
-/* VelocityEncodingMinimumValue                                   */ 1113,
-/* VelocityOfSound                                                */ 484,
-/* VerbalSourceIdentifierCodeSequenceTrial                        */ 2540,
-/* VerbalSourceTrial                                              */ 2537,
-/* VerificationDateTime                                           */ 2468,
-/* VerificationFlag                                               */ 2553,
-/* VerificationImageTiming                                        */ 3374,
-/* VerifyingObserverIdentificationCodeSequence                    */ 2491,
-/* VerifyingObserverName                                          */ 2482,
-/* VerifyingObserverSequence                                      */ 2480,
-/* VerifyingOrganization                                          */ 2466,
-/* VertexPointIndexList                                           */ 2929,
-/* VerticalAlignment                                              */ 3099,
-/* VerticalOffsetOfSensor                                         */ 419,
-/* VerticalPrismBase                                              */ 2628,
-/* VerticalPrismPower                                             */ 2627,
+/* ReferencedVerificationImageSequence                            */ 4458,
+/* DelayLawIdentifier                                             */ 481,
+/* RecommendedExposureIndex                                       */ 578,
+/* ComponentInputSequence                                         */ 3200,
+/* FrameType                                                      */ 242,
+/* LabelUsingInformationExtractedFromInstances                    */ 3650,
+/* RTReferencedSeriesSequence                                     */ 3722,
+/* SecondaryCaptureDeviceSoftwareVersions                         */ 727,
+/* RelatedSegmentCharacteristicsSequence                          */ 4524,
+/* TagSpacingSecondDimension                                      */ 1169,
+/* GraphicLayerDescription                                        */ 3073,
+/* GainCorrectionReferenceSequence                                */ 423,
+/* TwoDimensionalToThreeDimensionalMapSequence                    */ 1778,
+/* BlockMountingPosition                                          */ 4001,
+/* CornealISValue                                                 */ 2692,
+/* StudyArrivalDate                                               */ 2171,
 /* VerticesOfTheOutlineOfPupil                                    */ 2684,
-/* VerticesOfThePolygonalCollimator                               */ 903,
-/* VerticesOfThePolygonalExposureControlSensingRegion             */ 1314,
-/* VerticesOfThePolygonalOutline                                  */ 895,
-/* VerticesOfThePolygonalShutter                                  */ 883,
-/* VerticesOfTheRegion                                            */ 2147,
-/* VideoImageFormatAcquired                                       */ 731,
-/* ViewCodeSequence                                               */ 2824,
-/* ViewModifierCodeSequence                                       */ 2825,
-/* ViewName                                                       */ 203,
-/* ViewNumber                                                     */ 204,
-/* ViewOrientationCodeSequence                                    */ 2985,
-/* ViewOrientationModifierCodeSequence                            */ 2986,
-/* ViewPosition                                                   */ 945,
-/* ViewingDistance                                                */ 2657,
-/* ViewingDistanceType                                            */ 2671,
-/* ViewpointLookAtPoint                                           */ 3188,
-/* ViewpointPosition                                              */ 3187,
-/* ViewpointUpDirection                                           */ 3189,
-/* VirtualSourceAxisDistances                                     */ 4168,
-/* VisitComments                                                  */ 2223,
-/* VisitStatusID                                                  */ 2195,
-/* VisualAcuityBothEyesOpenSequence                               */ 2670,
-/* VisualAcuityLeftEyeSequence                                    */ 2669,
-/* VisualAcuityMeasurementSequence                                */ 1884,
-/* VisualAcuityModifiers                                          */ 2672,
-/* VisualAcuityRightEyeSequence                                   */ 2668,
-/* VisualAcuityTypeCodeSequence                                   */ 2667,
-/* VisualEvaluationMethodCodeSequence                             */ 2123,
-/* VisualEvaluationResultSequence                                 */ 2098,
-/* VisualEvaluationTestSequence                                   */ 2117,
-/* VisualFieldCatchTrialSequence                                  */ 1817,
-/* VisualFieldGlobalResultsIndexSequence                          */ 1901,
-/* VisualFieldHorizontalExtent                                    */ 1805,
-/* VisualFieldMeanSensitivity                                     */ 1849,
-/* VisualFieldShape                                               */ 1807,
-/* VisualFieldTestDuration                                        */ 1865,
-/* VisualFieldTestNormalsFlag                                     */ 1842,
-/* VisualFieldTestPointNormalsSequence                            */ 1874,
-/* VisualFieldTestPointSequence                                   */ 1866,
-/* VisualFieldTestPointXCoordinate                                */ 1867,
-/* VisualFieldTestPointYCoordinate                                */ 1868,
-/* VisualFieldTestReliabilityGlobalIndexSequence                  */ 1900,
-/* VisualFieldVerticalExtent                                      */ 1806,
-/* VitalStainCodeSequenceTrial                                    */ 2368,
-/* VitreousStatusCodeSequence                                     */ 1688,
-/* VitreousStatusDescription                                      */ 1710,
-/* VolumeBasedCalculationTechnique                                */ 250,
-/* VolumeCroppingMethod                                           */ 3170,
-/* VolumeCroppingSequence                                         */ 3169,
-/* VolumeFrameOfReferenceUID                                      */ 1623,
-/* VolumeLocalizationSequence                                     */ 1134,
-/* VolumeLocalizationTechnique                                    */ 1084,
-/* VolumeOfPTO                                                    */ 4691,
+/* FrameAcquisitionDuration                                       */ 1171,
+/* DateTime                                                       */ 2497,
+/* ProcedureCodeSequence                                          */ 149,
+/* CurveReferencedOverlaySequence                                 */ 4772,
+/* MemoryBitDepth                                                 */ 3563,
+/* SurfaceModelScalingFactor                                      */ 2999,
+/* PixelSpacingSequence                                           */ 2365,
+/* TreatmentSites                                                 */ 3872,
+/* ExtendedCodeMeaning                                            */ 103,
+/* AcquisitionProtocolElementSequence                             */ 1479,
+/* DeviceOrderIndex                                               */ 4360,
+/* BeamSequence                                                   */ 3939,
+/* TransformDescription                                           */ 408,
+/* InputAvailabilityFlag                                          */ 2416,
+/* RefractiveParametersUsedOnPatientSequence                      */ 1885,
+/* ScheduledStationAETitle                                        */ 2269,
+/* AddressTrial                                                   */ 2538,
+/* SurfacePointPresentationValueData                              */ 3471,
+/* OverlayType                                                    */ 4791,
+/* Sensitivity                                                    */ 949,
+/* NormalizationPoint                                             */ 3696,
+/* OverlayOrigin                                                  */ 4793,
+/* ContentLabel                                                   */ 3074,
+/* WaterReferenceAcquisition                                      */ 1200,
+/* ContrastBolusUsageSequence                                     */ 1239,
+/* IndicationLabel                                                */ 392,
+/* RowPositionInTotalImagePixelMatrix                             */ 2737,
+/* ReferencedDoseReferenceUID                                     */ 3920,
+/* TreatmentToleranceViolationDateTime                            */ 4426,
+/* PatientReligiousPreference                                     */ 320,
+/* QualityControlImage                                            */ 1964,
+/* TemporalRangeType                                              */ 2503,
+/* InterpretationIDIssuer                                         */ 4657,
+/* ReferencedFirstFrameSequence                                   */ 3327,
+/* EncryptedAttributesSequence                                    */ 3530,
+/* LUTFrameRange                                                  */ 2150,
+/* VValueData                                                     */ 3476,
+/* RequestPriority                                                */ 3665,
+/* PatientSex                                                     */ 272,
+/* BeamTaskSequence                                               */ 3362,
+/* DoseReferenceSequence                                          */ 3875,
+/* PreAmplifierSettingsSequence                                   */ 471,
+/* TreatmentProtocols                                             */ 3870,
+/* OversamplingPhase                                              */ 1063,
+/* AddPower                                                       */ 2656,
+/* IsocenterToCompensatorTrayDistance                             */ 4156,
+/* LocalizedDeviationFromNormal                                   */ 1847,
+/* PrivateGroupReference                                          */ 130,
+/* ProbeInductance                                                */ 497,
+/* ComponentTypesSequence                                         */ 3435,
+/* CornealTopographyMapQualityEvaluation                          */ 2699,
+/* RelativeTimeUnits                                              */ 3249,
+/* DetectorInformationSequence                                    */ 2795,
+/* PerformedProcedureStepEndTime                                  */ 2301,
+/* RadiusOfCircularCollimator                                     */ 902,
+/* HPGLPenSequence                                                */ 2990,
+/* SelectedTotalOphthalmicAxialLengthSequence                     */ 1749,
+/* InstitutionName                                                */ 86,
+/* TaggingDelay                                                   */ 1158,
+/* QuantityDefinitionSequence                                     */ 2455,
+/* FileMetaInformationGroupLength                                 */ 0,
+/* ScanProgressionDirection                                       */ 2836,
+/* RTImagePosition                                                */ 3675,
+/* ActualRespiratoryTriggerDelayTime                              */ 1609,
+/* LuminanceResponseSequence                                      */ 2105,
+/* RangeModulatorGatingStartWaterEquivalentThickness              */ 4209,
+/* MACCalculationTransferSyntaxUID                                */ 3515,
+/* ReferencedTextureSequence                                      */ 3477,
+/* BeamDosePointEquivalentDepth                                   */ 3924,
+/* CSSFontName                                                    */ 3091,
+/* DosimetricObjectiveParameterSequence                           */ 4596,
+/* MaximumCollatedFilms                                           */ 3589,
+/* PerformedProcedureTypeDescription                              */ 2305,
+/* StorageProtocolElementSequence                                 */ 1490,
+/* ReconstructionDescription                                      */ 1358,
+/* ConsentForDistributionFlag                                     */ 356,
+/* RefractiveIndexOfCornea                                        */ 2665,
+/* PerformedProcessingApplicationsCodeSequence                    */ 2407,
+/* ATDAssessmentSequence                                          */ 4704,
+/* VerticalPrismPower                                             */ 2627,
+/* SelectorSLValue                                                */ 3284,
+/* DeviceVolume                                                   */ 2749,
+/* TypeOfDetectorMotion                                           */ 2821,
+/* CalibrationNotes                                               */ 433,
+/* SpecificationSelectionGuidance                                 */ 3497,
+/* ReferencedBeamSequence                                         */ 4448,
 /* VolumeStreamSequence                                           */ 3217,
-/* VolumeToTableMappingMatrix                                     */ 1615,
-/* VolumeToTransducerMappingMatrix                                */ 1614,
-/* VolumeToTransducerRelationship                                 */ 1616,
-/* VolumetricAnnotationSequence                                   */ 3206,
-/* VolumetricCurvePoints                                          */ 3183,
-/* VolumetricCurveUpDirections                                    */ 3216,
-/* VolumetricPresentationInputAnnotationSequence                  */ 3209,
-/* VolumetricPresentationInputIndex                               */ 3201,
-/* VolumetricPresentationInputNumber                              */ 3162,
-/* VolumetricPresentationInputSetSequence                         */ 3165,
-/* VolumetricPresentationInputSetUID                              */ 3164,
-/* VolumetricPresentationStateInputSequence                       */ 3156,
-/* VolumetricProperties                                           */ 249,
-/* WADORSRetrievalSequence                                        */ 2585,
-/* WADORetrievalSequence                                          */ 2583,
-/* WarningReason                                                  */ 190,
+/* DICOMMediaRetrievalSequence                                    */ 2582,
+/* Polarity                                                       */ 3597,
+/* PrivateInformationCreatorUID                                   */ 20,
+/* SourceToCompensatorDistance                                    */ 4154,
+/* SpecularReflectionIntensity                                    */ 3196,
+/* FovealSensitivityMeasured                                      */ 1863,
+/* RepeatFractionCycleLength                                      */ 3916,
+/* MappingResourceIdentificationSequence                          */ 123,
+/* ReconstructionAngle                                            */ 1220,
+/* CornealTopographySurface                                       */ 2678,
+/* TextComments                                                   */ 4633,
+/* SelectorSSValue                                                */ 3285,
+/* MaxApertureValue                                               */ 587,
+/* TagThickness                                                   */ 1068,
+/* ShutterLowerHorizontalEdge                                     */ 880,
+/* RedPaletteColorLookupTableDescriptor                           */ 2006,
+/* TreatmentToleranceViolationSequence                            */ 4421,
+/* ContainerComponentSequence                                     */ 2343,
+/* FlashFiringStatus                                              */ 567,
+/* TrackingID                                                     */ 2891,
+/* PatientSupportRotationDirection                                */ 4028,
+/* ReviewTime                                                     */ 4483,
+/* ReferencedRTRadiationRecordSequence                            */ 4408,
+/* ScannerSettingsSequence                                        */ 509,
+/* OphthalmicAxialLengthMeasurementModified                       */ 1735,
+/* SourceStartDateTime                                            */ 1257,
+/* CertifiedTimestamp                                             */ 3524,
+/* FiducialIdentifierCodeSequence                                 */ 3138,
+/* DetectorType                                                   */ 998,
+/* ConventionalControlPointVerificationSequence                   */ 3385,
+/* PETPositionSequence                                            */ 1408,
+/* MinimumSensitivityValue                                        */ 1880,
+/* ProtocolElementName                                            */ 1481,
+/* TreatmentDate                                                  */ 3863,
+/* RotationDirection                                              */ 792,
+/* RTPrescriptionSequence                                         */ 4591,
+/* ASLMidSlabPosition                                             */ 1187,
+/* OffsetOfTheNextDirectoryRecord                                 */ 29,
+/* PETFrameCorrectionFactorsSequence                              */ 1409,
+/* FlowIdentifierSequence                                         */ 2182,
+/* Plane                                                          */ 3173,
+/* SpatialTransformOfDose                                         */ 3694,
+/* ModelUsageCodeSequence                                         */ 3040,
+/* OphthalmicAxialLengthMeasurementsSequence                      */ 1705,
+/* BeamDeliveryDurationLimit                                      */ 3953,
+/* ROIDisplayColor                                                */ 3730,
+/* PerformedProtocolCodeSequence                                  */ 2306,
+/* CameraAngleOfView                                              */ 1659,
+/* OverrideSequence                                               */ 3802,
+/* DeliveredDepthDoseParametersSequence                           */ 4260,
+/* AlternateContainerIdentifierSequence                           */ 2340,
+/* TransformedAxisUnits                                           */ 411,
+/* TimeOfGainCalibration                                          */ 431,
+/* ImagePositionVolume                                            */ 1610,
+/* WedgeSequence                                                  */ 3961,
+/* PrismSequence                                                  */ 2624,
+/* SourceSerialNumber                                             */ 3832,
+/* TransducerPosition                                             */ 215,
+/* CondenserLensPower                                             */ 2727,
 /* WaterDepth                                                     */ 597,
-/* WaterEquivalentDiameter                                        */ 840,
-/* WaterEquivalentDiameterCalculationMethodCodeSequence           */ 841,
-/* WaterReferenceAcquisition                                      */ 1200,
-/* WaterReferencedPhaseCorrection                                 */ 1165,
-/* WaveformAnnotationSequence                                     */ 2566,
-/* WaveformBitsAllocated                                          */ 4780,
-/* WaveformBitsStored                                             */ 2244,
-/* WaveformChannelNumber                                          */ 2230,
-/* WaveformData                                                   */ 4783,
-/* WaveformDataDisplayScale                                       */ 2249,
-/* WaveformDisplayBackgroundCIELabValue                           */ 2250,
-/* WaveformOriginality                                            */ 2224,
-/* WaveformPaddingValue                                           */ 4782,
-/* WaveformPresentationGroupSequence                              */ 2251,
-/* WaveformSampleInterpretation                                   */ 4781,
-/* WaveformSequence                                               */ 4777,
 /* WedgeAngle                                                     */ 3965,
-/* WedgeAngleFloat                                                */ 526,
-/* WedgeChamferHeight                                             */ 548,
-/* WedgeCurve                                                     */ 549,
-/* WedgeDefinitionSequence                                        */ 4347,
+/* RoboticPathNodeSetCodeSequence                                 */ 4622,
+/* DiameterOfVisibility                                           */ 3116,
+/* BiopsyTargetSequence                                           */ 917,
 /* WedgeDescription                                               */ 536,
-/* WedgeElement1Position                                          */ 528,
-/* WedgeFactor                                                    */ 3966,
-/* WedgeFrontGap                                                  */ 542,
-/* WedgeFrontHeight                                               */ 544,
-/* WedgeID                                                        */ 3964,
-/* WedgeInContactLength                                           */ 541,
-/* WedgeInContactWidth                                            */ 547,
-/* WedgeManufacturerName                                          */ 535,
-/* WedgeMaterial                                                  */ 530,
-/* WedgeMaterialVelocity                                          */ 529,
-/* WedgeModelNumber                                               */ 525,
-/* WedgeName                                                      */ 534,
-/* WedgeNumber                                                    */ 3962,
-/* WedgeOffsetX                                                   */ 538,
-/* WedgeOffsetY                                                   */ 539,
-/* WedgeOffsetZ                                                   */ 531,
-/* WedgeOrientation                                               */ 3968,
-/* WedgeOriginOffsetX                                             */ 532,
-/* WedgePosition                                                  */ 4020,
-/* WedgePositionSequence                                          */ 4019,
-/* WedgeRearHeight                                                */ 545,
-/* WedgeRoofAngle                                                 */ 527,
-/* WedgeSequence                                                  */ 3961,
-/* WedgeThinEdgePosition                                          */ 3971,
-/* WedgeTimeDelay                                                 */ 533,
-/* WedgeTotalHeight                                               */ 543,
-/* WedgeTotalLength                                               */ 540,
-/* WedgeTotalWidth                                                */ 546,
-/* WedgeType                                                      */ 3963,
-/* WeekdayFractionPatternSequence                                 */ 4618,
-/* WeightingLookupTableData                                       */ 3205,
-/* WeightingLookupTableDescriptor                                 */ 3204,
-/* WeightingTransferFunctionSequence                              */ 3203,
-/* WhiteBalance                                                   */ 608,
+/* MRAcquisitionFrequencyEncodingSteps                            */ 1085,
+/* PhysiciansOfRecordIdentificationSequence                       */ 155,
+/* SensitivityValue                                               */ 1871,
+/* AcquisitionProtocolElementSpecificationSequence                */ 1478,
+/* ResultsIDIssuer                                                */ 4635,
+/* AutoKVPSelectionType                                           */ 1502,
+/* ImagerPixelSpacing                                             */ 813,
+/* AcquisitionMatrix                                              */ 845,
+/* GraphicLayer                                                   */ 3044,
+/* GPSDestLongitudeRef                                            */ 646,
+/* NumberOfScreens                                                */ 3288,
+/* FixationDeviceSequence                                         */ 4060,
+/* SmallestPixelValueInSeries                                     */ 1953,
+/* ScheduledProcedureStepEndDate                                  */ 2272,
+/* DigitalSignatureUID                                            */ 3518,
+/* CroppingSpecificationIndex                                     */ 3160,
+/* FailedSOPSequence                                              */ 192,
+/* RadiusOfCircularExposureControlSensingRegion                   */ 1313,
+/* ReferenceDoseType                                              */ 4293,
+/* ViewingDistance                                                */ 2657,
+/* GeneralAccessoryDefinitionSequence                             */ 4379,
+/* FrameAcquisitionDateTime                                       */ 1098,
+/* DLPNotificationTrigger                                         */ 1501,
+/* AssertionUID                                                   */ 2610,
+/* CurveReferencedOverlayGroup                                    */ 4773,
+/* SequenceVariant                                                */ 662,
+/* SpectralSensitivity                                            */ 573,
+/* NotchFilterFrequency                                           */ 2247,
+/* PixelComponentOrganization                                     */ 983,
+/* AudioComments                                                  */ 4770,
+/* WaveformBitsAllocated                                          */ 4780,
+/* RadiationBeamWedgeAngle                                        */ 4348,
+/* CollimatorGridName                                             */ 816,
+/* ReferencedRTTreatmentPhaseSequence                             */ 4557,
+/* GPSDestLatitudeRef                                             */ 644,
+/* ScheduledStationGeographicLocationCodeSequence                 */ 2422,
+/* ExcludedIntervalsSequence                                      */ 1434,
+/* CoordinateSystemTransformRotationAndScaleMatrix                */ 412,
+/* BlindSpotYCoordinate                                           */ 1883,
+/* TherapeuticRoleTypeCodeSequence                                */ 4585,
+/* AcquisitionMethodCodeSequence                                  */ 1757,
+/* SOPClassesInStudy                                              */ 81,
+/* RecordInUseFlag                                                */ 30,
+/* OphthalmicImageTypeDescription                                 */ 1788,
+/* AcquisitionType                                                */ 1203,
+/* DetectorDescription                                            */ 1000,
+/* CalculatedDoseReferenceDescription                             */ 3814,
+/* EchoTime                                                       */ 695,
+/* KeratometryLeftEyeSequence                                     */ 2642,
+/* OCTBscanAnalysisAcquisitionParametersSequence                  */ 1796,
+/* OverallTemplateSpatialTolerance                                */ 2981,
+/* ProductDescription                                             */ 2600,
+/* GPSSatellites                                                  */ 633,
+/* RadiationSourceCoordinateSystemRollAngle                       */ 4626,
+/* PrintJobID                                                     */ 3624,
+/* SortByCategory                                                 */ 3338,
+/* OverlaysBlue                                                   */ 4819,
+/* NamesOfIntendedRecipientsOfResults                             */ 2379,
+/* ParallelAcquisition                                            */ 1101,
+/* SamplesPerPixelUsed                                            */ 1907,
+/* FractionalChannelDisplayScale                                  */ 2257,
+/* DetectorMode                                                   */ 1001,
+/* SelectedSegmentalOphthalmicAxialLengthSequence                 */ 1748,
+/* RTTreatmentSourceCoordinates                                   */ 4624,
+/* NearPupillaryDistance                                          */ 2638,
+/* CenterOfCircularShutter                                        */ 881,
+/* AngleNumber                                                    */ 1519,
+/* ScanningSpotSize                                               */ 4220,
+/* BeamModifierOrientationAngle                                   */ 4335,
+/* LongitudinalTemporalOffsetFromEvent                            */ 344,
+/* RespiratoryMotionCompensationTechniqueDescription              */ 1159,
+/* RelativeXRayExposure                                           */ 857,
+/* PETReconstructionSequence                                      */ 1414,
+/* ViewpointUpDirection                                           */ 3189,
+/* DACTimePoints                                                  */ 469,
+/* RTDeviceDistanceReferenceLocationCodeSequence                  */ 4355,
+/* DiffusionBValue                                                */ 1110,
+/* SourceOfCornealSizeDataCodeSequence                            */ 1693,
+/* InterpretationTranscriptionTime                                */ 4643,
+/* AnchorPointVisibility                                          */ 3055,
+/* ImageToEquipmentMappingMatrix                                  */ 2151,
+/* ProbeResistance                                                */ 498,
+/* MeasurementPrecisionDescriptionTrial                           */ 2472,
+/* VelocityEncodingAcquisitionSequence                            */ 1114,
+/* SegmentedAlphaPaletteColorLookupTableData                      */ 2026,
+/* ImageTransformationMatrix                                      */ 947,
+/* PlaneOrientationSequence                                       */ 1574,
+/* AcquisitionTime                                                */ 64,
+/* OutlineLeftVerticalEdge                                        */ 888,
+/* ContinuityOfContent                                            */ 2473,
+/* BlockColumns                                                   */ 1942,
+/* CarrierID                                                      */ 4721,
+/* ProbeDriveNotes                                                */ 495,
+/* FalseNegativesQuantity                                         */ 1829,
+/* InversionRecovery                                              */ 1045,
+/* NumberOfOpticalPaths                                           */ 2739,
+/* BoundingPolygon                                                */ 4686,
+/* ScanSpotMetersetWeights                                        */ 4219,
+/* CoordinatesSetGeometricTypeTrial                               */ 2526,
+/* VerticesOfThePolygonalExposureControlSensingRegion             */ 1314,
+/* RadiationDoseValuesParametersSequence                          */ 4298,
+/* PrinterConfigurationSequence                                   */ 3550,
+/* BodyPartExamined                                               */ 660,
+/* DistanceObjectToTableTop                                       */ 1287,
+/* FrameNumbersOfInterest                                         */ 2064,
+/* SpecifiedPrimaryMeterset                                       */ 3783,
+/* ReferenceCoordinates                                           */ 1666,
+/* LUTLabel                                                       */ 2449,
+/* CommentsOnPatientPerformanceOfVisualField                      */ 1825,
+/* SoftcopyVOILUTSequence                                         */ 2060,
+/* BillingItemSequence                                            */ 2315,
+/* VolumeToTransducerMappingMatrix                                */ 1614,
+/* SlideIdentifier                                                */ 2359,
+/* StartAngle                                                     */ 2820,
+/* ZOffsetInSlideCoordinateSystem                                 */ 2364,
+/* ScheduledProcedureStepPriority                                 */ 3392,
+/* TimeSlotNumber                                                 */ 1518,
+/* BreastSupportIsocenterSecondaryAngle                           */ 1365,
+/* GPSMeasureMode                                                 */ 635,
+/* RecommendedLineThickness                                       */ 2947,
+/* PerformedProcessingParametersSequence                          */ 3396,
+/* OverrideReason                                                 */ 3808,
+/* PixelPaddingRangeLimit                                         */ 1958,
 /* WhitePoint                                                     */ 551,
-/* WhitePointFlag                                                 */ 2110,
-/* WholeBodyTechnique                                             */ 843,
-/* WholeSlideMicroscopyImageFrameTypeSequence                     */ 2360,
-/* WideFieldOphthalmicPhotographyQualityRatingSequence            */ 1779,
-/* WideFieldOphthalmicPhotographyQualityThresholdSequence         */ 1780,
-/* WideFieldOphthalmicPhotographyThresholdQualityRating           */ 1781,
-/* WindowCenter                                                   */ 1996,
-/* WindowCenterWidthExplanation                                   */ 2001,
-/* WindowWidth                                                    */ 1997,
-/* WorklistLabel                                                  */ 3393,
-/* XAXRFFrameCharacteristicsSequence                              */ 1293,
-/* XCoordinatesCenterPixelViewAngle                               */ 1782,
-/* XDSRetrievalSequence                                           */ 2584,
-/* XDSStorageSequence                                             */ 2442,
-/* XFocusCenter                                                   */ 819,
-/* XOffsetInSlideCoordinateSystem                                 */ 2362,
-/* XRay3DAcquisitionSequence                                      */ 1341,
-/* XRay3DFrameTypeSequence                                        */ 1339,
-/* XRay3DReconstructionSequence                                   */ 1357,
-/* XRayAcquisitionDoseSequence                                    */ 1361,
-/* XRayDetectorID                                                 */ 1265,
-/* XRayDetectorIndex                                              */ 1264,
-/* XRayDetectorLabel                                              */ 1267,
-/* XRayFilterSequence                                             */ 1375,
-/* XRayGeometrySequence                                           */ 1337,
-/* XRayGridSequence                                               */ 1374,
-/* XRayImageReceptorAngle                                         */ 3672,
-/* XRayImageReceptorTranslation                                   */ 3671,
-/* XRayMassAttenuationCoefficient                                 */ 1284,
-/* XRayOutput                                                     */ 2324,
-/* XRayReceptorType                                               */ 1295,
-/* XRaySourceID                                                   */ 1255,
-/* XRaySourceIndex                                                */ 1254,
+/* LUTDescriptor                                                  */ 2055,
+/* VerticesOfThePolygonalOutline                                  */ 895,
+/* ImplementationVersionName                                      */ 6,
+/* ScheduledProcedureStepStartTime                                */ 2271,
+/* PatientPrimaryLanguageModifierCodeSequence                     */ 275,
+/* BeamLimitingDeviceLeafPairsSequence                            */ 3822,
+/* ImageQualityIndicatorMaterial                                  */ 515,
+/* TestPatternCodeSequence                                        */ 2121,
 /* XRaySourceIsocenterPrimaryAngle                                */ 1362,
-/* XRaySourceIsocenterSecondaryAngle                              */ 1363,
-/* XRayTubeCurrent                                                */ 802,
-/* XRayTubeCurrentInmA                                            */ 1231,
-/* XRayTubeCurrentInuA                                            */ 1040,
-/* YCoordinatesCenterPixelViewAngle                               */ 1783,
-/* YFocusCenter                                                   */ 820,
-/* YOffsetInSlideCoordinateSystem                                 */ 2363,
-/* ZEffective                                                     */ 4682,
-/* ZOffsetInSlideCoordinateSystem                                 */ 2364,
-/* ZeroVelocityPixelValue                                         */ 1446,
+/* HPGLPenLabel                                                   */ 2992,
+/* SnoutPosition                                                  */ 4170,
+/* AnatomicLocationOfExaminingInstrumentDescriptionTrial          */ 232,
+/* OverlayDate                                                    */ 59,
+/* CorrectedParameterSequence                                     */ 3810,
+/* FramePixelShiftSequence                                        */ 2135,
+/* HPGLDocumentScaling                                            */ 2987,
+/* TextureLabel                                                   */ 3474,
+/* FocalLength                                                    */ 591,
+/* SphericalLensPower                                             */ 1637,
+/* DeviceSettingDescription                                       */ 616,
+/* RouteSegmentSequence                                           */ 4672,
+/* ReferencedSOPInstanceUIDInFile                                 */ 37,
+/* ReferencedProcedureStepSequence                                */ 2331,
+/* ReferencedImageEvidenceSequence                                */ 243,
+/* OverlayData                                                    */ 4824,
+/* DeviceDescription                                              */ 2756,
+/* ThresholdDensity                                               */ 3619,
+/* OOIType                                                        */ 4708,
+/* GeneratorID                                                    */ 713,
+/* QuantifiedDefect                                               */ 1875,
+/* ImplantAssemblyTemplateName                                    */ 3425,
+/* ReferencedPresentationLUTSequence                              */ 3623,
+/* IdentifyingPrivateElements                                     */ 135,
+/* ProtocolPlanningInformation                                    */ 1462,
+/* CompensatorBasePlaneOffset                                     */ 4368,
+/* TransferTubeLength                                             */ 4140,
+/* SegmentSequence                                                */ 2873,
+/* PixelSpacingCalibrationType                                    */ 1992,
+/* PhotonEnergy                                                   */ 1283,
+/* ReferencedPerformedProcedureStepSequence                       */ 167,
+/* HalfValueLayer                                                 */ 2325,
+/* SequenceDelimitationItem                                       */ 4843,
+/* TimeOfFlightContrast                                           */ 1050,
+/* FrameDisplayShutterSequence                                    */ 1334,
+/* TrackSetSequence                                               */ 2952,
+/* AlgorithmSource                                                */ 1895,
+/* NumberOfFramesInRotation                                       */ 2806,
+/* RTTreatmentFractionCompletionStatus                            */ 4411,
+/* MultiPlanarReconstructionStyle                                 */ 3176,
+/* BreastSupportIsocenterPrimaryAngle                             */ 1364,
+/* FractionStatusSummarySequence                                  */ 3862,
+/* PositionerMotion                                               */ 868,
+/* SegmentedBluePaletteColorLookupTableData                       */ 2025,
+/* InitialCineRunState                                            */ 684,
+/* AbsoluteChannelDisplayScale                                    */ 2258,
+/* ContrastBolusAgentPhase                                        */ 1242,
+/* NumberOfTimeSlots                                              */ 2812,
+/* CodingSchemeUID                                                */ 107,
+/* ConstantVolumeFlag                                             */ 1233,
+/* MaximumNumberOfIntervalDays                                    */ 4565,
+/* PercentPhaseFieldOfView                                        */ 707,
+/* DocumentIdentifierCodeSequenceTrial                            */ 2476,
+/* RangeShifterType                                               */ 4176,
+/* UsedSegmentsSequence                                           */ 2889,
+/* InterventionDrugStopTime                                       */ 668,
+/* ConstituentConceptualVolumeUID                                 */ 4503,
+/* FinalCumulativeMetersetWeight                                  */ 4013,
+/* ConstraintViolationCondition                                   */ 3501,
+/* AddOtherSequence                                               */ 2655,
+/* ImplantTypeCodeSequence                                        */ 3002,
+/* SelectorSequencePointerPrivateCreator                          */ 3255,
+/* BeamOrderIndexTrial                                            */ 3364,
+/* PerProjectionAcquisitionSequence                               */ 1359,
+/* PrivateDataElement                                             */ 137,
+/* NTPSourceAddress                                               */ 907,
+/* RequestingService                                              */ 2169,
+/* MeasuredAPDimension                                            */ 298,
+/* BeamLimitingDeviceAngle                                        */ 4025,
+/* MRSpectroscopyAcquisitionType                                  */ 1166,
+/* SoundPathLength                                                */ 480,
+/* ThreeDImplantTemplateGroupMemberMatchingAxes                   */ 3457,
+/* RTPhysicianIntentInputInstanceSequence                         */ 4579,
+/* MultienergyCTCharacteristicsSequence                           */ 1252,
+/* IndicationDisposition                                          */ 395,
+/* BlockDefinitionSequence                                        */ 4372,
+/* AnnotationFlag                                                 */ 3559,
+/* WindowCenter                                                   */ 1996,
+/* IsocenterToGeneralAccessoryDistance                            */ 4240,
+/* ModifiableConstraintFlag                                       */ 3502,
+/* DetectorIsocenterPrimaryAngle                                  */ 1369,
+/* OverlayBitsAllocated                                           */ 4803,
+/* Trim                                                           */ 3586,
+/* SecondaryCaptureDeviceID                                       */ 720,
+/* NumberOfEnergyWindows                                          */ 2785,
+/* CurrentFrameFunctionalGroupsSequence                           */ 41,
+/* ThreatCategoryDescription                                      */ 4676,
+/* CornealPointEstimated                                          */ 2702,
+/* DeidentificationActionSequence                                 */ 134,
+/* ReferencedRTPlanSequence                                       */ 4447,
+/* VitreousStatusDescription                                      */ 1710,
+/* ReasonForTheAttributeModification                              */ 3540,
+/* NumberOfVisualStimuli                                          */ 1821,
 /* ZonalMap                                                       */ 3548,
-/* ZonalMapFormat                                                 */ 1984,
-/* ZonalMapLocation                                               */ 1983,
-/* ZonalMapNumberFormat                                           */ 1982,
-/* ZoomCenter                                                     */ 1921,
-/* ZoomFactor                                                     */ 1920,
-/* dBdt                                                           */ 850
+/* MaximumFractionalValue                                         */ 2885,
+/* MinimumStoredValueMapped                                       */ 2028,
+/* MultienergyCTPathIndex                                         */ 1274,
+/* SpecifiedMeterset                                              */ 3791,
+/* ReferenceLocationDescription                                   */ 1448,
+/* LateralSpreadingDeviceSettingsSequence                         */ 4203,
+/* RTRelatedROISequence                                           */ 3732,
+/* IncludesImagingSubject                                         */ 2188,
+/* PrimaryAnatomicStructureSequence                               */ 220,
+/* SpectroscopyAcquisitionDataColumns                             */ 1135,
+/* ReprojectionMethod                                             */ 2840,
+/* MPRThicknessType                                               */ 3177,
+/* DistributionAddress                                            */ 4655,
+/* ATDAbilityAssessment                                           */ 4677,
+/* ContextGroupExtensionCreatorUID                                */ 108,
+/* TestPointNormalsDataFlag                                       */ 1836,
+/* PreserveCompositeInstancesAfterMediaCreation                   */ 3659,
+/* PrescriptionDescription                                        */ 3874,
+/* CodeMeaning                                                    */ 99,
+/* ReferencePixelPhysicalValueY                                   */ 963,
+/* CenterOfRotationOffset                                         */ 797,
+/* GeneralizedDefectCorrectedSensitivityDeviationValue            */ 1878,
+/* InternalDetectorFrameTime                                      */ 414,
+/* PhaseNumber                                                    */ 1516,
+/* TerminationRespiratoryTriggerCountThreshold                    */ 1400,
+/* PresentationLUTSequence                                        */ 3621,
+/* LongPrimitivePointIndexList                                    */ 2948,
+/* SmallestImagePixelValueInPlane                                 */ 1955,
+/* GrayLookupTableData                                            */ 2014,
+/* ThreeDMatingAxes                                               */ 3020,
+/* StudyReadTime                                                  */ 2159,
+/* CollimatorShape                                                */ 896,
+/* SourceApplicationEntityTitle                                   */ 7,
+/* ChemicalShiftReference                                         */ 1083,
+/* EndingRespiratoryAmplitude                                     */ 1600,
+/* NumberOfFractions                                              */ 4608,
+/* ImplantAssemblyTemplateType                                    */ 3429,
+/* ScanningSequence                                               */ 661,
+/* PatientSupportPositionSpecificationMethod                      */ 4358,
+/* CodingSchemeResponsibleOrganization                            */ 115,
+/* OverlayOrImageMagnification                                    */ 3614,
+/* TemporalPositionTimeOffset                                     */ 1618,
+/* PulseSequenceName                                              */ 1042,
+/* CollimatorType                                                 */ 817,
+/* SpiralPitchFactor                                              */ 1212,
+/* DerivationImageSequence                                        */ 246,
+/* ImpedanceMeasurementDateTime                                   */ 2266,
+/* ReferencedContentItem                                          */ 3208,
+/* URNCodeValue                                                   */ 119,
+/* MaskPointers                                                   */ 2067,
+/* MeasuredDoseType                                               */ 3772,
+/* AlternateBeamDose                                              */ 3932,
+/* DataSetSubtype                                                 */ 69,
+/* DisplayedZValue                                                */ 922,
+/* ThreatROIVoxelSequence                                         */ 4665,
+/* ImagingDeviceSpecificAcquisitionParameters                     */ 3958,
+/* DVHMinimumDose                                                 */ 3712,
+/* ObjectDirectoryBinaryIdentifierTrial                           */ 2492,
+/* IsocenterReferenceSystemSequence                               */ 1324,
+/* RTPlanDescription                                              */ 3867,
+/* TableHeight                                                    */ 784,
+/* ContourNumber                                                  */ 3743,
+/* GPSProcessingMethod                                            */ 652,
+/* RecognizableVisualFeatures                                     */ 1966,
+/* CountryOfResidence                                             */ 310,
+/* WedgeOffsetY                                                   */ 539,
+/* BeamCurrentModulationID                                        */ 4191,
+/* ImageBoxTileVerticalDimension                                  */ 3311,
+/* PhysicalDetectorSize                                           */ 1302,
+/* GrayLookupTableDescriptor                                      */ 2005,
+/* UDISequence                                                    */ 718,
+/* PixelIntensityRelationship                                     */ 1994,
+/* BrachyAccessoryDeviceNominalThickness                          */ 4117,
+/* AcquisitionsInStudy                                            */ 1545,
+/* DetectorTemperatureSequence                                    */ 416
 };
 
 /* Length of longest keyword = 3 bytes,
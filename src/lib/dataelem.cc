@@ -138,6 +138,18 @@ void DataElement::_fromNumberVectorToAttrTags(const std::vector<AVT> &value) {
   }
 }
 
+// `size` bytes at the start of a DataElement's value, valid while this object
+// lives; streams that don't keep their bytes (WINDOWED) hold them pinned.
+struct pinned_value {
+  DataElement *de;
+  char *p;
+  explicit pinned_value(DataElement *de)
+      : de(de), p((char *)de->pinValue(0, de->length())) {}
+  pinned_value(DataElement *de, size_t size)
+      : de(de), p((char *)de->pinValue(0, size)) {}
+  ~pinned_value() { de->unpinValue(p); }
+};
+
 // Used by `DataElement::toLongVector()`, `DataElement::toLongLongVector()`,
 // `DataElement::toDoubleVector()`.
 #define __BUFFER_TO_VECTOR__(T)                                  \
@@ -203,6 +215,69 @@ void *DataElement::value_ptr() {
     return nullptr;
 }
 
+void *DataElement::pinValue(size_t offset, size_t size) {
+  if (vr_ == VR::SQ || vr_ == VR::PIXSEQ || offset + size > length_)
+    return nullptr;
+  else if (ptr_)
+    return (uint8_t *)ptr_ + offset;
+  else if (parent_ && parent_->instream())
+    return parent_->instream()->pin(offset_ + offset, size);
+  else
+    return nullptr;
+}
+
+void DataElement::unpinValue(const void *ptr) {
+  if (!ptr || vr_ == VR::SQ || vr_ == VR::PIXSEQ ||
+      (ptr_ && (const uint8_t *)ptr >= (uint8_t *)ptr_ &&
+               (const uint8_t *)ptr <= (uint8_t *)ptr_ + length_))
+    return;
+  if (parent_ && parent_->instream()) parent_->instream()->unpin(ptr);
+}
+
+void DataElement::retainValue() {
+  if (vr_ == VR::SQ || vr_ == VR::PIXSEQ || ptr_ || length_ == 0) return;
+
+  void *q = ::malloc(length_);
+  if (!q) {
+    LOGERROR_AND_THROW(
+        "DataElement::retainValue - "
+        "cannot allocate %zd bytes for the DataElement %s, VR %s.",
+        length_, TAG::repr(tag_).c_str(), VR::repr(vr_));
+  }
+  InStream *is = parent_ ? parent_->instream() : nullptr;
+  if (!is || is->read_at(offset_, q, length_) != length_) {
+    ::free(q);
+    LOGERROR_AND_THROW(
+        "DataElement::retainValue - cannot get %zd bytes of value for the "
+        "DataElement %s from the stream.",
+        length_, TAG::repr(tag_).c_str());
+  }
+  ptr_ = q;
+}
+
+void *DataElement::value_ptr(size_t offset, size_t size) {
+  if (offset + size > length_)
+    return nullptr;
+  else if (ptr_)
+    return (uint8_t *)ptr_ + offset;
+  else if (parent_ && parent_->instream())
+    return parent_->instream()->get_pointer(offset_ + offset, size);
+  else
+    return nullptr;
+}
+
+size_t DataElement::readValue(size_t offset, void *ptr, size_t size) {
+  if (offset + size > length_)
+    return 0;
+  else if (ptr_) {
+    memcpy(ptr, (uint8_t *)ptr_ + offset, size);
+    return size;
+  } else if (parent_ && parent_->instream())
+    return parent_->instream()->read_at(offset_ + offset, ptr, size);
+  else
+    return 0;
+}
+
 long DataElement::toLong(long default_value) {
   if (!isValid() || length_ == 0) return default_value;
 
@@ -236,7 +311,7 @@ long DataElement::toLong(long default_value) {
       value = length_ >= 8 ? toBuffer<uint64_t>()[0] : default_value;
       break;
     case VR::IS:
-      value = _fromStringToNumber<long>((const char *)value_ptr(), length_,
+      value = _fromStringToNumber<long>(pinned_value(this).p, length_,
                                         default_value);
       break;
     default:
@@ -284,7 +359,7 @@ long long DataElement::toLongLong(long long default_value) {
       value = length_ >= 8 ? toBuffer<uint64_t>()[0] : default_value;
       break;
     case VR::IS:
-      value = _fromStringToNumber<long long>((const char *)value_ptr(), length_,
+      value = _fromStringToNumber<long long>(pinned_value(this).p, length_,
                                              default_value);
       break;
     default:
@@ -333,7 +408,7 @@ std::vector<long> DataElement::toLongVector() {
       __BUFFER_TO_VECTOR__(uint64_t)
       break;
     case VR::IS:
-      _fromStringToNumberVector<long>((const char *)value_ptr(), length_, vec);
+      _fromStringToNumberVector<long>(pinned_value(this).p, length_, vec);
       break;
     default:
       LOGERROR_AND_THROW(
@@ -380,7 +455,7 @@ std::vector<long long> DataElement::toLongLongVector() {
       __BUFFER_TO_VECTOR__(uint64_t)
       break;
     case VR::IS:
-      _fromStringToNumberVector<long long>((const char *)value_ptr(), length_,
+      _fromStringToNumberVector<long long>(pinned_value(this).p, length_,
                                            vec);
       break;
     default:
@@ -409,7 +484,7 @@ double DataElement::toDouble(double default_value) {
       value = length_ >= 8 ? toBuffer<float64_t>()[0] : default_value;
       break;
     case VR::DS:
-      value = _fromStringToNumber<double>((const char *)value_ptr(), length_,
+      value = _fromStringToNumber<double>(pinned_value(this).p, length_,
                                           default_value);
       break;
     case VR::SS:
@@ -450,7 +525,7 @@ std::vector<double> DataElement::toDoubleVector() {
       __BUFFER_TO_VECTOR__(float64_t)
       break;
     case VR::DS:
-      _fromStringToNumberVector<double>((const char *)value_ptr(), length_,
+      _fromStringToNumberVector<double>(pinned_value(this).p, length_,
                                         vec);
       break;
     default:
@@ -486,7 +561,8 @@ int DataElement::vm() {
     case VR::DS:    case VR::DT:    case VR::IS:    case VR::LO:
     case VR::PN:    case VR::SH:    case VR::TM:    case VR::UC:
     case VR::UI: {
-      uint8_t *p = static_cast<uint8_t *>(value_ptr());
+      pinned_value value(this);
+      uint8_t *p = (uint8_t *)value.p;
       if (p) {
         int delims = 0;
         for (size_t i = 0; i < length_; i++)
@@ -539,31 +615,43 @@ static void de_value_lstrip(char **s, int *n) {
 
 template <typename T>
 Buffer<T> DataElement::toBuffer() {
-  if (sizeof(T) == 1)
-    return Buffer<T>((T *)(value_ptr()), length_);
-  else {
+  bool swap = false;
+  if (sizeof(T) > 1) {
     bool is_little_endian =
         parent_->isLittleEndian() || TAG::group(tag_) == 0x0002;
+    swap = (is_little_endian != (__BYTE_ORDER == __LITTLE_ENDIAN));
+  }
 
-    if (is_little_endian == (__BYTE_ORDER == __LITTLE_ENDIAN))
-      return Buffer<T>((T *)(value_ptr()), length_ / sizeof(T));
-    else {
-      Buffer<T> buf(length_ / sizeof(T));
-      if (sizeof(T) == 2)
-        copyswap2((uint8_t *)buf.data, (uint8_t *)value_ptr(), length_);
-      else if (sizeof(T) == 4)
-        copyswap4((uint8_t *)buf.data, (uint8_t *)value_ptr(), length_);
-      else if (sizeof(T) == 8)
-        copyswap8((uint8_t *)buf.data, (uint8_t *)value_ptr(), length_);
-      return buf;
-    }
+  uint8_t *p = (uint8_t *)value_ptr();
+  if (p && !swap) return Buffer<T>((T *)p, length_ / sizeof(T));
+
+  Buffer<T> buf(length_ / sizeof(T));
+  Buffer<uint8_t> copy;
+  if (!p && length_) {
+    // stream doesn't keep its bytes (WINDOWED); read a copy of the value.
+    size_t size = swap ? length_ : buf.size * sizeof(T);
+    p = swap ? copy.alloc(length_) : (uint8_t *)buf.data;
+    if (!p || readValue(0, p, size) != size)
+      LOGERROR_AND_THROW(
+          "DataElement::toBuffer - cannot get %zd bytes of value for the "
+          "DataElement %s from the stream.",
+          length_, TAG::repr(tag_).c_str());
+    if (!swap) return buf;
   }
+  if (sizeof(T) == 2)
+    copyswap2((uint8_t *)buf.data, p, length_);
+  else if (sizeof(T) == 4)
+    copyswap4((uint8_t *)buf.data, p, length_);
+  else if (sizeof(T) == 8)
+    copyswap8((uint8_t *)buf.data, p, length_);
+  return buf;
 }
 
 std::string DataElement::toBytes(const char *default_value) {
   if (!isValid() || length_ == 0) return std::string(default_value);
 
-  char *s = (char *)value_ptr();
+  pinned_value value(this);
+  char *s = value.p;
   int n = (int)length_;
 
   if (s) {
@@ -766,7 +854,8 @@ std::wstring DataElement::repr(size_t max_length) {
       wchar_t buf[32];
 
       oss << "'";
-      char *p = (char *)value_ptr();
+      pinned_value value(this, std::min(length_, max_length + 1));
+      char *p = value.p;
       for (size_t i = 0; i < length_; i++) {
         if (isprint(*p)) {
           swprintf(buf, 32, L"%hc", *p);
@@ -789,7 +878,8 @@ std::wstring DataElement::repr(size_t max_length) {
 std::vector<std::wstring> DataElement::toStringVector() {
   std::vector<std::wstring> vec;
 
-  char *p = (char *)value_ptr();
+  pinned_value value(this);
+  char *p = value.p;
 
   if (!isValid() || length_ == 0 || !p) return vec;
 
@@ -885,7 +975,8 @@ std::vector<std::wstring> DataElement::toStringVector() {
 std::wstring DataElement::toString(const wchar_t *default_value) {
   if (!isValid()) return default_value;
 
-  char *p = (char *)value_ptr();
+  pinned_value value(this);
+  char *p = value.p;
   int n = (int)length_;
 
   if (length_ == 0 || !p) return std::wstring(L"");
@@ -1378,6 +1469,8 @@ void DataElement::alloc_ptr_(size_t size) {
   }
 
   _free_ptr();
+  if (parent_ && TAG::is_private_creator(tag_))
+    parent_->invalidatePrivateBlocks();
   if (size == 0) return;
   ptr_ = ::malloc(size);
   if (!ptr_) {
@@ -6,13 +6,21 @@
  * dataset.cc
  */
 
+#include <errno.h>
 #include <stdio.h>
 #include <string.h>
 #include <wchar.h>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <memory>
+#include <new>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -24,10 +32,23 @@
 
 namespace dicom {
 
+// Tags selected by DataSet::setLoadTags(), for one level of DataSet.
+// A null TagFilter for a tag selects the whole element including its items.
+struct TagFilter {
+  std::map<tag_t, std::unique_ptr<TagFilter>> tags;
+};
+
 DataSet::DataSet()
     : root_dataset_(this),
       transfer_syntax_(UID::EXPLICIT_VR_LITTLE_ENDIAN),
-      specific_charset0_(CHARSET::UNKNOWN) {
+      specific_charset0_(CHARSET::UNKNOWN),
+      arena_used_(0),
+      arena_capacity_(0),
+      free_elements_(nullptr),
+      load_option_(LoadOption::DEFAULT),
+      tag_filter_(nullptr),
+      private_blocks_valid_(false),
+      load_complete_(true) {
   // 0xffffffff for last_tag_loaded_ will prevent getDataElement try to load()
   // from an empty DataSet.
   last_tag_loaded_ = 0xffffffff;
@@ -37,7 +58,14 @@ DataSet::DataSet()
 
 DataSet::DataSet(DataSet* parent)
     : root_dataset_(parent),
-      transfer_syntax_(parent->getTransferSyntax())
+      transfer_syntax_(parent->getTransferSyntax()),
+      arena_used_(0),
+      arena_capacity_(0),
+      free_elements_(nullptr),
+      load_option_(LoadOption::DEFAULT),
+      tag_filter_(nullptr),
+      private_blocks_valid_(false),
+      load_complete_(true)
 {
   last_tag_loaded_ = 0x0;
   UINT64(buf8_) = 0;
@@ -45,13 +73,113 @@ DataSet::DataSet(DataSet* parent)
   LOG_DEBUG("++ @%p\tDataSet::DataSet(DataSet*) parent @%p", this, parent);
 }
 
-DataSet::~DataSet() { LOG_DEBUG("-- @%p\t~DataSet::~DataSet()", this); }
+DataSet::~DataSet() {
+  destroyDataElements();
+  LOG_DEBUG("-- @%p\t~DataSet::~DataSet()", this);
+}
 
 void DataSet::close() {
-  edict_.clear();
+  destroyDataElements();
+  if (this == root_dataset_) {
+    arena_.clear();
+    arena_used_ = arena_capacity_ = 0;
+    free_elements_ = nullptr;
+  }
   detach();  
 }
 
+typedef std::pair<tag_t, DataElement*> ElementRecord;
+
+static inline bool tag_less(const ElementRecord& record, tag_t tag) {
+  return record.first < tag;
+}
+
+// find the record of `tag` or the position to insert it.
+static inline std::vector<ElementRecord>::iterator lower_bound_tag(
+    std::vector<ElementRecord>& edict, tag_t tag) {
+  return std::lower_bound(edict.begin(), edict.end(), tag, tag_less);
+}
+
+DataSet::iterator::iterator(DataSet* ds, size_t index)
+    : ds_(ds), index_(index), tag_(0) {
+  if (index_ < ds_->edict_.size())
+    tag_ = ds_->edict_[index_].first;
+  else
+    index_ = SIZE_MAX;
+}
+
+void DataSet::iterator::sync() const {
+  if (index_ == SIZE_MAX) return;
+  std::vector<ElementRecord>& edict = ds_->edict_;
+  if (index_ < edict.size() && edict[index_].first == tag_) return;
+
+  index_ = lower_bound_tag(edict, tag_) - edict.begin();
+  if (index_ == edict.size()) index_ = SIZE_MAX;
+}
+
+DataSet::iterator::reference DataSet::iterator::operator*() const {
+  sync();
+  return ds_->edict_[index_];
+}
+
+DataSet::iterator& DataSet::iterator::operator++() {
+  sync();
+  if (index_ == SIZE_MAX) return *this;
+
+  // already at the next record if the DataElement of tag_ was removed.
+  std::vector<ElementRecord>& edict = ds_->edict_;
+  if (edict[index_].first == tag_) index_++;
+  if (index_ < edict.size())
+    tag_ = edict[index_].first;
+  else
+    index_ = SIZE_MAX;
+  return *this;
+}
+
+bool DataSet::iterator::operator==(const iterator& other) const {
+  sync();
+  other.sync();
+  return ds_ == other.ds_ && index_ == other.index_;
+}
+
+DataElement* DataSet::newDataElement(tag_t tag, vr_t vr, size_t length,
+                                     size_t offset) {
+  DataSet* root = root_dataset_;
+  if (root->free_elements_) {
+    void* slot = root->free_elements_;
+    root->free_elements_ = *(void**)slot;
+    return new (slot) DataElement(tag, vr, length, offset, this);
+  }
+  if (root->arena_used_ == root->arena_capacity_) {
+    // blocks grow from 64 to 4096 DataElements.
+    size_t capacity =
+        root->arena_capacity_ ? std::min(root->arena_capacity_ * 2, size_t(4096))
+                              : 64;
+    root->arena_.push_back(
+        std::unique_ptr<ElementStorage[]>(new ElementStorage[capacity]));
+    root->arena_capacity_ = capacity;
+    root->arena_used_ = 0;
+  }
+  DataElement* de = new (&root->arena_.back()[root->arena_used_])
+      DataElement(tag, vr, length, offset, this);
+  root->arena_used_++;
+  return de;
+}
+
+void DataSet::deleteDataElement(DataElement* de) {
+  DataSet* root = root_dataset_;
+  de->~DataElement();
+  *(void**)de = root->free_elements_;
+  root->free_elements_ = de;
+}
+
+void DataSet::destroyDataElements() {
+  for (auto& record : edict_) deleteDataElement(record.second);
+  edict_.clear();
+  private_blocks_.clear();
+  private_blocks_valid_ = false;
+}
+
 DataElement* DataSet::addDataElement(tag_t tag, vr_t vr, uint32_t length,
                                      size_t offset) {
   if (tag != 0 && vr == VR::NONE) {
@@ -63,138 +191,109 @@ DataElement* DataSet::addDataElement(tag_t tag, vr_t vr, uint32_t length,
           TAG::repr(tag).c_str());
     }
   }
-  removeDataElement(tag);
-  return (edict_[tag] = std::unique_ptr<DataElement>(
-              new DataElement(tag, vr, length, offset, this)))
-      .get();
-}
+  DataElement* de = newDataElement(tag, vr, length, offset);
+  if (TAG::is_private_creator(tag)) private_blocks_valid_ = false;
+  if (edict_.empty() || edict_.back().first < tag) {
+    // tags arrive in ascending order while loading; append at the end.
+    edict_.emplace_back(tag, de);
+    return de;
+  }
 
-DataElement* DataSet::addDataElement(const char *tagstr, vr_t vr)
-{
-  char *_tagstr = (char *) tagstr;
-  char *nextptr;
-  char *endptr = (char *) tagstr + strlen(tagstr);
-
-  tag_t tag, gggg, eeee;
-  tag_t block;
-  int seqidx;
-  DataElement *el;
-  DataSet* dataset = this;
+  auto it = lower_bound_tag(edict_, tag);
+  if (it != edict_.end() && it->first == tag) {
+    deleteDataElement(it->second);
+    it->second = de;
+  } else {
+    edict_.emplace(it, tag, de);
+  }
+  return de;
+}
 
-  while (1) {
-    // ignore starting (
-    if (_tagstr[0] == '(')
-      _tagstr++;
-
-    if ((_tagstr[0] >= '0' && _tagstr[0] <= '9') ||   //
-        ((_tagstr[0] == 'F' || _tagstr[0] == 'f') &&  //
-         (_tagstr[1] == 'F' || _tagstr[1] == 'f'))) {
-      // string starts with number - read gggg or ggggeeee
-      tag = tag_t(strtol(_tagstr, &nextptr, 16));
-
-      if (nextptr && (*nextptr == ',' || *nextptr == '{')) {
-        // if string->hex conversion is stopped by ',' or '{',
-        // first portion is group number
-        gggg = tag;
-
-        // if ",{" string sequence, skip ','
-        if (*nextptr == ',' && nextptr[1] == '{') nextptr++;
-
-        // string between { and } is creator id
-        // e.g. 0000,{CREATOR}00
-        if ((*nextptr == '{') && (tag & 1)) {
-          _tagstr = nextptr + 1;
-
-          nextptr++;
-          int n = 0;
-          while (nextptr[n] && nextptr[n] != '}') n++;
-
-          if (nextptr[n] == '\0') {
-            LOGERROR_AND_THROW(
-                "DataSet::addDataElement(\"%s\"): "
-                "malformed string -- no matching '}'",
-                tagstr);
-            el = DataElement::NullElement();
-            break;
-          }
-          std::string creator(nextptr, n);
+tag_t DataSet::findPrivateBlock(uint16_t gggg, const std::string& creator) {
+  // load() of the root DataSet may add private creators until it completes.
+  std::unique_lock<std::recursive_mutex> lock;
+  if (this == root_dataset_ && !load_complete_) {
+    lock = lockLoading();
+    tag_t last_creator = TAG::build(gggg, 0xff);
+    if (last_creator > last_tag_loaded_) load(last_creator, NULL);
+  }
 
-          tag_t first_empty_block = 0x0;
+  // check again under the lock; another thread may have built the index.
+  if (!private_blocks_valid_ && !lock) lock = lockLoading();
+  if (!private_blocks_valid_) {
+    private_blocks_.clear();
+    for (auto it = lower_bound_tag(edict_, 0x00010010); it != edict_.end();
+         ++it) {
+      if (!TAG::is_private_creator(it->first) || !it->second->isValid())
+        continue;
+      // lowest block wins if a creator reserved several blocks in a group.
+      auto& blocks = private_blocks_[it->second->toBytes()];
+      if (blocks.empty() || blocks.back().first != TAG::group(it->first))
+        blocks.emplace_back(TAG::group(it->first),
+                            uint8_t(TAG::element(it->first)));
+    }
+    private_blocks_valid_ = true;
+  }
 
-          // find element from gggg0001 to gggg00ff
-          for (block = 0x10; block <= 0xff; block++) {
-            DataElement* creator_de =
-                dataset->getDataElement(TAG::build(gggg, block));
-            if (!creator_de->isValid()) {
-              if (first_empty_block == 0) first_empty_block = block;
-              continue;
-            }
-            if (creator_de->toBytes() == creator) break;
-          }
+  auto found = private_blocks_.find(creator);
+  if (found != private_blocks_.end())
+    for (const auto& block : found->second)
+      if (block.first == gggg) return block.second;
+  return 0;
+}
 
-          // it's very weird, but all blocks are filled...
-          if (first_empty_block > 0xff) {
-            LOGERROR_AND_THROW(
-                "DataSet::addDataElement - cannot add private DataElement for "
-                "(%s).",
-                tagstr);
-          }
+DataElement* DataSet::addDataElement(const char *tagstr, vr_t vr)
+{
+  return addDataElement(TagPath::from_string(tagstr), vr);
+}
 
-          if (block > 0xff) {
-            // no such block of elements from private creator
-            // make a new block 
-            block = first_empty_block;
-            // Private Creator Data Element
-            DataElement* creator_de =
-                dataset->addDataElement(TAG::build(gggg, block), VR::LO);
-            creator_de->fromBytes(creator);
-          }
+DataElement* DataSet::addDataElement(const TagPath& tagpath, vr_t vr)
+{
+  const std::vector<TagPath::Node>& nodes = tagpath.nodes();
+  DataElement *el = DataElement::NullElement();
+  DataSet* dataset = this;
 
-          _tagstr = nextptr + n + 1;
+  for (size_t i = 0; i < nodes.size(); i++) {
+    const TagPath::Node& node = nodes[i];
+    tag_t tag = node.tag;
 
-          // Get element number in the block
-          eeee = tag_t(strtol(_tagstr, &nextptr, 16));
-          eeee = (block << 8) + (eeee & 0xff);
-        } else {
-          _tagstr = nextptr + 1;
+    if (!node.creator.empty()) {
+      tag_t gggg = TAG::group(tag);
+      tag_t block = dataset->findPrivateBlock(gggg, node.creator);
 
-          // Get element number in eeee form
-          eeee = tag_t(strtol(_tagstr, &nextptr, 16));
-        }
+      if (block == 0) {
+        // no such block of elements from private creator
+        // make a new block
+        for (block = 0x10; block <= 0xff; block++)
+          if (!dataset->getDataElement(TAG::build(gggg, block))->isValid())
+            break;
 
-        if (eeee == 0 && _tagstr == nextptr)
+        // it's very weird, but all blocks are filled...
+        if (block > 0xff)
           LOGERROR_AND_THROW(
-              "DataSet::addDataElement - "
-              "malformed string '%s'; no number after ',' or '}'",
-              tagstr);
-
-        tag = TAG::build(gggg, eeee);
-
-        if (*nextptr == ')') nextptr++;
+              "DataSet::addDataElement - cannot add private DataElement for "
+              "(%s).",
+              tagpath.str().c_str());
+
+        // Private Creator Data Element
+        DataElement* creator_de =
+            dataset->addDataElement(TAG::build(gggg, block), VR::LO);
+        creator_de->fromBytes(node.creator);
       }
-    } else {
-      // tagstr is keyword string
-      int n = 0;
-
-      while (_tagstr[n] && _tagstr[n] != '.')  // take until next '.'
-        n++;
-      tag = TAG::from_keyword(std::string(_tagstr, n).c_str());
-      if (tag == 0xffffffff)
-        LOGERROR_AND_THROW(
-            "DataSet::getDataElement - error in string '%s'; no such keyword "
-            "'%s'",
-            tagstr, std::string(_tagstr, n).c_str());
-
-      nextptr = (char *) _tagstr + n;
+      tag = TAG::build(gggg, (block << 8) + (tag & 0xff));
     }
 
-    _tagstr = nextptr + 1;
-
-    if (_tagstr >= endptr) {
+    if (node.seqidx < 0) {
       el = dataset->addDataElement(tag, vr);
       break;
     }
 
+    if (i + 1 == nodes.size())
+      LOGERROR_AND_THROW(
+          "DataSet::addDataElement - error in string '%s'; tag is not "
+          "specified after sequence number",
+          tagpath.str().c_str());
+
     // There is more tagstr to be processed. It means we are dealing with SQ.
     el = dataset->getDataElement(tag);
 
@@ -202,168 +301,75 @@ DataElement* DataSet::addDataElement(const char *tagstr, vr_t vr)
       LOGERROR_AND_THROW(
           "DataSet::addDataElement - error in string '%s'; VR of element %s "
           "(VR::%s) is not VR::SQ",
-          tagstr, TAG::repr(tag).c_str(), VR::repr(el->vr()));
+          tagpath.str().c_str(), TAG::repr(tag).c_str(), VR::repr(el->vr()));
 
     if (!el->isValid()) {
       el = dataset->addDataElement(tag, VR::SQ);
     }
 
-    // number after '.' is DataSet sequence number, starting from 0.
-    seqidx = int(strtol(_tagstr, &nextptr, 10));
-
     Sequence *seq = el->toSequence();
 
-    while (seq->size() <= seqidx)
+    while (seq->size() <= node.seqidx)
       seq->addDataSet();
 
-    dataset = seq->getDataSet(seqidx);
-
-    _tagstr = nextptr + 1;
-    if (_tagstr >= endptr) {
-      LOGERROR_AND_THROW(
-          "DataSet::addDataElement - error in string '%s'; tag is not "
-          "specified after sequence number",
-          tagstr);
-    }
-  } // while (1)
+    dataset = seq->getDataSet(node.seqidx);
+  }
   return el;
 }
 
 
 DataElement* DataSet::getDataElement(tag_t tag)
 {
-  if (this == root_dataset_ && tag > last_tag_loaded_) load(tag, NULL);
+  // load() of the root DataSet may grow edict_ until it completes.
+  std::unique_lock<std::recursive_mutex> lock;
+  if (this == root_dataset_ && !load_complete_) {
+    lock = lockLoading();
+    if (tag > last_tag_loaded_) load(tag, NULL);
+  }
 
-  auto it = edict_.find(tag);
-  if (it != edict_.end())
-    return it->second.get();
+  auto it = lower_bound_tag(edict_, tag);
+  if (it != edict_.end() && it->first == tag)
+    return it->second;
   else
     return DataElement::NullElement();
 }
 
 DataElement* DataSet::getDataElement(const char *tagstr) {
-  char *_tagstr = (char *) tagstr;
-  char *nextptr;
-  char *endptr = (char *) tagstr + strlen(tagstr);
-
-  tag_t tag, gggg, eeee;
-  tag_t block;
-  int seqidx;
-  DataElement *el;
-  DataSet* dataset = this;
-
-  while (1) {
-    // ignore starting (
-    if (_tagstr[0] == '(')
-      _tagstr++;
-
-    if ((_tagstr[0] >= '0' && _tagstr[0] <= '9') ||   //
-        ((_tagstr[0] == 'F' || _tagstr[0] == 'f') &&  //
-         (_tagstr[1] == 'F' || _tagstr[1] == 'f'))) {
-      // string starts with number - read gggg or ggggeeee
-      tag = tag_t(strtol(_tagstr, &nextptr, 16));
-
-      if (nextptr && (*nextptr == ',' || *nextptr == '{')) {
-        // if string->hex conversion is stopped by ',' or '{',
-        // first portion is group number
-        gggg = tag;
-
-        // if ",{" string sequence, skip ','
-        if (*nextptr == ',' && nextptr[1] == '{') nextptr++;
-
-        // string between { and } is creator id
-        // e.g. 0000,{CREATOR}00
-        if ((*nextptr == '{') && (tag & 1)) {
-          _tagstr = nextptr + 1;
-
-          nextptr++;
-          int n = 0;
-          while (nextptr[n] && nextptr[n] != '}') n++;
-
-          if (nextptr[n] == '\0') {
-            LOGERROR_AND_THROW(
-                "DataSet::getDataElement(\"%s\"): "
-                "malformed string -- no matching '}'",
-                tagstr);
-            el = DataElement::NullElement();
-            break;
-          }
-          std::string creator(nextptr, n);
-
-          // find element from gggg0001 to gggg00ff
-          for (block = 0x10; block <= 0xff; block++) {
-            DataElement* creator_de =
-                dataset->getDataElement(TAG::build(gggg, block));
-            if (!creator_de->isValid()) continue;
-            if (creator_de->toBytes() == creator) break;
-          }
-
-          if (block > 0xff) {
-            // no such block of elements from private creator
-            el = DataElement::NullElement();
-            break;
-          }
-
-          _tagstr = nextptr + n + 1;
-
-          // Get element number in the block
-          eeee = tag_t(strtol(_tagstr, &nextptr, 16));
-          eeee = (block << 8) + (eeee & 0xff);
-        } else {
-          _tagstr = nextptr + 1;
-
-          // Get element number in eeee form
-          eeee = tag_t(strtol(_tagstr, &nextptr, 16));
-        }
+  return getDataElement(TagPath::from_string(tagstr));
+}
 
-        if (eeee == 0 && _tagstr == nextptr)
-          LOGERROR_AND_THROW(
-              "DataSet::getDataElement - "
-              "malformed string '%s'; no number after ',' or '}'",
-              tagstr);
+DataElement* DataSet::getDataElement(const TagPath& tagpath) {
+  const std::vector<TagPath::Node>& nodes = tagpath.nodes();
+  DataElement *el = DataElement::NullElement();
+  DataSet* dataset = this;
 
-        tag = TAG::build(gggg, eeee);
+  for (size_t i = 0; i < nodes.size(); i++) {
+    const TagPath::Node& node = nodes[i];
+    tag_t tag = node.tag;
 
-        if (*nextptr == ')') nextptr++;
+    if (!node.creator.empty()) {
+      tag_t gggg = TAG::group(tag);
+      tag_t block = dataset->findPrivateBlock(gggg, node.creator);
+      if (block == 0) {
+        // no such block of elements from private creator
+        el = DataElement::NullElement();
+        break;
       }
-    } else {
-      // tagstr is keyword string
-      int n = 0;
-
-      while (_tagstr[n] && _tagstr[n] != '.')  // take until next '.'
-        n++;
-      tag = TAG::from_keyword(std::string(_tagstr, n).c_str());
-      if (tag == 0xffffffff)
-        LOGERROR_AND_THROW(
-            "DataSet::getDataElement - error in string '%s'; no such keyword "
-            "'%s'",
-            tagstr, std::string(_tagstr, n).c_str());
-
-      nextptr = (char *) _tagstr + n;
+      tag = TAG::build(gggg, (block << 8) + (tag & 0xff));
     }
 
-    _tagstr = nextptr + 1;
-
     el = dataset->getDataElement(tag);
-    if (!el->isValid())
-      break;
-
-    if (_tagstr >= endptr)
+    if (!el->isValid() || node.seqidx < 0)
       break;
 
     if (el->vr() != VR::SQ)
       LOGERROR_AND_THROW(
           "DataSet::getDataElement - error in string '%s'; VR of element %s "
           "(VR::%s) is not VR::SQ",
-          tagstr, TAG::repr(tag).c_str(), VR::repr(el->vr()));
+          tagpath.str().c_str(), TAG::repr(tag).c_str(), VR::repr(el->vr()));
 
-    // number after '.' is DataSet sequence number, starting from 0
-    seqidx = int(strtol(_tagstr, &nextptr, 10));
-
-    dataset = el->toSequence()->getDataSet(seqidx);
-
-    _tagstr = nextptr + 1;
-    if (dataset == NULL || _tagstr >= endptr) {
+    dataset = el->toSequence()->getDataSet(node.seqidx);
+    if (dataset == NULL || i + 1 == nodes.size()) {
       // no DataSet with index in the Sequence
       el = DataElement::NullElement();
       break;
@@ -372,139 +378,33 @@ DataElement* DataSet::getDataElement(const char *tagstr) {
   return el;
 }
 
-void DataSet::removeDataElement(tag_t tag) { edict_.erase(tag); }
-
-void DataSet::removeDataElement(const char *tagstr) {
-  char *_tagstr = (char *) tagstr;
-  char *nextptr;
-  char *endptr = (char *) tagstr + strlen(tagstr);
-
-  tag_t tag, gggg, eeee;
-  tag_t block;
-  int seqidx;
-  DataElement *el;
-  DataSet* dataset = this;
+std::unique_lock<std::recursive_mutex> DataSet::lockLoading() {
+  DataSet* root = this;
+  while (root->root_dataset_ != root) root = root->root_dataset_;
 
-  while (1) {
-    // ignore starting (
-    if (_tagstr[0] == '(')
-      _tagstr++;
-
-    if ((_tagstr[0] >= '0' && _tagstr[0] <= '9') ||   //
-        ((_tagstr[0] == 'F' || _tagstr[0] == 'f') &&  //
-         (_tagstr[1] == 'F' || _tagstr[1] == 'f'))) {
-      // string starts with number - read gggg or ggggeeee
-      tag = tag_t(strtol(_tagstr, &nextptr, 16));
-
-      if (nextptr && (*nextptr == ',' || *nextptr == '{')) {
-        // if string->hex conversion is stopped by ',' or '{',
-        // first portion is group number
-        gggg = tag;
-
-        // if ",{" string sequence, skip ','
-        if (*nextptr == ',' && nextptr[1] == '{') nextptr++;
-
-        // string between { and } is creator id
-        // e.g. 0000,{CREATOR}00
-        if ((*nextptr == '{') && (tag & 1)) {
-          _tagstr = nextptr + 1;
-
-          nextptr++;
-          int n = 0;
-          while (nextptr[n] && nextptr[n] != '}') n++;
-
-          if (nextptr[n] == '\0') {
-            LOGERROR_AND_THROW(
-                "DataSet::removeDataElement(\"%s\"): "
-                "malformed string -- no matching '}'",
-                tagstr);
-            el = DataElement::NullElement();
-            break;
-          }
-          std::string creator(nextptr, n);
-
-          // find element from gggg0001 to gggg00ff
-          for (block = 0x10; block <= 0xff; block++) {
-            DataElement* creator_de =
-                dataset->getDataElement(TAG::build(gggg, block));
-            if (!creator_de->isValid()) continue;
-            if (creator_de->toBytes() == creator) break;
-          }
-
-          if (block > 0xff) {
-            // no such block of elements from private creator
-            el = DataElement::NullElement();
-            break;
-          }
-
-          _tagstr = nextptr + n + 1;
-
-          // Get element number in the block
-          eeee = tag_t(strtol(_tagstr, &nextptr, 16));
-          eeee = (block << 8) + (eeee & 0xff);
-        } else {
-          _tagstr = nextptr + 1;
-
-          // Get element number in eeee form
-          eeee = tag_t(strtol(_tagstr, &nextptr, 16));
-        }
-
-        if (eeee == 0 && _tagstr == nextptr)
-          LOGERROR_AND_THROW(
-              "DataSet::removeDataElement - "
-              "malformed string '%s'; no number after ',' or '}'",
-              tagstr);
-
-        tag = TAG::build(gggg, eeee);
-
-        if (*nextptr == ')') nextptr++;
-      }
-    } else {
-      // tagstr is keyword string
-      int n = 0;
-
-      while (_tagstr[n] && _tagstr[n] != '.')  // take until next '.'
-        n++;
-      tag = TAG::from_keyword(std::string(_tagstr, n).c_str());
-      if (tag == 0xffffffff)
-        LOGERROR_AND_THROW(
-            "DataSet::removeDataElement - error in string '%s'; no such keyword "
-            "'%s'",
-            tagstr, std::string(_tagstr, n).c_str());
-
-      nextptr = (char *) _tagstr + n;
-    }
-
-    _tagstr = nextptr + 1;
-
-    el = dataset->getDataElement(tag);
-    if (!el->isValid())
-      break;
-
-    if (_tagstr >= endptr)
-      break;
-
-    if (el->vr() != VR::SQ)
-      LOGERROR_AND_THROW(
-          "DataSet::removeDataElement - error in string '%s'; VR of element %s "
-          "(VR::%s) is not VR::SQ",
-          tagstr, TAG::repr(tag).c_str(), VR::repr(el->vr()));
-
-    // number after '.' is DataSet sequence number, starting from 0
-    seqidx = int(strtol(_tagstr, &nextptr, 10));
-
-    dataset = el->toSequence()->getDataSet(seqidx);
+  if (root->load_option_ & LoadOption::CONCURRENT)
+    return std::unique_lock<std::recursive_mutex>(root->load_mutex_);
+  else
+    return std::unique_lock<std::recursive_mutex>();
+}
 
-    _tagstr = nextptr + 1;
-    if (dataset == NULL || _tagstr >= endptr) {
-      // no DataSet with index in the Sequence
-      el = DataElement::NullElement();
-      break;
-    }
+void DataSet::removeDataElement(tag_t tag) {
+  auto it = lower_bound_tag(edict_, tag);
+  if (it != edict_.end() && it->first == tag) {
+    deleteDataElement(it->second);
+    edict_.erase(it);
+    if (TAG::is_private_creator(tag)) private_blocks_valid_ = false;
   }
+}
+
+void DataSet::removeDataElement(const char *tagstr) {
+  removeDataElement(TagPath::from_string(tagstr));
+}
 
+void DataSet::removeDataElement(const TagPath& tagpath) {
+  DataElement* el = getDataElement(tagpath);
   if (el->isValid())
-    dataset->removeDataElement(el->tag());
+    el->parent_->removeDataElement(el->tag());
 }
 
 charset_t DataSet::getSpecificCharset(int index) {
@@ -514,17 +414,22 @@ charset_t DataSet::getSpecificCharset(int index) {
   if (specific_charset0_ == CHARSET::UNKNOWN) {
     DataElement* de = root_dataset_->getDataElement(0x00080005);
 
+    std::string value;
     if (de->isValid()) {
-      char* valueptr = (char*)de->value_ptr();
-      size_t valuesize = de->length();
+      value.resize(de->length());
+      de->readValue(0, &value[0], value.size());
+      char* valueptr = &value[0];
+      size_t valuesize = value.size();
 
-      char* firstdelim = strchr(valueptr, '\\');
+      // value is not null-terminated; search within its length.
+      char* firstdelim = (char*)memchr(valueptr, '\\', valuesize);
       if (firstdelim == NULL) {
         // no delim, only one character set
         specific_charset1_ = specific_charset0_ =
             CHARSET::from_string(valueptr, valuesize);
       } else {
-        const char* lastdelim = strrchr(valueptr, '\\');
+        const char* lastdelim = valueptr + valuesize - 1;
+        while (*lastdelim != '\\') lastdelim--;
         specific_charset0_ =
             CHARSET::from_string(valueptr, firstdelim - valueptr);
         specific_charset1_ = CHARSET::from_string(
@@ -537,7 +442,7 @@ charset_t DataSet::getSpecificCharset(int index) {
     if (specific_charset0_ == CHARSET::UNKNOWN ||
         specific_charset1_ == CHARSET::UNKNOWN) {
       LOG_WARN("   DataSet::specific_charset - unknown CHARSET \"%s\"",
-               std::string((char*)de->value_ptr(), de->length()).c_str());
+               value.c_str());
       specific_charset0_ = CHARSET::DEFAULT;
       specific_charset1_ = CHARSET::DEFAULT;
     }
@@ -606,23 +511,387 @@ void DataSet::attachToMemory(const uint8_t* data, size_t datasize,
   iss->attachmemory(data, datasize, copy_data);
 }
 
-void DataSet::attachToFile(const char* filename) {
+void DataSet::attachToFile(const char* filename, int load_option) {
   // only a root DataSet may have InStream
   if (this != root_dataset_) {
     LOGERROR_AND_THROW(
         "only root dataset can call DataSet::attachToFile");
   }
   detach();
+  load_option_ = load_option;
+
+  // InWindowedFileStream fails to pin once every window is pinned, which
+  // readers on many threads would run into; CONCURRENT mode maps the file
+  // instead.
+  if ((load_option & LoadOption::MMAP) ||
+      ((load_option & LoadOption::CONCURRENT) &&
+       (load_option & (LoadOption::WINDOWED | LoadOption::HEADER_ONLY)))) {
+    is_ = std::unique_ptr<InStream>(new InMmapStream);
+    InMmapStream* ims = dynamic_cast<InMmapStream*>(is_.get());
+    ims->attachfile(filename);
+    return;
+  }
+
+  if (load_option & (LoadOption::WINDOWED | LoadOption::HEADER_ONLY)) {
+    is_ = std::unique_ptr<InStream>(new InWindowedFileStream);
+    InWindowedFileStream* iws = dynamic_cast<InWindowedFileStream*>(is_.get());
+    iws->attachfile(filename);
+    return;
+  }
 
   is_ = std::unique_ptr<InStream>(new InFileStream);
   InFileStream* ifs = dynamic_cast<InFileStream*>(is_.get());
   ifs->attachfile(filename);
+
+  // read the whole file now; growing the buffer later would move values
+  // that other threads are reading.
+  if (load_option & LoadOption::CONCURRENT) ifs->prefetch(ifs->end());
+}
+
+void DataSet::attachToReader(ReaderFunctionType reader) {
+  // only a root DataSet may have InStream
+  if (this != root_dataset_) {
+    LOGERROR_AND_THROW(
+        "only root dataset can call DataSet::attachToReader");
+  }
+  detach();
+
+  is_ = std::unique_ptr<InStream>(new InForwardStream);
+  InForwardStream* ifs = dynamic_cast<InForwardStream*>(is_.get());
+  ifs->attachreader(reader);
+}
+
+// copy values of `de` and DataSets or frames under `de` from the stream into
+// memory.
+static void retain_values(DataElement* de) {
+  if (de->vr() == VR::SQ) {
+    for (auto& ds : *de->toSequence())
+      for (auto& it : *ds) retain_values(it.second);
+  } else if (de->vr() == VR::PIXSEQ) {
+    PixelSequence* pixseq = de->toPixelSequence();
+    for (size_t idx = 0; idx < pixseq->numberOfFrames(); idx++) {
+      Buffer<uint8_t> encdata = pixseq->encodedFrameData(idx);
+      pixseq->setEncodedFrameData(idx, encdata.data, encdata.size);
+    }
+  } else {
+    de->retainValue();
+  }
 }
 
-void DataSet::attachToInstream(InStream* basestream, size_t size) {
+void DataSet::attachToInstream(InStream* basestream, size_t size,
+                               const TagFilter* tag_filter) {
   is_ = std::unique_ptr<InStream>(new InSubStream(basestream, size));
+  tag_filter_ = tag_filter;
+}
+
+void DataSet::setLoadTags(const std::vector<std::string>& tagpaths) {
+  if (this != root_dataset_) {
+    LOGERROR_AND_THROW(
+        "only root dataset can call DataSet::setLoadTags");
+  }
+  tag_filter_ = nullptr;
+  load_tags_.reset();
+  if (tagpaths.empty()) return;
+
+  load_tags_ = std::unique_ptr<TagFilter>(new TagFilter);
+  // SpecificCharacterSet is required to decode strings.
+  load_tags_->tags[0x00080005] = nullptr;
+
+  for (const std::string& tagpath : tagpaths) {
+    TagFilter* filter = load_tags_.get();
+    std::unique_ptr<TagFilter>* slot = nullptr;  // entry for last tag
+    size_t start = 0, end = 0;
+
+    while (end < tagpath.size()) {
+      end = tagpath.find('.', start);
+      if (end == std::string::npos) end = tagpath.size();
+      std::string component = tagpath.substr(start, end - start);
+      start = end + 1;
+
+      // number after '.' is item number; items are not distinguished.
+      if (component.size() < 8 &&
+          component.find_first_not_of("0123456789") == std::string::npos) {
+        if (!slot)
+          LOGERROR_AND_THROW(
+              "DataSet::setLoadTags - malformed string '%s'",
+              tagpath.c_str());
+        continue;
+      }
+
+      if (slot) {
+        // a null TagFilter already selects the whole element.
+        if (!*slot) break;
+        filter = slot->get();
+      }
+      TagPath part(component);
+      const TagPath::Node& node = part.nodes().front();
+      if (part.nodes().size() != 1 || node.seqidx >= 0)
+        LOGERROR_AND_THROW(
+            "DataSet::setLoadTags - malformed string '%s'", tagpath.c_str());
+      if (!node.creator.empty())
+        LOGERROR_AND_THROW(
+            "DataSet::setLoadTags - error in string '%s'; "
+            "tag with private creator is not supported",
+            tagpath.c_str());
+      tag_t tag = node.tag;
+      auto it = filter->tags.find(tag);
+      if (it == filter->tags.end())
+        it = filter->tags.emplace(tag, std::unique_ptr<TagFilter>(
+                                           new TagFilter)).first;
+      slot = &it->second;
+    }
+    // last tag in the path selects the whole element.
+    if (slot && end >= tagpath.size()) slot->reset();
+  }
+  tag_filter_ = load_tags_.get();
+}
+
+namespace {
+
+// kind of the length field following two VR characters in explicit VR.
+enum { VRLEN_2BYTES = 0, VRLEN_4BYTES, VRLEN_UT, VRLEN_UNKNOWN };
+
+struct VrCode {
+  vr_t vr;
+  uint8_t lenkind;
+};
+
+// Two VR characters -> vr_t and kind of the length field, indexed by
+// (c0 - 'A') * 26 + (c1 - 'A'). Built once from VR::from_uint16le().
+struct VrCodeTable {
+  VrCode codes[26 * 26];
+
+  VrCodeTable() {
+    for (int c0 = 0; c0 < 26; c0++) {
+      for (int c1 = 0; c1 < 26; c1++) {
+        VrCode& code = codes[c0 * 26 + c1];
+        code.vr = VR::from_uint16le(uint16_t('A' + c0) +
+                                    uint16_t('A' + c1) * 256);
+        switch (code.vr) {
+          case VR::AE: case VR::AS: case VR::AT: case VR::CS: case VR::DA:
+          case VR::DS: case VR::DT: case VR::FD: case VR::FL: case VR::IS:
+          case VR::LO: case VR::LT: case VR::PN: case VR::SH: case VR::SL:
+          case VR::SS: case VR::ST: case VR::TM: case VR::UI: case VR::UL:
+          case VR::US:
+            code.lenkind = VRLEN_2BYTES;
+            break;
+          case VR::OB: case VR::OD: case VR::OF: case VR::OL: case VR::OV:
+          case VR::OW: case VR::SQ: case VR::UN: case VR::SV: case VR::UC:
+          case VR::UR: case VR::UV:
+            code.lenkind = VRLEN_4BYTES;
+            break;
+          case VR::UT:
+            code.lenkind = VRLEN_UT;
+            break;
+          default:
+            code.lenkind = VRLEN_UNKNOWN;
+            break;
+        }
+      }
+    }
+    unknown.vr = VR::NONE;
+    unknown.lenkind = VRLEN_UNKNOWN;
+  }
+
+  inline const VrCode& lookup(const uint8_t* p) const {
+    unsigned int c0 = p[0] - 'A', c1 = p[1] - 'A';
+    return (c0 < 26 && c1 < 26) ? codes[c0 * 26 + c1] : unknown;
+  }
+
+  VrCode unknown;
+};
+
+const VrCodeTable vrcode_table;
+
+// Reads VR and length of a data element whose tag is in `buf8`.
+template <bool is_explicit_vr, bool is_little_endian>
+inline void read_vr_and_length(InStream* instream, uint8_t* buf8,
+                               tag_t tag, vr_t& vr, size_t& length) {
+  uint8_t buf4[4];
+
+  // DATA ELEMENT STRUCTURE WITH EXPLICIT VR
+  if (is_explicit_vr) {
+    const VrCode& vrcode = vrcode_table.lookup(buf8 + 4);
+    vr = vrcode.vr;
+
+    if (vrcode.lenkind == VRLEN_2BYTES) {
+      // PS 3.5-2020, Table 7.1-2
+      // Data Element with Explicit VR of AE, AS, AT, CS, DA, DS, DT, FL,
+      // FD, IS, LO, LT, PN, SH, SL, SS, ST, TM, UI, UL and US
+      length = load_e<uint16_t>(buf8 + 6, is_little_endian);
+    } else if (vrcode.lenkind == VRLEN_4BYTES) {
+      // PS3.5-2020, Table 7.1-1. Data Element with Explicit VR other than
+      // as shown in Table 7.1-2
+      // OB, OD, OF, OL, OV, OW, SQ and UN
+      // VRs of SV, UC, UR, UV and UT may not have an Undefined Length
+      if (instream->read(buf4, 4) < 4)
+        LOGERROR_AND_THROW(
+            "DataSet::load - cannot read 4 bytes for data element value's "
+            "length at {%x}",
+            instream->tell());
+      length = load_e<uint32_t>(buf4, is_little_endian);
+    } else if (vrcode.lenkind == VRLEN_UT) {
+      // In a strange implementation, VR 'UT' takes 2 bytes for 'len'
+      if (instream->read(buf4, 4) < 4)
+        LOGERROR_AND_THROW(
+            "DataSet::load - cannot read 4 bytes for data element value's "
+            "length at {%x}",
+            instream->tell());
+      length = load_e<uint32_t>(buf4, is_little_endian);
+      if (length > instream->bytes_remaining()) {
+        instream->unread(4);
+        length = load_e<uint16_t>(buf8 + 6, is_little_endian);
+      }
+    } else {
+      // salvage codes some unusual VR
+      // A non-standard VR 'UK' in RAYPAX file; may contains a short string
+      // and have 2 byte length
+      if (buf8[4] == 'U' && buf8[5] == 'K') {
+        vr = VR::UN;
+        length = load_e<uint16_t>(buf8 + 6, is_little_endian);
+      } else {
+        // assume this Data Element has implicit vr
+        // PS 3.5-2009, Table 7.1-3
+        // DATA ELEMENT STRUCTURE WITH IMPLICIT VR
+        length = load_le<uint32_t>(buf8 + 4);
+
+        vr = TAG::get_vr(tag);
+        if (vr == VR::NONE) vr = VR::UN;
+      }
+    }
+  } else {
+    // PS 3.5-2009, Table 7.1-3
+    // DATA ELEMENT STRUCTURE WITH IMPLICIT VR
+
+    // always little endian if vr is implicit.
+    length = load_le<uint32_t>(buf8 + 4);
+
+    vr = TAG::get_vr(tag);
+    if (vr == VR::NONE) vr = VR::UN;
+  }
+}
+// Skips items of a sequence with undefined length up to and including the
+// Sequence Delim. Tag, without building DataSets. Nested sequences are skipped
+// likewise; items are parsed later by Sequence::loadItems().
+template <bool is_explicit_vr, bool is_little_endian>
+void skip_sequence_items(InStream* instream);
+
+// Skips data elements of an item with undefined length up to and including
+// the Item Delim. Tag.
+template <bool is_explicit_vr, bool is_little_endian>
+void skip_item_elements(InStream* instream) {
+  uint8_t buf8[8];
+  tag_t tag, last_tag = 0;
+  vr_t vr;
+  size_t length;
+
+  while (!instream->is_eof()) {
+    if (instream->read(buf8, 8) < 8 || UINT32(buf8) == 0) {
+      // short tailing bytes or trailing zeros; DataSet::load() consumes them.
+      while (!instream->is_eof())
+        instream->read(buf8, 1);
+      break;
+    }
+
+    tag = TAG::load_32e(buf8, is_little_endian);
+    if (tag == 0xfffee00d || tag == 0xfffee0dd)
+      break;
+
+    if (last_tag > tag) {
+      // DataSet::load() quits this item here.
+      instream->unread(8);
+      break;
+    }
+
+    read_vr_and_length<is_explicit_vr, is_little_endian>(instream, buf8, tag,
+                                                         vr, length);
+    if (length == 0xffffffff) {
+      // sequence, encapsulated pixel data or
+      // sequence element with implicit VR with undefined length
+      skip_sequence_items<is_explicit_vr, is_little_endian>(instream);
+    } else if (instream->skip(length) != length) {
+      LOGERROR_AND_THROW(
+          "DataSet::load - "
+          "cannot process %lu bytes for tag=%08x, vr=%s from {%x}",
+          length, tag, VR::repr(vr), instream->tell());
+    }
+    last_tag = tag;
+  }
 }
 
+template <bool is_explicit_vr, bool is_little_endian>
+void skip_sequence_items(InStream* instream) {
+  uint8_t buf8[8];
+  tag_t tag;
+  size_t length;
+
+  while (!instream->is_eof()) {
+    if (instream->read(buf8, 8) < 8)
+      LOGERROR_AND_THROW(
+          "DataSet::load - "
+          "cannot read 8 bytes for Item Tag and length at {%x}",
+          instream->tell());
+
+    tag = TAG::load_32e(buf8, is_little_endian);
+    if (tag == 0xfffee0dd)  // Seq. Delim. Tag (FFFE, E0DD)
+      break;
+
+    if (tag != 0xfffee000) {  // Item Tag (FFFE, E000)
+      // Sequence::load() quits this sequence here.
+      instream->unread(8);
+      break;
+    }
+
+    length = load_e<uint32_t>(buf8 + 4, is_little_endian);
+    if (length == 0xffffffff)
+      skip_item_elements<is_explicit_vr, is_little_endian>(instream);
+    else if (instream->skip(length) != length)
+      LOGERROR_AND_THROW(
+          "DataSet::load - "
+          "cannot skip %lu bytes for an item at {%x}",
+          length, instream->tell());
+  }
+}
+
+// Skips items of encapsulated pixel data up to and including the Seq. Delim.
+// Tag. Item headers are read with small reads, so fragments between them are
+// not loaded.
+template <bool is_little_endian>
+void skip_fragments(InStream* instream) {
+  uint8_t buf8[8];
+  tag_t tag;
+  size_t length;
+  size_t pos = instream->tell();
+
+  while (pos < instream->end()) {
+    if (instream->peek_at(pos, buf8, 8) != 8)
+      LOGERROR_AND_THROW(
+          "DataSet::load - "
+          "cannot read 8 bytes for Item Tag and length at {%x}",
+          pos);
+
+    tag = TAG::load_32e(buf8, is_little_endian);
+    if (tag == 0xfffee0dd) {  // Seq. Delim. Tag (FFFE, E0DD)
+      pos += 8;
+      break;
+    }
+
+    if (tag != 0xfffee000)  // Item Tag (FFFE, E000)
+      break;  // loadFrames() quits the sequence here.
+
+    length = load_e<uint32_t>(buf8 + 4, is_little_endian);
+    if (length > instream->end() - pos - 8)
+      LOGERROR_AND_THROW(
+          "DataSet::load - "
+          "cannot skip %lu bytes for an item at {%x}",
+          length, pos + 8);
+    pos += 8 + length;
+  }
+  instream->seek(pos);
+}
+
+}  // namespace
+
 // - First call from DataSet::loadDicomFile()
 //   tag_t can be any value and instream should be valid
 // - Second and further calls from DataSet::loadDicomFile()
@@ -631,16 +900,23 @@ void DataSet::attachToInstream(InStream* basestream, size_t size) {
 // - Call from Sequence::load()
 //   tag_t should be (ffff,ffff) and instream should be valid.
 void DataSet::load(tag_t load_until, InStream *instream) {
-  uint8_t buf4[4];
+  // element loop is compiled for each transfer syntax family.
+  if (!isExplicitVr())
+    _load<false, true>(load_until, instream);
+  else if (isLittleEndian())
+    _load<true, true>(load_until, instream);
+  else
+    _load<true, false>(load_until, instream);
+}
+
+template <bool is_explicit_vr, bool is_little_endian>
+void DataSet::_load(tag_t load_until, InStream *instream) {
   size_t n;
 
   tag_t gggg, eeee, tag;
   vr_t vr;
   size_t length, offset;  // value's length and offset
 
-  bool is_little_endian = isLittleEndian();
-  bool is_explicit_vr = isExplicitVr();
-
   if (instream == nullptr) {
     // instream == nullptr; second call from DataSet::loadDicomFile() or calls
     // from Sequence::load()
@@ -652,6 +928,15 @@ void DataSet::load(tag_t load_until, InStream *instream) {
     }
   }
 
+  // bytes of a forward-only stream (or an InInflateStream over one) are
+  // discarded after each data element.
+  InStream* forward_stream =
+      (this == root_dataset_ && is_ && is_->is_forward_only() ? is_.get()
+                                                             : nullptr);
+  size_t retain_length = 0;
+  if (forward_stream)
+    retain_length = (size_t)Config::getInteger("STREAM_RETAIN_LENGTH", 65536);
+
   while (!instream->is_eof()) {
     if (UINT32(buf8_) == 0) {  // buffer is empty
       n = instream->read(buf8_, 8);
@@ -725,125 +1010,45 @@ void DataSet::load(tag_t load_until, InStream *instream) {
       break;
     }
 
-    // DATA ELEMENT STRUCTURE WITH EXPLICIT VR
-    if (is_explicit_vr) {
-      vr = VR::from_uint16le(uint16_t(buf8_[4])+uint16_t(buf8_[5])*256);
-      length = load_e<uint16_t>(buf8_ + 6, is_little_endian);
-
-      switch (vr) {
-        case VR::FL:
-        case VR::FD:
-        case VR::SL:
-        case VR::UL:
-        case VR::SS:
-        case VR::US:
-
-        case VR::AE:
-        case VR::AS:
-        case VR::AT:
-        case VR::CS:
-        case VR::DA:
-        case VR::DS:
-        case VR::DT:
-        case VR::IS:
-        case VR::LO:
-        case VR::LT:
-        case VR::PN:
-        case VR::SH:
-        case VR::ST:
-        case VR::TM:
-        case VR::UI:
-          // PS 3.5-2020, Table 7.1-2
-          // Data Element with Explicit VR of AE, AS, AT, CS, DA, DS, DT, FL,
-          // FD, IS, LO, LT, PN, SH, SL, SS, ST, TM, UI, UL and US
-          break;
+    read_vr_and_length<is_explicit_vr, is_little_endian>(instream, buf8_, tag,
+                                                         vr, length);
 
-        case VR::OB:
-        case VR::OD:
-        case VR::OF:
-        case VR::OL:
-        case VR::OV:
-        case VR::OW:
-        case VR::SQ:
-        case VR::UN:
-
-        case VR::SV:
-        case VR::UC:
-        case VR::UR:
-        case VR::UV:
-          // PS3.5-2020, Table 7.1-1. Data Element with Explicit VR other than
-          // as shown in Table 7.1-2
-          // OB, OD, OF, OL, OV, OW, SQ and UN
-          // VRs of SV, UC, UR, UV and UT may not have an Undefined Length
-
-          n = instream->read(buf4, 4);
-          if (n < 4)
-            LOGERROR_AND_THROW(
-                "DataSet::load - cannot read 4 bytes for data element value's "
-                "length at {%x}",
-                instream->tell());
-          length = load_e<uint32_t>(buf4, is_little_endian);
-          break;
+    // Data Element's values position
+    offset = instream->tell();
 
-        case VR::UT:
-          // In a strange implementation, VR 'UT' takes 2 bytes for 'len'
-          n = instream->read(buf4, 4);
-          if (n < 4)
-            LOGERROR_AND_THROW(
-                "DataSet::load - cannot read 4 bytes for data element value's "
-                "length at {%x}",
-                instream->tell());
-          length = load_e<uint32_t>(buf4, is_little_endian);
-          if (length > instream->bytes_remaining()) {
-            instream->unread(4);
-            length = load_e<uint16_t>(buf8_ + 6, is_little_endian);
-          }
-          break;
+    // elements not selected by setLoadTags() are skipped without DataElement.
+    const TagFilter* subfilter = nullptr;
+    if (tag_filter_ && gggg != 0x0002) {
+      auto it = tag_filter_->tags.find(tag);
+      if (it == tag_filter_->tags.end()) {
+        if (length == 0xffffffff)
+          skip_sequence_items<is_explicit_vr, is_little_endian>(instream);
+        else if (instream->skip(length) != length)
+          LOGERROR_AND_THROW(
+              "DataSet::load - "
+              "cannot process %lu bytes for tag=%08x, vr=%s from {%x}",
+              length, tag, VR::repr(vr), offset);
+        UINT32(buf8_) = 0;
 
-        default:
-          // salvage codes some unusual VR
-          // A non-standard VR 'UK' in RAYPAX file; may contains a short string
-          // and have 2 byte length
-          if (buf8_[4] == 'U' && buf8_[5] == 'K') {
-            vr = VR::UN;
-          } else {
-            // assume this Data Element has implicit vr
-            // PS 3.5-2009, Table 7.1-3
-            // DATA ELEMENT STRUCTURE WITH IMPLICIT VR
-            length = load_le<uint32_t>(buf8_ + 4);
-
-            vr = TAG::get_vr(tag);
-            if (vr == VR::NONE) vr = VR::UN;
-          }
-          break;
+        if (forward_stream && gggg > 0x0002)
+          forward_stream->discard(instream->tell());
+        last_tag_loaded_ = tag;
+        if (tag == load_until) break;
+        continue;
       }
-    } else {
-      // PS 3.5-2009, Table 7.1-3
-      // DATA ELEMENT STRUCTURE WITH IMPLICIT VR
-
-      // always little endian if vr is implicit.
-      length = load_le<uint32_t>(buf8_ + 4);
-
-      vr = TAG::get_vr(tag);
-      if (vr == VR::NONE) vr = VR::UN;
+      subfilter = it->second.get();
     }
 
-    // Data Element's values position
-    offset = instream->tell();
-
     if (vr == VR::SQ) {
-      if (length == 0xffffffff) length = instream->bytes_remaining();
+      if (length == 0xffffffff) {
+        // find the end of sequence; items are parsed on first access.
+        skip_sequence_items<is_explicit_vr, is_little_endian>(instream);
+        length = instream->tell() - offset;
+        instream->seek(offset);
+      }
 
       DataElement *de = addDataElement(tag, vr, length, offset);
-      Sequence *seq = de->toSequence();
-      InSubStream subs(instream, length);
-
-      size_t offset_end;
-      seq->load(&subs);
-      offset_end = subs.tell();
-      length = offset_end - offset;
-      de->setLength(length);
-
+      de->toSequence()->attachToInstream(instream, length, subfilter);
       instream->skip(length);
     }
 
@@ -864,13 +1069,24 @@ void DataSet::load(tag_t load_until, InStream *instream) {
         vr = VR::PIXSEQ;
         DataElement* de = addDataElement(tag, vr, length, offset);
         PixelSequence* pixseq = de->toPixelSequence();
-        // process basic offset table of the pixel sequence
-        pixseq->attachToInstream(instream, instream->bytes_remaining());
-        size_t offset_end;
 
-        pixseq->loadFrames();
-        offset_end = pixseq->instream()->tell();
-        length = offset_end - offset;
+        if (this == root_dataset_ &&
+            (load_option_ & LoadOption::HEADER_ONLY)) {
+          // walk item headers to the sequence delimiter and leave fragments
+          // on disk; loadFrames() is called on first access.
+          skip_fragments<is_little_endian>(instream);
+          length = instream->tell() - offset;
+          instream->seek(offset);
+          pixseq->attachToInstream(instream, length);
+        } else {
+          size_t offset_end;
+
+          // process basic offset table of the pixel sequence
+          pixseq->attachToInstream(instream, instream->bytes_remaining());
+          pixseq->loadFrames();
+          offset_end = pixseq->instream()->tell();
+          length = offset_end - offset;
+        }
         de->setLength(length);
         instream->skip(length);
       }
@@ -904,18 +1120,13 @@ void DataSet::load(tag_t load_until, InStream *instream) {
               length, tag, VR::repr(vr), offset);
       } else {
         // PROBABLY SEQUENCE ELEMENT WITH IMPLICIT VR WITH ...
-        length = instream->bytes_remaining();
+        skip_sequence_items<is_explicit_vr, is_little_endian>(instream);
+        length = instream->tell() - offset;
+        instream->seek(offset);
+
         vr = VR::SQ;
         DataElement *de = addDataElement(tag, vr, length, offset);
-        Sequence* seq = de->toSequence();
-        InSubStream subs(instream, length);
-
-        size_t offset_end;
-        seq->load(&subs);
-        offset_end = subs.tell();
-        length = offset_end - offset;
-        de->setLength(length);
-
+        de->toSequence()->attachToInstream(instream, length, subfilter);
         instream->skip(length);
       }
     }
@@ -925,6 +1136,19 @@ void DataSet::load(tag_t load_until, InStream *instream) {
     LOG_DEBUG("   DataSet::load - process (%08x) %s length=%4d at {%x}", tag,
               VR::repr(vr), length, offset);
 
+    if (forward_stream) {
+      DataElement* de = lower_bound_tag(edict_, tag)->second;
+      if (length <= retain_length || gggg == 0x0002) {
+        retain_values(de);
+      } else {
+        LOG_DEBUG("   DataSet::load - drop (%08x) %d bytes from the stream",
+                  tag, length);
+        removeDataElement(tag);
+      }
+      // keep file meta information on the stream for InInflateStream.
+      if (gggg > 0x0002) forward_stream->discard(instream->tell());
+    }
+
     last_tag_loaded_ = tag;
 
     if (tag == load_until) break;
@@ -938,6 +1162,7 @@ void DataSet::load(tag_t load_until, InStream *instream) {
 
   last_tag_loaded_ = load_until;
   if (instream->is_eof()) last_tag_loaded_ = 0xFFFFFFFF;
+  if (this == root_dataset_) load_complete_ = (last_tag_loaded_ == 0xFFFFFFFF);
 }
 
 void DataSet::saveToFile(const char* filename) {
@@ -1028,7 +1253,7 @@ void DataSet::saveToStream(std::ostream& oss) {
     uint8_t buf16_[16];  // temporary buffer for tag, vr, length
     for (auto it = ds->begin(); it != ds->end(); it++) {
       tag_t tag = it->first;
-      DataElement* de = it->second.get();
+      DataElement* de = it->second;
       vr_t vr = de->vr();
 
       if (writing_metainfo && tag > 0x0002ffff) {
@@ -1251,7 +1476,22 @@ void DataSet::saveToStream(std::ostream& oss) {
           oss.write((const char*)buf16_, 8);
         }  // if (is_explicit_vr)
 
-        oss.write((char*)de->value_ptr(), de->length());
+        const char* value = (const char*)de->value_ptr();
+        if (value) {
+          oss.write(value, de->length());
+        } else {
+          // stream doesn't keep its bytes (WINDOWED); copy in pieces.
+          std::vector<char> piece(std::min<size_t>(de->length(), 0x10000));
+          for (size_t off = 0; off < de->length(); off += piece.size()) {
+            size_t n = std::min(piece.size(), de->length() - off);
+            if (de->readValue(off, piece.data(), n) != n)
+              LOGERROR_AND_THROW(
+                  "DataSet::saveToStream - cannot read %zu bytes of value "
+                  "for tag %s from the stream",
+                  n, TAG::repr(tag).c_str());
+            oss.write(piece.data(), n);
+          }
+        }
       }  // vr == VR::SQ or VR::PIXSEQ or VR::...
 
       // Calculate group length
@@ -1311,6 +1551,7 @@ void DataSet::loadDicomFile(tag_t load_until){
     // Data elements in meta information should be little endian
     // and explicit VR.
     last_tag_loaded_ = 0x0;
+    load_complete_ = false;
     load(0x0002ffff, is_.get());
 
     std::string t = getDataElement(0x00020010)->toBytes();
@@ -1320,43 +1561,43 @@ void DataSet::loadDicomFile(tag_t load_until){
       DataElement* de = getDataElement(0x00020000);
       size_t zipped_start_offset = de->toLong() + de->offset() + de->length();
 
-      void* ptr =
-          is_->get_pointer(0, is_->end());  // pointer to whole DICOM file image
-      size_t zipped_len = is_->end();       // size of whole DICOM file image
-
-      // Inflated zipped data
-      std::ostringstream oss(std::ostringstream::binary);
-      inflate_dicomfile((uint8_t*)ptr, zipped_len, oss, zipped_start_offset);
-
       LOG_DEBUG(
-          "   @%p\tDataSet::loadDicomFile(tag_t)  unzip deflated file %d -> %d",
-          this, zipped_len, is_->endoffset());
-
-      // AttachToMemory to new stream on memory
-      std::string inflated_image = oss.str();
-      attachToMemory((const uint8_t*)inflated_image.c_str(),
-                     inflated_image.size(), true);
-
-      // continue on new stream on memory
+          "   @%p\tDataSet::loadDicomFile(tag_t)  inflate deflated file of %d "
+          "bytes from {%x}",
+          this, is_->end(), zipped_start_offset);
+
+      // continue on a stream that inflates zipped data on demand.
+      InInflateStream* iis = new InInflateStream;
+      std::unique_ptr<InStream> zipped(std::move(is_));
+      is_ = std::unique_ptr<InStream>(iis);
+      iis->attachstream(std::move(zipped), zipped_start_offset);
+      // inflated image should not grow while other threads read it.
+      if (load_option_ & LoadOption::CONCURRENT) iis->inflateAll();
       is_->seek(zipped_start_offset);
       UINT32(buf8_) = 0;  // clear temporary buffer for tag, vr, and length
     }
 
     // Parsing remaining Data Elements
     load(load_until, nullptr);
+
+    // resolve cached character set before the DataSet is shared by threads.
+    if (load_option_ & LoadOption::CONCURRENT) getSpecificCharset();
   } catch (DicomException& e) {
     last_tag_loaded_ = 0xFFFFFFFF;  // prevent from trying reloading
+    load_complete_ = true;
     throw e;
   }
 }
 
 void DataSet::detach() { is_.reset(nullptr); }
 
-std::unique_ptr<DataSet> open_file(const char* filename, tag_t load_until,
-                                   bool keep_on_error) {
+std::unique_ptr<DataSet> open_file(
+    const char* filename, tag_t load_until, bool keep_on_error,
+    int load_option, const std::vector<std::string>& load_tags) {
   std::unique_ptr<DataSet> dset(new DataSet);
   try {
-    dset->attachToFile(filename);
+    dset->setLoadTags(load_tags);
+    dset->attachToFile(filename, load_option);
     dset->loadDicomFile(load_until);
   } catch (DicomException&) {
     if (!keep_on_error) throw;
@@ -1366,11 +1607,50 @@ std::unique_ptr<DataSet> open_file(const char* filename, tag_t load_until,
   return dset;
 }
 
-std::unique_ptr<DataSet> open_memory(const uint8_t* data, size_t datasize,
-                                     bool copy_data, tag_t load_until,
-                                     bool keep_on_error) {
+std::unique_ptr<DataSet> open_stream(
+    ReaderFunctionType reader, tag_t load_until, bool keep_on_error,
+    const std::vector<std::string>& load_tags) {
   std::unique_ptr<DataSet> dset(new DataSet);
   try {
+    dset->setLoadTags(load_tags);
+    dset->attachToReader(reader);
+    dset->loadDicomFile(load_until);
+  } catch (DicomException&) {
+    if (!keep_on_error) throw;
+    // if keep_on_error is true, ignore exception and return partially decoded
+    // DataSet.
+  }
+  return dset;
+}
+
+std::unique_ptr<DataSet> open_fd(
+    int fd, tag_t load_until, bool keep_on_error,
+    const std::vector<std::string>& load_tags) {
+  ReaderFunctionType reader = [fd](uint8_t* buf, size_t size) -> size_t {
+    while (true) {
+#ifdef _WIN32
+      int n = _read(fd, buf, (unsigned int)size);
+#else
+      ssize_t n = ::read(fd, buf, size);
+      if (n < 0 && errno == EINTR) continue;
+#endif
+      if (n < 0) {
+        char *errmsg = strerror(errno);
+        LOGERROR_AND_THROW("cannot read from file descriptor %d: %s", fd,
+                           errmsg);
+      }
+      return (size_t)n;
+    }
+  };
+  return open_stream(reader, load_until, keep_on_error, load_tags);
+}
+
+std::unique_ptr<DataSet> open_memory(
+    const uint8_t* data, size_t datasize, bool copy_data, tag_t load_until,
+    bool keep_on_error, const std::vector<std::string>& load_tags) {
+  std::unique_ptr<DataSet> dset(new DataSet);
+  try {
+    dset->setLoadTags(load_tags);
     dset->attachToMemory(data, datasize, copy_data);
     dset->loadDicomFile(load_until);
   } catch (DicomException& ) {
@@ -1431,8 +1711,17 @@ void DataSet::copyFrameData(size_t index, uint8_t* data, int datasize,
       int src_rowstep = cols * bytesalloc * ncomps;
       int src_pagestep = src_rowstep * rows;
       uint8_t *p, *q;
-      p = (uint8_t*)de->value_ptr();
-      p += src_pagestep * index;
+      Buffer<uint8_t> page;  // frame read from a stream that drops its bytes.
+      p = (uint8_t*)de->value_ptr(src_pagestep * index, src_pagestep);
+      if (!p && page.alloc(src_pagestep) &&
+          de->readValue(src_pagestep * index, page.data, src_pagestep) ==
+              (size_t)src_pagestep)
+        p = page.data;
+      if (!p) {
+        LOGERROR_AND_THROW(
+            "DataSet::copyFrameData - cannot get pixel data of frame %d",
+            index);
+      }
       q = data;
       for (int r = 0; r < rows; r++) {
         ::memcpy(q, p, src_rowstep);
@@ -1444,9 +1733,19 @@ void DataSet::copyFrameData(size_t index, uint8_t* data, int datasize,
       int src_rowstep = cols * bytesalloc;
       int src_pagestep = src_rowstep * rows * ncomps;
       uint8_t *p, *q;
+      Buffer<uint8_t> plane;  // plane read from a stream that drops its bytes.
       for (int c = 0; c < ncomps; c++) {
-        p = (uint8_t*)de->value_ptr();
-        p += src_pagestep * index + c * src_rowstep * rows;
+        size_t plane_offset = src_pagestep * index + c * src_rowstep * rows;
+        size_t plane_size = src_rowstep * rows;
+        p = (uint8_t*)de->value_ptr(plane_offset, plane_size);
+        if (!p && plane.alloc(plane_size) &&
+            de->readValue(plane_offset, plane.data, plane_size) == plane_size)
+          p = plane.data;
+        if (!p) {
+          LOGERROR_AND_THROW(
+              "DataSet::copyFrameData - cannot get pixel data of frame %d",
+              index);
+        }
         q = data + rowstep * rows * c;
         for (int r = 0; r < rows; r++) {
           ::memcpy(q, p, src_rowstep);
@@ -1471,7 +1770,7 @@ std::wstring DataSet::dump(size_t max_length) {
     for (auto it = ds->begin(); it != ds->end(); it++) {
       wss << prefix;
       tag_t tag = it->first;
-      DataElement* de = it->second.get();
+      DataElement* de = it->second;
 
       swprintf(buf, 1023, L"%08x'\t%hs\t%zu\t%d\t%#zx", tag,
                VR::repr(de->vr()), de->length(), de->vm(),
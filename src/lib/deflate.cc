@@ -8,6 +8,7 @@
 
 #include "deflate.h"
 
+
 #include "dicom.h"
 #include "zlib/zlib.h"
 
@@ -128,4 +129,156 @@ DEFLATE_END:
   return;
 }
 
+// InInflateStream =============================================================
+
+InInflateStream::InInflateStream()
+    : inflating_(false),
+      forward_only_(false),
+      base_(0),
+      capacity_(0),
+      keep_from_(0),
+      inbuf_(nullptr) {
+  LOG_DEBUG("++ @%p\tInInflateStream::InInflateStream()", this);
+}
+
+InInflateStream::~InInflateStream() {
+  if (inflating_) (void)inflateEnd(&strm_);
+  if (inbuf_) free(inbuf_);
+  LOG_DEBUG("-- @%p\tInInflateStream::~InInflateStream()", this);
+}
+
+void InInflateStream::attachstream(std::unique_ptr<InStream> source,
+                                   size_t skip_offset) {
+  reset_internal_buffer();
+  if (inflating_) (void)inflateEnd(&strm_);
+  inflating_ = false;
+  base_ = capacity_ = keep_from_ = 0;
+
+  if (inbuf_ == nullptr) {
+    inbuf_ = (uint8_t *)malloc(CHUNK);
+    if (inbuf_ == nullptr)
+      LOGERROR_AND_THROW("cannot malloc %d bytes in InInflateStream", CHUNK);
+  }
+
+  source_ = std::move(source);
+  forward_only_ = source_->is_forward_only();
+
+  // copy first skip_offset bytes without inflation
+  capacity_ = skip_offset + CHUNK;
+  data_ = (uint8_t *)malloc(capacity_);
+  if (data_ == nullptr)
+    LOGERROR_AND_THROW("cannot malloc %d bytes in InInflateStream",
+                       capacity_);
+  own_data_ = true;
+  source_->rewind();
+  if (source_->read(data_, skip_offset) != skip_offset)
+    LOGERROR_AND_THROW(
+        "InInflateStream::attachstream - cannot read %d bytes from source.",
+        skip_offset);
+  loaded_bytes_ = skip_offset;
+
+  strm_.zalloc = Z_NULL;
+  strm_.zfree = Z_NULL;
+  strm_.opaque = Z_NULL;
+  strm_.avail_in = 0;
+  strm_.next_in = Z_NULL;
+  if (inflateInit2(&strm_, -15) != Z_OK)
+    LOGERROR_AND_THROW("InInflateStream::attachstream - cannot init inflate.");
+  inflating_ = true;
+
+  // size of inflated image is known only at the end of deflated data.
+  startoffset_ = offset_ = 0;
+  endoffset_ = filesize_ = INSTREAM_SIZE_UNKNOWN;
+
+  LOG_DEBUG(
+      "   @%p\tInInflateStream::attachstream(InStream*, size_t)\t source %p, "
+      "skip %d",
+      this, source_.get(), skip_offset);
+}
+
+void InInflateStream::prefetch(size_t newsize) {
+  if (newsize <= loaded_bytes_ || !inflating_) return;
+
+  // drop bytes that won't be accessed again.
+  if (keep_from_ > base_) {
+    size_t drop = keep_from_ - base_;
+    if (drop > loaded_bytes_ - base_) drop = loaded_bytes_ - base_;
+    memmove(data_, data_ + drop, loaded_bytes_ - base_ - drop);
+    base_ += drop;
+  }
+  size_t keep_from = (keep_from_ > base_ ? keep_from_ : base_);
+
+  if (newsize - keep_from > capacity_) {
+    size_t new_capacity = capacity_ * 2;
+    while (new_capacity < newsize - keep_from) new_capacity *= 2;
+
+    uint8_t *tmpdata = (uint8_t *)realloc(data_, new_capacity);
+    if (tmpdata == NULL) {
+      LOGERROR_AND_THROW(
+          "cannot realloc %d bytes in InInflateStream::prefetch",
+          new_capacity);
+    }
+    data_ = tmpdata;
+    capacity_ = new_capacity;
+  }
+
+  while (loaded_bytes_ < newsize) {
+    if (strm_.avail_in == 0) {
+      size_t n = source_->read_some(inbuf_, CHUNK);
+      if (n == 0)
+        LOGERROR_AND_THROW(
+            "InInflateStream::prefetch - unexpected end of deflated data.");
+      source_->discard(source_->tell());
+      strm_.next_in = inbuf_;
+      strm_.avail_in = (uInt)n;
+    }
+
+    // bytes between dropped ones and requested ones are inflated and thrown
+    // away.
+    bool throwaway = (loaded_bytes_ < keep_from);
+    if (throwaway) base_ = loaded_bytes_;
+    size_t avail = capacity_ - (loaded_bytes_ - base_);
+    if (throwaway && avail > keep_from - loaded_bytes_)
+      avail = keep_from - loaded_bytes_;
+
+    strm_.next_out = data_ + (loaded_bytes_ - base_);
+    strm_.avail_out = (uInt)avail;
+    int ret = inflate(&strm_, Z_NO_FLUSH);
+    loaded_bytes_ += avail - strm_.avail_out;
+    if (throwaway) base_ = loaded_bytes_;
+
+    if (ret == Z_STREAM_END) {
+      // now we know where the inflated image ends.
+      (void)inflateEnd(&strm_);
+      inflating_ = false;
+      endoffset_ = filesize_ = loaded_bytes_;
+      source_.reset(nullptr);
+      break;
+    } else if (ret != Z_OK && ret != Z_BUF_ERROR) {
+      LOGERROR_AND_THROW("InInflateStream::prefetch - cannot inflate file.");
+    }
+  }
+
+  LOG_DEBUG(
+      "   @%p\tInInflateStream::prefetch() inflated to %d bytes, data %p", this,
+      loaded_bytes_, data_);
+}
+
+uint8_t *InInflateStream::fetch(size_t offset, size_t size, bool) {
+  if (offset < base_) {
+    LOG_ERROR(
+        "InInflateStream::fetch - bytes at {%x} are already discarded from "
+        "the forward-only stream.",
+        offset);
+    return nullptr;
+  }
+
+  if (offset + size > loaded_bytes_) {
+    prefetch(offset + size);
+    if (offset + size > loaded_bytes_) return nullptr;
+  }
+
+  return data_ + (offset - base_);
+}
+
 }  // namespace dicom
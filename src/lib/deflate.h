@@ -10,6 +10,9 @@
 #define __DEFLATE_H__
 
 #include "dicom.h"
+#include "instream.h"
+#include "zlib/zlib.h"
+#include <memory>
 #include <sstream>
 
 namespace dicom {  //------------------------------------------------------
@@ -19,6 +22,46 @@ void inflate_dicomfile(uint8_t *data, size_t datasize, std::ostringstream &oss,
 void deflate_dicomfile(uint8_t *data, size_t datasize, std::ostringstream &oss,
                        size_t skip_offset, int level);
 
+// InInflateStream inflates a deflated DICOM file on demand as prefetch() asks
+// for more bytes. The first `skip_offset` bytes of the source (preamble and
+// file meta information) are copied as they are.
+// endoffset_ is unknown until the end of deflated data is reached; until then
+// it is INSTREAM_SIZE_UNKNOWN and is_eof() is true only after that.
+// Over a forward-only source, inflated bytes before the offset given to
+// discard() are dropped, and deflated bytes are discarded from the source as
+// soon as they are inflated.
+class InInflateStream : public InStream {
+  std::unique_ptr<InStream> source_;  // deflated stream
+  z_stream strm_;
+  bool inflating_;        // strm_ is initialized and not ended.
+  bool forward_only_;     // source_ is forward-only.
+  size_t base_;           // stream offset of data_[0]
+  size_t capacity_;       // allocated bytes of data_
+  size_t keep_from_;      // bytes before this offset may be dropped
+  uint8_t* inbuf_;        // chunk of deflated data
+
+ protected:
+  uint8_t* fetch(size_t offset, size_t size, bool pin = false);
+
+ public:
+  InInflateStream();
+  virtual ~InInflateStream();
+
+  // take over `source`; inflation starts from `skip_offset` of the source.
+  void attachstream(std::unique_ptr<InStream> source, size_t skip_offset);
+  void prefetch(size_t newsize);
+
+  bool is_forward_only() const { return forward_only_; }
+  void discard(size_t offset) {
+    if (forward_only_ && offset > keep_from_) keep_from_ = offset;
+  }
+
+  // inflate the rest of the deflated data at once.
+  void inflateAll() {
+    while (inflating_) prefetch(base_ + capacity_ * 2);
+  }
+};
+
 }  // namespace dicom -----------------------------------------------------
 
 #endif // __DEFLATE_H__
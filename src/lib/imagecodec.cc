@@ -9,7 +9,10 @@
 #include <sstream>
 #include <stdio.h>
 #include <string.h>
-#include <list>
+#include <stdlib.h>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include "dicom.h"
 #include "imagecodec.h"
@@ -72,26 +75,51 @@ struct t_codec {
   void* codec_handle;
   encoder_fnptr encoder;
   decoder_fnptr decoder;
+  fragments_decoder_fnptr fragments_decoder;  // optional
+  std::vector<tsuid_t> tsuids;  // transfer syntaxes handled by codec
+  bool all_tsuids;  // codec is tried for all transfer syntaxes
   char errmsg[ERROR_MSG_SIZE];
 
   t_codec() {
     codec_handle = NULL;
     encoder = NULL;
     decoder = NULL;
+    fragments_decoder = NULL;
+    all_tsuids = true;
   }
   ;
   ~t_codec() {
-    unload_codec();
+    if (unload_codec() != DICOMSDL_CODEC_OK)
+      LOG_WARN("%s '%s'", errmsg, codec_name.c_str());
+  }
+
+  void set_transfer_syntaxes(transfer_syntaxes_fnptr transfer_syntaxes) {
+    tsuids.clear();
+    all_tsuids = (transfer_syntaxes == NULL);
+    if (all_tsuids)
+      return;
+    for (const char *const *t = transfer_syntaxes(); t && *t; t++) {
+      tsuid_t tsuid = UID::from_uidvalue(*t);
+      if (tsuid != UID::UNKNOWN)
+        tsuids.push_back(tsuid);
+      else
+        LOG_WARN("t_codec::load_codec(%s) - unknown transfer syntax '%s'",
+                 codec_name.c_str(), *t);
+    }
   }
 
   DICOMSDL_CODEC_RESULT load_codec(const char *_codec_name,
                                    encoder_fnptr _encoder,
-                                   decoder_fnptr _decoder) {
+                                   decoder_fnptr _decoder,
+                                   fragments_decoder_fnptr _fragments_decoder,
+                                   transfer_syntaxes_fnptr _transfer_syntaxes) {
     if (_decoder || _encoder) {
       codec_name = _codec_name;
       codec_handle = NULL;
       decoder = _decoder;
+      fragments_decoder = _fragments_decoder;
       encoder = _encoder;
+      set_transfer_syntaxes(_transfer_syntaxes);
       LOG_DEBUG(
           "t_codec::load_codec(%s,{%p},{%p})", _codec_name, encoder, decoder);
       return DICOMSDL_CODEC_OK;
@@ -103,18 +131,24 @@ struct t_codec {
     if (!codec_handle) {
       snprintf(errmsg, ERROR_MSG_SIZE, "load_codec(): "
                "cannot load '%s'",
-               codec_name.c_str());
+               _codec_name);
       return DICOMSDL_CODEC_ERROR;
     }
 
     decoder = (decoder_fnptr) getfunc(codec_handle, "decode_pixeldata");
     encoder = (encoder_fnptr) getfunc(codec_handle, "encode_pixeldata");
+    // optional; fragments are joined for codec without it.
+    fragments_decoder = (fragments_decoder_fnptr) getfunc(
+        codec_handle, "decode_pixeldata_fragments");
+    // optional; codec without it is tried for all transfer syntaxes.
+    transfer_syntaxes_fnptr transfer_syntaxes =
+        (transfer_syntaxes_fnptr) getfunc(codec_handle, "transfer_syntaxes");
 
     if (!decoder || !encoder) {
       freelib(codec_handle);
       snprintf(errmsg, ERROR_MSG_SIZE, "load_codec(): "
                "cannot GetProcAddress/dlsym from codec '%s'",
-               codec_name.c_str());
+               _codec_name);
       return DICOMSDL_CODEC_ERROR;
     }
 
@@ -122,6 +156,7 @@ struct t_codec {
               encoder, decoder, codec_handle);
 
     codec_name = _codec_name;
+    set_transfer_syntaxes(transfer_syntaxes);
     return DICOMSDL_CODEC_OK;
   }
 
@@ -142,53 +177,112 @@ struct t_codec {
   }
 };
 
-struct t_codec_registry {
-  std::list<t_codec *> codecs;
-  char errmsg[ERROR_MSG_SIZE];
+// immutable set of codecs; replaced as a whole when a codec is loaded or
+// unloaded, so that a lookup never sees a table being changed.
+struct t_codec_table {
+  std::vector<std::shared_ptr<t_codec> > codecs;  // in the loading order
+  // codecs to try for each transfer syntax, most recently loaded first.
+  std::vector<std::vector<t_codec *> > dispatch;
+  // codecs for transfer syntaxes out of `dispatch`.
+  std::vector<t_codec *> any_tsuid;
+
+  void build_dispatch() {
+    size_t size = 0;
+    for (auto &c : codecs)
+      for (auto tsuid : c->tsuids)
+        if (size_t(tsuid) + 1 > size) size = size_t(tsuid) + 1;
+
+    dispatch.assign(size, std::vector<t_codec *>());
+    any_tsuid.clear();
+    for (auto rit = codecs.rbegin(); rit != codecs.rend(); rit++) {
+      t_codec *c = rit->get();
+      if (c->all_tsuids) {
+        for (auto &slot : dispatch) slot.push_back(c);
+        any_tsuid.push_back(c);
+      } else {
+        for (auto tsuid : c->tsuids) {
+          std::vector<t_codec *> &slot = dispatch[size_t(tsuid)];
+          if (slot.empty() || slot.back() != c) slot.push_back(c);
+        }
+      }
+    }
+  }
 
-  t_codec_registry() {
-    load_codec("rle", rle_encoder, rle_decoder);
-    load_codec("jpeg", ijg_encoder, ijg_decoder);
-    load_codec("jpegls", charls_encoder, charls_decoder);
-    load_codec("jpeg2000", opj_encoder, opj_decoder);
+  const std::vector<t_codec *> &codecs_for(tsuid_t tsuid) const {
+    if (tsuid >= 0 && size_t(tsuid) < dispatch.size())
+      return dispatch[size_t(tsuid)];
+    return any_tsuid;
   }
+};
 
-  ~t_codec_registry() {
-    unload_all_codec();
+// encoded data from a loaded codec is copied to memory released by this,
+// because the codec may be unloaded before the caller frees it.
+static void free_copied_pixeldata(char *data) {
+  ::free(data);
+}
+
+// encode_pixeldata and decode_pixeldata work on a reference-counted
+// snapshot of the codec table and never wait for load_codec or
+// unload_codec; a codec is unloaded after the last call using it returns.
+// std::atomic_load/_store on a shared_ptr is not lock-free: libstdc++ guards
+// it with a small mutex from a pool hashed by address, held only for the
+// pointer copy. Each call takes one snapshot, so this is one short lock per
+// encoded or decoded frame.
+struct t_codec_registry {
+  std::shared_ptr<const t_codec_table> table;  // std::atomic_load/_store
+  std::mutex update_mutex;  // serializes load_codec and unload_codec
+
+  t_codec_registry() : table(std::make_shared<t_codec_table>()) {
+    char errmsg[ERROR_MSG_SIZE];
+    load_codec("rle", rle_encoder, rle_decoder, NULL, rle_transfer_syntaxes,
+               errmsg);
+    load_codec("jpeg", ijg_encoder, ijg_decoder, ijg_fragments_decoder,
+               ijg_transfer_syntaxes, errmsg);
+    load_codec("jpegls", charls_encoder, charls_decoder, NULL,
+               charls_transfer_syntaxes, errmsg);
+    load_codec("jpeg2000", opj_encoder, opj_decoder, opj_fragments_decoder,
+               opj_transfer_syntaxes, errmsg);
+  }
+
+  std::shared_ptr<const t_codec_table> snapshot() const {
+    return std::atomic_load(&table);
   }
 
   DICOMSDL_CODEC_RESULT load_codec(const char *codec_name,
                                    encoder_fnptr encoder,
-                                   decoder_fnptr decoder) {
-    t_codec *c = new t_codec();
-    DICOMSDL_CODEC_RESULT ret = c->load_codec(codec_name, encoder, decoder);
-    if (ret == DICOMSDL_CODEC_OK)
-      codecs.push_back(c);
-    else {
+                                   decoder_fnptr decoder,
+                                   fragments_decoder_fnptr fragments_decoder,
+                                   transfer_syntaxes_fnptr transfer_syntaxes,
+                                   char *errmsg) {
+    std::shared_ptr<t_codec> c = std::make_shared<t_codec>();
+    DICOMSDL_CODEC_RESULT ret = c->load_codec(
+        codec_name, encoder, decoder, fragments_decoder, transfer_syntaxes);
+    if (ret != DICOMSDL_CODEC_OK) {
       snprintf(errmsg, ERROR_MSG_SIZE, "%s", c->errmsg);
-      delete c;
+      return ret;
     }
-    return ret;
+
+    std::lock_guard<std::mutex> lock(update_mutex);
+    std::shared_ptr<t_codec_table> t = std::make_shared<t_codec_table>();
+    t->codecs = snapshot()->codecs;
+    t->codecs.push_back(c);
+    t->build_dispatch();
+    std::atomic_store(&table, std::shared_ptr<const t_codec_table>(t));
+    return DICOMSDL_CODEC_OK;
   }
 
-  DICOMSDL_CODEC_RESULT unload_codec(char *codec_name) {
-    std::list<t_codec *>::iterator it;
-
-    for (it = codecs.begin(); it != codecs.end(); it++) {
-      if ((*it)->codec_name == codec_name) {
-        if ((*it)->codec_handle) {
-          if ((*it)->unload_codec() == DICOMSDL_CODEC_OK) {
-            delete *it;
-            codecs.erase(it);
-            return DICOMSDL_CODEC_OK;
-          } else {
-            snprintf(errmsg, ERROR_MSG_SIZE, "unload_codec():"
-                     "cannot unload '%s'",
-                     codec_name);
-            return DICOMSDL_CODEC_ERROR;
-          }
-        }
-        break;
+  DICOMSDL_CODEC_RESULT unload_codec(char *codec_name, char *errmsg) {
+    std::lock_guard<std::mutex> lock(update_mutex);
+    std::shared_ptr<const t_codec_table> current = snapshot();
+
+    for (auto it = current->codecs.begin(); it != current->codecs.end(); it++) {
+      if ((*it)->codec_name == codec_name && (*it)->codec_handle) {
+        std::shared_ptr<t_codec_table> t = std::make_shared<t_codec_table>();
+        t->codecs = current->codecs;
+        t->codecs.erase(t->codecs.begin() + (it - current->codecs.begin()));
+        t->build_dispatch();
+        std::atomic_store(&table, std::shared_ptr<const t_codec_table>(t));
+        return DICOMSDL_CODEC_OK;
       }
     }
 
@@ -198,28 +292,23 @@ struct t_codec_registry {
     return DICOMSDL_CODEC_ERROR;
   }
 
-  void unload_all_codec() {
-    std::list<t_codec *>::iterator it;
-
-    for (it = codecs.begin(); it != codecs.end(); it++)
-      delete (*it);
-    codecs.clear();
-  }
-
-  DICOMSDL_CODEC_RESULT encode_pixeldata(const char *tsuid, imagecontainer *ic,
+  DICOMSDL_CODEC_RESULT encode_pixeldata(tsuid_t tsuid_type,
+                                         const char *tsuid, imagecontainer *ic,
                                          char **data, long *datasize,
                                          free_memory_fnptr *free_memory_fn) {
     DICOMSDL_CODEC_RESULT ret = DICOMSDL_CODEC_NOTSUPPORTED;
-    std::stringstream ss;
-    char *dst = NULL;
-    *data = dst;
-    int dstlen = 0;
-    *datasize = dstlen;
+    *data = NULL;
+    *datasize = 0;
 
-    for (auto rit = codecs.rbegin(); rit != codecs.rend(); rit++) {
-      ret = (*rit)->encoder(tsuid, ic, data, datasize, free_memory_fn);
+    std::shared_ptr<const t_codec_table> t = snapshot();
+    t_codec *codec = NULL;
+    for (auto c : t->codecs_for(tsuid_type)) {
+      if (!c->encoder)
+        continue;
+      ret = c->encoder(tsuid, ic, data, datasize, free_memory_fn);
       if (ret == DICOMSDL_CODEC_NOTSUPPORTED)  // not supported; try next codec
         continue;
+      codec = c;
       break;
     }
 
@@ -235,16 +324,86 @@ struct t_codec_registry {
       return DICOMSDL_CODEC_ERROR;
     }
 
+    if (codec->codec_handle && *data) {
+      char *copied = (char *) ::malloc(size_t(*datasize));
+      if (copied)
+        memcpy(copied, *data, size_t(*datasize));
+      (*free_memory_fn)(*data);
+      *data = copied;
+      *free_memory_fn = free_copied_pixeldata;
+      if (!copied) {
+        snprintf(ic->info, ARGBUF_SIZE, "encode_pixeldata(...): "
+                 "cannot allocate %ld bytes", *datasize);
+        *datasize = 0;
+        return DICOMSDL_CODEC_ERROR;
+      }
+    }
+
     // return DICOMSDL_CODEC_OK or DICOMSDL_CODEC_INFO or DICOMSDL_CODEC_WARN
     return ret;
   }
 
-  DICOMSDL_CODEC_RESULT decode_pixeldata(const char *tsuid, char *data,
+  DICOMSDL_CODEC_RESULT decode_pixeldata(tsuid_t tsuid_type,
+                                         const char *tsuid, char *data,
                                          long datasize, imagecontainer *ic) {
-    DICOMSDL_CODEC_RESULT ret = DICOMSDL_CODEC_ERROR;
+    DICOMSDL_CODEC_RESULT ret = DICOMSDL_CODEC_NOTSUPPORTED;
 
-    for (auto rit = codecs.rbegin(); rit != codecs.rend(); rit++) {
-      ret = (*rit)->decoder(tsuid, data, datasize, ic);
+    std::shared_ptr<const t_codec_table> t = snapshot();
+    for (auto c : t->codecs_for(tsuid_type)) {
+      if (!c->decoder)
+        continue;
+      ret = c->decoder(tsuid, data, datasize, ic);
+      if (ret == DICOMSDL_CODEC_NOTSUPPORTED)  // not supported; try next codec
+        continue;
+      break;
+    }
+
+    if (ret == DICOMSDL_CODEC_NOTSUPPORTED)  // not supported
+        {
+      snprintf(ic->info, ARGBUF_SIZE, "decode_pixeldata(...):"
+               "no codec for '%s'",
+               tsuid);
+      return DICOMSDL_CODEC_ERROR;  // NO AVAILABLE CODEC
+    } else if (ret == DICOMSDL_CODEC_ERROR)  // some error
+        {
+      // error string set in ic->info;
+      return DICOMSDL_CODEC_ERROR;
+    }
+
+    // return DICOMSDL_CODEC_OK or DICOMSDL_CODEC_INFO or DICOMSDL_CODEC_WARN
+    return ret;
+  }
+
+  DICOMSDL_CODEC_RESULT decode_pixeldata_fragments(tsuid_t tsuid_type,
+                                                   const char *tsuid,
+                                                   const fragmentlist *frags,
+                                                   imagecontainer *ic) {
+    if (frags->nfragments == 1)
+      return decode_pixeldata(tsuid_type, tsuid, frags->data[0],
+                              frags->datasize[0], ic);
+
+    DICOMSDL_CODEC_RESULT ret = DICOMSDL_CODEC_NOTSUPPORTED;
+    // fragments joined for codecs that cannot read them in place.
+    static thread_local std::vector<char> joined;
+    bool is_joined = false;
+
+    std::shared_ptr<const t_codec_table> t = snapshot();
+    for (auto c : t->codecs_for(tsuid_type)) {
+      if (c->fragments_decoder) {
+        ret = c->fragments_decoder(tsuid, frags, ic);
+        if (ret != DICOMSDL_CODEC_NOTSUPPORTED)
+          break;
+      }
+      if (!c->decoder)
+        continue;
+      if (!is_joined) {
+        joined.clear();
+        for (int i = 0; i < frags->nfragments; i++)
+          joined.insert(joined.end(), frags->data[i],
+                        frags->data[i] + frags->datasize[i]);
+        is_joined = true;
+      }
+      ret = c->decoder(tsuid, joined.data(), long(joined.size()), ic);
       if (ret == DICOMSDL_CODEC_NOTSUPPORTED)  // not supported; try next codec
         continue;
       break;
@@ -272,33 +431,68 @@ static t_codec_registry codec_registery;
 DICOMSDL_CODEC_RESULT encode_pixeldata(const char *tsuid, imagecontainer *ic,
                                        char **data, long *datasize,
                                        free_memory_fnptr *free_memory_fn) {
-  return codec_registery.encode_pixeldata(tsuid, ic, data, datasize,
-                                          free_memory_fn);
+  return codec_registery.encode_pixeldata(UID::from_uidvalue(tsuid), tsuid, ic,
+                                          data, datasize, free_memory_fn);
 }
 
 DICOMSDL_CODEC_RESULT decode_pixeldata(const char *tsuid, char *data,
                                        long datasize, imagecontainer *ic) {
-  return codec_registery.decode_pixeldata(tsuid, data, datasize, ic);
+  return codec_registery.decode_pixeldata(UID::from_uidvalue(tsuid), tsuid,
+                                          data, datasize, ic);
 }
 
 } // extern "C"
 
+DICOMSDL_CODEC_RESULT encode_pixeldata(tsuid_t tsuid, imagecontainer *ic,
+                                       char **data, long *datasize,
+                                       free_memory_fnptr *free_memory_fn) {
+  return codec_registery.encode_pixeldata(tsuid, UID::to_uidvalue(tsuid), ic,
+                                          data, datasize, free_memory_fn);
+}
+
+DICOMSDL_CODEC_RESULT decode_pixeldata(tsuid_t tsuid, char *data,
+                                       long datasize, imagecontainer *ic) {
+  return codec_registery.decode_pixeldata(tsuid, UID::to_uidvalue(tsuid),
+                                          data, datasize, ic);
+}
+
+DICOMSDL_CODEC_RESULT decode_pixeldata_fragments(tsuid_t tsuid,
+                                                 const fragmentlist *frags,
+                                                 imagecontainer *ic) {
+  return codec_registery.decode_pixeldata_fragments(
+      tsuid, UID::to_uidvalue(tsuid), frags, ic);
+}
+
+bool encoded_data_is_malloced(free_memory_fnptr free_memory_fn) {
+  // built-in codecs allocate with malloc(); data from loaded codecs is
+  // copied to malloc()ed memory by encode_pixeldata.
+  return free_memory_fn == rle_codec_free_memory ||
+         free_memory_fn == ijg_codec_free_memory ||
+         free_memory_fn == charls_codec_free_memory ||
+         free_memory_fn == opj_codec_free_memory ||
+         free_memory_fn == free_copied_pixeldata;
+}
+
 #if defined (_MSC_VER)
 // cause error at LogLevel::ERROR
 #undef ERROR
 #endif
 
 void load_codec(char *codec_filename) {
+  char errmsg[ERROR_MSG_SIZE];
   DICOMSDL_CODEC_RESULT ret;
-  ret = codec_registery.load_codec(codec_filename, NULL, NULL);
+  ret = codec_registery.load_codec(codec_filename, NULL, NULL, NULL, NULL,
+                                   errmsg);
   if (ret != DICOMSDL_CODEC_OK)
-    LOGERROR_AND_THROW("%s", codec_registery.errmsg);
+    LOGERROR_AND_THROW("%s", errmsg);
 }
 
 void unload_codec(char *codec_filename) {
-  DICOMSDL_CODEC_RESULT ret = codec_registery.unload_codec(codec_filename);
+  char errmsg[ERROR_MSG_SIZE];
+  DICOMSDL_CODEC_RESULT ret =
+      codec_registery.unload_codec(codec_filename, errmsg);
   if (ret != DICOMSDL_CODEC_OK)
-    LOGERROR_AND_THROW("%s", codec_registery.errmsg);
+    LOGERROR_AND_THROW("%s", errmsg);
 }
 
 
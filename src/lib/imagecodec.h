@@ -41,6 +41,25 @@ typedef enum {
 } JPEG2K_MODE;
 
 }
+
+// same as above; codec is looked up by `tsuid` without parsing UID value.
+DICOMSDL_CODEC_RESULT decode_pixeldata(tsuid_t tsuid, char *data,
+                                       long datasize, imagecontainer *ic);
+
+DICOMSDL_CODEC_RESULT encode_pixeldata(tsuid_t tsuid, imagecontainer *ic,
+                                       char **data, long *datasize,
+                                       free_memory_fnptr *free_memory_fn);
+
+// true if encoded data released by `free_memory_fn` may be released with
+// ::free() instead, i.e. the caller may take it over.
+bool encoded_data_is_malloced(free_memory_fnptr free_memory_fn);
+
+// decode pixel data split into fragments; codecs that read fragments in
+// place get them as they are, others get a joined copy.
+DICOMSDL_CODEC_RESULT decode_pixeldata_fragments(tsuid_t tsuid,
+                                                 const fragmentlist *frags,
+                                                 imagecontainer *ic);
+
 }  // namespace dicom ----------------------------------------------------------
 
 #endif // __IMAGECODEC_H__
@@ -12,8 +12,16 @@
 
 #ifdef _WIN32
 #include <errno.h>
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#include <windows.h>
 #else
+#include <fcntl.h>
 #include <sys/errno.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #endif
 
 #include "dicom.h"
@@ -47,30 +55,52 @@ void InStream::reset_internal_buffer() {
   data_ = nullptr;
 }
 
-size_t InStream::read(uint8_t *ptr, size_t size) {
-  if (offset_ + size > rootstream_->loaded_bytes_) {
-    // size of `data_` will be larger than `offset_ + size`.
-    rootstream_->prefetch(offset_ + size);
+uint8_t *InStream::fetch(size_t offset, size_t size, bool) {
+  if (offset + size > loaded_bytes_) {
+    // size of `data_` will be larger than `offset + size`.
+    prefetch(offset + size);
 
-    if (offset_ + size > rootstream_->loaded_bytes_) return 0;
+    if (offset + size > loaded_bytes_) return nullptr;
   }
 
-  if (offset_ + size <= endoffset_) {
-    memcpy(ptr, rootstream_->data_ + offset_, size);
-    offset_ += size;
-    return size;
-  }
+  return data_ + offset;
+}
 
-  return 0;
+size_t InStream::copyout(size_t offset, uint8_t *ptr, size_t size) {
+  uint8_t *p = fetch(offset, size);
+  if (p == nullptr) return 0;
+
+  memcpy(ptr, p, size);
+  return size;
 }
 
-size_t InStream::seek(size_t pos) {
-  if (pos > rootstream_->loaded_bytes_) {
-    rootstream_->prefetch(pos);
+size_t InStream::read(uint8_t *ptr, size_t size) {
+  if (offset_ + size > endoffset_) return 0;
 
-    if (pos > rootstream_->loaded_bytes_) return offset_;
-  }
+  if (rootstream_->copyout(offset_, ptr, size) != size) return 0;
+  offset_ += size;
+  return size;
+}
 
+size_t InStream::read_some(uint8_t *ptr, size_t size) {
+  if (size > bytes_remaining()) size = bytes_remaining();
+  return read(ptr, size);
+}
+
+size_t InStream::read_at(size_t offset, void *ptr, size_t size) {
+  if (offset < startoffset_ || offset + size > endoffset_) return 0;
+
+  return rootstream_->copyout(offset, (uint8_t *)ptr, size);
+}
+
+size_t InStream::peek_at(size_t offset, void *ptr, size_t size) {
+  if (offset < startoffset_ || offset + size > endoffset_) return 0;
+
+  return rootstream_->copyout_small(offset, (uint8_t *)ptr, size);
+}
+
+// seek() and skip() only move the cursor; bytes are loaded when they are read.
+size_t InStream::seek(size_t pos) {
   if (pos >= startoffset_ && pos <= endoffset_) {
     offset_ = pos;
   }
@@ -79,13 +109,6 @@ size_t InStream::seek(size_t pos) {
 }
 
 size_t InStream::skip(size_t size) {
-  if (offset_ + size > rootstream_->loaded_bytes_) {
-    // size of `data_` will be larger than `offset_ + size`.
-    rootstream_->prefetch(offset_ + size);
-
-    if (offset_ + size > rootstream_->loaded_bytes_) return 0;
-  }
-
   if (offset_ + size <= endoffset_) {
     offset_ += size;
     return size;
@@ -95,18 +118,19 @@ size_t InStream::skip(size_t size) {
 }
 
 void *InStream::get_pointer(size_t offset, size_t size) {
-  if (offset + size > rootstream_->loaded_bytes_) {
-    // size of `data_` will be larger than `offset + size`.
-    rootstream_->prefetch(offset + size);
+  if (offset + size > endoffset_) return nullptr;
 
-    if (offset + size > rootstream_->loaded_bytes_) return nullptr;
-  }
+  return rootstream_->fetch(offset, size);
+}
 
-  if (offset + size <= endoffset_) {
-    return rootstream_->data_ + offset;
-  }
+void *InStream::pin(size_t offset, size_t size) {
+  if (offset + size > endoffset_) return nullptr;
+
+  return rootstream_->fetch(offset, size, true);
+}
 
-  return nullptr;
+void InStream::unpin(const void *ptr) {
+  rootstream_->release((const uint8_t *)ptr);
 }
 
 // InStringStream ==============================================================
@@ -205,6 +229,7 @@ void InFileStream::prefetch(size_t newsize) {
   // InSubStream should use `rootstream_->data_` rather than it's own `data_`
   // and `loaded_bytes_`.
   if (newsize < loaded_bytes_) return;
+  if (data_ && loaded_bytes_ == filesize_) return;  // whole file is read.
 
   size_t new_loaded_bytes =
       (loaded_bytes_ > 0 ? loaded_bytes_ * 2
@@ -246,6 +271,465 @@ void InFileStream::prefetch(size_t newsize) {
   loaded_bytes_ = new_loaded_bytes;
 }
 
+// InWindowedFileStream ========================================================
+
+InWindowedFileStream::InWindowedFileStream()
+    : window_size_(DEFAULT_INSTREAM_WINDOW_SIZE),
+      max_windows_(DEFAULT_INSTREAM_WINDOW_COUNT),
+      usecount_(0),
+      fd_(-1),
+      filename_("") {
+  LOG_DEBUG("++ @%p\tInWindowedFileStream::InWindowedFileStream()", this);
+}
+
+InWindowedFileStream::~InWindowedFileStream() {
+  detachfile();
+  LOG_DEBUG("-- @%p\tInWindowedFileStream::~InWindowedFileStream()", this);
+}
+
+void InWindowedFileStream::attachfile(const char *filename) {
+  // reset data before load a new file
+  detachfile();
+  reset_internal_buffer();
+
+#ifdef _WIN32
+  fd_ = _open(filename, _O_RDONLY | _O_BINARY);
+#else
+  fd_ = open(filename, O_RDONLY);
+#endif
+  if (fd_ < 0) {
+    char *errmsg = strerror(errno);
+    LOGERROR_AND_THROW("cannot open \"%s\": %s", filename, errmsg);
+  }
+
+#ifdef _WIN32
+  struct _stat64 st;
+  int ret = _fstat64(fd_, &st);
+  size_t pagesize = 4096;
+#else
+  struct stat st;
+  int ret = fstat(fd_, &st);
+  size_t pagesize = (size_t)sysconf(_SC_PAGESIZE);
+#endif
+  if (ret < 0) {
+    detachfile();
+    LOGERROR_AND_THROW("cannot get size of \"%s\"", filename);
+  }
+
+  // window size is rounded up to multiple of page size.
+  long wsize = Config::getInteger("INSTREAM_WINDOW_SIZE",
+                                  DEFAULT_INSTREAM_WINDOW_SIZE);
+  long wcount = Config::getInteger("INSTREAM_WINDOW_COUNT",
+                                   DEFAULT_INSTREAM_WINDOW_COUNT);
+  if (wsize < 1) wsize = DEFAULT_INSTREAM_WINDOW_SIZE;
+  if (wcount < 1) wcount = DEFAULT_INSTREAM_WINDOW_COUNT;
+  window_size_ = ((size_t)wsize + pagesize - 1) / pagesize * pagesize;
+  max_windows_ = (size_t)wcount;
+
+  filename_ = filename;
+  startoffset_ = offset_ = 0;
+  // every byte is addressable; bytes are read into windows in fetch().
+  endoffset_ = filesize_ = loaded_bytes_ = (size_t)st.st_size;
+
+  LOG_DEBUG(
+      "++ @%p\tInWindowedFileStream::attachfile(const char*)\t %s, window %d "
+      "x %d",
+      this, filename_.c_str(), window_size_, max_windows_);
+}
+
+void InWindowedFileStream::detachfile() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto &w : windows_) free(w.data);
+  windows_.clear();
+  if (fd_ >= 0) {
+    LOG_DEBUG("-- @%p\tInWindowedFileStream::detachfile()\t %s", this,
+              filename_.c_str());
+#ifdef _WIN32
+    _close(fd_);
+#else
+    ::close(fd_);
+#endif
+    fd_ = -1;
+  }
+  startoffset_ = offset_ = endoffset_ = filesize_ = loaded_bytes_ = 0;
+  filename_ = "";
+}
+
+// drop least recently used windows that are not pinned, to make room for a
+// new window. return false if every window is pinned.
+bool InWindowedFileStream::evict() {
+  while (windows_.size() >= max_windows_) {
+    size_t victim = windows_.size();
+    for (size_t i = 0; i < windows_.size(); i++) {
+      if (windows_[i].pincount > 0) continue;
+      if (victim == windows_.size() ||
+          windows_[i].lastuse < windows_[victim].lastuse)
+        victim = i;
+    }
+    if (victim == windows_.size()) return false;
+
+    free(windows_[victim].data);
+    windows_.erase(windows_.begin() + victim);
+  }
+  return true;
+}
+
+void InWindowedFileStream::readfile(size_t offset, uint8_t *ptr,
+                                    size_t size) {
+  size_t nread = 0;
+  while (nread < size) {
+#ifdef _WIN32
+    long long ret = -1;
+    if (_lseeki64(fd_, (long long)(offset + nread), SEEK_SET) >= 0)
+      ret = _read(fd_, ptr + nread, (unsigned int)(size - nread));
+#else
+    ssize_t ret = pread(fd_, ptr + nread, size - nread,
+                        (off_t)(offset + nread));
+    if (ret < 0 && errno == EINTR) continue;
+#endif
+    if (ret <= 0) {
+      LOGERROR_AND_THROW(
+          "cannot read %d bytes from \"%s\":%d in InWindowedFileStream",
+          size - nread, filename_.c_str(), offset + nread);
+    }
+    nread += (size_t)ret;
+  }
+}
+
+// called with `mutex_` held. return nullptr for an unpinned range when every
+// window is pinned.
+uint8_t *InWindowedFileStream::window(size_t offset, size_t size, bool pin) {
+  usecount_++;
+  for (auto &w : windows_) {
+    if (w.start <= offset && offset + size <= w.start + w.size) {
+      w.lastuse = usecount_;
+      if (pin) w.pincount++;
+      return w.data + (offset - w.start);
+    }
+  }
+
+  Window w;
+  if (size > window_size_) {
+    // pinned value larger than a window gets a window of its own.
+    w.start = offset;
+    w.size = size;
+    w.oversize = true;
+  } else {
+    // new window begins at a window boundary unless the requested range
+    // crosses the next one.
+    w.start = offset - offset % window_size_;
+    if (offset + size > w.start + window_size_) w.start = offset;
+    w.size = window_size_;
+    if (w.start + w.size > filesize_) w.size = filesize_ - w.start;
+    w.oversize = false;
+  }
+  w.pincount = (pin ? 1 : 0);
+  w.lastuse = usecount_;
+
+  if (!evict()) {
+    if (!pin) return nullptr;
+    LOGERROR_AND_THROW(
+        "InWindowedFileStream - cannot pin %d bytes at {%08x}; all %d windows "
+        "are pinned (Config INSTREAM_WINDOW_COUNT)",
+        size, offset, max_windows_);
+  }
+
+  w.data = (uint8_t *)malloc(w.size);
+  if (w.data == NULL) {
+    LOGERROR_AND_THROW(
+        "cannot malloc %d bytes in InWindowedFileStream::fetch", w.size);
+  }
+  try {
+    readfile(w.start, w.data, w.size);
+  } catch (...) {
+    free(w.data);
+    throw;
+  }
+
+  LOG_DEBUG(
+      "   @%p\tInWindowedFileStream::fetch() read window {%08x} +%d bytes, "
+      "%d windows",
+      this, w.start, w.size, windows_.size() + 1);
+
+  windows_.push_back(w);
+  return w.data + (offset - w.start);
+}
+
+// an unpinned window may be dropped by the next fetch, so only pinned
+// pointers are handed out.
+uint8_t *InWindowedFileStream::fetch(size_t offset, size_t size, bool pin) {
+  static uint8_t empty[1] = {0};
+  if (offset + size > filesize_) return nullptr;
+  if (size == 0) return empty;  // zero-length value needs no backing bytes.
+  if (!pin) return nullptr;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  return window(offset, size, true);
+}
+
+size_t InWindowedFileStream::copyout(size_t offset, uint8_t *ptr,
+                                     size_t size) {
+  if (offset + size > filesize_) return 0;
+  if (size == 0) return 0;
+
+  if (size <= window_size_) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    uint8_t *p = window(offset, size, false);
+    if (p) {
+      memcpy(ptr, p, size);
+      return size;
+    }
+  }
+  // large values aren't held in windows; nor is anything while every window
+  // is pinned.
+  readfile(offset, ptr, size);
+  return size;
+}
+
+// bytes in a resident window are copied from it; others are read from the
+// file without bringing a window in.
+size_t InWindowedFileStream::copyout_small(size_t offset, uint8_t *ptr,
+                                           size_t size) {
+  if (offset + size > filesize_) return 0;
+  if (size == 0) return 0;
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto &w : windows_) {
+      if (w.start <= offset && offset + size <= w.start + w.size) {
+        memcpy(ptr, w.data + (offset - w.start), size);
+        return size;
+      }
+    }
+  }
+  readfile(offset, ptr, size);
+  return size;
+}
+
+void InWindowedFileStream::release(const uint8_t *ptr) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (size_t i = 0; i < windows_.size(); i++) {
+    Window &w = windows_[i];
+    if (w.pincount > 0 && w.data <= ptr && ptr < w.data + w.size) {
+      if (--w.pincount == 0 && w.oversize) {
+        free(w.data);
+        windows_.erase(windows_.begin() + i);
+      }
+      return;
+    }
+  }
+}
+
+// InForwardStream =============================================================
+
+InForwardStream::InForwardStream()
+    : base_(0), filled_(0), capacity_(0), keep_from_(0), at_end_(false) {
+  LOG_DEBUG("++ @%p\tInForwardStream::InForwardStream()", this);
+}
+
+InForwardStream::~InForwardStream() {
+  LOG_DEBUG("-- @%p\tInForwardStream::~InForwardStream()", this);
+}
+
+void InForwardStream::attachreader(ReaderFunctionType reader) {
+  reset_internal_buffer();
+  reader_ = reader;
+  base_ = filled_ = capacity_ = keep_from_ = 0;
+  at_end_ = false;
+
+  // size of the stream is known only at the end of stream.
+  startoffset_ = offset_ = 0;
+  endoffset_ = filesize_ = INSTREAM_SIZE_UNKNOWN;
+
+  LOG_DEBUG("   @%p\tInForwardStream::attachreader(ReaderFunctionType)",
+            this);
+}
+
+// read from reader_ until bytes [from, to) of the stream are in data_.
+void InForwardStream::fill(size_t from, size_t to) {
+  if (to <= base_ + filled_ || at_end_) return;
+
+  // drop bytes that won't be accessed again.
+  size_t keep_from = (keep_from_ < from ? keep_from_ : from);
+  if (keep_from > base_) {
+    size_t drop = keep_from - base_;
+    if (drop > filled_) drop = filled_;
+    memmove(data_, data_ + drop, filled_ - drop);
+    base_ += drop;
+    filled_ -= drop;
+  }
+
+  size_t need = to - (keep_from > base_ ? keep_from : base_);
+  if (need > capacity_) {
+    size_t new_capacity =
+        (capacity_ > 0 ? capacity_ * 2 : INITIAL_INSTREAM_DATABUFFER_SIZE);
+    while (new_capacity < need) new_capacity *= 2;
+
+    uint8_t *tmpdata = (uint8_t *)realloc(data_, new_capacity);
+    if (tmpdata == NULL) {
+      LOGERROR_AND_THROW("cannot realloc %d bytes in InForwardStream::fill",
+                         new_capacity);
+    }
+    data_ = tmpdata;
+    own_data_ = true;
+    capacity_ = new_capacity;
+  }
+
+  // bytes between dropped ones and requested ones are read and thrown away.
+  while (base_ < keep_from && !at_end_) {
+    size_t n = keep_from - base_;
+    if (n > capacity_) n = capacity_;
+    n = reader_(data_, n);
+    if (n == 0) at_end_ = true;
+    base_ += n;
+  }
+
+  while (base_ + filled_ < to && !at_end_) {
+    size_t n = reader_(data_ + filled_, capacity_ - filled_);
+    if (n == 0) at_end_ = true;
+    filled_ += n;
+  }
+
+  loaded_bytes_ = base_ + filled_;
+  if (at_end_) {
+    endoffset_ = filesize_ = base_ + filled_;
+    LOG_DEBUG("   @%p\tInForwardStream::fill() end of stream at {%x}", this,
+              endoffset_);
+  }
+}
+
+uint8_t *InForwardStream::fetch(size_t offset, size_t size, bool) {
+  if (offset < base_) {
+    LOG_ERROR(
+        "InForwardStream::fetch - bytes at {%x} are already discarded from "
+        "the forward-only stream.",
+        offset);
+    return nullptr;
+  }
+
+  if (offset + size > base_ + filled_) {
+    fill(offset, offset + size);
+    if (offset < base_ || offset + size > base_ + filled_) return nullptr;
+  }
+
+  return data_ + (offset - base_);
+}
+
+size_t InForwardStream::read_some(uint8_t *ptr, size_t size) {
+  // the end of stream is found while the bytes are read.
+  fill(offset_, offset_ + size);
+  if (offset_ < base_ || offset_ >= base_ + filled_) return 0;
+
+  size_t n = base_ + filled_ - offset_;
+  if (n > size) n = size;
+  memcpy(ptr, data_ + (offset_ - base_), n);
+  offset_ += n;
+  return n;
+}
+
+// InMmapStream ================================================================
+
+InMmapStream::InMmapStream()
+    :
+#ifdef _WIN32
+      hfile_(INVALID_HANDLE_VALUE),
+      hmap_(NULL),
+#endif
+      filename_("") {
+  LOG_DEBUG("++ @%p\tInMmapStream::InMmapStream()", this);
+}
+
+InMmapStream::~InMmapStream() {
+  detachfile();
+  LOG_DEBUG("-- @%p\tInMmapStream::~InMmapStream()", this);
+}
+
+void InMmapStream::attachfile(const char* filename) {
+  // reset data before map a new file
+  detachfile();
+  reset_internal_buffer();
+
+  size_t filesize;
+#ifdef _WIN32
+  hfile_ = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL,
+                       OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (hfile_ == INVALID_HANDLE_VALUE) {
+    LOGERROR_AND_THROW("cannot open \"%s\": error %d", filename,
+                       (int)GetLastError());
+  }
+
+  LARGE_INTEGER li;
+  if (!GetFileSizeEx(hfile_, &li)) {
+    detachfile();
+    LOGERROR_AND_THROW("cannot get size of \"%s\"", filename);
+  }
+  filesize = (size_t)li.QuadPart;
+
+  if (filesize > 0) {
+    hmap_ = CreateFileMappingA(hfile_, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (hmap_ != NULL)
+      data_ = (uint8_t *)MapViewOfFile(hmap_, FILE_MAP_READ, 0, 0, 0);
+    if (data_ == nullptr) {
+      detachfile();
+      LOGERROR_AND_THROW("cannot mmap \"%s\"", filename);
+    }
+  }
+#else
+  int fd = open(filename, O_RDONLY);
+  if (fd < 0) {
+    char *errmsg = strerror(errno);
+    LOGERROR_AND_THROW("cannot open \"%s\": %s", filename, errmsg);
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) < 0) {
+    ::close(fd);
+    LOGERROR_AND_THROW("cannot get size of \"%s\"", filename);
+  }
+  filesize = (size_t)st.st_size;
+
+  if (filesize > 0) {
+    void *p = mmap(NULL, filesize, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (p == MAP_FAILED) {
+      char *errmsg = strerror(errno);
+      ::close(fd);
+      LOGERROR_AND_THROW("cannot mmap \"%s\": %s", filename, errmsg);
+    }
+    data_ = (uint8_t *)p;
+  }
+  // the mapping stays valid after the descriptor is closed.
+  ::close(fd);
+#endif
+
+  filename_ = filename;
+  own_data_ = false;  // unmapped in detachfile(), never free()'d
+  startoffset_ = offset_ = 0;
+  endoffset_ = filesize_ = loaded_bytes_ = filesize;
+
+  LOG_DEBUG("++ @%p\tInMmapStream::attachfile(const char*)\t %s, %d bytes",
+            this, filename_.c_str(), filesize_);
+}
+
+// unmap file -- pointers into the mapping become invalid
+void InMmapStream::detachfile() {
+#ifdef _WIN32
+  if (data_) UnmapViewOfFile(data_);
+  if (hmap_ != NULL) CloseHandle(hmap_);
+  if (hfile_ != INVALID_HANDLE_VALUE) CloseHandle(hfile_);
+  hmap_ = NULL;
+  hfile_ = INVALID_HANDLE_VALUE;
+#else
+  if (data_) munmap(data_, filesize_);
+#endif
+  if (data_) {
+    LOG_DEBUG("-- @%p\tInMmapStream::detachfile()\t %s", this,
+              filename_.c_str());
+  }
+  data_ = nullptr;
+  startoffset_ = offset_ = endoffset_ = filesize_ = loaded_bytes_ = 0;
+  filename_ = "";
+}
+
 // InSubStream ==============================================================
 
 InSubStream::InSubStream(InStream *basestream, size_t size) {
@@ -9,12 +9,19 @@
 #ifndef DICOMSDL_INSTREAM_H__
 #define DICOMSDL_INSTREAM_H__
 
+#include <stdint.h>
+#include <mutex>
 #include <string>
+#include <vector>
 #include "dicom.h"
 
 namespace dicom {  //-----------------------------------------------------------
 
 #define INITIAL_INSTREAM_DATABUFFER_SIZE  1024
+#define DEFAULT_INSTREAM_WINDOW_SIZE      0x100000  // 1 MiB
+#define DEFAULT_INSTREAM_WINDOW_COUNT     8
+// endoffset_ of a stream whose size is not known yet.
+#define INSTREAM_SIZE_UNKNOWN             SIZE_MAX
 
 // template <typename T>
 // class DataValue {
@@ -124,6 +131,24 @@ class InStream {
 
   void reset_internal_buffer();
 
+  // return pointer to `size` bytes at `offset` of this (root) stream, loading
+  // them if necessary; nullptr if they lie beyond the loadable data.
+  // if `pin` is true, the bytes stay valid until release() is called with the
+  // returned pointer.
+  virtual uint8_t* fetch(size_t offset, size_t size, bool pin = false);
+  virtual void release(const uint8_t*) {}
+  virtual size_t pin_limit() const { return SIZE_MAX; }
+
+  // copy `size` bytes at `offset` of this (root) stream into `ptr`; return
+  // number of bytes copied (0 or `size`).
+  virtual size_t copyout(size_t offset, uint8_t* ptr, size_t size);
+
+  // same as copyout(), for a few bytes that aren't worth loading the bytes
+  // around them.
+  virtual size_t copyout_small(size_t offset, uint8_t* ptr, size_t size) {
+    return copyout(offset, ptr, size);
+  }
+
  public:
   InStream();
   InStream(InStream& other) = delete;
@@ -133,7 +158,7 @@ class InStream {
 
   virtual ~InStream();
 
-  inline bool is_valid() const { return (data_ != nullptr); }
+  virtual bool is_valid() const { return (data_ != nullptr); }
 
   // return current position in the stream
   inline size_t tell() const { return offset_; }
@@ -154,18 +179,47 @@ class InStream {
   // return number of bytes read
   size_t read(uint8_t* ptr, size_t size);
 
+  // copy at most 'size' bytes from the current position; fewer bytes are
+  // read only at the end of stream.
+  // return number of bytes read
+  virtual size_t read_some(uint8_t* ptr, size_t size);
+
   // advance current position by 'size'
   size_t skip(size_t size);
 
+  // copy 'size' bytes at 'offset' without moving current position
+  // return number of bytes read
+  size_t read_at(size_t offset, void* ptr, size_t size);
+
+  // same as read_at(), but InWindowedFileStream reads the bytes without
+  // loading a window; for item headers between large values.
+  size_t peek_at(size_t offset, void* ptr, size_t size);
+
   // get memory pointer at offset
   // don't change offset_
   // caller can memcpy using returned value and size
-  // TODO: write docs .....................................
+  // returns nullptr for streams that drop loaded bytes (InWindowedFileStream);
+  // use read_at() or pin() there.
   void* get_pointer(size_t offset, size_t size);
 
+  // same as get_pointer(), but returned memory is kept valid until unpin() is
+  // called with the returned pointer; works for every stream.
+  void* pin(size_t offset, size_t size);
+  void unpin(const void* ptr);
+
+  // number of pins that may be held at once; pin() fails beyond it.
+  size_t max_pins() const { return rootstream_->pin_limit(); }
+
   // make size of `data_` at least newsize and fill it from stream.
   virtual void prefetch(size_t newsize) = 0;
 
+  // true if bytes can be read only once, in order (e.g. from a pipe).
+  virtual bool is_forward_only() const { return false; }
+
+  // bytes before `offset` won't be accessed again; forward-only streams may
+  // drop them.
+  virtual void discard(size_t) {}
+
   // move current position to new 'pos' and return new position.
   // if 'pos' is out of range, current position is not changed...
   size_t seek(size_t pos);
@@ -215,6 +269,107 @@ class InFileStream : public InStream {
   void prefetch(size_t newsize);
 };
 
+class InWindowedFileStream : public InStream {
+  // reads windows of at most `window_size_` bytes with positioned reads and
+  // keeps at most `max_windows_` windows resident, pinned or not (least
+  // recently used unpinned ones are dropped first). only pinned pointers are
+  // handed out; get_pointer() returns nullptr, and pin() fails when every
+  // window is pinned. values larger than a window are read directly into the
+  // caller's memory, or into a window of their own that is freed when its
+  // last pin is released. `mutex_` guards the windows.
+  struct Window {
+    size_t start;
+    size_t size;
+    uint8_t* data;
+    int pincount;
+    size_t lastuse;
+    bool oversize;  // larger than window_size_; freed when unpinned.
+  };
+  std::vector<Window> windows_;
+  size_t window_size_;
+  size_t max_windows_;
+  size_t usecount_;
+  std::mutex mutex_;
+
+  int fd_;
+  std::string filename_;
+
+  bool evict();
+  void readfile(size_t offset, uint8_t* ptr, size_t size);
+  uint8_t* window(size_t offset, size_t size, bool pin);
+
+ protected:
+  uint8_t* fetch(size_t offset, size_t size, bool pin = false);
+  void release(const uint8_t* ptr);
+  size_t pin_limit() const { return max_windows_; }
+  size_t copyout(size_t offset, uint8_t* ptr, size_t size);
+  size_t copyout_small(size_t offset, uint8_t* ptr, size_t size);
+
+ public:
+  InWindowedFileStream();
+  virtual ~InWindowedFileStream();
+
+  // Config::setInteger("INSTREAM_WINDOW_SIZE", bytes)  (default 1 MiB)
+  // Config::setInteger("INSTREAM_WINDOW_COUNT", n)  (default 8)
+  // attach to a new file will disrupt contents in DataSet
+  void attachfile(const char* filename);
+  void detachfile();
+  void prefetch(size_t) {}  // windows are read in fetch().
+  bool is_valid() const { return fd_ >= 0; }
+};
+
+class InForwardStream : public InStream {
+  // forward-only stream over a reader function; `data_` holds bytes from
+  // `base_` of the stream. Bytes before the offset given to discard() are
+  // dropped when more bytes are read. endoffset_ is unknown until the reader
+  // returns 0; until then it is INSTREAM_SIZE_UNKNOWN.
+  ReaderFunctionType reader_;
+  size_t base_;      // stream offset of data_[0]
+  size_t filled_;    // number of valid bytes in data_
+  size_t capacity_;  // allocated bytes of data_
+  size_t keep_from_;  // bytes before this offset may be dropped
+  bool at_end_;
+
+  void fill(size_t from, size_t to);
+
+ protected:
+  uint8_t* fetch(size_t offset, size_t size, bool pin = false);
+
+ public:
+  InForwardStream();
+  virtual ~InForwardStream();
+
+  void attachreader(ReaderFunctionType reader);
+  void prefetch(size_t newsize) { fill(newsize, newsize); }
+  bool is_valid() const { return (bool)reader_; }
+  size_t read_some(uint8_t* ptr, size_t size);
+
+  bool is_forward_only() const { return true; }
+  void discard(size_t offset) {
+    if (offset > keep_from_) keep_from_ = offset;
+  }
+};
+
+class InMmapStream : public InStream {
+  // `data_` points into a read-only mapping of the whole file; pointers from
+  // get_pointer() stay valid until the file is detached.
+#ifdef _WIN32
+  void* hfile_;
+  void* hmap_;
+#endif
+  std::string filename_;
+
+ public:
+  InMmapStream();
+  virtual ~InMmapStream();
+
+  // map file into memory
+  // attach to a new file will disrupt contents in DataSet
+  void attachfile(const char* filename);
+  void detachfile();
+  void prefetch(size_t) {}  // entire file is already mapped.
+};
+
 class InSubStream : public InStream {
   // any operation during InSubStream don't change basestream's offset
  public:
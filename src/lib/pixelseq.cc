@@ -8,7 +8,13 @@
 
 #include "pixelseq.h"
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
 #include <iostream>
+#include <mutex>
+#include <thread>
 
 #include "dicom.h"
 #include "instream.h"
@@ -17,30 +23,10 @@
 
 namespace dicom {
 
-PixelFrame::PixelFrame()
-    : startoffset_(0),
-      endoffset_(0),
-      encoded_data_(nullptr),
-      encoded_data_size_(0) {
-  LOG_DEBUG("++ @%p\tPixelFrame::PixelFrame()", this);
-}
-
-PixelFrame::~PixelFrame() {
-  if (startoffset_ || endoffset_) {
-    LOG_DEBUG("-- @%p\tPixelFrame::~PixelFrame() start @{%08x}.", this,
-              startoffset_);
-  } else if (encoded_data_) {
-    LOG_DEBUG("-- @%p\tPixelFrame::~PixelFrame() encoded frame @%p.", this,
-              encoded_data_);
-  } else {
-    LOG_DEBUG("-- @%p\tPixelFrame::~PixelFrame()", this, encoded_data_);
-  }
-
-  if (encoded_data_) ::free(encoded_data_);
-}
-
 PixelSequence::PixelSequence(DataSet *root_dataset, tsuid_t tsuid)
-    : root_dataset_(root_dataset),
+    : frames_pending_(false),
+      frames_loading_(false),
+      root_dataset_(root_dataset),
       transfer_syntax_(tsuid),
       jpeg_transfer_syntex_(
           transfer_syntax_ >= UID::JPEG_BASELINE_PROCESS1 &&
@@ -55,15 +41,63 @@ PixelSequence::~PixelSequence() {
   LOG_DEBUG("-- @%p\tPixelSequence::PixelSequence()", this);
 }
 
-PixelFrame* PixelSequence::addPixelFrame() {
-    frames_.push_back(
-          std::unique_ptr<PixelFrame>(new PixelFrame()));
-    return frames_.back().get();
+// copy `data` into `buf`, padded with 0x00 to even length.
+static void copy_encoded_data(Buffer<uint8_t> &buf, const uint8_t *data,
+                              size_t size) {
+  size_t padded_size = size + (size & 1);
+  if (!padded_size) {
+    buf.free();
+    return;
+  }
+  if (!buf.alloc(padded_size)) {
+    LOGERROR_AND_THROW(
+        "PixelSequence - cannot allocate %zd bytes for the encoded frame.",
+        padded_size);
+  }
+  ::memcpy(buf.data, data, size);
+  if (size & 1)
+    buf.data[size] = 0x0;  // padding 0x00 to make length even
+  buf.size = padded_size;
+}
+
+void PixelSequence::addEncodedFrameData(const uint8_t *data, size_t datasize) {
+  if (frames_pending_) loadFrames();
+
+  Buffer<uint8_t> buf;
+  copy_encoded_data(buf, data, datasize);
+  appendEncodedFrame(std::move(buf));
+}
+
+void PixelSequence::adoptEncodedFrameData(uint8_t *data, size_t datasize) {
+  Buffer<uint8_t> buf;  // owns `data` from here, even if this throws.
+  buf.set(data, datasize);
+  buf.owndata = true;
+  if (frames_pending_) loadFrames();
+
+  // pad to even length; also trims encoders' oversized output buffers.
+  size_t padded_size = datasize + (datasize & 1);
+  if (padded_size && !buf.realloc(padded_size)) {
+    LOGERROR_AND_THROW(
+        "PixelSequence - cannot allocate %zd bytes for the encoded frame.",
+        padded_size);
+  }
+  if (datasize & 1)
+    buf.data[datasize] = 0x0;  // padding 0x00 to make length even
+  appendEncodedFrame(std::move(buf));
+}
+
+void PixelSequence::appendEncodedFrame(Buffer<uint8_t> &&buf) {
+  size_t nfrags = frag_offsets_.size() / 2;
+  encoded_frames_.resize(numberOfFrames());
+  encoded_frames_.push_back(std::move(buf));
+  frame_offsets_.insert(frame_offsets_.end(), 2, 0);
+  frame_frags_.insert(frame_frags_.end(), 2, nfrags);
 }
 
 void PixelSequence::attachToInstream(InStream *basestream, size_t size)
 {
   is_ = std::unique_ptr<InStream>(new InSubStream(basestream, size));
+  frames_pending_ = true;
 }
 
 bool check_have_ffd9(uint8_t *p, size_t size) {
@@ -80,102 +114,34 @@ bool check_have_ffd9(uint8_t *p, size_t size) {
   return false;
 }
 
-void PixelFrame::setEncodedData(uint8_t *data, size_t size)
-{
-  startoffset_ = endoffset_ = 0;
-  if (encoded_data_) {
-    ::free(encoded_data_);
-    encoded_data_ = nullptr;
-    encoded_data_size_ = 0;
-  }
-
-  encoded_data_size_ = size;
-  if (size & 1)
-    encoded_data_size_ += 1;
-
-  encoded_data_ = (uint8_t *)::malloc(encoded_data_size_);
-  if (!encoded_data_) {
-    encoded_data_size_ = 0;
-    LOGERROR_AND_THROW(
-        "PixelFrame::setEncodedData(uint8_t*, size_t) - "
-        "cannot allocate %zd bytes for the encoded_data_.",
-        size);
-  }
-  
-  ::memcpy(encoded_data_, data, size);    
-  if (size & 1)
-    encoded_data_[size] = 0x0;  // padding 0x00 to make length even
+// true if `p` holds the first bytes of a JPEG or JPEG-LS frame (SOI marker)
+// or of a JPEG 2000 codestream (SOC and SIZ markers).
+static bool is_frame_start(tsuid_t tsuid, const uint8_t *p) {
+  if (tsuid >= UID::JPEG2000_IMAGE_COMPRESSION_LOSSLESS_ONLY)
+    return p[0] == 0xff && p[1] == 0x4f && p[2] == 0xff && p[3] == 0x51;
+  return p[0] == 0xff && p[1] == 0xd8 && p[2] == 0xff;
 }
 
-void PixelFrame::load(InStream *instream, size_t frame_length, uint8_t* buf) {
-  if (encoded_data_) {
-    // should not occur.
-    LOGERROR_AND_THROW(
-        "PixelFrame::load - cannot load if encoded_data_ exists.");
-  }
-
-  startoffset_ = instream->tell();
-  LOG_DEBUG("   @%p\tPixelFrame::load - start loading a frame at {%#x}.", this,
-            startoffset_);
-
-  // instream->tell() should locate the position of the start of frame
-  tag_t tag;
-  size_t length;
-  long remaining_bytes = (long)frame_length;
-  encoded_data_size_ = 0;
-
-  while (true) {
-    if (instream->read(buf, 8) != 8) {
-      LOGERROR_AND_THROW(
-          "PixelFrame::load - cannot read 8 bytes for tags (FFFE,E000) or "
-          "(FFFE,E0DD) from {%#x},",
-          instream->tell());
-    }
-
-    // Item Tag (FFFE,E000) or (FFFE,E0DD)
-    tag = TAG::load_32le(buf);
-    // Item Length (4 bytes)
-    length = load_le<uint32_t>(buf + 4);
-    encoded_data_size_ += length;
-
-    remaining_bytes -= 8;
-
-    if (tag == 0xfffee0dd) {
-      // This Sequence of Items is terminated by a Sequence Delimiter Item
-      // with the Tag (FFFE,E0DD).
-      break;
-    }
-
-    size_t frag_offset = instream->tell();
-    size_t n = instream->skip(length);
-    if (n != length) {
-      LOGERROR_AND_THROW("PixelFrame::load - cannot skip %d bytes from {%#x}.",
-                         length, instream->tell() - n);
-    }
-    remaining_bytes -= length;
-
-    // start and end offset of the fragment item's value
-    frag_offsets_.push_back(frag_offset);
-    frag_offsets_.push_back(frag_offset + n);
-    LOG_DEBUG("   @%p\tPixelFrame::load - add a fragment at {%#x} to {%#x}.",
-              this, frag_offset, frag_offset + n);
-
-    // I have no more bytes to read.
-    if (remaining_bytes <= 0) break;
-
-    // end of image or codestream marker?; end this frame.
-    uint8_t *frag_data = (uint8_t *)instream->get_pointer(frag_offset, length);
-    if (check_have_ffd9(frag_data, length) && (remaining_bytes < 8)) {
-      puts("BREAK!!!");
-      break;
-      // 8 remaining_bytes may be for (fffe,e0dd)
-    }    
+void PixelSequence::loadFrames()
+{
+  // in LoadOption::CONCURRENT mode, other threads wait here until frames are
+  // loaded. a call from _loadFrames() itself returns at once.
+  std::unique_lock<std::recursive_mutex> lock = root_dataset_->lockLoading();
+  if (!frames_pending_ || frames_loading_) return;
+
+  frames_loading_ = true;
+  try {
+    _loadFrames();
+  } catch (...) {
+    frames_loading_ = false;
+    frames_pending_ = false;  // don't retry on error
+    throw;
   }
-  // instream->tell() should locate the position of the end of frame
-  endoffset_ = instream->tell();
+  frames_loading_ = false;
+  frames_pending_ = false;
 }
 
-void PixelSequence::loadFrames()
+void PixelSequence::_loadFrames()
 {
   uint8_t buf[8];
   tag_t tag;
@@ -204,161 +170,286 @@ void PixelSequence::loadFrames()
         "Values(%u at {%#x}) is too large.",
         length, instream->tell() - 4);
 
+  // 'Basic Offset Table'; offsets of frames from base_offset_.
+  // Table A.4-2. Examples of Elements for an Encoded Two-Frame Image
+  // Defined as a Sequence of Three Fragments with Basic Table Item Values
+  size_t offset_table_items = length / 4;
+  std::vector<uint32_t> offsets(offset_table_items);
   if (length) {
-    // This pixel sequence has 'Basic Offset Table'.
-    // Table A.4-2. Examples of Elements for an Encoded Two-Frame Image
-    // Defined as a Sequence of Three Fragments with Basic Table Item Values
-
-    size_t offset_table_items = length / 4;
-    std::vector<uint32_t> offsets(length / 4);
-
-    // Read offset table
-    size_t n;
-    n = instream->read((uint8_t *) &offsets[0], length);
+    size_t n = instream->read((uint8_t *) offsets.data(), length);
     if (n != length) {
       LOGERROR_AND_THROW(
           "PixelSequence::loadFrames - Could not read %u bytes from "
           "{%#x} for basic offset table",
           length, instream->tell() - n);
     }
+    for (auto &offset : offsets)
+      offset = load_le<uint32_t>(&offset);
+  }
+
+  // The first frame's base offset is just after basic offset table.
+  base_offset_ = instream->tell();
+
+  // Collect fragments of all frames in one pass; frames are cut out of them
+  // below. tables are built aside, so an error leaves this sequence as is.
+  size_t frag_base = frag_offsets_.size() / 2;  // frames added before
+  std::vector<size_t> frag_offsets;
+  frag_offsets.reserve(offset_table_items * 2);
+  while (instream->bytes_remaining() >= 8) {
+    // headers only; fragments are read when their frames are decoded.
+    instream->peek_at(instream->tell(), buf, 8);
+    instream->skip(8);
+
+    // Item Tag (FFFE,E000) or (FFFE,E0DD)
+    tag = TAG::load_32le(buf);
+    // Item Length (4 bytes)
+    length = load_le<uint32_t>(buf + 4);
+
+    if (tag == 0xfffee0dd) {
+      // This Sequence of Items is terminated by a Sequence Delimiter Item
+      // with the Tag (FFFE,E0DD).
+      break;
+    }
+
+    size_t frag_offset = instream->tell();
+    size_t n = instream->skip(length);
+    if (n != length) {
+      LOGERROR_AND_THROW(
+          "PixelSequence::loadFrames - cannot skip %d bytes from {%#x}.",
+          length, instream->tell() - n);
+    }
+
+    // start and end offset of the fragment item's value
+    frag_offsets.push_back(frag_offset);
+    frag_offsets.push_back(frag_offset + n);
+  }
+  size_t end_offset = instream->tell();  // just after item (fffe,e0dd)
+  size_t nfrags = frag_offsets.size() / 2;
+
+  std::vector<size_t> frame_offsets, frame_frags;
+  std::vector<size_t> order;  // table items in ascending order of offsets
+  bool sorted = true;
+  bool use_table = (offset_table_items > 0);
+  if (use_table) {
+    // frame i takes fragments from the item at base_offset_ + offsets[i]
+    // up to the item of the next larger offset in the table.
+    frame_offsets.resize(offset_table_items * 2);
+    frame_frags.resize(offset_table_items * 2);
+
+    // offsets are in ascending order but in broken files; sort only then.
+    sorted = std::is_sorted(offsets.begin(), offsets.end());
+    if (!sorted) {
+      order.resize(offset_table_items);
+      for (size_t j = 0; j < offset_table_items; j++) order[j] = j;
+      std::stable_sort(order.begin(), order.end(),
+                       [&](size_t a, size_t b) {
+                         return offsets[a] < offsets[b];
+                       });
+    }
 
-    // The first frame's base offset is just after basic offset table.
-    base_offset_ = instream->tell();
-
-    // Sort offsets in ascending order.
-    // Build a map of offset of a frame -> offset of the next frame.
-    std::map<uint32_t, uint32_t> temp_offset_map;
-    for (int i = 0; i < offset_table_items; i++)
-      temp_offset_map[offsets[i]] = 0;
-    for (auto it = temp_offset_map.rbegin();;) {
-      int n = it->first;
-      if (++it == temp_offset_map.rend())
+    size_t k = 0;
+    for (size_t j = 0; j < offset_table_items; j++) {
+      size_t i = sorted ? j : order[j];
+      size_t item_offset = base_offset_ + offsets[i];
+      // fragment value starts 8 bytes after its item tag.
+      while (k < nfrags && frag_offsets[k * 2] - 8 < item_offset) k++;
+      if (k == nfrags || frag_offsets[k * 2] - 8 != item_offset) {
+        LOG_WARN(
+            "PixelSequence::loadFrames - offset %u of frame %zu in basic "
+            "offset table is not at a fragment; the table is ignored",
+            offsets[i], i);
+        use_table = false;
+        frame_offsets.clear();
+        frame_frags.clear();
         break;
-      it->second = n;
+      }
+      frame_offsets[i * 2] = item_offset;
+      frame_frags[i * 2] = k;
     }
-    // temp_offset_map.rbegin()->second = 0; // calculate it later
-
-    // make PixelFrames
-    PixelFrame *frame;
-    size_t last_endpos = 0;
-    for (int i = 0; i < offset_table_items; i++) {
-      size_t startpos = offsets[i];
-      size_t endpos = temp_offset_map[offsets[i]];
-      if (endpos == 0)
-        endpos = startpos+instream->bytes_remaining();
-
-      frame = addPixelFrame();
-
-      // frame->startoffset_ <- base_offset_ + startpos
-      instream->seek(base_offset_ + startpos);
-      frame->load(instream, endpos-startpos, buf);
-      if (instream->tell() > last_endpos)
-        last_endpos = instream->tell();
+  }
+
+  // without a (usable) table, frames of JPEG, JPEG-LS and JPEG 2000 are told
+  // apart by the marker at the start of their first fragment. they are used
+  // only if there are as many as NumberOfFrames and the first fragment starts
+  // a frame; otherwise all fragments make one frame.
+  std::vector<size_t> starts;  // fragments that start a frame
+  size_t nframes =
+      size_t(root_dataset_->getDataElement(0x00280008)->toLong(1));
+  if (!use_table && nfrags > 1 && nframes > 1 && jpeg_transfer_syntex_) {
+    uint8_t head[4];
+    for (size_t k = 0; k < nfrags; k++) {
+      if (frag_offsets[k * 2 + 1] - frag_offsets[k * 2] >= 4 &&
+          instream->peek_at(frag_offsets[k * 2], head, 4) == 4 &&
+          is_frame_start(transfer_syntax_, head))
+        starts.push_back(k);
     }
+    if (starts.size() != nframes || starts[0] != 0) starts.clear();
+  }
 
-    // instream->tell() is located just after item with tag (fffe,e0dd).
-    // ; frame->load already ate that item.
-    instream->seek(last_endpos);
+  if (use_table) {
+    for (size_t j = offset_table_items; j-- > 0;) {
+      size_t i = sorted ? j : order[j];
+      size_t next = (j + 1 < offset_table_items)
+                        ? (sorted ? j + 1 : order[j + 1]) : size_t(-1);
+      if (next == size_t(-1)) {
+        frame_frags[i * 2 + 1] = nfrags;
+        frame_offsets[i * 2 + 1] = end_offset;
+      } else if (offsets[next] == offsets[i]) {
+        // same offset in the table; same frame.
+        frame_frags[i * 2 + 1] = frame_frags[next * 2 + 1];
+        frame_offsets[i * 2 + 1] = frame_offsets[next * 2 + 1];
+      } else {
+        frame_frags[i * 2 + 1] = frame_frags[next * 2];
+        frame_offsets[i * 2 + 1] = frag_offsets[frame_frags[next * 2] * 2 - 1];
+      }
+    }
 
     LOG_DEBUG("   @%p\tPixelSequence::loadFrames - "
               "basic offset table with %d item(s) at {%#x}",
               this, offset_table_items, base_offset_);
+  } else if (!starts.empty()) {
+    // no (usable) basic offset table; frames begin at fragments that start
+    // with a marker.
+    frame_offsets.resize(nframes * 2);
+    frame_frags.resize(nframes * 2);
+    for (size_t i = 0; i < nframes; i++) {
+      size_t k0 = starts[i], k1 = (i + 1 < nframes ? starts[i + 1] : nfrags);
+      frame_offsets[i * 2] = frag_offsets[k0 * 2] - 8;
+      frame_offsets[i * 2 + 1] = frag_offsets[k1 * 2 - 1];
+      frame_frags[i * 2] = k0;
+      frame_frags[i * 2 + 1] = k1;
+    }
+    frame_offsets[nframes * 2 - 1] = end_offset;
+
+    LOG_DEBUG("   @%p\tPixelSequence::loadFrames - "
+              "pixel sequence (%d frames) found by start markers",
+              this, nframes);
   } else {  // no basic offset table
     // Table A.4-1. Example for Elements of an Encoded Single-Frame Image
     // Defined as a Sequence of Three Fragments
     // Without Basic Offset Table Item Value
-
-    PixelFrame *frame;
-    base_offset_ = instream->tell();
-
-    while (true) {
-      frame = addPixelFrame();
-      frame->load(instream, instream->bytes_remaining(), buf);
-
-      // last frame->load store tag/length information to the buf
-      tag = TAG::load_32le(buf);
-
-      if (tag == 0xfffee0dd)
-        break;
-      if (instream->bytes_remaining() < 8) // a fragment takes a least 8 bytes
-        break;
-    }
-
-    if (frames_.back()->frag_offsets_.size() == 0) {
-      // last frame without fragment  -> delete it
-      frames_.pop_back();
+    if (nfrags) {
+      frame_offsets = {base_offset_, end_offset};
+      frame_frags = {0, nfrags};
     }
 
     LOG_DEBUG("   @%p\tPixelSequence::loadFrames - "
               "pixel sequence (%d frames) without basic offset table",
-              this, frames_.size());
+              this, frame_offsets.size() / 2);
+  }
+
+  if (frame_offsets_.empty()) {
+    frame_offsets_.swap(frame_offsets);
+    frame_frags_.swap(frame_frags);
+    frag_offsets_.swap(frag_offsets);
+  } else {
+    for (auto &k : frame_frags) k += frag_base;
+    frame_offsets_.insert(frame_offsets_.end(), frame_offsets.begin(),
+                          frame_offsets.end());
+    frame_frags_.insert(frame_frags_.end(), frame_frags.begin(),
+                        frame_frags.end());
+    frag_offsets_.insert(frag_offsets_.end(), frag_offsets.begin(),
+                         frag_offsets.end());
   }
 }
 
+// encoded data of frame `index` set by user, or nullptr for a frame on the
+// InStream.
+static Buffer<uint8_t> *user_frame(std::vector<Buffer<uint8_t>> &frames,
+                                   size_t index) {
+  if (index < frames.size() && frames[index].data) return &frames[index];
+  return nullptr;
+}
+
 // return start and end offset of `frame` with `index`
 size_t PixelSequence::frameOffset(size_t index, size_t &end_offset) {
-  if (index >= frames_.size())
+  if (frames_pending_) loadFrames();
+
+  if (index >= numberOfFrames())
     LOGERROR_AND_THROW(
         "PixelSequence::frameOffset  - index '%d' is out of range(0..%d)",
-        index, (long)frames_.size()-1);
-  end_offset = frames_[index].get()->endoffset_;
-  return frames_[index].get()->startoffset_;
+        index, (long)numberOfFrames()-1);
+  end_offset = frame_offsets_[index * 2 + 1];
+  return frame_offsets_[index * 2];
 }
 
 size_t PixelSequence::encodedFrameDataSize(size_t index) {
-  if (index >= frames_.size())
+  if (frames_pending_) loadFrames();
+
+  if (index >= numberOfFrames())
     LOGERROR_AND_THROW(
         "PixelSequence::encodedFrameDataSize - index '%d' is out of "
         "range(0..%d)",
-        index, (long)frames_.size() - 1)
+        index, (long)numberOfFrames() - 1)
 
-  return frames_[index].get()->encodedDataSize();
+  Buffer<uint8_t> *encoded = user_frame(encoded_frames_, index);
+  if (encoded) return encoded->size;
+
+  size_t size = 0;
+  for (size_t k = frame_frags_[index * 2]; k < frame_frags_[index * 2 + 1];
+       k++)
+    size += frag_offsets_[k * 2 + 1] - frag_offsets_[k * 2];
+  return size;
 }
 
 std::vector<size_t> PixelSequence::frameFragmentOffsets(size_t index) {
-  if (index >= frames_.size())
+  if (frames_pending_) loadFrames();
+
+  if (index >= numberOfFrames())
     LOGERROR_AND_THROW(
         "PixelSequence::frameFragmentOffsets - index '%d' is out of "
         "range(0..%d)",
-        index, (long)frames_.size() - 1);
+        index, (long)numberOfFrames() - 1);
 
-  return frames_[index].get()->frag_offsets_;
+  return std::vector<size_t>(
+      frag_offsets_.begin() + frame_frags_[index * 2] * 2,
+      frag_offsets_.begin() + frame_frags_[index * 2 + 1] * 2);
 }
 
 Buffer<uint8_t> PixelSequence::encodedFrameData(size_t index) {
-  if (index >= frames_.size())
+  if (frames_pending_) loadFrames();
+
+  if (index >= numberOfFrames())
     LOGERROR_AND_THROW(
         "PixelSequence::encodedFrameData - index '%d' is out of range(0..%d)",
-        index, (long)frames_.size()-1);
-
-  PixelFrame *frame = frames_[index].get();
+        index, (long)numberOfFrames()-1);
 
-  if (frame->encoded_data_) {
-    return Buffer<uint8_t>(frame->encoded_data_, frame->encoded_data_size_);
+  Buffer<uint8_t> *encoded = user_frame(encoded_frames_, index);
+  if (encoded) {
+    return Buffer<uint8_t>(encoded->data, encoded->size);
   } else {
-    if (frame->frag_offsets_.size() == 2) {
-      // this frame has one fragment; returned buffer points to internal memory.
-      size_t startpos = frame->frag_offsets_[0];
-      size_t length = frame->frag_offsets_[1] - startpos;
-      return Buffer<uint8_t>(
-          (uint8_t *)(is_.get()->get_pointer(startpos, length)), length);
+    const size_t *frag = &frag_offsets_[0] + frame_frags_[index * 2] * 2;
+    size_t nfrags = frame_frags_[index * 2 + 1] - frame_frags_[index * 2];
+    if (nfrags == 1) {
+      // this frame has one fragment; returned buffer points to internal memory
+      // unless the stream drops its bytes (WINDOWED).
+      size_t startpos = frag[0];
+      size_t length = frag[1] - startpos;
+      uint8_t *p = (uint8_t *)(is_.get()->get_pointer(startpos, length));
+      if (p) return Buffer<uint8_t>(p, length);
+      Buffer<uint8_t> data(length);
+      if (is_.get()->read_at(startpos, data.data, length) != length)
+        LOGERROR_AND_THROW(
+            "PixelSequence::encodedFrameData - cannot read %zu bytes at "
+            "{%#zx}", length, startpos);
+      return data;
     } else {
       // frame is split into several fragments; allocate memory for joined data.
-      size_t nfrags = frame->frag_offsets_.size() / 2;
       size_t length = 0;
       // calculate entire length
       for (size_t i = 0; i < nfrags; i++) {
-        length += frame->frag_offsets_[i * 2 + 1] - frame->frag_offsets_[i * 2];
+        length += frag[i * 2 + 1] - frag[i * 2];
       }
       // assemble splited data
       Buffer<uint8_t> data(length);
-      uint8_t *p;
       uint8_t *q = data.data;
       for (size_t i = 0; i < nfrags; i++) {
-        size_t frag_startpos = frame->frag_offsets_[i * 2];
-        size_t frag_length = frame->frag_offsets_[i * 2 + 1] - frag_startpos;
-        p = (uint8_t *)(is_.get()->get_pointer(frag_startpos, frag_length));
-        ::memcpy(q, p, frag_length);
+        size_t frag_startpos = frag[i * 2];
+        size_t frag_length = frag[i * 2 + 1] - frag_startpos;
+        if (is_.get()->read_at(frag_startpos, q, frag_length) != frag_length)
+          LOGERROR_AND_THROW(
+              "PixelSequence::encodedFrameData - cannot read %zu bytes at "
+              "{%#zx}", frag_length, frag_startpos);
         q += frag_length;
       }
       return data;
@@ -368,37 +459,204 @@ Buffer<uint8_t> PixelSequence::encodedFrameData(size_t index) {
 
 void PixelSequence::setEncodedFrameData(size_t index, uint8_t *data,
                                         size_t datasize) {
-  if (index >= frames_.size())
+  if (frames_pending_) loadFrames();
+
+  if (index >= numberOfFrames())
     LOGERROR_AND_THROW(
         "PixelSequence::copyDecodedFrameData - index '%d' is out of "
         "range(0..%d)",
-        index, (long)frames_.size() - 1);
+        index, (long)numberOfFrames() - 1);
+
+  if (encoded_frames_.size() <= index)
+    encoded_frames_.resize(numberOfFrames());
+  copy_encoded_data(encoded_frames_[index], data, datasize);
+
+  // frame leaves the InStream.
+  frame_offsets_[index * 2] = frame_offsets_[index * 2 + 1] = 0;
+  frame_frags_[index * 2 + 1] = frame_frags_[index * 2];
+}
+
+// fill image attributes of `ic` from the (root) DataSet of the pixel data.
+static void set_image_attributes(DataSet *dataset, imagecontainer *ic) {
+  ic->rows = dataset->getDataElement(0x00280010)->toLong();
+  ic->cols = dataset->getDataElement(0x00280011)->toLong();
+  ic->prec = dataset->getDataElement(0x00280100)->toLong();
+  ic->ncomps = dataset->getDataElement(0x00280002)->toLong();  // SamplesPerPixel
+  ic->sgnd = dataset->getDataElement(0x00280103)
+                 ->toLong();  // PixelRepresentation
+  ic->lossy = 0;
+  ic->args[0] = '\0';
+}
+
+// append "threads=n" for codecs that split a frame among threads to
+// `ic->args`. Config is read here, on the calling thread, not by the codec.
+static void set_codec_threads(tsuid_t tsuid, imagecontainer *ic) {
+  long n;
+  if (tsuid == UID::RLE_LOSSLESS)
+    n = Config::getInteger("RLE_DECODE_THREADS", 0);
+  else if (tsuid >= UID::JPEG2000_IMAGE_COMPRESSION_LOSSLESS_ONLY &&
+           tsuid <= UID::JPEG2000_PART2_MULTICOMPONENT_IMAGE_COMPRESSION)
+    n = Config::getInteger("OPJ_DECODE_THREADS", 1);
+  else
+    return;
+  size_t len = strlen(ic->args);
+  snprintf(ic->args + len, ARGBUF_SIZE - len, "%sthreads=%ld",
+           len ? ";" : "", n);
+}
+
+// throw or log on `codec_result` of decoding into `ic`; `funcname` is used in
+// error messages.
+static void check_decode_result(const char *funcname,
+                                DICOMSDL_CODEC_RESULT codec_result,
+                                imagecontainer *ic) {
+  if (codec_result == DICOMSDL_CODEC_ERROR) {
+    LOGERROR_AND_THROW(
+        "PixelSequence::%s - error in decoding frame data '%s'", funcname,
+        ic->info);
+  } else if (codec_result == DICOMSDL_CODEC_WARN)
+    LOG_WARN("%s", ic->info);
+  else if (codec_result == DICOMSDL_CODEC_INFO)
+    LOG_DEBUG("%s", ic->info);
+}
+
+// decode a frame into `ic->data`; the frame is `encoded` if set by user, or
+// else `nfrags` fragments at `frag` ([start] [end] pairs) on the InStream,
+// which are read from `span` holding the stream bytes from `span_start`.
+static void decode_frame(const char *funcname, tsuid_t tsuid,
+                         Buffer<uint8_t> *encoded, const size_t *frag,
+                         size_t nfrags, uint8_t *span, size_t span_start,
+                         imagecontainer *ic) {
+  DICOMSDL_CODEC_RESULT codec_result;
+  if (encoded) {
+    codec_result =
+        decode_pixeldata(tsuid, (char *)encoded->data, encoded->size, ic);
+  } else if (nfrags == 1) {
+    codec_result =
+        decode_pixeldata(tsuid, (char *)(span + (frag[0] - span_start)),
+                         frag[1] - frag[0], ic);
+  } else {
+    // hand fragments to the codec in place, without joining them.
+    static thread_local std::vector<char *> fragdata;
+    static thread_local std::vector<long> fragsize;
+    fragdata.resize(nfrags);
+    fragsize.resize(nfrags);
+    for (size_t k = 0; k < nfrags; k++) {
+      fragdata[k] = (char *)(span + (frag[k * 2] - span_start));
+      fragsize[k] = long(frag[k * 2 + 1] - frag[k * 2]);
+    }
+    fragmentlist frags;
+    frags.nfragments = int(nfrags);
+    frags.data = fragdata.data();
+    frags.datasize = fragsize.data();
+    codec_result = decode_pixeldata_fragments(tsuid, &frags, ic);
+  }
+  check_decode_result(funcname, codec_result, ic);
+}
+
+// unlocks `codec_lock` (if any) in its scope; see CodecLock.
+struct CodecUnlock {
+  CodecLock *lock_;
+  explicit CodecUnlock(CodecLock *lock) : lock_(lock) {
+    if (lock_) lock_->unlock();
+  }
+  ~CodecUnlock() {
+    if (lock_) lock_->lock();
+  }
+};
+
+// decode a frame of `is` into `ic->data`, reading its fragments in place.
+// `codec_lock` is unlocked only while the codec runs.
+static void decode_frame(const char *funcname, tsuid_t tsuid, InStream *is,
+                         Buffer<uint8_t> *encoded, const size_t *frag,
+                         size_t nfrags, imagecontainer *ic,
+                         CodecLock *codec_lock = nullptr) {
+  if (encoded || nfrags == 0) {
+    CodecUnlock unlock(codec_lock);
+    decode_frame(funcname, tsuid, encoded, frag, nfrags, nullptr, 0, ic);
+    return;
+  }
+
+  std::vector<size_t> frags(frag, frag + nfrags * 2);
+  size_t span_start = frags[0];
+  size_t span_size = frags[nfrags * 2 - 1] - span_start;
+  uint8_t *span = (uint8_t *)is->pin(span_start, span_size);
+  if (!span)
+    LOGERROR_AND_THROW(
+        "PixelSequence::%s - cannot read %zu bytes at {%#zx}", funcname,
+        span_size, span_start);
+  try {
+    CodecUnlock unlock(codec_lock);
+    decode_frame(funcname, tsuid, encoded, frags.data(), nfrags, span,
+                 span_start, ic);
+  } catch (...) {
+    is->unpin(span);
+    throw;
+  }
+  is->unpin(span);
+}
+
+// number of threads for coding `count` frames; Config `key` or 0 (default)
+// for the number of cores.
+static long worker_threads(const char *key, size_t count) {
+  long nthreads = Config::getInteger(key, 0);
+  if (nthreads <= 0) nthreads = long(std::thread::hardware_concurrency());
+  if (nthreads > long(count)) nthreads = long(count);
+  return (nthreads < 1 ? 1 : nthreads);
+}
+
+// call fn(i, t) for each i in [0, count) on up to `nthreads` threads, the
+// calling thread included; t (< nthreads) identifies the thread for its own
+// scratch state. the first exception from fn is rethrown after all threads
+// finished; fewer threads are used if spawning fails.
+template <typename Fn>
+static void parallel_for(size_t count, long nthreads, Fn fn) {
+  std::atomic<size_t> next(0);
+  std::atomic<bool> failed(false);
+  std::exception_ptr error;
+  std::mutex error_mutex;
+
+  auto worker = [&](long t) {
+    while (!failed) {
+      size_t i = next++;
+      if (i >= count) break;
+      try {
+        fn(i, t);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(error_mutex);
+        if (!error) error = std::current_exception();
+        failed = true;
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (long t = 1; t < nthreads; t++) {
+    try {
+      threads.emplace_back(worker, t);
+    } catch (...) {
+      break;
+    }
+  }
+  worker(0);
+  for (auto &thread : threads) thread.join();
 
-  frames_[index].get()->setEncodedData(data, datasize);
+  if (error) std::rethrow_exception(error);
 }
 
 void PixelSequence::copyDecodedFrameData(size_t index, uint8_t *data,
-                                         int datasize, int rowstep) {
-  if (index >= frames_.size())
+                                         int datasize, int rowstep,
+                                         int max_layers) {
+  if (frames_pending_) loadFrames();
+
+  if (index >= numberOfFrames())
     LOGERROR_AND_THROW(
         "PixelSequence::copyDecodedFrameData - index '%d' is out of "
         "range(0..%d)",
-        index, (long)frames_.size() - 1);
-
-  // get encoded data
-  Buffer<uint8_t> encdata = encodedFrameData(index);
+        index, (long)numberOfFrames() - 1);
 
   // start decompress
   imagecontainer ic;
-
-  ic.rows = root_dataset_->getDataElement(0x00280010)->toLong();
-  ic.cols = root_dataset_->getDataElement(0x00280011)->toLong();
-  ic.prec = root_dataset_->getDataElement(0x00280100)->toLong();
-  ic.ncomps =
-      root_dataset_->getDataElement(0x00280002)->toLong();  // SamplesPerPixel
-  ic.sgnd = root_dataset_->getDataElement(0x00280103)
-                ->toLong();  // PixelRepresentation
-  ic.lossy = 0;
+  set_image_attributes(root_dataset_, &ic);
 
   ic.rowstep = rowstep;
   if (!data) {
@@ -406,29 +664,386 @@ void PixelSequence::copyDecodedFrameData(size_t index, uint8_t *data,
         "PixelSequence::copyDecodedFrameData - data for decoded image is "
         "null.");
   }
-  if (ic.rows * ic.rowstep != datasize) {
+  int absrowstep = (rowstep < 0 ? -rowstep : rowstep);
+  if (ic.rows * absrowstep != datasize) {
     LOGERROR_AND_THROW(
         "PixelSequence::copyDecodedFrameData - datasize '%d' is not suitable "
         "for decoded data (%d bytes is required)",
-        datasize, ic.rows * ic.rowstep);
+        datasize, ic.rows * absrowstep);
   }
   ic.datasize = datasize;  // TODO: check if ic.rows * ic.rowstep;
   ic.data = (char *)data;
+  if (max_layers > 0)
+    snprintf(ic.args, ARGBUF_SIZE, "layer=%d", max_layers);
+  set_codec_threads(root_dataset_->getTransferSyntax(), &ic);
 
-  DICOMSDL_CODEC_RESULT codec_result =
-      decode_pixeldata(UID::to_uidvalue(root_dataset_->getTransferSyntax()),
-                       (char *)encdata.data, encdata.size, &ic);
-  if (codec_result == DICOMSDL_CODEC_ERROR) {
-    LOGERROR_AND_THROW(
-        "PixelSequence::copyDecodedFrameData - error in decoding frame data "
-        "'%s'",
-        ic.info);
-  } else if (codec_result == DICOMSDL_CODEC_WARN)
-    LOG_WARN("%s", codec_result, ic.info);
-  else if (codec_result == DICOMSDL_CODEC_INFO)
-    LOG_DEBUG("%s", codec_result, ic.info);
+  decode_frame("copyDecodedFrameData", root_dataset_->getTransferSyntax(),
+               is_.get(), user_frame(encoded_frames_, index),
+               frag_offsets_.data() + frame_frags_[index * 2] * 2,
+               frame_frags_[index * 2 + 1] - frame_frags_[index * 2], &ic);
 
   // check lossy and check DataElement in DataSet...
 }
 
-}  // namespace dicom
\ No newline at end of file
+void PixelSequence::decodedRegionSize(int reduce, int x0, int y0, int x1,
+                                      int y1, int &rows, int &cols) {
+  int full_rows = root_dataset_->getDataElement(0x00280010)->toLong();
+  int full_cols = root_dataset_->getDataElement(0x00280011)->toLong();
+  if (x1 == 0) x1 = full_cols;
+  if (y1 == 0) y1 = full_rows;
+  if (reduce < 0 || reduce > 32 || x0 < 0 || y0 < 0 || x0 >= x1 ||
+      y0 >= y1 || x1 > full_cols || y1 > full_rows)
+    LOGERROR_AND_THROW(
+        "PixelSequence::decodedRegionSize - reduce '%d' or area "
+        "(%d,%d)-(%d,%d) is out of image (%dx%d)",
+        reduce, x0, y0, x1, y1, full_cols, full_rows);
+
+  // same as the component size of openjpeg; ceil(x1 / 2^r) - ceil(x0 / 2^r)
+  int64_t n = (int64_t(1) << reduce) - 1;
+  cols = int(((x1 + n) >> reduce) - ((x0 + n) >> reduce));
+  rows = int(((y1 + n) >> reduce) - ((y0 + n) >> reduce));
+}
+
+void PixelSequence::copyDecodedFrameRegion(size_t index, uint8_t *data,
+                                           int datasize, int rowstep,
+                                           int reduce, int x0, int y0, int x1,
+                                           int y1, int max_layers,
+                                           CodecLock *codec_lock) {
+  if (frames_pending_) loadFrames();
+
+  if (index >= numberOfFrames())
+    LOGERROR_AND_THROW(
+        "PixelSequence::copyDecodedFrameRegion - index '%d' is out of "
+        "range(0..%d)",
+        index, (long)numberOfFrames() - 1);
+
+  tsuid_t tsuid = root_dataset_->getTransferSyntax();
+  if (tsuid != UID::JPEG2000_IMAGE_COMPRESSION_LOSSLESS_ONLY &&
+      tsuid != UID::JPEG2000_IMAGE_COMPRESSION)
+    LOGERROR_AND_THROW(
+        "PixelSequence::copyDecodedFrameRegion - transfer syntax '%s' is not "
+        "JPEG 2000",
+        UID::to_uidvalue(tsuid));
+
+  imagecontainer ic;
+  set_image_attributes(root_dataset_, &ic);
+  if (x1 == 0) x1 = ic.cols;
+  if (y1 == 0) y1 = ic.rows;
+  decodedRegionSize(reduce, x0, y0, x1, y1, ic.rows, ic.cols);
+
+  ic.rowstep = rowstep;
+  if (!data) {
+    LOGERROR_AND_THROW(
+        "PixelSequence::copyDecodedFrameRegion - data for decoded image is "
+        "null.");
+  }
+  if (ic.rows * ic.rowstep != datasize) {
+    LOGERROR_AND_THROW(
+        "PixelSequence::copyDecodedFrameRegion - datasize '%d' is not "
+        "suitable for decoded data (%d bytes is required)",
+        datasize, ic.rows * ic.rowstep);
+  }
+  ic.datasize = datasize;
+  ic.data = (char *)data;
+  snprintf(ic.args, ARGBUF_SIZE, "reduce=%d;area=%d,%d,%d,%d;layer=%d",
+           reduce, x0, y0, x1, y1, max_layers > 0 ? max_layers : 0);
+  set_codec_threads(tsuid, &ic);
+
+  decode_frame("copyDecodedFrameRegion", tsuid, is_.get(),
+               user_frame(encoded_frames_, index),
+               frag_offsets_.data() + frame_frags_[index * 2] * 2,
+               frame_frags_[index * 2 + 1] - frame_frags_[index * 2], &ic,
+               codec_lock);
+}
+
+void PixelSequence::decodeFrames(size_t first, size_t count, uint8_t *data,
+                                 int rowstep, size_t framestep,
+                                 CodecLock *codec_lock) {
+  if (frames_pending_) loadFrames();
+
+  if (first + count > numberOfFrames() || first + count < first)
+    LOGERROR_AND_THROW(
+        "PixelSequence::decodeFrames - frames '%zu..%zu' are out of "
+        "range(0..%d)",
+        first, first + count - 1, (long)numberOfFrames() - 1);
+  if (count == 0) return;
+  if (!data)
+    LOGERROR_AND_THROW(
+        "PixelSequence::decodeFrames - data for decoded image is null.");
+
+  imagecontainer ic0;
+  set_image_attributes(root_dataset_, &ic0);
+  ic0.rowstep = rowstep;
+  ic0.datasize = ic0.rows * rowstep;
+  ic0.data = nullptr;
+  if (rowstep <= 0 || framestep < size_t(ic0.datasize))
+    LOGERROR_AND_THROW(
+        "PixelSequence::decodeFrames - rowstep '%d' or framestep '%zu' is not "
+        "suitable for decoded data (%d rows)",
+        rowstep, framestep, ic0.rows);
+  tsuid_t tsuid = root_dataset_->getTransferSyntax();
+
+  long nthreads = worker_threads("DECODE_THREADS", count);
+  // frames are already decoded in parallel; keep codecs single-threaded.
+  if (nthreads > 1)
+    snprintf(ic0.args, ARGBUF_SIZE, "threads=1");
+  else
+    set_codec_threads(tsuid, &ic0);
+
+  // workers see only these copies of the frame table, taken while
+  // `codec_lock` is held.
+  std::vector<Buffer<uint8_t>> encoded(count);
+  std::vector<size_t> frags;
+  std::vector<size_t> frame_frags(count + 1, 0);
+  for (size_t i = 0; i < count; i++) {
+    size_t index = first + i;
+    Buffer<uint8_t> *e = user_frame(encoded_frames_, index);
+    if (e) encoded[i].set(e->data, e->size);
+    frags.insert(frags.end(),
+                 frag_offsets_.begin() + frame_frags_[index * 2] * 2,
+                 frag_offsets_.begin() + frame_frags_[index * 2 + 1] * 2);
+    frame_frags[i + 1] = frags.size() / 2;
+  }
+
+  // the calling thread pins each frame's bytes just before it is decoded and
+  // unpins it afterwards, so workers never touch `is_` and at most `ahead`
+  // frames, no more than `is_` can pin, are held in memory. frames
+  // [unpinned, pinned) are pinned, frames [taken, pinned) are waiting for a
+  // thread.
+  size_t ahead = size_t(nthreads) * 2;
+  if (ahead > is_->max_pins()) ahead = is_->max_pins();
+  std::vector<uint8_t *> spans(count, nullptr);
+  std::vector<char> done(count, 0);
+  size_t pinned = 0, taken = 0, unpinned = 0;
+  bool failed = false;
+  std::exception_ptr error;
+  std::mutex mutex;
+  std::condition_variable cv;
+
+  auto pin_frame = [&](size_t i) -> uint8_t * {
+    size_t k0 = frame_frags[i], k1 = frame_frags[i + 1];
+    if (encoded[i].data || k0 == k1) return nullptr;
+    size_t start = frags[k0 * 2], size = frags[k1 * 2 - 1] - start;
+    uint8_t *span = (uint8_t *)is_->pin(start, size);
+    if (!span)
+      LOGERROR_AND_THROW(
+          "PixelSequence::decodeFrames - cannot read %zu bytes at {%#zx}",
+          size, start);
+    return span;
+  };
+  auto decode = [&](size_t i) {
+    imagecontainer ic = ic0;
+    ic.data = (char *)(data + i * framestep);
+    const size_t *frag = frags.data() + frame_frags[i] * 2;
+    size_t nfrags = frame_frags[i + 1] - frame_frags[i];
+    decode_frame("decodeFrames", tsuid,
+                 encoded[i].data ? &encoded[i] : nullptr, frag, nfrags,
+                 spans[i], nfrags ? frag[0] : 0, &ic);
+  };
+  // run `fn` without the lock; keep the first exception and stop others.
+  auto unlocked = [&](std::unique_lock<std::mutex> &lock,
+                      std::function<void()> fn) {
+    lock.unlock();
+    try {
+      fn();
+    } catch (...) {
+      lock.lock();
+      if (!error) error = std::current_exception();
+      failed = true;
+      cv.notify_all();
+      return false;
+    }
+    lock.lock();
+    return true;
+  };
+
+  auto worker = [&]() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+      cv.wait(lock, [&] { return failed || taken < pinned || taken == count; });
+      if (failed || taken == count) break;
+      size_t i = taken++;
+      if (!unlocked(lock, [&] { decode(i); })) break;
+      done[i] = 1;
+      cv.notify_all();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (long t = 1; t < nthreads; t++) {
+    try {
+      threads.emplace_back(worker);
+    } catch (...) {
+      break;
+    }
+  }
+
+  // `codec_lock` is held while the calling thread pins or unpins frames.
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!failed && unpinned < count) {
+      if (unpinned < pinned && done[unpinned]) {
+        uint8_t *span = spans[unpinned++];
+        if (span) unlocked(lock, [&] { is_->unpin(span); });
+      } else if (pinned < count && pinned - unpinned < ahead) {
+        size_t i = pinned;
+        if (!unlocked(lock, [&] { spans[i] = pin_frame(i); })) break;
+        pinned++;
+        cv.notify_one();
+      } else if (taken < pinned) {
+        size_t i = taken++;
+        if (!unlocked(lock, [&] {
+              CodecUnlock unlock(codec_lock);
+              decode(i);
+            }))
+          break;
+        done[i] = 1;
+      } else {
+        if (codec_lock) codec_lock->unlock();
+        cv.wait(lock);
+        lock.unlock();
+        if (codec_lock) codec_lock->lock();
+        lock.lock();
+      }
+    }
+  }
+  {
+    CodecUnlock unlock(codec_lock);
+    for (auto &thread : threads) thread.join();
+  }
+
+  for (size_t i = unpinned; i < pinned; i++)
+    if (spans[i]) is_->unpin(spans[i]);
+  if (error) std::rethrow_exception(error);
+}
+
+// value of LossyImageCompressionMethod (0028,2114) for `tsuid`.
+static const char *lossy_compression_method(tsuid_t tsuid) {
+  if (tsuid >= UID::JPEGLS_LOSSLESS_IMAGE_COMPRESSION &&
+      tsuid <= UID::JPEGLS_LOSSY_NEARLOSSLESS_IMAGE_COMPRESSION)
+    return "ISO_14495_1";
+  if (tsuid >= UID::JPEG2000_IMAGE_COMPRESSION_LOSSLESS_ONLY &&
+      tsuid <= UID::JPEG2000_IMAGE_COMPRESSION)
+    return "ISO_15444_1";
+  if (tsuid >= UID::JPEG2000_PART2_MULTICOMPONENT_IMAGE_COMPRESSION_LOSSLESS_ONLY &&
+      tsuid <= UID::JPEG2000_PART2_MULTICOMPONENT_IMAGE_COMPRESSION)
+    return "ISO_15444_2";
+  if (tsuid >= UID::JPEG_BASELINE_PROCESS1 &&
+      tsuid <= UID::JPEG_LOSSLESS_NONHIERARCHICAL_FIRSTORDER_PREDICTION_PROCESS14)
+    return "ISO_10918_1";
+  return nullptr;
+}
+
+// mark `dataset` as lossy compressed with `ratio` by `tsuid`; ratio and method
+// of an earlier lossy compression are kept in front (PS3.3 C.7.6.1.1.5).
+static void set_lossy_attributes(DataSet *dataset, tsuid_t tsuid,
+                                 double ratio) {
+  bool was_lossy =
+      (dataset->getDataElement(0x00282110)->toBytes() == "01");
+  dataset->addDataElement(0x00282110, VR::CS)->fromBytes("01");
+
+  std::vector<double> ratios;
+  if (was_lossy) ratios = dataset->getDataElement(0x00282112)->toDoubleVector();
+  ratios.push_back(ratio);
+  dataset->addDataElement(0x00282112, VR::DS)->fromDoubleVector(ratios);
+
+  const char *method = lossy_compression_method(tsuid);
+  if (!method) return;
+  std::string methods;
+  if (was_lossy) methods = dataset->getDataElement(0x00282114)->toBytes();
+  if (!methods.empty()) methods.push_back('\\');
+  methods.append(method);
+  dataset->addDataElement(0x00282114, VR::CS)->fromBytes(methods);
+}
+
+void PixelSequence::encodeFrames(const uint8_t *data, size_t count,
+                                 int rowstep, size_t framestep,
+                                 const char *codec_args,
+                                 CodecLock *codec_lock) {
+  if (frames_pending_) loadFrames();
+
+  if (count == 0) return;
+  if (!data)
+    LOGERROR_AND_THROW(
+        "PixelSequence::encodeFrames - data for image to encode is null.");
+
+  imagecontainer ic0;
+  set_image_attributes(root_dataset_, &ic0);
+  size_t framebytes =
+      size_t(ic0.rows) * ic0.cols * ic0.ncomps * ((ic0.prec + 7) / 8);
+  ic0.rowstep = rowstep;
+  ic0.datasize = ic0.rows * rowstep;
+  ic0.data = nullptr;
+  if (rowstep <= 0 || framestep < size_t(ic0.datasize))
+    LOGERROR_AND_THROW(
+        "PixelSequence::encodeFrames - rowstep '%d' or framestep '%zu' is not "
+        "suitable for image data (%d rows)",
+        rowstep, framestep, ic0.rows);
+  // prec keeps the sample layout (BitsAllocated); codecs that code fewer
+  // bits per sample take BitsStored from "bits=", which codec_args may
+  // override.
+  long bits_stored =
+      root_dataset_->getDataElement(0x00280101)->toLong(ic0.prec);
+  snprintf(ic0.args, ARGBUF_SIZE, "bits=%ld;%s", bits_stored,
+           codec_args ? codec_args : "");
+  tsuid_t tsuid = transfer_syntax_;
+
+  struct encoded_frame {
+    char *data;
+    long size;
+    free_memory_fnptr free_memory;
+    int lossy;
+  };
+  std::vector<encoded_frame> encoded(count,
+                                     encoded_frame{nullptr, 0, nullptr, 0});
+
+  auto free_encoded = [&]() {
+    for (auto &e : encoded)
+      if (e.data && e.free_memory) e.free_memory(e.data);
+  };
+
+  try {
+    {
+      CodecUnlock unlock(codec_lock);
+      parallel_for(count, worker_threads("ENCODE_THREADS", count),
+                   [&](size_t i, long) {
+        imagecontainer ic = ic0;
+        ic.data = (char *)(data + i * framestep);
+        encoded_frame &e = encoded[i];
+        DICOMSDL_CODEC_RESULT codec_result =
+            encode_pixeldata(tsuid, &ic, &e.data, &e.size, &e.free_memory);
+        if (codec_result == DICOMSDL_CODEC_ERROR || !e.data) {
+          LOGERROR_AND_THROW(
+              "PixelSequence::encodeFrames - error in encoding frame %zu '%s'",
+              i, ic.info);
+        } else if (codec_result == DICOMSDL_CODEC_WARN)
+          LOG_WARN("%s", ic.info);
+        e.lossy = ic.lossy;
+      });
+    }
+
+    bool lossy = false;
+    size_t encodedbytes = 0;
+    for (auto &e : encoded) {
+      lossy = lossy || e.lossy > 0;
+      encodedbytes += size_t(e.size);
+      if (encoded_data_is_malloced(e.free_memory)) {
+        char *p = e.data;
+        e.data = nullptr;  // owned by the frame from here
+        adoptEncodedFrameData((uint8_t *)p, size_t(e.size));
+      } else {
+        addEncodedFrameData((uint8_t *)e.data, size_t(e.size));
+      }
+    }
+    if (lossy)
+      set_lossy_attributes(root_dataset_, tsuid,
+                           double(framebytes * count) /
+                               double(encodedbytes ? encodedbytes : 1));
+  } catch (...) {
+    free_encoded();
+    throw;
+  }
+  free_encoded();
+}
+
+}  // namespace dicom
@@ -9,122 +9,438 @@
 #include "rle_codec.h"
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 #include "codec_common.h"
 #include "dicom.h"
 
 namespace dicom {  //------------------------------------------------------
 
+// PS3.5 G.5 - at most 15 segments fit in the RLE header.
+static const int RLE_MAX_SEGMENTS = 15;
+static const int RLE_HEADER_SIZE = 64;
+
+// a frame is decoded on multiple threads only if each thread gets at least
+// this many bytes; smaller frames are decoded faster than threads start.
+static const size_t RLE_MIN_BYTES_PER_THREAD = 256 * 1024;
+
+// number of bytes in a sample of `prec` bits.
+static inline int sample_bytes(int prec) {
+  return (prec > 16 ? 4 : (prec > 8 ? 2 : 1));
+}
+
+static inline uint32_t read_le32(const uint8_t *p) {
+  return uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16) |
+         (uint32_t(p[3]) << 24);
+}
+
+static inline void write_le32(uint8_t *p, uint32_t v) {
+  p[0] = uint8_t(v);
+  p[1] = uint8_t(v >> 8);
+  p[2] = uint8_t(v >> 16);
+  p[3] = uint8_t(v >> 24);
+}
 
-static long decode_rle_segment(Buffer<uint8_t>& encdata, Buffer<uint8_t>& decdata) {
-  uint8_t *p = encdata.data;
-  uint8_t *p_end = p + encdata.size;
-  uint8_t *q = decdata.data;
-  uint8_t *q_end = q + decdata.size;
-  size_t decoded_bytes = 0;
-
-  uint8_t c;
-  int i;
-  while (p < p_end - 1) {
-    c = *p++;
-    if (c > 0x80) {
-      for (i = 0; i < (0x101 - c); i++)
-        *q++ = *p;
-      p++;
-    } else if (c < 0x80) {
-      for (i = 0; i < (c + 1); i++)
-        *q++ = *p++;
+// decode PackBits segment `p`..`p_end` into `q`..`q_end`.
+// return number of decoded bytes; decoding stops when `q` is filled, so that
+// pad byte or excess runs at the end of the segment are ignored.
+static size_t decode_rle_segment(const uint8_t *p, const uint8_t *p_end,
+                                 uint8_t *q, uint8_t *q_end) {
+  uint8_t *q_start = q;
+
+  // while a whole run fits in both buffers with room to spare, copy runs in
+  // 16 byte blocks; bytes beyond the run are overwritten by the next one.
+  while (p_end - p > 129 + 16 && q_end - q > 128 + 16) {
+    int c = *p++;
+    int n;
+    if (c < 0x80) {
+      n = c + 1;
+      for (int i = 0; i < n; i += 16) memcpy(q + i, p + i, 16);
+      p += n;
+    } else if (c > 0x80) {
+      n = 0x101 - c;
+      uint8_t v[16];
+      memset(v, *p++, 16);
+      for (int i = 0; i < n; i += 16) memcpy(q + i, v, 16);
     } else {
-      return -1; // error
+      continue;
+    }
+    q += n;
+  }
+
+  while (p < p_end && q < q_end) {
+    int c = *p++;
+    size_t n;
+    if (c < 0x80) {  // literal run of c + 1 bytes
+      size_t len = size_t(c) + 1;
+      if (len > size_t(p_end - p)) len = size_t(p_end - p);
+      n = (len < size_t(q_end - q) ? len : size_t(q_end - q));
+      memcpy(q, p, n);
+      p += len;
+    } else if (c > 0x80) {  // replicate run of 257 - c bytes
+      if (p == p_end) break;
+      n = size_t(0x101 - c);
+      if (n > size_t(q_end - q)) n = size_t(q_end - q);
+      memset(q, *p++, n);
+    } else {  // -128 is a no-op
+      continue;
+    }
+    q += n;
+  }
+  return size_t(q - q_start);
+}
+
+// encode `n` bytes of `p` to PackBits into `q`; return end of encoded data.
+// `q` should have room for n + (n + 127) / 128 bytes.
+static uint8_t *encode_rle_row(const uint8_t *p, int n, uint8_t *q) {
+  int i = 0;
+  while (i < n) {
+    int run = 1, maxrun = (n - i < 128 ? n - i : 128);
+#ifdef __SSE2__
+    const __m128i v = _mm_set1_epi8(char(p[i]));
+    while (run + 16 <= maxrun) {
+      int m = _mm_movemask_epi8(_mm_cmpeq_epi8(
+          _mm_loadu_si128((const __m128i *)(p + i + run)), v));
+      if (m != 0xffff) {
+        run += __builtin_ctz(~m);
+        maxrun = run;  // run ends here
+        break;
+      }
+      run += 16;
     }
+#endif
+    while (run < maxrun && p[i + run] == p[i]) run++;
+    if (run > 1) {
+      *q++ = uint8_t(0x101 - run);
+      *q++ = p[i];
+      i += run;
+      continue;
+    }
+
+    // literal run; ends where three or more equal bytes follow.
+    int start = i++;
+    int end = (n - start < 128 ? n : start + 128);
+#ifdef __SSE2__
+    while (i + 16 <= end && i + 18 <= n) {
+      __m128i a = _mm_loadu_si128((const __m128i *)(p + i));
+      __m128i b = _mm_loadu_si128((const __m128i *)(p + i + 1));
+      __m128i c = _mm_loadu_si128((const __m128i *)(p + i + 2));
+      int m = _mm_movemask_epi8(
+          _mm_and_si128(_mm_cmpeq_epi8(a, b), _mm_cmpeq_epi8(a, c)));
+      if (m) {
+        i += __builtin_ctz(m);
+        end = i;
+        break;
+      }
+      i += 16;
+    }
+#endif
+    while (i < end) {
+      if (i + 2 < n && p[i] == p[i + 1] && p[i] == p[i + 2]) break;
+      i++;
+    }
+    *q++ = uint8_t(i - start - 1);
+    memcpy(q, p + start, size_t(i - start));
+    q += i - start;
   }
-  return q - decdata.data;
+  return q;
+}
+
+// interleave `n` byte planes into `count` pixels of `n` bytes each;
+// byte k of a pixel comes from src[k].
+static void interleave_row(const uint8_t *const *src, int n, uint8_t *dst,
+                           int count) {
+  int i = 0;
+  switch (n) {
+    case 1:
+      memcpy(dst, src[0], size_t(count));
+      break;
+    case 2: {
+      const uint8_t *s0 = src[0], *s1 = src[1];
+#ifdef __SSE2__
+      for (; i + 16 <= count; i += 16) {
+        __m128i a = _mm_loadu_si128((const __m128i *)(s0 + i));
+        __m128i b = _mm_loadu_si128((const __m128i *)(s1 + i));
+        _mm_storeu_si128((__m128i *)(dst + i * 2), _mm_unpacklo_epi8(a, b));
+        _mm_storeu_si128((__m128i *)(dst + i * 2 + 16),
+                         _mm_unpackhi_epi8(a, b));
+      }
+#endif
+      for (; i < count; i++) {
+        dst[i * 2] = s0[i];
+        dst[i * 2 + 1] = s1[i];
+      }
+    } break;
+    case 3: {
+      const uint8_t *s0 = src[0], *s1 = src[1], *s2 = src[2];
+      for (; i < count; i++) {
+        dst[i * 3] = s0[i];
+        dst[i * 3 + 1] = s1[i];
+        dst[i * 3 + 2] = s2[i];
+      }
+    } break;
+    case 4: {
+      const uint8_t *s0 = src[0], *s1 = src[1], *s2 = src[2], *s3 = src[3];
+#ifdef __SSE2__
+      for (; i + 16 <= count; i += 16) {
+        __m128i a = _mm_loadu_si128((const __m128i *)(s0 + i));
+        __m128i b = _mm_loadu_si128((const __m128i *)(s1 + i));
+        __m128i c = _mm_loadu_si128((const __m128i *)(s2 + i));
+        __m128i d = _mm_loadu_si128((const __m128i *)(s3 + i));
+        __m128i ab_lo = _mm_unpacklo_epi8(a, b), ab_hi = _mm_unpackhi_epi8(a, b);
+        __m128i cd_lo = _mm_unpacklo_epi8(c, d), cd_hi = _mm_unpackhi_epi8(c, d);
+        __m128i *q = (__m128i *)(dst + i * 4);
+        _mm_storeu_si128(q, _mm_unpacklo_epi16(ab_lo, cd_lo));
+        _mm_storeu_si128(q + 1, _mm_unpackhi_epi16(ab_lo, cd_lo));
+        _mm_storeu_si128(q + 2, _mm_unpacklo_epi16(ab_hi, cd_hi));
+        _mm_storeu_si128(q + 3, _mm_unpackhi_epi16(ab_hi, cd_hi));
+      }
+#endif
+      for (; i < count; i++) {
+        dst[i * 4] = s0[i];
+        dst[i * 4 + 1] = s1[i];
+        dst[i * 4 + 2] = s2[i];
+        dst[i * 4 + 3] = s3[i];
+      }
+    } break;
+    default:
+      for (int k = 0; k < n; k++) {
+        const uint8_t *s = src[k];
+        uint8_t *q = dst + k;
+        for (i = 0; i < count; i++, q += n) *q = s[i];
+      }
+      break;
+  }
+}
+
+// split `count` pixels of `n` bytes each into `n` byte planes;
+// byte k of a pixel goes to dst[k].
+static void deinterleave_row(const uint8_t *src, int n,
+                             uint8_t *const *dst, int count) {
+  int i = 0;
+  switch (n) {
+    case 1:
+      memcpy(dst[0], src, size_t(count));
+      break;
+    case 2: {
+      uint8_t *d0 = dst[0], *d1 = dst[1];
+#ifdef __SSE2__
+      const __m128i mask = _mm_set1_epi16(0xff);
+      for (; i + 16 <= count; i += 16) {
+        __m128i v0 = _mm_loadu_si128((const __m128i *)(src + i * 2));
+        __m128i v1 = _mm_loadu_si128((const __m128i *)(src + i * 2 + 16));
+        _mm_storeu_si128((__m128i *)(d0 + i),
+                         _mm_packus_epi16(_mm_and_si128(v0, mask),
+                                          _mm_and_si128(v1, mask)));
+        _mm_storeu_si128((__m128i *)(d1 + i),
+                         _mm_packus_epi16(_mm_srli_epi16(v0, 8),
+                                          _mm_srli_epi16(v1, 8)));
+      }
+#endif
+      for (; i < count; i++) {
+        d0[i] = src[i * 2];
+        d1[i] = src[i * 2 + 1];
+      }
+    } break;
+    case 3: {
+      uint8_t *d0 = dst[0], *d1 = dst[1], *d2 = dst[2];
+      for (; i < count; i++) {
+        d0[i] = src[i * 3];
+        d1[i] = src[i * 3 + 1];
+        d2[i] = src[i * 3 + 2];
+      }
+    } break;
+    case 4: {
+      uint8_t *d0 = dst[0], *d1 = dst[1], *d2 = dst[2], *d3 = dst[3];
+#ifdef __SSE2__
+      const __m128i mask = _mm_set1_epi16(0xff);
+      for (; i + 16 <= count; i += 16) {
+        const __m128i *p = (const __m128i *)(src + i * 4);
+        __m128i v0 = _mm_loadu_si128(p), v1 = _mm_loadu_si128(p + 1);
+        __m128i v2 = _mm_loadu_si128(p + 2), v3 = _mm_loadu_si128(p + 3);
+        // bytes 0 and 2, 1 and 3 of pixels
+        __m128i e01 = _mm_packus_epi16(_mm_and_si128(v0, mask),
+                                       _mm_and_si128(v1, mask));
+        __m128i e23 = _mm_packus_epi16(_mm_and_si128(v2, mask),
+                                       _mm_and_si128(v3, mask));
+        __m128i o01 = _mm_packus_epi16(_mm_srli_epi16(v0, 8),
+                                       _mm_srli_epi16(v1, 8));
+        __m128i o23 = _mm_packus_epi16(_mm_srli_epi16(v2, 8),
+                                       _mm_srli_epi16(v3, 8));
+        _mm_storeu_si128((__m128i *)(d0 + i),
+                         _mm_packus_epi16(_mm_and_si128(e01, mask),
+                                          _mm_and_si128(e23, mask)));
+        _mm_storeu_si128((__m128i *)(d2 + i),
+                         _mm_packus_epi16(_mm_srli_epi16(e01, 8),
+                                          _mm_srli_epi16(e23, 8)));
+        _mm_storeu_si128((__m128i *)(d1 + i),
+                         _mm_packus_epi16(_mm_and_si128(o01, mask),
+                                          _mm_and_si128(o23, mask)));
+        _mm_storeu_si128((__m128i *)(d3 + i),
+                         _mm_packus_epi16(_mm_srli_epi16(o01, 8),
+                                          _mm_srli_epi16(o23, 8)));
+      }
+#endif
+      for (; i < count; i++) {
+        d0[i] = src[i * 4];
+        d1[i] = src[i * 4 + 1];
+        d2[i] = src[i * 4 + 2];
+        d3[i] = src[i * 4 + 3];
+      }
+    } break;
+    default:
+      for (int k = 0; k < n; k++) {
+        const uint8_t *p = src + k;
+        uint8_t *d = dst[k];
+        for (i = 0; i < count; i++, p += n) d[i] = *p;
+      }
+      break;
+  }
+}
+
+// number of threads to decode a frame; "threads=" in ic->args. 0 (default)
+// for the number of cores.
+static int decode_threads(imagecontainer *ic, int nsegments,
+                          size_t planesize, int *threads) {
+  int n = 0;
+
+  argparser p(ic);  // argument is set in ic->args
+  int key = 0;
+  while ((key = p.get_next_argkey()) > 0) {
+    switch (key) {
+      case ARGKEY_THREADS:
+        n = p.value_as_int();
+        break;
+      default:
+        break;
+    }
+  }
+  if (key != 0) {
+    // argument key error, error message in ic->info
+    return -1;
+  }
+
+  if (n <= 0) n = int(std::thread::hardware_concurrency());
+  size_t maxn = planesize * size_t(nsegments) / RLE_MIN_BYTES_PER_THREAD;
+  if (size_t(n) > maxn) n = int(maxn);
+  if (n > nsegments) n = nsegments;
+  *threads = (n < 1 ? 1 : n);
+  return 0;
 }
 
 static DICOMSDL_CODEC_RESULT decode_rle(char *src, long srclen,
                                         imagecontainer *ic) {
-  uint32_t *header;
-  header = (uint32_t *) src;
-  int nsegments = int(header[0]);
-  DICOMSDL_CODEC_RESULT result;
-
-  // prepare buffer for decoded pixels
-  int decdata_size = ic->rows * ic->cols * (ic->prec > 8 ? 2 : 1) * ic->ncomps;
-  Buffer<uint8_t> decdata(decdata_size);
-
-  // process each segments
-  uint8_t *q =  decdata.data;
-  size_t remaining = decdata.size;
-  for (int i = 1; i <= nsegments; i++) {
-    size_t startoffset, endoffset;
-    startoffset = header[i];
-    if (i == nsegments)
-      endoffset = srclen;
-    else
-      endoffset = header[i + 1];
-
-    Buffer<uint8_t> enc_segment((uint8_t *)src + startoffset,
-                                endoffset - startoffset);
-    Buffer<uint8_t> dec_segment(q, remaining);
-
-    long ndecoded = decode_rle_segment(enc_segment, dec_segment);
-    if (ndecoded < 0)
-      break; // error
-    remaining -= (size_t)ndecoded;
-    q += ndecoded;
-  }
-
-  if (remaining > 0) {
+  const uint8_t *header = (const uint8_t *)src;
+  int nsegments = int(read_le32(header));
+
+  // PS3.5 G.2 - one segment per byte of a sample, the most significant
+  // byte first, for each sample in a pixel.
+  int nbytes = sample_bytes(ic->prec);
+  if (nsegments != ic->ncomps * nbytes || nsegments > RLE_MAX_SEGMENTS) {
     snprintf(ic->info, ARGBUF_SIZE, "decode_rle(...): "
-             "out buffer is not filled by %d bytes.",
-             int(remaining));
-    result = DICOMSDL_CODEC_ERROR;
-    goto DECODE_END;
+             "unsupported image format - %d segments for %d bits and "
+             "%d samples.", nsegments, ic->prec, ic->ncomps);
+    return DICOMSDL_CODEC_ERROR;
   }
 
-  // change planar configuration color-by-plane to color-by-pixel
-  {
-    int nplanes;
-    if (ic->prec > 8 && ic->ncomps == 1)
-      nplanes = 2;
-    else if (ic->prec == 8)
-      nplanes = ic->ncomps;
-    else {
+  const uint8_t *segstart[RLE_MAX_SEGMENTS], *segend[RLE_MAX_SEGMENTS];
+  for (int k = 0; k < nsegments; k++) {
+    size_t startoffset = read_le32(header + 4 * (k + 1));
+    size_t endoffset =
+        (k + 1 == nsegments ? size_t(srclen)
+                            : size_t(read_le32(header + 4 * (k + 2))));
+    if (startoffset < size_t(RLE_HEADER_SIZE) || startoffset > endoffset ||
+        endoffset > size_t(srclen)) {
       snprintf(ic->info, ARGBUF_SIZE, "decode_rle(...): "
-               "unsupported image format - %d bits and %d planes.",
-               ic->prec, ic->ncomps);
+               "segment %d has invalid offsets %d..%d in %d bytes.",
+               k, int(startoffset), int(endoffset), int(srclen));
       return DICOMSDL_CODEC_ERROR;
-      goto DECODE_END;
     }
-    { // copy
-      int msb_first = (ic->prec > 8 ? 0 : 1);
-      uint8_t *p, *q;
-      int plane_strides = ic->rows * ic->cols;
-      for (int k = 0; k < nplanes; k++) {
-        p = decdata.data + plane_strides * k;
-        q = (uint8_t *) (ic->data);
-        if (ic->rowstep < 0)
-          q += -(ic->rowstep) * (ic->rows - 1);
-        if (msb_first)
-          q += k;
-        else
-          q += nplanes - k - 1;
-
-        for (int j = 0; j < ic->rows; j++) {
-          for (int i = 0; i < ic->cols; i++) {
-            q[i * nplanes] = p[i];
-          }
-          p += ic->cols;
-          q += ic->rowstep;
-        }
+    segstart[k] = header + startoffset;
+    segend[k] = header + endoffset;
+  }
+
+  int threads;
+  size_t planesize = size_t(ic->rows) * size_t(ic->cols);
+  if (decode_threads(ic, nsegments, planesize, &threads) < 0)
+    return DICOMSDL_CODEC_ERROR;
+
+  // decode segments into planes; single plane image with packed rows is
+  // decoded in place.
+  static thread_local std::vector<uint8_t> scratch;
+  uint8_t *planes;
+  bool inplace = (nsegments == 1 && ic->rowstep == ic->cols);
+  if (inplace) {
+    planes = (uint8_t *)ic->data;
+  } else {
+    if (scratch.size() < planesize * nsegments)
+      scratch.resize(planesize * nsegments);
+    planes = scratch.data();
+  }
+
+  size_t decoded[RLE_MAX_SEGMENTS];
+  std::atomic<int> next(0);
+  auto worker = [&]() {
+    int k;
+    while ((k = next++) < nsegments) {
+      uint8_t *q = planes + planesize * k;
+      decoded[k] = decode_rle_segment(segstart[k], segend[k], q, q + planesize);
+    }
+  };
+  {
+    std::vector<std::thread> workers;
+    for (int t = 1; t < threads; t++) {
+      try {
+        workers.emplace_back(worker);
+      } catch (...) {
+        break;  // decode remaining segments on fewer threads
       }
     }
+    worker();
+    for (auto &w : workers) w.join();
   }
-  result = DICOMSDL_CODEC_OK;
- DECODE_END:
-  //  decdata.free(); // `~Buffer` will free allocated data.
-   return result;
- }
+
+  for (int k = 0; k < nsegments; k++) {
+    if (decoded[k] < planesize) {
+      snprintf(ic->info, ARGBUF_SIZE, "decode_rle(...): "
+               "out buffer is not filled by %d bytes in segment %d.",
+               int(planesize - decoded[k]), k);
+      return DICOMSDL_CODEC_ERROR;
+    }
+  }
+
+  if (inplace)
+    return DICOMSDL_CODEC_OK;
+
+  // change planar configuration color-by-plane to color-by-pixel;
+  // samples are stored in little endian.
+  const uint8_t *src_row[RLE_MAX_SEGMENTS];
+  for (int c = 0; c < ic->ncomps; c++)
+    for (int b = 0; b < nbytes; b++)
+      src_row[c * nbytes + (nbytes - 1 - b)] =
+          planes + planesize * (c * nbytes + b);
+
+  uint8_t *q = (uint8_t *)(ic->data);
+  if (ic->rowstep < 0)
+    q += -(ic->rowstep) * (ic->rows - 1);
+  for (int j = 0; j < ic->rows; j++) {
+    interleave_row(src_row, nsegments, q, ic->cols);
+    for (int k = 0; k < nsegments; k++)
+      src_row[k] += ic->cols;
+    q += ic->rowstep;
+  }
+
+  return DICOMSDL_CODEC_OK;
+}
 
 extern "C" DICOMSDL_CODEC_RESULT rle_decoder(const char *tsuid, char *data,
                                              long datasize,
@@ -140,22 +456,25 @@ extern "C" DICOMSDL_CODEC_RESULT rle_decoder(const char *tsuid, char *data,
     return DICOMSDL_CODEC_ERROR;
   }
 
-  if (ic->datasize < ic->rowstep * ic->rows
-      || ic->rowstep < ic->cols * (ic->prec > 8 ? 2 : 1) * ic->ncomps) {
+  long rowstep = (ic->rowstep < 0 ? -long(ic->rowstep) : long(ic->rowstep));
+  int nbytes = sample_bytes(ic->prec);
+  if (ic->datasize < rowstep * ic->rows
+      || rowstep < long(ic->cols) * nbytes * ic->ncomps) {
     snprintf(ic->info, ARGBUF_SIZE, "pixelbuf for decoded image is too small; "
              "buflen %d < rowstep %d * rows %d or "
-             "rowstep < cols %d * (prec %d > 8 ? 2 : 1) * ncomps %d",
-             int(ic->datasize), ic->rowstep, ic->rows, ic->cols, ic->prec,
-             ic->ncomps);
+             "rowstep < cols %d * %d bytes (prec %d) * ncomps %d",
+             int(ic->datasize), ic->rowstep, ic->rows, ic->cols, nbytes,
+             ic->prec, ic->ncomps);
     return DICOMSDL_CODEC_ERROR;
   }
 
-  if (datasize < 64 + 2 + 2) {
+  if (datasize < RLE_HEADER_SIZE + 2) {
     snprintf(ic->info, ARGBUF_SIZE, "datasize (%d) is too small.",
              int(datasize));
     return DICOMSDL_CODEC_ERROR;
   }
 
+  ic->lossy = 0;
   return decode_rle(data, datasize, ic);
 }
 
@@ -168,9 +487,9 @@ extern "C" DICOMSDL_CODEC_RESULT rle_encoder(
       )
     return DICOMSDL_CODEC_NOTSUPPORTED;
 
-  if (!*data || datasize || *free_memory_fn) {
+  if (data == NULL || datasize == NULL || free_memory_fn == NULL) {
     snprintf(ic->info, ARGBUF_SIZE, "rle_encoder(...): "
-             "*data or datasize or *free_memory_fn is NULL.");
+             "data or datasize or free_memory_fn is NULL.");
     return DICOMSDL_CODEC_ERROR;
   }
 
@@ -178,13 +497,95 @@ extern "C" DICOMSDL_CODEC_RESULT rle_encoder(
   *datasize = 0;
   *free_memory_fn = rle_codec_free_memory;
 
-  snprintf(ic->info, ARGBUF_SIZE, "rle_encoder(...): "
-           "not implemented yet.");
-  return DICOMSDL_CODEC_ERROR;
+  int nbytes = sample_bytes(ic->prec);
+  int nsegments = ic->ncomps * nbytes;
+  if (ic->ncomps < 1 || nsegments > RLE_MAX_SEGMENTS) {
+    snprintf(ic->info, ARGBUF_SIZE, "rle_encoder(...): "
+             "cannot encode image with %d bits and %d samples.",
+             ic->prec, ic->ncomps);
+    return DICOMSDL_CODEC_ERROR;
+  }
+
+  long rowstep = (ic->rowstep < 0 ? -long(ic->rowstep) : long(ic->rowstep));
+  if (!ic->data || ic->rows <= 0 || ic->cols <= 0
+      || ic->datasize < rowstep * ic->rows
+      || rowstep < long(ic->cols) * nsegments) {
+    snprintf(ic->info, ARGBUF_SIZE, "rle_encoder(...): "
+             "image buffer is too small; buflen %d < rowstep %d * rows %d or "
+             "rowstep < cols %d * %d bytes * ncomps %d",
+             int(ic->datasize), ic->rowstep, ic->rows, ic->cols, nbytes,
+             ic->ncomps);
+    return DICOMSDL_CODEC_ERROR;
+  }
+
+  const uint8_t *row = (const uint8_t *)(ic->data);
+  if (ic->rowstep < 0)
+    row += rowstep * (ic->rows - 1);
+
+  // split pixels into byte planes, in the order of segments; single plane
+  // image is read straight from its rows.
+  size_t planesize = size_t(ic->rows) * size_t(ic->cols);
+  static thread_local std::vector<uint8_t> scratch;
+  const uint8_t *planes = row;
+  long planestep = ic->rowstep;
+  if (nsegments > 1 || ic->rowstep < 0) {
+    if (scratch.size() < planesize * nsegments)
+      scratch.resize(planesize * nsegments);
+    uint8_t *dst_row[RLE_MAX_SEGMENTS];
+    for (int c = 0; c < ic->ncomps; c++)
+      for (int b = 0; b < nbytes; b++)
+        dst_row[c * nbytes + (nbytes - 1 - b)] =
+            scratch.data() + planesize * (c * nbytes + b);
+    for (int j = 0; j < ic->rows; j++) {
+      deinterleave_row(row, nsegments, dst_row, ic->cols);
+      for (int k = 0; k < nsegments; k++)
+        dst_row[k] += ic->cols;
+      row += ic->rowstep;
+    }
+    planes = scratch.data();
+    planestep = ic->cols;
+  }
+
+  // worst case is a literal run header for every 128 bytes.
+  size_t rowbound = size_t(ic->cols) + (size_t(ic->cols) + 127) / 128;
+  size_t bound = RLE_HEADER_SIZE + (rowbound * ic->rows + 1) * nsegments;
+  uint8_t *out = (uint8_t *)::malloc(bound);
+  if (!out) {
+    snprintf(ic->info, ARGBUF_SIZE, "rle_encoder(...): "
+             "cannot allocate %d bytes.", int(bound));
+    return DICOMSDL_CODEC_ERROR;
+  }
+
+  memset(out, 0, RLE_HEADER_SIZE);
+  write_le32(out, uint32_t(nsegments));
+  uint8_t *q = out + RLE_HEADER_SIZE;
+  for (int k = 0; k < nsegments; k++) {
+    write_le32(out + 4 * (k + 1), uint32_t(q - out));
+    const uint8_t *p = planes + planesize * k;
+    // PS3.5 G.3.1 - each row is encoded separately.
+    for (int j = 0; j < ic->rows; j++) {
+      q = encode_rle_row(p, ic->cols, q);
+      p += planestep;
+    }
+    if ((q - out) & 1) *q++ = 0;  // segments have even length
+  }
+
+  *datasize = long(q - out);
+  uint8_t *shrunk = (uint8_t *)::realloc(out, size_t(*datasize));
+  *data = (char *)(shrunk ? shrunk : out);
+  ic->lossy = 0;
+  return DICOMSDL_CODEC_OK;
 }
 
 extern "C" void rle_codec_free_memory(char *data) {
   ::free(data);
 }
 
+extern "C" const char *const *rle_transfer_syntaxes() {
+  static const char *const tsuids[] = {
+      "1.2.840.10008.1.2.5",  // RLE Lossless
+      NULL};
+  return tsuids;
+}
+
 }  // namespace dicom -----------------------------------------------------
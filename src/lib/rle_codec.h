@@ -14,9 +14,21 @@
 
 namespace dicom {  //------------------------------------------------------
 
+/*
+ * RLE Lossless decoder; 8, 16 and 32 bits samples with up to 15 segments.
+ *
+ * acceptable arguments in ic->args are ...
+ * 	threads=[ int value >= 0; 0 for number of cpus ]
+ *
+ *	threads defaults to 0; PixelSequence passes Config "RLE_DECODE_THREADS".
+ *	segments are decoded in parallel only in large frames.
+ */
 extern "C" DICOMSDL_CODEC_RESULT rle_decoder(const char *tsuid, char *data,
                                              long datasize, imagecontainer *ic);
 
+/*
+ * RLE Lossless encoder; no arguments.
+ */
 extern "C" DICOMSDL_CODEC_RESULT rle_encoder(const char *tsuid,
                                              imagecontainer *ic, char **data,
                                              long *datasize,
@@ -24,6 +36,8 @@ extern "C" DICOMSDL_CODEC_RESULT rle_encoder(const char *tsuid,
 
 extern "C" void rle_codec_free_memory(char *data);
 
+extern "C" const char *const *rle_transfer_syntaxes();
+
 }  // namespace dicom -----------------------------------------------------
 
 #endif // DICOMSDL_CODEC_RLE_H__
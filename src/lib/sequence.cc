@@ -13,7 +13,9 @@
 
 namespace dicom {
 
-Sequence::Sequence(DataSet *root_dataset): root_dataset_(root_dataset)
+Sequence::Sequence(DataSet *root_dataset)
+    : root_dataset_(root_dataset), items_pending_(false),
+      items_loading_(false), tag_filter_(nullptr)
 {
   LOG_DEBUG("++ @%p\tSequence::Sequence(DataSet *)", this);
 
@@ -27,6 +29,7 @@ Sequence::~Sequence()
 
 DataSet* Sequence::addDataSet()
 {
+  if (items_pending_) loadItems();
   seq_.push_back(std::unique_ptr<DataSet>(new DataSet(root_dataset_)));
   return seq_.back().get();
 }
@@ -45,6 +48,32 @@ DataSet* Sequence::operator[](size_t index) {
     return nullptr;
 }
 
+void Sequence::attachToInstream(InStream *basestream, size_t size,
+                                const TagFilter *tag_filter)
+{
+  is_ = std::unique_ptr<InStream>(new InSubStream(basestream, size));
+  items_pending_ = true;
+  tag_filter_ = tag_filter;
+}
+
+void Sequence::loadItems() {
+  // in LoadOption::CONCURRENT mode, other threads wait here until items are
+  // loaded. a call from load() itself (by addDataSet()) returns at once.
+  std::unique_lock<std::recursive_mutex> lock = root_dataset_->lockLoading();
+  if (!items_pending_ || items_loading_) return;
+
+  items_loading_ = true;
+  try {
+    load(is_.get());
+  } catch (...) {
+    items_loading_ = false;
+    items_pending_ = false;  // don't retry on error
+    throw;
+  }
+  items_loading_ = false;
+  items_pending_ = false;
+}
+
 void Sequence::load(InStream *instream) {
   uint8_t buf[8];
   size_t n;
@@ -89,7 +118,7 @@ void Sequence::load(InStream *instream) {
 
     DataSet* dataset = addDataSet();
     if (length) {
-      dataset->attachToInstream(instream, length);
+      dataset->attachToInstream(instream, length, tag_filter_);
       dataset->setOffset(offset);
       InStream* subs = dataset->instream();
       size_t offset_start, offset_end;
@@ -0,0 +1,124 @@
+/*
+ * DICOM software development library (SDL)
+ * Copyright (c) 2010-2020, Kim, Tae-Sung. All rights reserved.
+ * See copyright.txt for details.
+ *
+ * tagpath.cc
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <memory>
+#include <string>
+
+#include "dicom.h"
+
+namespace dicom {
+
+TagPath::TagPath(const char* tagstr) : tagstr_(tagstr) {
+  const char* _tagstr = tagstr;
+  const char* endptr = tagstr + strlen(tagstr);
+  char* nextptr;
+
+  tag_t tag, gggg, eeee;
+
+  while (1) {
+    Node node;
+    node.seqidx = -1;
+
+    // ignore starting (
+    if (_tagstr[0] == '(')
+      _tagstr++;
+
+    if ((_tagstr[0] >= '0' && _tagstr[0] <= '9') ||   //
+        ((_tagstr[0] == 'F' || _tagstr[0] == 'f') &&  //
+         (_tagstr[1] == 'F' || _tagstr[1] == 'f'))) {
+      // string starts with number - read gggg or ggggeeee
+      tag = tag_t(strtoul(_tagstr, &nextptr, 16));
+
+      if (*nextptr == ',' || *nextptr == '{') {
+        // if string->hex conversion is stopped by ',' or '{',
+        // first portion is group number
+        gggg = tag;
+
+        // if ",{" string sequence, skip ','
+        if (*nextptr == ',' && nextptr[1] == '{') nextptr++;
+
+        // string between { and } is creator id
+        // e.g. 0009,{CREATOR}00
+        if ((*nextptr == '{') && (gggg & 1)) {
+          const char* creator = nextptr + 1;
+          const char* closing = strchr(creator, '}');
+          if (closing == nullptr)
+            LOGERROR_AND_THROW(
+                "TagPath - malformed string '%s'; no matching '}'", tagstr);
+          node.creator.assign(creator, closing - creator);
+
+          // Get element number in the block
+          _tagstr = closing + 1;
+          eeee = tag_t(strtoul(_tagstr, &nextptr, 16)) & 0xff;
+        } else {
+          // Get element number in eeee form
+          _tagstr = nextptr + 1;
+          eeee = tag_t(strtoul(_tagstr, &nextptr, 16));
+        }
+
+        if (_tagstr == nextptr)
+          LOGERROR_AND_THROW(
+              "TagPath - malformed string '%s'; no number after ',' or '}'",
+              tagstr);
+
+        tag = TAG::build(gggg, eeee);
+      }
+      if (*nextptr == ')') nextptr++;
+    } else {
+      // tagstr is keyword string
+      int n = 0;
+
+      while (_tagstr[n] && _tagstr[n] != '.')  // take until next '.'
+        n++;
+      tag = TAG::from_keyword(_tagstr, n);
+      if (tag == 0xffffffff)
+        LOGERROR_AND_THROW(
+            "TagPath - error in string '%s'; no such keyword '%s'", tagstr,
+            std::string(_tagstr, n).c_str());
+
+      nextptr = (char*)_tagstr + n;
+    }
+    node.tag = tag;
+
+    _tagstr = nextptr + 1;
+    if (_tagstr >= endptr) {
+      nodes_.push_back(node);
+      break;
+    }
+
+    // number after '.' is DataSet sequence number, starting from 0.
+    node.seqidx = int(strtol(_tagstr, &nextptr, 10));
+    nodes_.push_back(node);
+
+    _tagstr = nextptr + 1;
+    if (_tagstr >= endptr)
+      break;  // no tag after sequence number
+  }
+}
+
+// number of slots in the direct-mapped cache of TagPath::from_string().
+static const size_t TAGPATH_CACHE_SIZE = 256;
+
+const TagPath& TagPath::from_string(const char* tagstr) {
+  static thread_local std::unique_ptr<TagPath> cache[TAGPATH_CACHE_SIZE];
+
+  // FNV-1a
+  uint32_t h = 2166136261u;
+  for (const char* p = tagstr; *p; p++)
+    h = (h ^ uint8_t(*p)) * 16777619u;
+
+  std::unique_ptr<TagPath>& entry = cache[h % TAGPATH_CACHE_SIZE];
+  if (!entry || strcmp(entry->str().c_str(), tagstr) != 0)
+    entry = std::unique_ptr<TagPath>(new TagPath(tagstr));
+  return *entry;
+}
+
+}  // namespace dicom
@@ -26,6 +26,17 @@ struct Iterator {
   bool first_or_done;
 };
 
+// releases the GIL only while codecs run; the DataSet is read and changed
+// with the GIL held.
+class GILCodecLock : public CodecLock {
+  PyThreadState *state_;
+
+ public:
+  GILCodecLock() : state_(nullptr) {}
+  void unlock() { state_ = PyEval_SaveThread(); }
+  void lock() { PyEval_RestoreThread(state_); }
+};
+
 PYBIND11_MODULE(_dicomsdl, m) {
   m.attr("DICOMSDL_VERSION") = py::cast(DICOMSDL_VERSION);
   m.attr("DICOMSDL_UIDPREFIX") = py::cast(DICOMSDL_UIDPREFIX);
@@ -47,23 +58,76 @@ PYBIND11_MODULE(_dicomsdl, m) {
 #endif // __SSE2__
 
   m.def("open_file", &open_file, "Open a DICOM file from a file.", "filename"_a,
-        "load_until"_a = 0xffffffff, "keep_on_error"_a = false);
+        "load_until"_a = 0xffffffff, "keep_on_error"_a = false,
+        "load_option"_a = (int)LoadOption::DEFAULT,
+        "load_tags"_a = std::vector<std::string>());
   m.def("open", &open_file, "Open a DICOM file from a file.", "filename"_a,
-        "load_until"_a = 0xffffffff, "keep_on_error"_a = false);
+        "load_until"_a = 0xffffffff, "keep_on_error"_a = false,
+        "load_option"_a = (int)LoadOption::DEFAULT,
+        "load_tags"_a = std::vector<std::string>());
   m.def(
       "open_memory",
-      [](py::bytes data, bool copy_data = true, tag_t load_until = 0xffffffff,
-         bool keep_on_error = false) {
-        char *buffer;
-        py::ssize_t length;
-        if (PYBIND11_BYTES_AS_STRING_AND_SIZE(data.ptr(), &buffer, &length))
-          py::pybind11_fail("Unable to extract bytes contents!");
+      [](py::buffer data, bool copy_data = true,
+         tag_t load_until = 0xffffffff, bool keep_on_error = false,
+         const std::vector<std::string> &load_tags =
+             std::vector<std::string>()) {
+        // a memoryview holds the buffer export (e.g. bytearray cannot be
+        // resized, mmap cannot be closed) as long as it is alive.
+        py::object mv = py::reinterpret_steal<py::object>(
+            PyMemoryView_FromObject(data.ptr()));
+        if (!mv) throw py::error_already_set();
+
+        Py_buffer *view = PyMemoryView_GET_BUFFER(mv.ptr());
+        if (!PyBuffer_IsContiguous(view, 'C'))
+          throw py::value_error("open_memory - data should be C-contiguous.");
+
+        py::object dset = py::cast(
+            open_memory((uint8_t *)view->buf, (size_t)view->len, copy_data,
+                        load_until, keep_on_error, load_tags));
 
-        return open_memory((uint8_t *)buffer, (size_t)length, copy_data,
-                           load_until, keep_on_error);
+        // DataSet parses `data` in place; keep it alive with the DataSet.
+        if (!copy_data) py::detail::keep_alive_impl(dset, mv);
+        return dset;
       },
-      "Open a DICOM file from a string.", "data"_a, "copy_data"_a = true,
-      "load_until"_a = 0xffffffff, "keep_on_error"_a = false);
+      "Open a DICOM file from a bytes-like object.\n\n"
+      "Any C-contiguous buffer (bytes, bytearray, memoryview, numpy array, "
+      "mmap) is accepted. If copy_data is False, the DataSet refers to "
+      "`data` without copying; `data` is kept alive with the DataSet and "
+      "cannot be resized or closed meanwhile.",
+      "data"_a, "copy_data"_a = true, "load_until"_a = 0xffffffff,
+      "keep_on_error"_a = false, "load_tags"_a = std::vector<std::string>());
+
+  m.def(
+      "open_stream",
+      [](py::object fileobj, tag_t load_until = 0xffffffff,
+         bool keep_on_error = false,
+         const std::vector<std::string> &load_tags =
+             std::vector<std::string>()) {
+        ReaderFunctionType reader = [fileobj](uint8_t *buf,
+                                              size_t size) -> size_t {
+          py::bytes data = fileobj.attr("read")(size);
+          char *buffer;
+          py::ssize_t length;
+          if (PYBIND11_BYTES_AS_STRING_AND_SIZE(data.ptr(), &buffer, &length))
+            py::pybind11_fail("Unable to extract bytes contents!");
+          if ((size_t)length > size)
+            throw py::value_error(
+                "open_stream - read(size) returned more than size bytes.");
+          memcpy(buf, buffer, (size_t)length);
+          return (size_t)length;
+        };
+        return open_stream(reader, load_until, keep_on_error, load_tags);
+      },
+      "Parse a DICOM file in a single pass from a file-like object with "
+      "read() (e.g. a pipe, socket file or tar member).\n\n"
+      "Values longer than Config.getInteger('STREAM_RETAIN_LENGTH', 65536) "
+      "bytes are dropped.",
+      "fileobj"_a, "load_until"_a = 0xffffffff, "keep_on_error"_a = false,
+      "load_tags"_a = std::vector<std::string>());
+  m.def("open_fd", &open_fd,
+        "Parse a DICOM file in a single pass from a file descriptor.", "fd"_a,
+        "load_until"_a = 0xffffffff, "keep_on_error"_a = false,
+        "load_tags"_a = std::vector<std::string>());
 
   // Types --------------------------------------------------------------------
 
@@ -201,9 +265,19 @@ PYBIND11_MODULE(_dicomsdl, m) {
                   "Get Tag's Keyword. e.g. 0x00080008 -> 'ImageType'")
       .def_static("name", &TAG::name,
                   "Get Tag's Name. e.g. 0x00080008 -> 'Image Type'")
-      .def_static("from_keyword", &TAG::from_keyword,
+      .def_static("from_keyword",
+                  static_cast<tag_t (*)(const char*)>(&TAG::from_keyword),
                   "Get a Tag from Keyword. e.g. 'ImageType' -> 0x00080008");
 
+  py::class_<LoadOption> loadoption(m, "LoadOption");
+  py::enum_<LoadOption::type>(loadoption, "type", py::arithmetic())
+      .value("DEFAULT", LoadOption::DEFAULT)
+      .value("MMAP", LoadOption::MMAP)
+      .value("WINDOWED", LoadOption::WINDOWED)
+      .value("HEADER_ONLY", LoadOption::HEADER_ONLY)
+      .value("CONCURRENT", LoadOption::CONCURRENT)
+      .export_values();
+
   py::class_<CHARSET> charset(m, "CHARSET");
   py::enum_<CHARSET::type>(charset, "type")
       .value("DEFAULT", CHARSET::DEFAULT)
@@ -318,7 +392,7 @@ PYBIND11_MODULE(_dicomsdl, m) {
              return py::bytes((const char *)data.data, data.size);
            })
       .def("copyDecodedFrameData", [](PixelSequence &pixseq, size_t index,
-                                      py::array outarr) {
+                                      py::array outarr, int max_layers) {
         auto buf = outarr.request();
         if (buf.ndim != 2) {
           throw std::runtime_error("output array's dimension should be 2");
@@ -330,6 +404,9 @@ PYBIND11_MODULE(_dicomsdl, m) {
         else if (fmt == py::format_descriptor<int16_t>::format() ||
                  fmt == py::format_descriptor<uint16_t>::format())
           bytesalloc = 2;
+        else if (fmt == py::format_descriptor<int32_t>::format() ||
+                 fmt == py::format_descriptor<uint32_t>::format())
+          bytesalloc = 4;
         else {
           char errmsg[128];
           snprintf(errmsg, 128, "cannot copy to array with format '%s'",
@@ -347,11 +424,142 @@ PYBIND11_MODULE(_dicomsdl, m) {
         }
 
         uint8_t *data = (uint8_t *)buf.ptr;
-        int rows, cols, rowstrides;
+        int rows, rowstrides;
         rows = buf.shape[0];
-        cols = buf.shape[1];
         rowstrides = buf.strides[0];
-        pixseq.copyDecodedFrameData(index, data, rowstrides * cols, rowstrides);
+        // rows of a flipped array, e.g. outarr[::-1], are stored bottom-up.
+        int datasize = (rowstrides < 0 ? -rowstrides : rowstrides) * rows;
+        if (rowstrides < 0) data += rowstrides * (rows - 1);
+        pixseq.copyDecodedFrameData(index, data, datasize, rowstrides,
+                                    max_layers);
+      }, "index"_a, "outarr"_a, "max_layers"_a = 0)
+      .def("copyDecodedFrameRegion",
+           [](PixelSequence &pixseq, size_t index, py::array outarr,
+              int reduce, int x0, int y0, int x1, int y1, int max_layers) {
+        auto buf = outarr.request(true);
+        if (buf.ndim != 2 && buf.ndim != 3) {
+          throw std::runtime_error("output array's dimension should be 2 or 3");
+        }
+        std::string fmt = buf.format;
+        int bytesalloc;
+        if (fmt == py::format_descriptor<uint8_t>::format())
+          bytesalloc = 1;
+        else if (fmt == py::format_descriptor<int16_t>::format() ||
+                 fmt == py::format_descriptor<uint16_t>::format())
+          bytesalloc = 2;
+        else {
+          // JPEG 2000 regions are decoded to 8 or 16 bit samples only.
+          char errmsg[128];
+          snprintf(errmsg, 128,
+                   "cannot copy a region to array with format '%s'; "
+                   "use an 8 or 16 bit array",
+                   fmt.c_str());
+          throw std::runtime_error(errmsg);
+        }
+
+        if (bytesalloc * (buf.ndim == 3 ? buf.shape[2] : 1) != buf.strides[1] ||
+            (buf.ndim == 3 && bytesalloc != buf.strides[2])) {
+          char errmsg[128];
+          snprintf(errmsg, 128,
+                   "output array's pixels should be contiguous in a row for "
+                   "format '%s'",
+                   fmt.c_str());
+          throw std::runtime_error(errmsg);
+        }
+
+        int rowstrides = int(buf.strides[0]);
+        GILCodecLock codec_lock;
+        pixseq.copyDecodedFrameRegion(index, (uint8_t *)buf.ptr,
+                                      rowstrides * int(buf.shape[0]),
+                                      rowstrides, reduce, x0, y0, x1, y1,
+                                      max_layers, &codec_lock);
+      }, "index"_a, "outarr"_a, "reduce"_a = 0, "x0"_a = 0, "y0"_a = 0,
+         "x1"_a = 0, "y1"_a = 0, "max_layers"_a = 0)
+      .def("decodedRegionSize",
+           [](PixelSequence &pixseq, int reduce, int x0, int y0, int x1,
+              int y1) {
+             int rows, cols;
+             pixseq.decodedRegionSize(reduce, x0, y0, x1, y1, rows, cols);
+             return py::make_tuple(rows, cols);
+           },
+           "reduce"_a = 0, "x0"_a = 0, "y0"_a = 0, "x1"_a = 0, "y1"_a = 0)
+      .def("encodeFrames", [](PixelSequence &pixseq, py::array inarr,
+                              const char *codec_args) {
+        auto buf = inarr.request();
+        if (buf.ndim != 3 && buf.ndim != 4) {
+          throw std::runtime_error("input array's dimension should be 3 or 4");
+        }
+        std::string fmt = buf.format;
+        int bytesalloc;
+        if (fmt == py::format_descriptor<uint8_t>::format())
+          bytesalloc = 1;
+        else if (fmt == py::format_descriptor<int16_t>::format() ||
+                 fmt == py::format_descriptor<uint16_t>::format())
+          bytesalloc = 2;
+        else if (fmt == py::format_descriptor<int32_t>::format() ||
+                 fmt == py::format_descriptor<uint32_t>::format())
+          bytesalloc = 4;
+        else {
+          char errmsg[128];
+          snprintf(errmsg, 128, "cannot encode array with format '%s'",
+                   fmt.c_str());
+          throw std::runtime_error(errmsg);
+        }
+
+        if (bytesalloc * (buf.ndim == 4 ? buf.shape[3] : 1) != buf.strides[2] ||
+            (buf.ndim == 4 && bytesalloc != buf.strides[3])) {
+          char errmsg[128];
+          snprintf(errmsg, 128,
+                   "input array's pixels should be contiguous in a row for "
+                   "format '%s'",
+                   fmt.c_str());
+          throw std::runtime_error(errmsg);
+        }
+
+        // frames are encoded by worker threads without the GIL.
+        GILCodecLock codec_lock;
+        pixseq.encodeFrames((const uint8_t *)buf.ptr, buf.shape[0],
+                            int(buf.strides[1]), size_t(buf.strides[0]),
+                            codec_args, &codec_lock);
+      }, "inarr"_a, "codec_args"_a = "")
+      .def("decodeFrames", [](PixelSequence &pixseq, size_t first,
+                              py::array outarr) {
+        auto buf = outarr.request(true);
+        if (buf.ndim != 3 && buf.ndim != 4) {
+          throw std::runtime_error("output array's dimension should be 3 or 4");
+        }
+        std::string fmt = buf.format;
+        int bytesalloc;
+        if (fmt == py::format_descriptor<uint8_t>::format())
+          bytesalloc = 1;
+        else if (fmt == py::format_descriptor<int16_t>::format() ||
+                 fmt == py::format_descriptor<uint16_t>::format())
+          bytesalloc = 2;
+        else if (fmt == py::format_descriptor<int32_t>::format() ||
+                 fmt == py::format_descriptor<uint32_t>::format())
+          bytesalloc = 4;
+        else {
+          char errmsg[128];
+          snprintf(errmsg, 128, "cannot copy to array with format '%s'",
+                   fmt.c_str());
+          throw std::runtime_error(errmsg);
+        }
+
+        if (bytesalloc * (buf.ndim == 4 ? buf.shape[3] : 1) != buf.strides[2] ||
+            (buf.ndim == 4 && bytesalloc != buf.strides[3])) {
+          char errmsg[128];
+          snprintf(errmsg, 128,
+                   "output array's pixels should be contiguous in a row for "
+                   "format '%s'",
+                   fmt.c_str());
+          throw std::runtime_error(errmsg);
+        }
+
+        // frames are decoded by worker threads without the GIL.
+        GILCodecLock codec_lock;
+        pixseq.decodeFrames(first, buf.shape[0], (uint8_t *)buf.ptr,
+                            int(buf.strides[1]), size_t(buf.strides[0]),
+                            &codec_lock);
       });
 
   // class DataElement ---------------------------------------------------------
@@ -398,10 +606,20 @@ PYBIND11_MODULE(_dicomsdl, m) {
       .def("setValue", &_DataElement_setValue);
 
 
+  // class TagPath -------------------------------------------------------------
+
+  py::class_<TagPath>(m, "TagPath")
+      .def(py::init<const std::string &>(), "tagstr"_a,
+           "Parse a tag string once for repeated lookups, e.g. "
+           "'52009229.0.00289145.0.RescaleSlope'.")
+      .def("__str__", &TagPath::str)
+      .def("__repr__", [](const TagPath &tagpath) {
+        return "TagPath('" + tagpath.str() + "')";
+      });
+
   // class DataSet -------------------------------------------------------------
 
-  typedef Iterator<std::map<tag_t, std::unique_ptr<DataElement>>>
-      DataElementIterator;
+  typedef Iterator<DataSet> DataElementIterator;
   py::class_<DataElementIterator>(m, "DataElementIterator")
       .def("__iter__",
            [](DataElementIterator &s) -> DataElementIterator & { return s; })
@@ -416,7 +634,7 @@ PYBIND11_MODULE(_dicomsdl, m) {
               s.first_or_done = true;
               throw py::stop_iteration();
             }
-            return s.it->second.get();
+            return s.it->second;
           },
           py::return_value_policy::reference_internal);
 
@@ -432,16 +650,27 @@ PYBIND11_MODULE(_dicomsdl, m) {
                DataSet::addDataElement,
            py::return_value_policy::reference_internal, "tag"_a,
            "vr"_a = VR::NONE)
+      .def("addDataElement",
+           (DataElement * (DataSet::*)(const TagPath &, vr_t)) &
+               DataSet::addDataElement,
+           py::return_value_policy::reference_internal, "tag"_a,
+           "vr"_a = VR::NONE)
       .def("getDataElement",
            (DataElement * (DataSet::*)(tag_t)) & DataSet::getDataElement,
            py::return_value_policy::reference_internal)
       .def("getDataElement",
            (DataElement * (DataSet::*)(const char *)) & DataSet::getDataElement,
            py::return_value_policy::reference_internal)
+      .def("getDataElement",
+           (DataElement * (DataSet::*)(const TagPath &)) &
+               DataSet::getDataElement,
+           py::return_value_policy::reference_internal)
       .def("removeDataElement",
            (void (DataSet::*)(tag_t)) & DataSet::removeDataElement)
       .def("removeDataElement",
            (void (DataSet::*)(const char *)) & DataSet::removeDataElement)
+      .def("removeDataElement",
+           (void (DataSet::*)(const TagPath &)) & DataSet::removeDataElement)
       .def("attachToFile", &DataSet::attachToFile)
       .def("attachToMemory", &DataSet::attachToMemory)
       .def("getSpecificCharset", &DataSet::getSpecificCharset, "index"_a = 0)
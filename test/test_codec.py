@@ -0,0 +1,250 @@
+# -*- coding: utf-8 -*-
+from __future__ import print_function
+import struct
+import numpy as np
+import dicomsdl as dicom
+
+RLE_LOSSLESS = '1.2.840.10008.1.2.5'
+JPEGLS_LOSSLESS = '1.2.840.10008.1.2.4.80'
+JPEGLS_NEARLOSSLESS = '1.2.840.10008.1.2.4.81'
+JPEG2000_LOSSLESS = '1.2.840.10008.1.2.4.90'
+
+ROWS, COLS, NFRAMES = 13, 17, 3
+
+def element(tag, vr, value):
+  if len(value) & 1:
+    value += b'\0' if vr in ('UI', 'OB') else b' '
+  if vr in ('OB', 'OW', 'SQ', 'UN', 'UT'):
+    return struct.pack('<HH2sHI', tag >> 16, tag & 0xffff, vr.encode(), 0,
+                       len(value)) + value
+  return struct.pack('<HH2sH', tag >> 16, tag & 0xffff, vr.encode(),
+                     len(value)) + value
+
+def us(tag, value):
+  return element(tag, 'US', struct.pack('<H', value))
+
+def item(value):
+  return struct.pack('<HHI', 0xfffe, 0xe000, len(value)) + value
+
+def encapsulated_file(tsuid, bits, samples, fragments=(), stored=None,
+                      nframes=None):
+  """DICOM file with an encapsulated pixel data of a frame per fragment.
+
+  If nframes is given, the fragments make nframes frames and the basic offset
+  table is left empty.
+  """
+  stored = stored or bits
+  meta = element(0x00020001, 'OB', b'\0\1') + \
+         element(0x00020010, 'UI', tsuid.encode())
+  offsets, offset = [], 0
+  for fragment in fragments:
+    offsets.append(offset)
+    offset += 8 + len(fragment)
+  if nframes:
+    offsets = []
+  else:
+    nframes = len(fragments)
+  return b'\0' * 128 + b'DICM' + \
+         element(0x00020000, 'UL', struct.pack('<I', len(meta))) + meta + \
+         us(0x00280002, samples) + \
+         element(0x00280004, 'CS', b'RGB' if samples == 3 else b'MONOCHROME2') + \
+         (us(0x00280006, 0) if samples == 3 else b'') + \
+         (element(0x00280008, 'IS', str(nframes).encode())
+          if fragments else b'') + \
+         us(0x00280010, ROWS) + us(0x00280011, COLS) + \
+         us(0x00280100, bits) + us(0x00280101, stored) + \
+         us(0x00280102, stored - 1) + us(0x00280103, 0) + \
+         struct.pack('<HH2sHI', 0x7fe0, 0x0010, b'OB', 0, 0xffffffff) + \
+         item(struct.pack('<%dI' % len(offsets), *offsets)) + \
+         b''.join(item(fragment) for fragment in fragments) + \
+         struct.pack('<HHI', 0xfffe, 0xe0dd, 0)
+
+def frames(dtype, samples, seed=0):
+  """Random frames with runs of equal values, from 0 up to the max value."""
+  shape = (NFRAMES, ROWS, COLS) + ((samples,) if samples > 1 else ())
+  rng = np.random.RandomState(seed)
+  a = rng.randint(0, np.iinfo(dtype).max, size=shape,
+                  dtype=np.int64).astype(dtype)
+  a[:, 2:6, 3:12] = 7
+  a[:, -1] = np.iinfo(dtype).max
+  return a
+
+def rle_frame(a):
+  """RLE Lossless frame of grey pixels `a` in literal runs of a row each."""
+  planes = a.astype(a.dtype.newbyteorder('>')).view(np.uint8).reshape(
+      a.shape + (a.itemsize,))
+  segments = []
+  for k in range(a.itemsize):  # most significant byte first
+    segments.append(b''.join(struct.pack('B', len(row) - 1) + row.tobytes()
+                             for row in planes[:, :, k]))
+  header = [len(segments)] + [0] * 15
+  offset = 64
+  for k, segment in enumerate(segments):
+    header[k + 1] = offset
+    offset += len(segment)
+  data = struct.pack('<16I', *header) + b''.join(segments)
+  return data + b'\0' * (len(data) & 1)
+
+def pixel_sequence(tsuid, dtype, samples, fragments=(), stored=None,
+                   nframes=None):
+  data = encapsulated_file(tsuid, np.dtype(dtype).itemsize * 8, samples,
+                           fragments, stored, nframes)
+  ds = dicom.open_memory(data)
+  return ds, ds.getDataElement(0x7fe00010).toPixelSequence()
+
+def decode_frames(ps, first, like):
+  out = np.zeros_like(like)
+  ps.decodeFrames(first, out)
+  return out
+
+def roundtrip(tsuid, dtype, samples):
+  ds, ps = pixel_sequence(tsuid, dtype, samples)
+  a = frames(dtype, samples)
+  ps.encodeFrames(a)
+  assert len(ps) == NFRAMES
+  assert (decode_frames(ps, 0, a) == a).all()
+
+  # encoded frames are saved and read back.
+  ds2 = dicom.open_memory(ds.saveToMemory())
+  ps2 = ds2.getDataElement(0x7fe00010).toPixelSequence()
+  assert len(ps2) == NFRAMES
+  assert (decode_frames(ps2, 0, a) == a).all()
+
+def test_decode_frames():
+  for dtype in (np.uint8, np.uint16):
+    a = frames(dtype, 1)
+    ds, ps = pixel_sequence(RLE_LOSSLESS, dtype, 1,
+                            [rle_frame(frame) for frame in a])
+    assert len(ps) == NFRAMES
+
+    # a range of frames, on one or more threads.
+    for threads in (1, 2, 0):
+      dicom.Config.setInteger('DECODE_THREADS', threads)
+      try:
+        assert (decode_frames(ps, 0, a) == a).all()
+        assert (decode_frames(ps, 1, a[1:]) == a[1:]).all()
+      finally:
+        dicom.Config.setInteger('DECODE_THREADS', 0)
+
+    try:
+      decode_frames(ps, NFRAMES - 1, a)
+    except RuntimeError:
+      pass
+    else:
+      assert False, 'decodeFrames beyond the last frame should fail'
+
+def test_rle_roundtrip():
+  for dtype in (np.uint8, np.uint16, np.uint32):
+    for samples in (1, 3):
+      roundtrip(RLE_LOSSLESS, dtype, samples)
+
+def test_jpegls_roundtrip():
+  for dtype in (np.uint8, np.uint16):
+    for samples in (1, 3):
+      roundtrip(JPEGLS_LOSSLESS, dtype, samples)
+
+def test_decode_frames_layout():
+  # samples of a pixel in the last dimension, or interleaved in a row.
+  for tsuid, dtype in ((RLE_LOSSLESS, np.uint32), (JPEGLS_LOSSLESS, np.uint8)):
+    ds, ps = pixel_sequence(tsuid, dtype, 3)
+    a = frames(dtype, 3)
+    ps.encodeFrames(a)
+    out = np.zeros((NFRAMES, ROWS, COLS * 3), dtype)
+    ps.decodeFrames(0, out)
+    assert (out.reshape(a.shape) == a).all()
+    out = np.zeros(a.shape, dtype)
+    ps.decodeFrames(0, out)
+    assert (out == a).all()
+    for i in range(NFRAMES):
+      out = np.zeros((ROWS, COLS * 3), dtype)
+      ps.copyDecodedFrameData(i, out)
+      assert (out.reshape(a[i].shape) == a[i]).all()
+
+def test_region_format():
+  # JPEG 2000 regions are decoded to 8 or 16 bit samples.
+  ds, ps = pixel_sequence(JPEG2000_LOSSLESS, np.uint32, 1,
+                          [b'\xff\x4f\xff\x51'])
+  for dtype in (np.int32, np.uint32, np.float32):
+    try:
+      ps.copyDecodedFrameRegion(0, np.zeros((ROWS, COLS), dtype))
+    except RuntimeError as e:
+      assert '8 or 16 bit' in str(e)
+    else:
+      assert False, 'copyDecodedFrameRegion to %s should fail' % dtype
+
+def test_bits_stored():
+  # BitsStored bits in samples of BitsAllocated bits, from 0 up to the
+  # max value of BitsStored bits.
+  for tsuid, dtype, stored in ((RLE_LOSSLESS, np.uint16, 12),
+                               (RLE_LOSSLESS, np.uint32, 16),
+                               (JPEGLS_LOSSLESS, np.uint16, 12),
+                               (JPEGLS_LOSSLESS, np.uint16, 8)):
+    ds, ps = pixel_sequence(tsuid, dtype, 1, stored=stored)
+    a = frames(dtype, 1) >> (np.dtype(dtype).itemsize * 8 - stored)
+    ps.encodeFrames(a)
+    assert (decode_frames(ps, 0, a) == a).all()
+
+def test_jpegls_nearlossless():
+  ds, ps = pixel_sequence(JPEGLS_NEARLOSSLESS, np.uint8, 1)
+  a = frames(np.uint8, 1)
+  ps.encodeFrames(a, 'near=2')
+  diff = decode_frames(ps, 0, a).astype(int) - a
+  assert abs(diff).max() <= 2
+  assert ds.getDataElement('LossyImageCompression').toString() == '01'
+  assert ds.getDataElement('LossyImageCompressionMethod').toString() == \
+      'ISO_14495_1'
+  assert ds.getDataElement('LossyImageCompressionRatio').toDouble() > 0
+
+def test_encode_appends():
+  ds, ps = pixel_sequence(JPEGLS_LOSSLESS, np.uint16, 1)
+  a = frames(np.uint16, 1)
+  ps.encodeFrames(a)
+  # frames are appended after the existing ones.
+  ps.encodeFrames(a[::-1].copy())
+  assert len(ps) == NFRAMES * 2
+  assert (decode_frames(ps, 0, a) == a).all()
+  assert (decode_frames(ps, NFRAMES, a) == a[::-1]).all()
+
+def test_padded_rows():
+  for tsuid in (RLE_LOSSLESS, JPEGLS_LOSSLESS):
+    for dtype in (np.uint8, np.uint16):
+      ds, ps = pixel_sequence(tsuid, dtype, 1)
+      a = frames(dtype, 1)
+      # rows of the input and the output are 5 pixels apart.
+      src = np.zeros((NFRAMES, ROWS, COLS + 5), dtype)
+      src[:, :, :COLS] = a
+      ps.encodeFrames(src[:, :, :COLS])
+      out = np.full((NFRAMES, ROWS, COLS + 5), 0xab, dtype)
+      ps.decodeFrames(0, out[:, :, :COLS])
+      assert (out[:, :, :COLS] == a).all()
+      assert (out[:, :, COLS:] == 0xab).all()
+
+def test_bottom_up_rows():
+  for tsuid in (RLE_LOSSLESS, JPEGLS_LOSSLESS):
+    for dtype in (np.uint8, np.uint16):
+      ds, ps = pixel_sequence(tsuid, dtype, 1)
+      a = frames(dtype, 1)
+      ps.encodeFrames(a)
+      for i in range(NFRAMES):
+        out = np.zeros((ROWS, COLS), dtype)
+        ps.copyDecodedFrameData(i, out[::-1])
+        assert (out[::-1] == a[i]).all()
+
+def test_no_offset_table():
+  ds, ps = pixel_sequence(JPEGLS_LOSSLESS, np.uint8, 1)
+  a = frames(np.uint8, 1)
+  ps.encodeFrames(a)
+  encoded = [ps.encodedFrameData(i) for i in range(NFRAMES)]
+
+  # JPEG-LS frames start with SOI, in one fragment or in two.
+  split = [part for frame in encoded for part in (frame[:10], frame[10:])]
+  for fragments in (encoded, split):
+    ds, ps = pixel_sequence(JPEGLS_LOSSLESS, np.uint8, 1, fragments,
+                            nframes=NFRAMES)
+    assert len(ps) == NFRAMES
+    assert (decode_frames(ps, 0, a) == a).all()
+
+  # RLE frames have no start marker; all fragments make one frame.
+  ds, ps = pixel_sequence(RLE_LOSSLESS, np.uint8, 1,
+                          [rle_frame(frame) for frame in a], nframes=NFRAMES)
+  assert len(ps) == 1
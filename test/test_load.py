@@ -0,0 +1,199 @@
+# -*- coding: utf-8 -*-
+from __future__ import print_function
+import io
+import os
+import struct
+import threading
+import zlib
+import dicomsdl as dicom
+
+os.chdir(os.path.dirname(os.path.abspath(__file__)))
+
+DEFLATED_EXPLICIT_VR_LITTLE_ENDIAN = b'1.2.840.10008.1.2.1.99'
+
+def dump_lines(ds):
+  return [l.strip() for l in ds.dump().splitlines()]
+
+def check_load_option(load_option):
+  """test_le.dcm opened with load_option, alone and with MMAP, dumps the
+  same as the reference."""
+  dump_ref = [l.strip() for l in open('test_le.dcm.dump.txt', 'r').read()
+              .splitlines()]
+  for more in (0, int(dicom.LoadOption.MMAP)):
+    ds = dicom.open_file('test_le.dcm', load_option=int(load_option) | more)
+    assert dump_lines(ds) == dump_ref
+
+def elements(ds):
+  """(tag, vr, value) of data elements after the file meta information."""
+  return [(de.tag(), de.vr(), de.repr()) for de in ds if de.tag() > 0x0002ffff]
+
+def deflated(filename):
+  """Copy of an explicit VR little endian file in deflated transfer syntax."""
+  data = open(filename, 'rb').read()
+  # file meta information starts with its group length after 'DICM'.
+  metaend = 144 + struct.unpack('<I', data[140:144])[0]
+  meta, pos = b'', 144
+  while pos < metaend:
+    tag, vr = struct.unpack('<I2s', data[pos:pos + 6])
+    if vr in (b'OB', b'OW', b'SQ', b'UN', b'UT'):
+      length = struct.unpack('<I', data[pos + 8:pos + 12])[0]
+      end = pos + 12 + length
+    else:
+      length = struct.unpack('<H', data[pos + 6:pos + 8])[0]
+      end = pos + 8 + length
+    if tag == 0x00100002:  # (0002,0010) TransferSyntaxUID
+      value = DEFLATED_EXPLICIT_VR_LITTLE_ENDIAN
+      meta += struct.pack('<I2sH', tag, vr, len(value)) + value
+    else:
+      meta += data[pos:end]
+    pos = end
+  compressor = zlib.compressobj(9, zlib.DEFLATED, -15)  # raw deflate
+  body = compressor.compress(data[metaend:]) + compressor.flush()
+  return data[:132] + struct.pack('<HH2sHI', 0x0002, 0x0000, b'UL', 4,
+                                  len(meta)) + meta + body
+
+def nested_dataset(add):
+  """DataSet with a StackID in two items of nested sequences; `add` adds
+  an element by a tag path string."""
+  ds = dicom.DataSet()
+  ds.addDataElement('TransferSyntaxUID', dicom.VR.UI).fromString(
+      '1.2.840.10008.1.2.1')
+  ds.addDataElement('Rows', dicom.VR.US).fromLong(512)
+  ds.addDataElement('Columns', dicom.VR.US).fromLong(256)
+  for i in range(2):
+    item = 'PerFrameFunctionalGroupsSequence.%d.FrameContentSequence.0.' % i
+    add(ds, item + 'StackID', dicom.VR.SH).fromString('STACK%d' % i)
+    add(ds, item + 'InStackPositionNumber', dicom.VR.UL).fromLong(i + 1)
+  return ds
+
+def test_mmap():
+  check_load_option(dicom.LoadOption.MMAP)
+
+def test_windowed():
+  check_load_option(dicom.LoadOption.WINDOWED)
+  # values are read while at most one small window is held.
+  ref = dicom.open_file('test_le.dcm')
+  dicom.Config.setInteger('INSTREAM_WINDOW_SIZE', 4096)
+  dicom.Config.setInteger('INSTREAM_WINDOW_COUNT', 1)
+  try:
+    ds = dicom.open_file('test_le.dcm',
+                         load_option=int(dicom.LoadOption.WINDOWED))
+    assert dump_lines(ds) == dump_lines(ref)
+    assert ds.saveToMemory() == ref.saveToMemory()
+  finally:
+    dicom.Config.setInteger('INSTREAM_WINDOW_SIZE', 0)
+    dicom.Config.setInteger('INSTREAM_WINDOW_COUNT', 0)
+
+def test_header_only():
+  check_load_option(dicom.LoadOption.HEADER_ONLY)
+  # position and length of pixel data are known without reading its value.
+  ds = dicom.open_file('test_le.dcm',
+                       load_option=int(dicom.LoadOption.HEADER_ONLY))
+  de = ds.getDataElement('PixelData')
+  assert (de.offset(), de.length()) == (0xa00, 32)
+
+def test_open_memory_buffer():
+  data = open('test_le.dcm', 'rb').read()
+  ref = dump_lines(dicom.open_file('test_le.dcm'))
+  for buf in (data, bytearray(data), memoryview(data)):
+    for copy_data in (False, True):
+      assert dump_lines(dicom.open_memory(buf, copy_data=copy_data)) == ref
+  try:
+    dicom.open_memory(memoryview(data)[::2])
+  except ValueError:
+    pass
+  else:
+    assert False, 'open_memory should reject a non-contiguous buffer'
+
+  # without a copy, the buffer can't be resized while the DataSet uses it.
+  buf = bytearray(data)
+  ds = dicom.open_memory(buf, copy_data=False)
+  try:
+    buf.extend(b'\0' * 4096)
+  except BufferError:
+    pass
+  else:
+    assert False, 'a buffer in use by a DataSet should not be resized'
+  assert dump_lines(ds) == ref
+  del ds
+  buf.extend(b'\0' * 4096)
+
+  buf = bytearray(data)
+  ds = dicom.open_memory(buf, copy_data=True)
+  buf.extend(b'\0' * 4096)
+  assert dump_lines(ds) == ref
+
+def test_deflated():
+  ref = elements(dicom.open_file('test_le.dcm'))
+  data = deflated('test_le.dcm')
+  ds = dicom.open_memory(data)
+  assert ds.getTransferSyntax() == \
+      dicom.UID.DEFLATED_EXPLICIT_VR_LITTLE_ENDIAN
+  assert elements(ds) == ref
+  # inflated while read from a forward-only stream.
+  assert elements(dicom.open_stream(io.BytesIO(data))) == ref
+
+def test_open_stream():
+  ref = elements(dicom.open_file('test_le.dcm'))
+  with open('test_le.dcm', 'rb') as f:
+    assert elements(dicom.open_stream(f)) == ref
+  fd = os.open('test_le.dcm', os.O_RDONLY)
+  try:
+    assert elements(dicom.open_fd(fd)) == ref
+  finally:
+    os.close(fd)
+
+  class Overread(object):
+    def read(self, size):
+      return b'\0' * (size + 1)
+  try:
+    dicom.open_stream(Overread())
+  except ValueError:
+    pass
+  else:
+    assert False, 'open_stream should reject more bytes than requested'
+
+def test_load_tags():
+  ds = nested_dataset(lambda ds, path, vr: ds.addDataElement(path, vr))
+  data = ds.saveToMemory()
+
+  # only the selected elements are loaded, in every item of the path.
+  ds2 = dicom.open_memory(data, load_tags=[
+      'Rows', 'PerFrameFunctionalGroupsSequence.FrameContentSequence.StackID'])
+  assert ds2.getDataElement('Rows').toLong() == 512
+  assert ds2.getDataElement('Columns').vr() == dicom.VR.NONE
+  for i in range(2):
+    item = 'PerFrameFunctionalGroupsSequence.%d.FrameContentSequence.0.' % i
+    assert ds2.getDataElement(item + 'StackID').toString() == 'STACK%d' % i
+    assert ds2.getDataElement(item + 'InStackPositionNumber').vr() == \
+        dicom.VR.NONE
+
+def test_tagpath():
+  ds = nested_dataset(
+      lambda ds, path, vr: ds.addDataElement(dicom.TagPath(path), vr))
+  path = dicom.TagPath('PerFrameFunctionalGroupsSequence.1.'
+                       'FrameContentSequence.0.StackID')
+  assert str(path) == 'PerFrameFunctionalGroupsSequence.1.' \
+                      'FrameContentSequence.0.StackID'
+  assert ds.getDataElement(path).toString() == 'STACK1'
+  assert ds.getDataElement(dicom.TagPath('52009230.1.00209111.0.00209056')) \
+           .toString() == 'STACK1'
+  assert ds.getDataElement(dicom.TagPath('Rows')).toLong() == 512
+  ds.removeDataElement(dicom.TagPath('Columns'))
+  assert ds.getDataElement('Columns').vr() == dicom.VR.NONE
+
+def test_concurrent():
+  check_load_option(dicom.LoadOption.CONCURRENT)
+
+  # elements are loaded once while threads read the DataSet together.
+  ds = dicom.open_file('test_le.dcm',
+                       load_option=int(dicom.LoadOption.CONCURRENT))
+  ref = dump_lines(dicom.open_file('test_le.dcm'))
+  dumps = []
+  threads = [threading.Thread(target=lambda: dumps.append(dump_lines(ds)))
+             for i in range(4)]
+  for t in threads:
+    t.start()
+  for t in threads:
+    t.join()
+  assert dumps == [ref] * 4